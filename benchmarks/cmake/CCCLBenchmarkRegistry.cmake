@@ -1,4 +1,5 @@
-find_package(CUDAToolkit REQUIRED)
+# The Thrust host benchmarks are also built without a CUDA toolkit.
+find_package(CUDAToolkit)
 
 set(cccl_revision "")
 find_package(Git)
@@ -32,10 +33,20 @@ function(get_meta_path meta_path)
   set(meta_path "${CMAKE_BINARY_DIR}/cccl_meta_bench.csv" PARENT_SCOPE)
 endfunction()
 
+# Called by every project with benchmarks; only the first call creates the registry.
 function(create_benchmark_registry)
+  get_property(registry_created GLOBAL PROPERTY _CCCL_BENCHMARK_REGISTRY_CREATED)
+  if (registry_created)
+    return()
+  endif()
+  set_property(GLOBAL PROPERTY _CCCL_BENCHMARK_REGISTRY_CREATED TRUE)
+
   get_meta_path(meta_path)
 
-  set(ctk_version "${CUDAToolkit_VERSION}")
+  set(ctk_version "0.0.0")
+  if (CUDAToolkit_FOUND)
+    set(ctk_version "${CUDAToolkit_VERSION}")
+  endif()
   message(STATUS "CTK version: ${ctk_version}")
 
   file(REMOVE "${meta_path}")
@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 
 import argparse
+import json
 import os
 
 import cccl
@@ -53,25 +54,62 @@ def filter_by_type(df):
     return df
 
 
-def alg_dfs(file):
-    result = {}
+def host_json_dfs(file):
+    """Yields (algorithm, subbench, dataframe) for results of the Thrust host benchmarks.
+
+    The file contains either the JSON object written by a single host benchmark (`--json`), or a list of such objects,
+    e.g. produced with `jq -s . *.json`. The resulting dataframes have the same layout as the tuning database tables.
+    """
+    with open(file, "r") as f:
+        root = json.load(f)
+    if isinstance(root, dict):
+        root = [root]
+
+    for result in root:
+        algname = result["algorithm"]
+        for bench in result["benchmarks"]:
+            rows = []
+            for state in bench["states"]:
+                samples = np.array(state["samples"])
+                row = {
+                    "ctk": result["system"],
+                    "cccl": result["cccl"],
+                    "gpu": "host",
+                    "variant": "base",
+                    "elapsed": samples.sum(),
+                    "center": np.median(samples),
+                    "bw": np.nan,
+                    "samples": samples,
+                }
+                row.update(state["axes"])
+                rows.append(row)
+            yield algname, bench["name"], pd.DataFrame(rows)
+
+
+def storage_dfs(file):
     storage = cccl.bench.StorageBase(file)
     for algname in storage.algnames():
         for subbench in storage.subbenches(algname):
-            df = storage.alg_to_df(algname, subbench)
-            df = df.map(lambda x: x if is_finite(x) else np.nan)
-            df = df.dropna(subset=["center"], how="all")
-            # TODO(bgruber): maybe expose the filters under a -p0, or --short flag
-            # df = filter_by_type(filter_by_offset_type(filter_by_problem_size(df)))
-            df["Noise"] = df["samples"].apply(lambda x: np.std(x) / np.mean(x)) * 100
-            df["Mean"] = df["samples"].apply(lambda x: np.mean(x))
-            df = df.drop(columns=["samples", "center", "bw", "elapsed", "variant"])
-            fused_algname = (
-                algname.removeprefix("cub.bench.").removeprefix("thrust.bench.")
-                + "."
-                + subbench
-            )
-            result[fused_algname] = df
+            yield algname, subbench, storage.alg_to_df(algname, subbench)
+
+
+def alg_dfs(file):
+    result = {}
+    dfs = host_json_dfs(file) if file.endswith(".json") else storage_dfs(file)
+    for algname, subbench, df in dfs:
+        df = df.map(lambda x: x if is_finite(x) else np.nan)
+        df = df.dropna(subset=["center"], how="all")
+        # TODO(bgruber): maybe expose the filters under a -p0, or --short flag
+        # df = filter_by_type(filter_by_offset_type(filter_by_problem_size(df)))
+        df["Noise"] = df["samples"].apply(lambda x: np.std(x) / np.mean(x)) * 100
+        df["Mean"] = df["samples"].apply(lambda x: np.mean(x))
+        df = df.drop(columns=["samples", "center", "bw", "elapsed", "variant"])
+        fused_algname = (
+            algname.removeprefix("cub.bench.").removeprefix("thrust.bench.")
+            + "."
+            + subbench
+        )
+        result[fused_algname] = df
 
     for algname in result:
         if result[algname]["cccl"].nunique() != 1:
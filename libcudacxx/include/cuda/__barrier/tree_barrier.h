@@ -0,0 +1,204 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/limits>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// A small index of the calling thread, assigned in the order threads first ask for one, which spreads the threads
+// taking part in a barrier over its leaves.
+_CCCL_HOST _CCCL_VISIBILITY_DEFAULT inline size_t __cccl_host_thread_index() noexcept
+{
+  static _CUDA_VSTD::atomic<size_t> __next(0);
+  static thread_local size_t const __index = __next.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+  return __index;
+}
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+//! A barrier for host threads, with the interface and the semantics of `cuda::std::barrier`, whose participants arrive
+//! at the leaves of a combining tree instead of at a single counter. Unlike `cuda::std::barrier`, it needs at least one
+//! expected participant.
+//!
+//! Each node of the tree takes the arrivals of two participants, or of two nodes of the round below, and the second of
+//! them moves on to the next round, so no cache line is written by more than two threads per phase. The thread which
+//! arrives at the root runs the completion function and starts the next phase. This keeps the latency of a phase
+//! logarithmic in the number of participants where `cuda::std::barrier` serializes all of them on one counter, at the
+//! cost of a heap-allocated tree of `(expected + 1) / 2` nodes. Prefer it for bulk-synchronous loops of dozens of host
+//! threads or more.
+template <class _CompletionF = _CUDA_VSTD::__empty_completion>
+class tree_barrier
+{
+  // phases advance by two, so that a ticket holds the current phase, a half step once one of its two arrivals took
+  // it, or the next phase once both did
+  using __phase_t = uint32_t;
+
+  // the tree halves its width every round, so this many rounds cover max() participants
+  static constexpr int __rounds = 32;
+
+  struct alignas(64) __node
+  {
+    _CUDA_VSTD::atomic<__phase_t> __tickets[__rounds];
+  };
+
+  // written by the arrival which completes a phase, concurrently with the arrivals of the next phase which read it
+  _CUDA_VSTD::atomic<ptrdiff_t> __expected;
+  _CUDA_VSTD::atomic<ptrdiff_t> __expected_adjustment;
+  _CompletionF __completion;
+  __node* __state;
+  _CUDA_VSTD::atomic<__phase_t> __phase;
+
+  // Returns true for the one arrival of the phase that reached the root of the tree.
+  _CCCL_HOST_API bool __arrive(__phase_t __old_phase) noexcept
+  {
+    __phase_t const __half_step = __old_phase + 1;
+    __phase_t const __full_step = __old_phase + 2;
+
+    size_t __current_expected = static_cast<size_t>(__expected.load(_CUDA_VSTD::memory_order_relaxed));
+    if (__current_expected <= 1)
+    {
+      return true;
+    }
+    size_t __current = __cccl_host_thread_index() % ((__current_expected + 1) >> 1);
+
+    for (int __round = 0;; ++__round)
+    {
+      if (__current_expected <= 1)
+      {
+        return true;
+      }
+      size_t const __end_node  = (__current_expected + 1) >> 1;
+      size_t const __last_node = __end_node - 1;
+      // another arrival may have taken both halves of this node, in which case the next one is tried
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        auto& __ticket     = __state[__current].__tickets[__round];
+        __phase_t __expect = __old_phase;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // the last node of an odd round has a single arrival, which moves on
+          if (__ticket.compare_exchange_strong(__expect, __full_step, _CUDA_VSTD::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__expect, __half_step, _CUDA_VSTD::memory_order_acq_rel))
+        {
+          // the first of two arrivals at this node leaves it to the second
+          return false;
+        }
+        else if (__expect == __half_step)
+        {
+          if (__ticket.compare_exchange_strong(__expect, __full_step, _CUDA_VSTD::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+      }
+      __current_expected = __last_node + 1;
+      __current >>= 1;
+    }
+  }
+
+public:
+  using arrival_token = __phase_t;
+
+  _CCCL_HOST_API explicit tree_barrier(ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __expected(__expected)
+      , __expected_adjustment(0)
+      , __completion(_CUDA_VSTD::move(__completion))
+      , __state(new __node[(static_cast<size_t>(__expected) + 1) >> 1]())
+      , __phase(0)
+  {
+    _CCCL_ASSERT(__expected > 0 && __expected <= max(), "tree_barrier: expected is out of range");
+  }
+
+  _CCCL_HOST_API ~tree_barrier()
+  {
+    delete[] __state;
+  }
+
+  tree_barrier(tree_barrier const&)            = delete;
+  tree_barrier& operator=(tree_barrier const&) = delete;
+
+  [[nodiscard]] _CCCL_HOST_API arrival_token arrive(ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "tree_barrier: update must be positive");
+    // synchronizes with the update of the expected count by the arrival which completed the previous phase
+    __phase_t const __old_phase = __phase.load(_CUDA_VSTD::memory_order_acquire);
+    for (; __update; --__update)
+    {
+      if (__arrive(__old_phase))
+      {
+        __completion();
+        __expected.fetch_add(__expected_adjustment.exchange(0, _CUDA_VSTD::memory_order_relaxed),
+                             _CUDA_VSTD::memory_order_relaxed);
+        __phase.store(__old_phase + 2, _CUDA_VSTD::memory_order_release);
+        __phase.notify_all();
+      }
+    }
+    return __old_phase;
+  }
+  _CCCL_HOST_API void wait(arrival_token&& __old_phase) const
+  {
+    __phase.wait(__old_phase, _CUDA_VSTD::memory_order_acquire);
+  }
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __expected_adjustment.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr ptrdiff_t max() noexcept
+  {
+    return _CUDA_VSTD::numeric_limits<int32_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
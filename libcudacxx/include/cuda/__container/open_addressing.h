@@ -0,0 +1,173 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___CONTAINER_OPEN_ADDRESSING_H
+#define _CUDA___CONTAINER_OPEN_ADDRESSING_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__functional/hash_combine.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__functional/hash.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+//! The hash function of the probing schemes by default. It hashes keys like `cuda::hash_combine`, so tuple-like keys
+//! and arrays work without a hash of their own.
+struct __default_hash
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Key>
+  [[nodiscard]] _CCCL_API size_t operator()(const _Key& __key) const
+  {
+    return ::cuda::__hash_value(__key);
+  }
+};
+
+// The windows a key visits, in order. The number of windows is a power of two, so the window index wraps around with a
+// mask, and an odd step visits every window once before it returns to the first.
+struct __probe_sequence
+{
+  size_t __window;
+  size_t __step;
+  size_t __mask;
+
+  _CCCL_API constexpr void __advance() noexcept
+  {
+    __window = (__window + __step) & __mask;
+  }
+};
+
+//! Linear probing: a key visits consecutive windows of `_WindowSize` slots, starting at the window picked by its hash.
+//! Neighboring windows share cache lines, so this is the fastest scheme for good hash functions and moderate load
+//! factors.
+template <size_t _WindowSize = 1, class _Hash = __default_hash>
+class linear_probing
+{
+  static_assert(_WindowSize > 0, "cuda::linear_probing: the window size must be positive");
+
+  _Hash __hash_;
+
+public:
+  using hasher = _Hash;
+
+  static constexpr size_t window_size = _WindowSize;
+
+  _CCCL_HIDE_FROM_ABI constexpr linear_probing() = default;
+
+  _CCCL_API constexpr explicit linear_probing(const _Hash& __hash)
+      : __hash_(__hash)
+  {}
+
+  [[nodiscard]] _CCCL_API constexpr hasher hash_function() const
+  {
+    return __hash_;
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Key>
+  [[nodiscard]] _CCCL_API __probe_sequence __sequence(const _Key& __key, size_t __num_windows) const
+  {
+    const size_t __mask = __num_windows - 1;
+    return {_CUDA_VSTD::__hash_mix(__hash_(__key)) & __mask, 1, __mask};
+  }
+};
+
+//! Double hashing: a key visits every window, starting at the window picked by its first hash and stepping by an odd
+//! number of windows picked by its second hash. Keys which collide in the first window usually part after it, which
+//! avoids the long runs of linear probing at high load factors or with weak hash functions.
+template <size_t _WindowSize = 1, class _Hash1 = __default_hash, class _Hash2 = _Hash1>
+class double_hashing
+{
+  static_assert(_WindowSize > 0, "cuda::double_hashing: the window size must be positive");
+
+  _Hash1 __hash1_;
+  _Hash2 __hash2_;
+
+public:
+  static constexpr size_t window_size = _WindowSize;
+
+  _CCCL_HIDE_FROM_ABI constexpr double_hashing() = default;
+
+  _CCCL_API constexpr explicit double_hashing(const _Hash1& __hash1, const _Hash2& __hash2 = _Hash2())
+      : __hash1_(__hash1)
+      , __hash2_(__hash2)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Key>
+  [[nodiscard]] _CCCL_API __probe_sequence __sequence(const _Key& __key, size_t __num_windows) const
+  {
+    const size_t __mask = __num_windows - 1;
+    // the second hash goes through a different mixer than the first, so that the two stay independent even when both
+    // hash functions are the same
+    const size_t __start = _CUDA_VSTD::__hash_mix(__hash1_(__key)) & __mask;
+    const size_t __step  = (_CUDA_VSTD::__hash_combine(__hash2_(__key), 0) & __mask) | 1;
+    return {__start, __step, __mask};
+  }
+};
+
+// Sentinels are compared by their object representation, which is what the compare-and-swap of a slot compares, and
+// not by the key equality of the container
+template <class _Tp>
+[[nodiscard]] _CCCL_API bool __bitwise_equal(const _Tp& __lhs, const _Tp& __rhs) noexcept
+{
+  unsigned char __lhs_bytes[sizeof(_Tp)];
+  unsigned char __rhs_bytes[sizeof(_Tp)];
+  _CUDA_VSTD::memcpy(__lhs_bytes, &__lhs, sizeof(_Tp));
+  _CUDA_VSTD::memcpy(__rhs_bytes, &__rhs, sizeof(_Tp));
+  for (size_t __i = 0; __i < sizeof(_Tp); ++__i)
+  {
+    if (__lhs_bytes[__i] != __rhs_bytes[__i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether a slot member can be accessed with a single atomic operation of up to eight bytes
+template <class _Tp>
+inline constexpr bool __is_atomic_slot_member_v =
+  _CCCL_TRAIT(_CUDA_VSTD::is_trivially_copyable, _Tp) && sizeof(_Tp) <= 8 && _CUDA_VSTD::has_single_bit(sizeof(_Tp));
+
+// Atomics need their operands aligned to their size, so slot members which are accessed atomically are over-aligned
+// when their natural alignment is smaller
+template <class _Tp>
+inline constexpr size_t __atomic_alignment_v = __is_atomic_slot_member_v<_Tp> ? sizeof(_Tp) : alignof(_Tp);
+
+// The smallest valid capacity of at least __capacity slots: a power of two of windows of _WindowSize slots
+template <size_t _WindowSize>
+[[nodiscard]] _CCCL_API constexpr size_t __open_addressing_capacity(size_t __capacity) noexcept
+{
+  const size_t __windows = (__capacity + _WindowSize - 1) / _WindowSize;
+  return _CUDA_VSTD::bit_ceil(__windows < 1 ? size_t{1} : __windows) * _WindowSize;
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___CONTAINER_OPEN_ADDRESSING_H
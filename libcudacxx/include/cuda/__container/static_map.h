@@ -0,0 +1,521 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___CONTAINER_STATIC_MAP_H
+#define _CUDA___CONTAINER_STATIC_MAP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__atomic/atomic.h>
+#include <cuda/__container/open_addressing.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__memory/allocator.h>
+#include <cuda/std/__memory/allocator_traits.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Whether a key and a value fit into a single compare-and-swap
+template <class _Key, class _Tp>
+inline constexpr bool __is_packable_slot_v =
+  sizeof(_Key) + sizeof(_Tp) <= 8 && _CUDA_VSTD::has_single_bit(sizeof(_Key) + sizeof(_Tp));
+
+template <class _Key, class _Tp>
+inline constexpr size_t __map_slot_alignment_v =
+  __is_packable_slot_v<_Key, _Tp>
+    ? sizeof(_Key) + sizeof(_Tp)
+    : (_CUDA_VSTD::max) (__atomic_alignment_v<_Key>, __atomic_alignment_v<_Tp>);
+
+template <class _Key, class _Tp>
+struct alignas(__map_slot_alignment_v<_Key, _Tp>) __map_slot
+{
+  alignas(__atomic_alignment_v<_Key>) _Key first;
+  alignas(__atomic_alignment_v<_Tp>) _Tp second;
+};
+
+//! A non-owning view of the slots of a fixed-capacity hash map with open addressing, which threads on the host and on
+//! the device use concurrently. All operations are lock-free and go through `cuda::atomic_ref` with scope `_Scope`.
+//! The view is trivially copyable, so it is passed to kernels by value.
+//!
+//! A key and its value of eight bytes or less together are inserted with a single compare-and-swap of the slot.
+//! Otherwise, the key is claimed with a compare-and-swap and the value is published after it, and lookups which find
+//! the key wait for its value. Either way, the value of a key does not change once it has been inserted.
+//!
+//! The capacity is a power of two of windows of `_ProbingScheme::window_size` slots. Empty slots hold the empty key and
+//! empty value sentinels, which must never be inserted, and which are compared by their object representation.
+template <class _Key,
+          class _Tp,
+          thread_scope _Scope = thread_scope_device,
+          class _KeyEqual = _CUDA_VSTD::equal_to<_Key>,
+          class _ProbingScheme = linear_probing<>>
+class static_map_ref
+{
+  static_assert(__is_atomic_slot_member_v<_Key>,
+                "cuda::static_map: the key type must be trivially copyable and of 1, 2, 4 or 8 bytes");
+  static_assert(__is_atomic_slot_member_v<_Tp>,
+                "cuda::static_map: the mapped type must be trivially copyable and of 1, 2, 4 or 8 bytes");
+
+public:
+  using key_type            = _Key;
+  using mapped_type         = _Tp;
+  using value_type          = _CUDA_VSTD::pair<_Key, _Tp>;
+  using size_type           = size_t;
+  using key_equal           = _KeyEqual;
+  using probing_scheme_type = _ProbingScheme;
+  using slot_type           = __map_slot<_Key, _Tp>;
+  using const_iterator      = const slot_type*;
+
+  static constexpr thread_scope scope    = _Scope;
+  static constexpr size_type window_size = _ProbingScheme::window_size;
+
+private:
+  static constexpr bool __packed = __is_packable_slot_v<_Key, _Tp> && sizeof(slot_type) == sizeof(_Key) + sizeof(_Tp);
+
+  slot_type* __slots_;
+  size_type __num_windows_;
+  key_type __empty_key_;
+  mapped_type __empty_value_;
+  key_equal __key_eq_;
+  probing_scheme_type __probing_;
+
+  // Lookups load with acquire, which makes the slot of a key found in it visible to the calling thread. Packed slots
+  // are loaded whole, matching the compare-and-swap which fills them.
+  [[nodiscard]] _CCCL_API key_type __load_key(slot_type& __slot, _CUDA_VSTD::memory_order __order) const noexcept
+  {
+    if constexpr (__packed)
+    {
+      return atomic_ref<slot_type, _Scope>(__slot).load(__order).first;
+    }
+    else
+    {
+      return atomic_ref<key_type, _Scope>(__slot.first).load(__order);
+    }
+    _CCCL_UNREACHABLE();
+  }
+
+  // Returns the key of __slot, or the empty key sentinel if it is free, after claiming it for __key and __value
+  _CCCL_API key_type __try_claim(slot_type& __slot, const key_type& __key, const mapped_type& __value) const
+  {
+    if constexpr (__packed)
+    {
+      slot_type __expected{__empty_key_, __empty_value_};
+      if (atomic_ref<slot_type, _Scope>(__slot).compare_exchange_strong(
+            __expected, slot_type{__key, __value}, _CUDA_VSTD::memory_order_release))
+      {
+        return __empty_key_;
+      }
+      return __expected.first;
+    }
+    else
+    {
+      key_type __expected = __empty_key_;
+      if (atomic_ref<key_type, _Scope>(__slot.first)
+            .compare_exchange_strong(__expected, __key, _CUDA_VSTD::memory_order_relaxed))
+      {
+        atomic_ref<mapped_type, _Scope>(__slot.second).store(__value, _CUDA_VSTD::memory_order_release);
+        return __empty_key_;
+      }
+      return __expected;
+    }
+    _CCCL_UNREACHABLE();
+  }
+
+  // Waits until the value of a slot whose key was claimed by another thread is published. The claiming thread stores
+  // the value right after its compare-and-swap, so this polls, backing off if that thread is descheduled in between.
+  // Waiting with atomic_ref::wait would make every insertion notify, and is not available before SM 70.
+  _CCCL_API void __wait_for_value(slot_type& __slot) const noexcept
+  {
+    if constexpr (!__packed)
+    {
+      atomic_ref<mapped_type, _Scope> __value(__slot.second);
+      _CUDA_VSTD::__cccl_thread_poll_with_backoff([&] {
+        return !::cuda::__bitwise_equal(__value.load(_CUDA_VSTD::memory_order_acquire), __empty_value_);
+      });
+    }
+  }
+
+public:
+  //! Returns the capacity of the smallest table with at least `__capacity` slots
+  [[nodiscard]] _CCCL_API static constexpr size_type valid_capacity(size_type __capacity) noexcept
+  {
+    return ::cuda::__open_addressing_capacity<window_size>(__capacity);
+  }
+
+  //! Views the `__capacity` slots at `__slots`, where `__capacity` must be a valid capacity. The slots must be
+  //! initialized before the first insertion, for example with `initialize`.
+  _CCCL_API static_map_ref(slot_type* __slots,
+                           size_type __capacity,
+                           key_type __empty_key,
+                           mapped_type __empty_value,
+                           key_equal __key_eq            = key_equal(),
+                           probing_scheme_type __probing = probing_scheme_type()) noexcept
+      : __slots_(__slots)
+      , __num_windows_(__capacity / window_size)
+      , __empty_key_(__empty_key)
+      , __empty_value_(__empty_value)
+      , __key_eq_(__key_eq)
+      , __probing_(__probing)
+  {
+    _CCCL_ASSERT(__capacity == valid_capacity(__capacity), "cuda::static_map_ref: the capacity is not valid");
+  }
+
+  //! Empties the slots `__rank`, `__rank + __count`, ... so that `__count` threads can initialize a table together
+  _CCCL_API void initialize(size_type __rank = 0, size_type __count = 1) const noexcept
+  {
+    for (size_type __i = __rank; __i < capacity(); __i += __count)
+    {
+      __slots_[__i].first  = __empty_key_;
+      __slots_[__i].second = __empty_value_;
+    }
+  }
+
+  //! Inserts `__value`, unless a key equal to `__value.first` is in the table already. Returns whether it was inserted,
+  //! which is also false when the table is full.
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_API bool insert(const value_type& __value) const
+  {
+    _CCCL_ASSERT(!::cuda::__bitwise_equal(__value.first, __empty_key_),
+                 "cuda::static_map: the empty key cannot be inserted");
+    _CCCL_ASSERT(!::cuda::__bitwise_equal(__value.second, __empty_value_),
+                 "cuda::static_map: the empty value cannot be inserted");
+    auto __sequence = __probing_.__sequence(__value.first, __num_windows_);
+    for (size_type __n = 0; __n < __num_windows_; ++__n, __sequence.__advance())
+    {
+      slot_type* __window = __slots_ + __sequence.__window * window_size;
+      for (size_type __i = 0; __i < window_size; ++__i)
+      {
+        key_type __current = __load_key(__window[__i], _CUDA_VSTD::memory_order_relaxed);
+        if (::cuda::__bitwise_equal(__current, __empty_key_))
+        {
+          __current = __try_claim(__window[__i], __value.first, __value.second);
+          if (::cuda::__bitwise_equal(__current, __empty_key_))
+          {
+            return true;
+          }
+          // another thread took the slot first, and __current now holds its key
+        }
+        if (__key_eq_(__current, __value.first))
+        {
+          return false;
+        }
+      }
+    }
+    return false;
+  }
+
+  //! Inserts the key-value pairs of [__first, __last) and returns how many of them were inserted
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt>
+  _CCCL_API size_type insert(_InputIt __first, _InputIt __last) const
+  {
+    size_type __inserted = 0;
+    for (; __first != __last; ++__first)
+    {
+      __inserted += insert(static_cast<value_type>(*__first));
+    }
+    return __inserted;
+  }
+
+  //! Returns an iterator to the slot of the key equal to `__key`, or `end()` if there is none
+  _CCCL_EXEC_CHECK_DISABLE
+  [[nodiscard]] _CCCL_API const_iterator find(const key_type& __key) const
+  {
+    auto __sequence = __probing_.__sequence(__key, __num_windows_);
+    for (size_type __n = 0; __n < __num_windows_; ++__n, __sequence.__advance())
+    {
+      slot_type* __window = __slots_ + __sequence.__window * window_size;
+      for (size_type __i = 0; __i < window_size; ++__i)
+      {
+        const key_type __current = __load_key(__window[__i], _CUDA_VSTD::memory_order_acquire);
+        if (::cuda::__bitwise_equal(__current, __empty_key_))
+        {
+          return end();
+        }
+        if (__key_eq_(__current, __key))
+        {
+          __wait_for_value(__window[__i]);
+          return __window + __i;
+        }
+      }
+    }
+    return end();
+  }
+
+  //! Writes the values of the keys of [__first, __last) to __out, or the empty value for keys which are missing
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt, class _OutputIt>
+  _CCCL_API _OutputIt find(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    for (; __first != __last; ++__first, ++__out)
+    {
+      const const_iterator __it = find(static_cast<key_type>(*__first));
+      *__out                    = __it == end() ? __empty_value_ : __it->second;
+    }
+    return __out;
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  [[nodiscard]] _CCCL_API bool contains(const key_type& __key) const
+  {
+    return find(__key) != end();
+  }
+
+  //! Writes whether the table contains each key of [__first, __last) to __out
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt, class _OutputIt>
+  _CCCL_API _OutputIt contains(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    for (; __first != __last; ++__first, ++__out)
+    {
+      *__out = contains(static_cast<key_type>(*__first));
+    }
+    return __out;
+  }
+
+  //! Counts the keys in the table, which visits every slot
+  [[nodiscard]] _CCCL_API size_type size() const noexcept
+  {
+    size_type __size = 0;
+    for (size_type __i = 0; __i < capacity(); ++__i)
+    {
+      __size += !::cuda::__bitwise_equal(__load_key(__slots_[__i], _CUDA_VSTD::memory_order_relaxed), __empty_key_);
+    }
+    return __size;
+  }
+
+  [[nodiscard]] _CCCL_API const_iterator end() const noexcept
+  {
+    return __slots_ + capacity();
+  }
+
+  [[nodiscard]] _CCCL_API size_type capacity() const noexcept
+  {
+    return __num_windows_ * window_size;
+  }
+
+  [[nodiscard]] _CCCL_API key_type empty_key_sentinel() const noexcept
+  {
+    return __empty_key_;
+  }
+
+  [[nodiscard]] _CCCL_API mapped_type empty_value_sentinel() const noexcept
+  {
+    return __empty_value_;
+  }
+
+  [[nodiscard]] _CCCL_API key_equal key_eq() const
+  {
+    return __key_eq_;
+  }
+
+  [[nodiscard]] _CCCL_API probing_scheme_type probing_scheme() const
+  {
+    return __probing_;
+  }
+
+  [[nodiscard]] _CCCL_API slot_type* data() const noexcept
+  {
+    return __slots_;
+  }
+};
+
+#if !_CCCL_COMPILER(NVRTC)
+
+//! A fixed-capacity hash map with open addressing, which owns slots allocated with `_Allocator` rebound to the slot
+//! type. The slots are initialized on the host, so the allocator must return host-accessible memory, such as host,
+//! pinned or managed memory. The table is shared with other host threads and with kernels through the view returned by
+//! `ref()`.
+template <class _Key,
+          class _Tp,
+          thread_scope _Scope = thread_scope_device,
+          class _KeyEqual = _CUDA_VSTD::equal_to<_Key>,
+          class _ProbingScheme = linear_probing<>,
+          class _Allocator = _CUDA_VSTD::allocator<_CUDA_VSTD::pair<_Key, _Tp>>>
+class static_map
+{
+public:
+  using ref_type            = static_map_ref<_Key, _Tp, _Scope, _KeyEqual, _ProbingScheme>;
+  using key_type            = typename ref_type::key_type;
+  using mapped_type         = typename ref_type::mapped_type;
+  using value_type          = typename ref_type::value_type;
+  using size_type           = typename ref_type::size_type;
+  using key_equal           = _KeyEqual;
+  using probing_scheme_type = _ProbingScheme;
+  using allocator_type      = _Allocator;
+  using slot_type           = typename ref_type::slot_type;
+  using const_iterator      = typename ref_type::const_iterator;
+
+private:
+  using __slot_allocator = typename _CUDA_VSTD::allocator_traits<_Allocator>::template rebind_alloc<slot_type>;
+  using __alloc_traits   = _CUDA_VSTD::allocator_traits<__slot_allocator>;
+
+  __slot_allocator __alloc_;
+  slot_type* __slots_;
+  size_type __capacity_;
+  key_type __empty_key_;
+  mapped_type __empty_value_;
+  key_equal __key_eq_;
+  probing_scheme_type __probing_;
+
+public:
+  //! Allocates a table with room for at least `__capacity` keys, whose empty slots hold `__empty_key` and
+  //! `__empty_value`
+  _CCCL_HOST_API static_map(size_type __capacity,
+                            key_type __empty_key,
+                            mapped_type __empty_value,
+                            key_equal __key_eq            = key_equal(),
+                            probing_scheme_type __probing = probing_scheme_type(),
+                            const allocator_type& __alloc = allocator_type())
+      : __alloc_(__alloc)
+      , __slots_(nullptr)
+      , __capacity_(ref_type::valid_capacity(__capacity))
+      , __empty_key_(__empty_key)
+      , __empty_value_(__empty_value)
+      , __key_eq_(__key_eq)
+      , __probing_(__probing)
+  {
+    __slots_ = __alloc_traits::allocate(__alloc_, __capacity_);
+    clear();
+  }
+
+  _CCCL_HOST_API static_map(static_map&& __other) noexcept
+      : __alloc_(_CUDA_VSTD::move(__other.__alloc_))
+      , __slots_(_CUDA_VSTD::exchange(__other.__slots_, nullptr))
+      , __capacity_(_CUDA_VSTD::exchange(__other.__capacity_, 0))
+      , __empty_key_(__other.__empty_key_)
+      , __empty_value_(__other.__empty_value_)
+      , __key_eq_(__other.__key_eq_)
+      , __probing_(__other.__probing_)
+  {}
+
+  _CCCL_HOST_API static_map& operator=(static_map&& __other) noexcept
+  {
+    static_map __tmp(_CUDA_VSTD::move(__other));
+    _CUDA_VSTD::swap(__alloc_, __tmp.__alloc_);
+    _CUDA_VSTD::swap(__slots_, __tmp.__slots_);
+    _CUDA_VSTD::swap(__capacity_, __tmp.__capacity_);
+    _CUDA_VSTD::swap(__empty_key_, __tmp.__empty_key_);
+    _CUDA_VSTD::swap(__empty_value_, __tmp.__empty_value_);
+    _CUDA_VSTD::swap(__key_eq_, __tmp.__key_eq_);
+    _CUDA_VSTD::swap(__probing_, __tmp.__probing_);
+    return *this;
+  }
+
+  static_map(const static_map&)            = delete;
+  static_map& operator=(const static_map&) = delete;
+
+  _CCCL_HOST_API ~static_map()
+  {
+    if (__slots_ != nullptr)
+    {
+      __alloc_traits::deallocate(__alloc_, __slots_, __capacity_);
+    }
+  }
+
+  //! Returns a view of the table for other host threads and for kernels
+  [[nodiscard]] _CCCL_HOST_API ref_type ref() const noexcept
+  {
+    return ref_type(__slots_, __capacity_, __empty_key_, __empty_value_, __key_eq_, __probing_);
+  }
+
+  //! Removes all keys
+  _CCCL_HOST_API void clear() noexcept
+  {
+    ref().initialize();
+  }
+
+  _CCCL_HOST_API bool insert(const value_type& __value)
+  {
+    return ref().insert(__value);
+  }
+
+  template <class _InputIt>
+  _CCCL_HOST_API size_type insert(_InputIt __first, _InputIt __last)
+  {
+    return ref().insert(__first, __last);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API const_iterator find(const key_type& __key) const
+  {
+    return ref().find(__key);
+  }
+
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API _OutputIt find(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    return ref().find(__first, __last, __out);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool contains(const key_type& __key) const
+  {
+    return ref().contains(__key);
+  }
+
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API _OutputIt contains(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    return ref().contains(__first, __last, __out);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API const_iterator end() const noexcept
+  {
+    return ref().end();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_type size() const noexcept
+  {
+    return ref().size();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_type capacity() const noexcept
+  {
+    return __capacity_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API key_type empty_key_sentinel() const noexcept
+  {
+    return __empty_key_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API mapped_type empty_value_sentinel() const noexcept
+  {
+    return __empty_value_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API allocator_type get_allocator() const
+  {
+    return allocator_type(__alloc_);
+  }
+};
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___CONTAINER_STATIC_MAP_H
@@ -0,0 +1,422 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___CONTAINER_STATIC_SET_H
+#define _CUDA___CONTAINER_STATIC_SET_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__atomic/atomic.h>
+#include <cuda/__container/open_addressing.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__memory/allocator.h>
+#include <cuda/std/__memory/allocator_traits.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+template <class _Key>
+struct alignas(__atomic_alignment_v<_Key>) __set_slot
+{
+  _Key __key;
+};
+
+//! A non-owning view of the slots of a fixed-capacity hash set with open addressing, which threads on the host and on
+//! the device use concurrently. All operations are lock-free: a key is inserted with a single compare-and-swap through
+//! `cuda::atomic_ref` with scope `_Scope`, and lookups only load. The view is trivially copyable, so it is passed to
+//! kernels by value.
+//!
+//! The capacity is a power of two of windows of `_ProbingScheme::window_size` slots. Empty slots hold the empty key
+//! sentinel, which must never be inserted, and which is compared by its object representation.
+template <class _Key,
+          thread_scope _Scope = thread_scope_device,
+          class _KeyEqual = _CUDA_VSTD::equal_to<_Key>,
+          class _ProbingScheme = linear_probing<>>
+class static_set_ref
+{
+  static_assert(__is_atomic_slot_member_v<_Key>,
+                "cuda::static_set: the key type must be trivially copyable and of 1, 2, 4 or 8 bytes");
+
+public:
+  using key_type            = _Key;
+  using value_type          = _Key;
+  using size_type           = size_t;
+  using key_equal           = _KeyEqual;
+  using probing_scheme_type = _ProbingScheme;
+  using slot_type           = __set_slot<_Key>;
+  using const_iterator      = const key_type*;
+
+  static constexpr thread_scope scope    = _Scope;
+  static constexpr size_type window_size = _ProbingScheme::window_size;
+
+private:
+  slot_type* __slots_;
+  size_type __num_windows_;
+  key_type __empty_key_;
+  key_equal __key_eq_;
+  probing_scheme_type __probing_;
+
+  [[nodiscard]] _CCCL_API static const_iterator __to_iterator(const slot_type* __slot) noexcept
+  {
+    return reinterpret_cast<const_iterator>(__slot);
+  }
+
+public:
+  //! Returns the capacity of the smallest table with at least `__capacity` slots
+  [[nodiscard]] _CCCL_API static constexpr size_type valid_capacity(size_type __capacity) noexcept
+  {
+    return ::cuda::__open_addressing_capacity<window_size>(__capacity);
+  }
+
+  //! Views the `__capacity` slots at `__slots`, where `__capacity` must be a valid capacity. The slots must be
+  //! initialized before the first insertion, for example with `initialize`.
+  _CCCL_API static_set_ref(slot_type* __slots,
+                           size_type __capacity,
+                           key_type __empty_key,
+                           key_equal __key_eq            = key_equal(),
+                           probing_scheme_type __probing = probing_scheme_type()) noexcept
+      : __slots_(__slots)
+      , __num_windows_(__capacity / window_size)
+      , __empty_key_(__empty_key)
+      , __key_eq_(__key_eq)
+      , __probing_(__probing)
+  {
+    _CCCL_ASSERT(__capacity == valid_capacity(__capacity), "cuda::static_set_ref: the capacity is not valid");
+  }
+
+  //! Empties the slots `__rank`, `__rank + __count`, ... so that `__count` threads can initialize a table together
+  _CCCL_API void initialize(size_type __rank = 0, size_type __count = 1) const noexcept
+  {
+    for (size_type __i = __rank; __i < capacity(); __i += __count)
+    {
+      __slots_[__i].__key = __empty_key_;
+    }
+  }
+
+  //! Inserts `__key`, unless an equal key is in the table already. Returns whether it was inserted, which is also false
+  //! when the table is full.
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_API bool insert(const key_type& __key) const
+  {
+    _CCCL_ASSERT(!::cuda::__bitwise_equal(__key, __empty_key_), "cuda::static_set: the empty key cannot be inserted");
+    auto __sequence = __probing_.__sequence(__key, __num_windows_);
+    for (size_type __n = 0; __n < __num_windows_; ++__n, __sequence.__advance())
+    {
+      slot_type* __window = __slots_ + __sequence.__window * window_size;
+      for (size_type __i = 0; __i < window_size; ++__i)
+      {
+        atomic_ref<key_type, _Scope> __slot(__window[__i].__key);
+        key_type __current = __slot.load(_CUDA_VSTD::memory_order_relaxed);
+        if (::cuda::__bitwise_equal(__current, __empty_key_))
+        {
+          if (__slot.compare_exchange_strong(__current, __key, _CUDA_VSTD::memory_order_release))
+          {
+            return true;
+          }
+          // another thread took the slot first, and __current now holds its key
+        }
+        if (__key_eq_(__current, __key))
+        {
+          return false;
+        }
+      }
+    }
+    return false;
+  }
+
+  //! Inserts the keys of [__first, __last) and returns how many of them were inserted
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt>
+  _CCCL_API size_type insert(_InputIt __first, _InputIt __last) const
+  {
+    size_type __inserted = 0;
+    for (; __first != __last; ++__first)
+    {
+      __inserted += insert(static_cast<key_type>(*__first));
+    }
+    return __inserted;
+  }
+
+  //! Returns an iterator to the key equal to `__key`, or `end()` if there is none
+  _CCCL_EXEC_CHECK_DISABLE
+  [[nodiscard]] _CCCL_API const_iterator find(const key_type& __key) const
+  {
+    auto __sequence = __probing_.__sequence(__key, __num_windows_);
+    for (size_type __n = 0; __n < __num_windows_; ++__n, __sequence.__advance())
+    {
+      slot_type* __window = __slots_ + __sequence.__window * window_size;
+      for (size_type __i = 0; __i < window_size; ++__i)
+      {
+        const key_type __current =
+          atomic_ref<key_type, _Scope>(__window[__i].__key).load(_CUDA_VSTD::memory_order_acquire);
+        if (::cuda::__bitwise_equal(__current, __empty_key_))
+        {
+          return end();
+        }
+        if (__key_eq_(__current, __key))
+        {
+          return __to_iterator(__window + __i);
+        }
+      }
+    }
+    return end();
+  }
+
+  //! Writes the keys equal to those of [__first, __last) to __out, or the empty key for those without one
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt, class _OutputIt>
+  _CCCL_API _OutputIt find(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    for (; __first != __last; ++__first, ++__out)
+    {
+      const const_iterator __it = find(static_cast<key_type>(*__first));
+      *__out                    = __it == end() ? __empty_key_ : *__it;
+    }
+    return __out;
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  [[nodiscard]] _CCCL_API bool contains(const key_type& __key) const
+  {
+    return find(__key) != end();
+  }
+
+  //! Writes whether the table contains each key of [__first, __last) to __out
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _InputIt, class _OutputIt>
+  _CCCL_API _OutputIt contains(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    for (; __first != __last; ++__first, ++__out)
+    {
+      *__out = contains(static_cast<key_type>(*__first));
+    }
+    return __out;
+  }
+
+  //! Counts the keys in the table, which visits every slot
+  [[nodiscard]] _CCCL_API size_type size() const noexcept
+  {
+    size_type __size = 0;
+    for (size_type __i = 0; __i < capacity(); ++__i)
+    {
+      const key_type __current =
+        atomic_ref<key_type, _Scope>(__slots_[__i].__key).load(_CUDA_VSTD::memory_order_relaxed);
+      __size += !::cuda::__bitwise_equal(__current, __empty_key_);
+    }
+    return __size;
+  }
+
+  [[nodiscard]] _CCCL_API const_iterator end() const noexcept
+  {
+    return __to_iterator(__slots_ + capacity());
+  }
+
+  [[nodiscard]] _CCCL_API size_type capacity() const noexcept
+  {
+    return __num_windows_ * window_size;
+  }
+
+  [[nodiscard]] _CCCL_API key_type empty_key_sentinel() const noexcept
+  {
+    return __empty_key_;
+  }
+
+  [[nodiscard]] _CCCL_API key_equal key_eq() const
+  {
+    return __key_eq_;
+  }
+
+  [[nodiscard]] _CCCL_API probing_scheme_type probing_scheme() const
+  {
+    return __probing_;
+  }
+
+  [[nodiscard]] _CCCL_API slot_type* data() const noexcept
+  {
+    return __slots_;
+  }
+};
+
+#if !_CCCL_COMPILER(NVRTC)
+
+//! A fixed-capacity hash set with open addressing, which owns slots allocated with `_Allocator` rebound to the slot
+//! type. The slots are initialized on the host, so the allocator must return host-accessible memory, such as host,
+//! pinned or managed memory. The table is shared with other host threads and with kernels through the view returned by
+//! `ref()`.
+template <class _Key,
+          thread_scope _Scope = thread_scope_device,
+          class _KeyEqual = _CUDA_VSTD::equal_to<_Key>,
+          class _ProbingScheme = linear_probing<>,
+          class _Allocator = _CUDA_VSTD::allocator<_Key>>
+class static_set
+{
+public:
+  using ref_type            = static_set_ref<_Key, _Scope, _KeyEqual, _ProbingScheme>;
+  using key_type            = typename ref_type::key_type;
+  using value_type          = typename ref_type::value_type;
+  using size_type           = typename ref_type::size_type;
+  using key_equal           = _KeyEqual;
+  using probing_scheme_type = _ProbingScheme;
+  using allocator_type      = _Allocator;
+  using slot_type           = typename ref_type::slot_type;
+  using const_iterator      = typename ref_type::const_iterator;
+
+private:
+  using __slot_allocator = typename _CUDA_VSTD::allocator_traits<_Allocator>::template rebind_alloc<slot_type>;
+  using __alloc_traits   = _CUDA_VSTD::allocator_traits<__slot_allocator>;
+
+  __slot_allocator __alloc_;
+  slot_type* __slots_;
+  size_type __capacity_;
+  key_type __empty_key_;
+  key_equal __key_eq_;
+  probing_scheme_type __probing_;
+
+public:
+  //! Allocates a table with room for at least `__capacity` keys, whose empty slots hold `__empty_key`
+  _CCCL_HOST_API static_set(size_type __capacity,
+                            key_type __empty_key,
+                            key_equal __key_eq            = key_equal(),
+                            probing_scheme_type __probing = probing_scheme_type(),
+                            const allocator_type& __alloc = allocator_type())
+      : __alloc_(__alloc)
+      , __slots_(nullptr)
+      , __capacity_(ref_type::valid_capacity(__capacity))
+      , __empty_key_(__empty_key)
+      , __key_eq_(__key_eq)
+      , __probing_(__probing)
+  {
+    __slots_ = __alloc_traits::allocate(__alloc_, __capacity_);
+    clear();
+  }
+
+  _CCCL_HOST_API static_set(static_set&& __other) noexcept
+      : __alloc_(_CUDA_VSTD::move(__other.__alloc_))
+      , __slots_(_CUDA_VSTD::exchange(__other.__slots_, nullptr))
+      , __capacity_(_CUDA_VSTD::exchange(__other.__capacity_, 0))
+      , __empty_key_(__other.__empty_key_)
+      , __key_eq_(__other.__key_eq_)
+      , __probing_(__other.__probing_)
+  {}
+
+  _CCCL_HOST_API static_set& operator=(static_set&& __other) noexcept
+  {
+    static_set __tmp(_CUDA_VSTD::move(__other));
+    _CUDA_VSTD::swap(__alloc_, __tmp.__alloc_);
+    _CUDA_VSTD::swap(__slots_, __tmp.__slots_);
+    _CUDA_VSTD::swap(__capacity_, __tmp.__capacity_);
+    _CUDA_VSTD::swap(__empty_key_, __tmp.__empty_key_);
+    _CUDA_VSTD::swap(__key_eq_, __tmp.__key_eq_);
+    _CUDA_VSTD::swap(__probing_, __tmp.__probing_);
+    return *this;
+  }
+
+  static_set(const static_set&)            = delete;
+  static_set& operator=(const static_set&) = delete;
+
+  _CCCL_HOST_API ~static_set()
+  {
+    if (__slots_ != nullptr)
+    {
+      __alloc_traits::deallocate(__alloc_, __slots_, __capacity_);
+    }
+  }
+
+  //! Returns a view of the table for other host threads and for kernels
+  [[nodiscard]] _CCCL_HOST_API ref_type ref() const noexcept
+  {
+    return ref_type(__slots_, __capacity_, __empty_key_, __key_eq_, __probing_);
+  }
+
+  //! Removes all keys
+  _CCCL_HOST_API void clear() noexcept
+  {
+    ref().initialize();
+  }
+
+  _CCCL_HOST_API bool insert(const key_type& __key)
+  {
+    return ref().insert(__key);
+  }
+
+  template <class _InputIt>
+  _CCCL_HOST_API size_type insert(_InputIt __first, _InputIt __last)
+  {
+    return ref().insert(__first, __last);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API const_iterator find(const key_type& __key) const
+  {
+    return ref().find(__key);
+  }
+
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API _OutputIt find(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    return ref().find(__first, __last, __out);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool contains(const key_type& __key) const
+  {
+    return ref().contains(__key);
+  }
+
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API _OutputIt contains(_InputIt __first, _InputIt __last, _OutputIt __out) const
+  {
+    return ref().contains(__first, __last, __out);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API const_iterator end() const noexcept
+  {
+    return ref().end();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_type size() const noexcept
+  {
+    return ref().size();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_type capacity() const noexcept
+  {
+    return __capacity_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API key_type empty_key_sentinel() const noexcept
+  {
+    return __empty_key_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API allocator_type get_allocator() const
+  {
+    return allocator_type(__alloc_);
+  }
+};
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___CONTAINER_STATIC_SET_H
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_FUNCTIONAL_HASH_COMBINE_H
+#define _CUDA_FUNCTIONAL_HASH_COMBINE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__functional/hash.h>
+#include <cuda/std/__fwd/array.h>
+#include <cuda/std/__fwd/get.h>
+#include <cuda/std/__fwd/span.h>
+#include <cuda/std/__tuple_dir/tuple_like.h>
+#include <cuda/std/__tuple_dir/tuple_size.h>
+#include <cuda/std/__type_traits/extent.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_array.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+template <class _Tp>
+inline constexpr bool __is_hash_contiguous_v = false;
+
+template <class _Tp, size_t _Size>
+inline constexpr bool __is_hash_contiguous_v<_CUDA_VSTD::array<_Tp, _Size>> = true;
+
+template <class _Tp, size_t _Extent>
+inline constexpr bool __is_hash_contiguous_v<_CUDA_VSTD::span<_Tp, _Extent>> = true;
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API size_t __hash_value(const _Tp& __value);
+
+// Integers hash to themselves, so a range of them is hashed through its bytes in a single pass. Other ranges combine
+// the hashes of their elements.
+template <class _Tp>
+[[nodiscard]] _CCCL_API size_t __hash_elements(const _Tp* __first, size_t __size)
+{
+  if constexpr (_CCCL_TRAIT(_CUDA_VSTD::is_integral, _Tp))
+  {
+    return _CUDA_VSTD::__hash_memory(__first, __size * sizeof(_Tp));
+  }
+  else
+  {
+    size_t __seed = 0;
+    for (size_t __i = 0; __i < __size; ++__i)
+    {
+      __seed = _CUDA_VSTD::__hash_combine(__seed, ::cuda::__hash_value(__first[__i]));
+    }
+    return __seed;
+  }
+  _CCCL_UNREACHABLE();
+}
+
+template <class _Tp, size_t... _Indices>
+[[nodiscard]] _CCCL_API size_t __hash_tuple(const _Tp& __value, _CUDA_VSTD::index_sequence<_Indices...>)
+{
+  size_t __seed = 0;
+  ((__seed = _CUDA_VSTD::__hash_combine(__seed, ::cuda::__hash_value(_CUDA_VSTD::get<_Indices>(__value)))), ...);
+  return __seed;
+}
+
+// Hashes tuple-like types and arrays element by element, and everything else with cuda::std::hash
+template <class _Tp>
+[[nodiscard]] _CCCL_API size_t __hash_value(const _Tp& __value)
+{
+  if constexpr (_CCCL_TRAIT(_CUDA_VSTD::is_array, _Tp))
+  {
+    return ::cuda::__hash_elements(__value, _CUDA_VSTD::extent_v<_Tp>);
+  }
+  else if constexpr (__is_hash_contiguous_v<_Tp>)
+  {
+    return ::cuda::__hash_elements(__value.data(), __value.size());
+  }
+  else if constexpr (_CUDA_VSTD::__tuple_like_impl<_Tp>::value)
+  {
+    return ::cuda::__hash_tuple(__value, _CUDA_VSTD::make_index_sequence<_CUDA_VSTD::tuple_size<_Tp>::value>{});
+  }
+  else
+  {
+    return _CUDA_VSTD::hash<_Tp>{}(__value);
+  }
+  _CCCL_UNREACHABLE();
+}
+
+//! Combines the hashes of the given values into __seed, in order, and returns the result. Tuple-like types and arrays
+//! are hashed element by element, and other types with cuda::std::hash.
+template <class... _Tps>
+[[nodiscard]] _CCCL_API size_t hash_combine(size_t __seed, const _Tps&... __values)
+{
+  ((__seed = _CUDA_VSTD::__hash_combine(__seed, ::cuda::__hash_value(__values))), ...);
+  return __seed;
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_FUNCTIONAL_HASH_COMBINE_H
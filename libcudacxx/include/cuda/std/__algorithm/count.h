@@ -20,17 +20,43 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/__type_traits/remove_cv.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+template <class _Tp, class _Up>
+[[nodiscard]] _CCCL_HOST_API inline ptrdiff_t __count_vectorized(_Tp* __first, _Tp* __last, const _Up& __value) noexcept
+{
+  using _Vp = remove_cv_t<_Tp>;
+  // A value that does not survive the round trip through _Vp compares unequal to every element, see find
+  if (static_cast<_Vp>(__value) != __value)
+  {
+    return 0;
+  }
+  return _CUDA_VSTD::__simd_count<_Vp>(__first, __last, static_cast<_Vp>(__value));
+}
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
 _CCCL_EXEC_CHECK_DISABLE
 template <class _InputIterator, class _Tp>
 [[nodiscard]] _CCCL_API constexpr __iter_diff_t<_InputIterator>
 count(_InputIterator __first, _InputIterator __last, const _Tp& __value_)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_pointer_v<_InputIterator> && __is_simd_comparable_v<_Tp>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _CUDA_VSTD::__count_vectorized(__first, __last, __value_);))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   __iter_diff_t<_InputIterator> __r{0};
   for (; __first != __last; ++__first)
   {
@@ -21,19 +21,40 @@
 #endif // no system header
 
 #include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__type_traits/add_lvalue_reference.h>
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+// The elements are integers, so the ranges are equal exactly when their bytes are
+template <class _Tp, class _Up>
+[[nodiscard]] _CCCL_HOST_API inline bool __equal_vectorized(_Tp* __first1, _Tp* __last1, _Up* __first2) noexcept
+{
+  return __first1 == __last1
+      || __builtin_memcmp(__first1, __first2, static_cast<size_t>(__last1 - __first1) * sizeof(_Tp)) == 0;
+}
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
 _CCCL_EXEC_CHECK_DISABLE
 template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
 [[nodiscard]] _CCCL_API constexpr bool
 equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _BinaryPredicate __pred)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_equal_ranges_v<_InputIterator1, _InputIterator2, _BinaryPredicate>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _CUDA_VSTD::__equal_vectorized(__first1, __last1, __first2);))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   for (; __first1 != __last1; ++__first1, (void) ++__first2)
   {
     if (!__pred(*__first1, *__first2))
@@ -20,7 +20,10 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/__type_traits/remove_cv.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -41,10 +44,34 @@ template <class _Iter, class _Sent, class _Tp, class _Proj>
   return __first;
 }
 
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+template <class _Tp, class _Up>
+[[nodiscard]] _CCCL_HOST_API inline _Tp* __find_vectorized(_Tp* __first, _Tp* __last, const _Up& __value) noexcept
+{
+  using _Vp = remove_cv_t<_Tp>;
+  // Both sides are converted to a type that is at least as wide, so a value that does not survive the round trip
+  // through _Vp compares unequal to every element
+  if (static_cast<_Vp>(__value) != __value)
+  {
+    return __last;
+  }
+  return __first + (_CUDA_VSTD::__simd_find<_Vp>(__first, __last, static_cast<_Vp>(__value)) - __first);
+}
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
 _CCCL_EXEC_CHECK_DISABLE
 template <class _InputIterator, class _Tp>
 [[nodiscard]] _CCCL_API constexpr _InputIterator find(_InputIterator __first, _InputIterator __last, const _Tp& __value_)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_pointer_v<_InputIterator> && __is_simd_comparable_v<_Tp>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _CUDA_VSTD::__find_vectorized(__first, __last, __value_);))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   for (; __first != __last; ++__first)
   {
     if (*__first == __value_)
@@ -0,0 +1,291 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
+#define _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/lower_bound.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/move.h>
+#include <cuda/std/__algorithm/rotate.h>
+#include <cuda/std/__algorithm/upper_bound.h>
+#include <cuda/std/__functional/identity.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__iterator/reverse_iterator.h>
+#include <cuda/std/__memory/destruct_n.h>
+#include <cuda/std/__memory/temporary_buffer.h>
+#include <cuda/std/__memory/unique_ptr.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Compares its arguments in the opposite order, for merging from the back.
+template <class _Predicate>
+class __invert
+{
+  _Predicate __p_;
+
+public:
+  _CCCL_API constexpr explicit __invert(_Predicate __p)
+      : __p_(__p)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _T1, class _T2>
+  _CCCL_API constexpr bool operator()(const _T1& __x, const _T2& __y)
+  {
+    return __p_(__y, __x);
+  }
+};
+
+// Merges [__first1, __last1) and [__first2, __last2) into the range ending at __last2, which starts at __result.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy,
+          class _Compare,
+          class _InputIterator1,
+          class _Sent1,
+          class _InputIterator2,
+          class _Sent2,
+          class _OutputIterator>
+_CCCL_API inline void __half_inplace_merge(
+  _InputIterator1 __first1,
+  _Sent1 __last1,
+  _InputIterator2 __first2,
+  _Sent2 __last2,
+  _OutputIterator __result,
+  _Compare&& __comp)
+{
+  for (; __first1 != __last1; ++__result)
+  {
+    if (__first2 == __last2)
+    {
+      _CUDA_VSTD::__move<_AlgPolicy>(__first1, __last1, __result);
+      return;
+    }
+
+    if (__comp(*__first2, *__first1))
+    {
+      *__result = _IterOps<_AlgPolicy>::__iter_move(__first2);
+      ++__first2;
+    }
+    else
+    {
+      *__result = _IterOps<_AlgPolicy>::__iter_move(__first1);
+      ++__first1;
+    }
+  }
+  // [__first2, __last2) is in place already
+}
+
+// Merges through a buffer which fits the shorter of the two ranges.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_CCCL_API inline void __buffered_inplace_merge(
+  _BidirectionalIterator __first,
+  _BidirectionalIterator __middle,
+  _BidirectionalIterator __last,
+  _Compare&& __comp,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len1,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len2,
+  typename iterator_traits<_BidirectionalIterator>::value_type* __buff)
+{
+  using value_type = typename iterator_traits<_BidirectionalIterator>::value_type;
+
+  __destruct_n __d(0);
+  unique_ptr<value_type, __destruct_n&> __h2(__buff, __d);
+  if (__len1 <= __len2)
+  {
+    value_type* __p = __buff;
+    for (_BidirectionalIterator __i = __first; __i != __middle;
+         __d.template __incr<value_type>(), (void) ++__i, (void) ++__p)
+    {
+      ::new ((void*) __p) value_type(_IterOps<_AlgPolicy>::__iter_move(__i));
+    }
+    _CUDA_VSTD::__half_inplace_merge<_AlgPolicy>(__buff, __p, __middle, __last, __first, __comp);
+  }
+  else
+  {
+    value_type* __p = __buff;
+    for (_BidirectionalIterator __i = __middle; __i != __last;
+         __d.template __incr<value_type>(), (void) ++__i, (void) ++__p)
+    {
+      ::new ((void*) __p) value_type(_IterOps<_AlgPolicy>::__iter_move(__i));
+    }
+    using _RBi      = reverse_iterator<_BidirectionalIterator>;
+    using _Rv       = reverse_iterator<value_type*>;
+    using _Inverted = __invert<_Compare>;
+    _CUDA_VSTD::__half_inplace_merge<_AlgPolicy>(
+      _Rv(__p), _Rv(__buff), _RBi(__middle), _RBi(__first), _RBi(__last), _Inverted(__comp));
+  }
+}
+
+// Merges [__first, __middle) and [__middle, __last) through the buffer once one of them fits into it, and before that
+// splits them around the median of the shorter one and swaps the middle parts into place with a rotation. Without a
+// buffer this takes O(N log N) moves.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_CCCL_API inline void __inplace_merge(
+  _BidirectionalIterator __first,
+  _BidirectionalIterator __middle,
+  _BidirectionalIterator __last,
+  _Compare&& __comp,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len1,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len2,
+  typename iterator_traits<_BidirectionalIterator>::value_type* __buff,
+  ptrdiff_t __buff_size)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_BidirectionalIterator>::difference_type;
+
+  while (true)
+  {
+    if (__len2 == 0)
+    {
+      return;
+    }
+    if (__len1 <= __buff_size || __len2 <= __buff_size)
+    {
+      _CUDA_VSTD::__buffered_inplace_merge<_AlgPolicy>(__first, __middle, __last, __comp, __len1, __len2, __buff);
+      return;
+    }
+    // skip the leading elements of [__first, __middle) which are in place already
+    for (; true; ++__first, (void) --__len1)
+    {
+      if (__len1 == 0)
+      {
+        return;
+      }
+      if (__comp(*__middle, *__first))
+      {
+        break;
+      }
+    }
+    // *__first > *__middle. Split into [__first, __m1) [__m1, __middle) [__middle, __m2) [__m2, __last) so that
+    //   [__first, __m1) <= [__middle, __m2) < [__m1, __middle) <= [__m2, __last)
+    // with __m1 or __m2 in the middle of its range.
+    _BidirectionalIterator __m1;
+    _BidirectionalIterator __m2;
+    difference_type __len11; // distance(__first, __m1)
+    difference_type __len21; // distance(__middle, __m2)
+    if (__len1 < __len2)
+    {
+      // __len1 >= 1, __len2 >= 2
+      __len21 = __len2 / 2;
+      __m2    = __middle;
+      _Ops::advance(__m2, __len21);
+      __m1    = _CUDA_VSTD::__upper_bound<_AlgPolicy>(__first, __middle, *__m2, __comp, _CUDA_VSTD::identity());
+      __len11 = _Ops::distance(__first, __m1);
+    }
+    else
+    {
+      if (__len1 == 1)
+      {
+        // __len1 >= __len2 > 0, so __len2 == 1, and *__first > *__middle
+        _Ops::iter_swap(__first, __middle);
+        return;
+      }
+      // __len1 >= 2, __len2 >= 1
+      __len11 = __len1 / 2;
+      __m1    = __first;
+      _Ops::advance(__m1, __len11);
+      auto __proj = _CUDA_VSTD::identity();
+      __m2        = _CUDA_VSTD::__lower_bound<_AlgPolicy>(__middle, __last, *__m1, __comp, __proj);
+      __len21     = _Ops::distance(__middle, __m2);
+    }
+    difference_type __len12 = __len1 - __len11; // distance(__m1, __middle)
+    difference_type __len22 = __len2 - __len21; // distance(__m2, __last)
+    __middle                = _CUDA_VSTD::__rotate<_AlgPolicy>(__m1, __middle, __m2).first;
+    // recurse into the smaller merge and loop on the larger one
+    if (__len11 + __len21 < __len12 + __len22)
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy>(__first, __m1, __middle, __comp, __len11, __len21, __buff, __buff_size);
+      __first  = __middle;
+      __middle = __m2;
+      __len1   = __len12;
+      __len2   = __len22;
+    }
+    else
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy>(__middle, __m2, __last, __comp, __len12, __len22, __buff, __buff_size);
+      __last   = __middle;
+      __middle = __m1;
+      __len1   = __len11;
+      __len2   = __len21;
+    }
+  }
+}
+
+// Host code merges through a temporary buffer when one can be allocated. Device code merges without one, which keeps
+// per-thread merges off the device heap.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _BidirectionalIterator, class _Compare>
+_CCCL_API inline void __inplace_merge(
+  _BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last, _Compare&& __comp)
+{
+  using value_type      = typename iterator_traits<_BidirectionalIterator>::value_type;
+  using difference_type = typename iterator_traits<_BidirectionalIterator>::difference_type;
+
+  difference_type __len1 = _IterOps<_AlgPolicy>::distance(__first, __middle);
+  difference_type __len2 = _IterOps<_AlgPolicy>::distance(__middle, __last);
+  NV_IF_ELSE_TARGET(
+    NV_IS_HOST,
+    ({
+      difference_type __buf_size         = (_CUDA_VSTD::min) (__len1, __len2);
+      pair<value_type*, ptrdiff_t> __buf = _CUDA_VSTD::get_temporary_buffer<value_type>(__buf_size);
+      unique_ptr<value_type, __return_temporary_buffer> __h(__buf.first);
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy>(
+        __first, __middle, __last, __comp, __len1, __len2, __buf.first, __buf.second);
+    }),
+    ({
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy>(
+        __first, __middle, __last, __comp, __len1, __len2, static_cast<value_type*>(nullptr), 0);
+    }))
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _BidirectionalIterator, class _Compare>
+_CCCL_API inline void inplace_merge(
+  _BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last, _Compare __comp)
+{
+  _CUDA_VSTD::__inplace_merge<_ClassicAlgPolicy>(
+    _CUDA_VSTD::move(__first),
+    _CUDA_VSTD::move(__middle),
+    _CUDA_VSTD::move(__last),
+    static_cast<__comp_ref_type<_Compare>>(__comp));
+}
+
+template <class _BidirectionalIterator>
+_CCCL_API inline void
+inplace_merge(_BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last)
+{
+  _CUDA_VSTD::inplace_merge(_CUDA_VSTD::move(__first), _CUDA_VSTD::move(__middle), _CUDA_VSTD::move(__last), __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
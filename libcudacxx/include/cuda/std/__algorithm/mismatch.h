@@ -21,18 +21,41 @@
 #endif // no system header
 
 #include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/__type_traits/remove_cv.h>
 #include <cuda/std/__utility/pair.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+template <class _Tp, class _Up>
+[[nodiscard]] _CCCL_HOST_API inline pair<_Tp*, _Up*>
+__mismatch_vectorized(_Tp* __first1, _Up* __first2, ptrdiff_t __len) noexcept
+{
+  const size_t __pos = _CUDA_VSTD::__simd_mismatch<remove_cv_t<_Tp>>(__first1, __first2, static_cast<size_t>(__len));
+  return pair<_Tp*, _Up*>{__first1 + __pos, __first2 + __pos};
+}
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
 _CCCL_EXEC_CHECK_DISABLE
 template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
 [[nodiscard]] _CCCL_API constexpr pair<_InputIterator1, _InputIterator2>
 mismatch(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _BinaryPredicate __pred)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_equal_ranges_v<_InputIterator1, _InputIterator2, _BinaryPredicate>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _CUDA_VSTD::__mismatch_vectorized(__first1, __first2, __last1 - __first1);))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   for (; __first1 != __last1; ++__first1, (void) ++__first2)
   {
     if (!__pred(*__first1, *__first2))
@@ -59,6 +82,18 @@ template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
   _InputIterator2 __last2,
   _BinaryPredicate __pred)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_equal_ranges_v<_InputIterator1, _InputIterator2, _BinaryPredicate>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(
+        NV_IS_HOST,
+        (return _CUDA_VSTD::__mismatch_vectorized(
+                  __first1, __first2, (_CUDA_VSTD::min)(__last1 - __first1, __last2 - __first2));))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   for (; __first1 != __last1 && __first2 != __last2; ++__first1, (void) ++__first2)
   {
     if (!__pred(*__first1, *__first2))
@@ -0,0 +1,292 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+#define _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__utility/move.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_CCCL_API constexpr void
+__selection_sort(_BidirectionalIterator __first, _BidirectionalIterator __last, _Compare __comp)
+{
+  _BidirectionalIterator __lm1 = __last;
+  for (--__lm1; __first != __lm1; ++__first)
+  {
+    _BidirectionalIterator __i = __first;
+    for (_BidirectionalIterator __j = _IterOps<_AlgPolicy>::next(__first); __j != __last; ++__j)
+    {
+      if (__comp(*__j, *__i))
+      {
+        __i = __j;
+      }
+    }
+    if (__i != __first)
+    {
+      _IterOps<_AlgPolicy>::iter_swap(__first, __i);
+    }
+  }
+}
+
+// Moves __j down towards __i until it finds an element less than *__m, which then guards the unguarded partition.
+// Returns false if there is none.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr bool __nth_element_find_guard(
+  _RandomAccessIterator& __i, _RandomAccessIterator& __j, _RandomAccessIterator __m, _Compare __comp)
+{
+  while (true)
+  {
+    if (__i == --__j)
+    {
+      return false;
+    }
+    if (__comp(*__j, *__m))
+    {
+      return true;
+    }
+  }
+}
+
+// Quickselect with a median of three as the pivot, which only keeps partitioning the part holding __nth.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  constexpr difference_type __limit = 7;
+  while (true)
+  {
+    if (__nth == __last)
+    {
+      return;
+    }
+    difference_type __len = __last - __first;
+    switch (__len)
+    {
+      case 0:
+      case 1:
+        return;
+      case 2:
+        if (__comp(*--__last, *__first))
+        {
+          _Ops::iter_swap(__first, __last);
+        }
+        return;
+      case 3: {
+        _RandomAccessIterator __m = __first;
+        _CUDA_VSTD::__sort3_maybe_branchless<_AlgPolicy, _Compare>(__first, ++__m, --__last, __comp);
+        return;
+      }
+    }
+    if (__len <= __limit)
+    {
+      _CUDA_VSTD::__selection_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      return;
+    }
+    // __len > __limit >= 3
+    _RandomAccessIterator __m   = __first + __len / 2;
+    _RandomAccessIterator __lm1 = __last;
+    unsigned __n_swaps          = _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __m, --__lm1, __comp);
+    // *__m is the median. Partition into [__first, __m) < *__m <= [__m, __last), which keeps elements equal to *__m
+    // where they are.
+    _RandomAccessIterator __i = __first;
+    _RandomAccessIterator __j = __lm1;
+    // __j points past the range to test, and *__lm1 >= *__m. The upward scan is guarded by *__m, the downward one
+    // needs a guard first.
+    if (!__comp(*__i, *__m)) // *__first == *__m
+    {
+      if (_CUDA_VSTD::__nth_element_find_guard<_Compare>(__i, __j, __m, __comp))
+      {
+        _Ops::iter_swap(__i, __j);
+        ++__n_swaps;
+      }
+      else
+      {
+        // *__first == *__m <= every other element. Partition into [__first, __i) == *__first < [__i, __last) instead.
+        ++__i;
+        __j = __last;
+        if (!__comp(*__first, *--__j)) // *__first == *(__last - 1) does not guard the scan
+        {
+          while (true)
+          {
+            if (__i == __j)
+            {
+              return; // all the elements are equivalent
+            }
+            if (__comp(*__first, *__i))
+            {
+              _Ops::iter_swap(__i, __j);
+              ++__n_swaps;
+              ++__i;
+              break;
+            }
+            ++__i;
+          }
+        }
+        // [__first, __i) == *__first < [__j, __last), and __j == __last - 1
+        if (__i == __j)
+        {
+          return;
+        }
+        while (true)
+        {
+          while (!__comp(*__first, *__i))
+          {
+            ++__i;
+          }
+          while (__comp(*__first, *--__j))
+            ;
+          if (__i >= __j)
+          {
+            break;
+          }
+          _Ops::iter_swap(__i, __j);
+          ++__n_swaps;
+          ++__i;
+        }
+        // [__first, __i) == *__first < [__i, __last), and the first part is sorted
+        if (__nth < __i)
+        {
+          return;
+        }
+        __first = __i;
+        continue;
+      }
+    }
+    ++__i;
+    if (__i < __j)
+    {
+      // *(__i - 1) < *__m
+      while (true)
+      {
+        // *__m guards the upward scan
+        while (__comp(*__i, *__m))
+        {
+          ++__i;
+        }
+        // and an element less than *__m guards the downward one
+        while (!__comp(*--__j, *__m))
+          ;
+        if (__i >= __j)
+        {
+          break;
+        }
+        _Ops::iter_swap(__i, __j);
+        ++__n_swaps;
+        // __m != __j, but __m follows the pivot if it was just swapped
+        if (__m == __i)
+        {
+          __m = __j;
+        }
+        ++__i;
+      }
+    }
+    // [__first, __i) < *__m <= [__i, __last)
+    if (__i != __m && __comp(*__m, *__i))
+    {
+      _Ops::iter_swap(__i, __m);
+      ++__n_swaps;
+    }
+    // [__first, __i) < *__i <= [__i + 1, __last)
+    if (__nth == __i)
+    {
+      return;
+    }
+    if (__n_swaps == 0)
+    {
+      // the range was partitioned already, so the part holding __nth may be sorted already too
+      _RandomAccessIterator __begin = __nth < __i ? __first : __i;
+      _RandomAccessIterator __end   = __nth < __i ? __i : __last;
+      __j = __m = __begin;
+      while (true)
+      {
+        if (++__j == __end)
+        {
+          return;
+        }
+        if (__comp(*__j, *__m))
+        {
+          break;
+        }
+        __m = __j;
+      }
+    }
+    if (__nth < __i)
+    {
+      __last = __i;
+    }
+    else
+    {
+      __first = ++__i;
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr void __nth_element_impl(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare& __comp)
+{
+  if (__nth == __last)
+  {
+    return;
+  }
+  _CUDA_VSTD::__nth_element<_AlgPolicy, __comp_ref_type<_Compare>>(__first, __nth, __last, __comp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr void nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__nth_element_impl<_ClassicAlgPolicy>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__nth), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_CCCL_API constexpr void
+nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::nth_element(__first, __nth, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
@@ -21,6 +21,7 @@
 #endif // no system header
 
 #include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__functional/identity.h>
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__iterator/advance.h>
@@ -28,6 +29,8 @@
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__type_traits/add_lvalue_reference.h>
 #include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/__type_traits/remove_cv.h>
 #include <cuda/std/__utility/pair.h>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -145,6 +148,41 @@ template <class _BinaryPredicate, class _RandomAccessIterator1, class _RandomAcc
   }
 }
 
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+// Looks for the first element of the pattern a vector at a time and compares the rest of the pattern bytewise
+template <class _Tp, class _Up>
+[[nodiscard]] _CCCL_HOST_API inline _Tp*
+__search_vectorized(_Tp* __first1, _Tp* __last1, _Up* __first2, _Up* __last2) noexcept
+{
+  using _Vp              = remove_cv_t<_Tp>;
+  const ptrdiff_t __len2 = __last2 - __first2;
+  if (__len2 == 0)
+  {
+    return __first1;
+  }
+  if (__last1 - __first1 < __len2)
+  {
+    return __last1;
+  }
+  _Tp* const __s      = __last1 - (__len2 - 1); // Start of pattern match can't go beyond here
+  const _Vp __head    = *__first2;
+  const size_t __tail = static_cast<size_t>(__len2 - 1) * sizeof(_Vp);
+  while (true)
+  {
+    __first1 += _CUDA_VSTD::__simd_find<_Vp>(__first1, __s, __head) - __first1;
+    if (__first1 == __s)
+    {
+      return __last1;
+    }
+    if (__builtin_memcmp(__first1 + 1, __first2 + 1, __tail) == 0)
+    {
+      return __first1;
+    }
+    ++__first1;
+  }
+}
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
 [[nodiscard]] _CCCL_API constexpr _ForwardIterator1
 search(_ForwardIterator1 __first1,
@@ -153,6 +191,15 @@ search(_ForwardIterator1 __first1,
        _ForwardIterator2 __last2,
        _BinaryPredicate __pred)
 {
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  if constexpr (__is_simd_equal_ranges_v<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>)
+  {
+    if (!_CUDA_VSTD::__cccl_default_is_constant_evaluated())
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return _CUDA_VSTD::__search_vectorized(__first1, __last1, __first2, __last2);))
+    }
+  }
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   return _CUDA_VSTD::__search<add_lvalue_reference_t<_BinaryPredicate>>(
            __first1,
            __last1,
@@ -0,0 +1,337 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_SIMD_UTILS_H
+#define _LIBCUDACXX___ALGORITHM_SIMD_UTILS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// On the host, find, count, mismatch, equal and search compare contiguous ranges of integers a vector at a time with
+// the vector extensions of GCC and clang, which become SSE2 or AVX2 on x86-64 and NEON on AArch64. Define
+// _LIBCUDACXX_NO_HOST_SIMD_ALGORITHMS to always use the element loops.
+#if !_CCCL_COMPILER(NVRTC) && !_CCCL_COMPILER(MSVC) && !_CCCL_COMPILER(NVHPC) \
+  && (_CCCL_ARCH(X86_64) || _CCCL_ARCH(ARM64)) && !defined(_LIBCUDACXX_NO_HOST_SIMD_ALGORITHMS)
+#  define _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+#endif // !NVRTC && !MSVC && !NVHPC && (X86_64 || ARM64) && !_LIBCUDACXX_NO_HOST_SIMD_ALGORITHMS
+
+#if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+
+#  include <cuda/std/__algorithm/comp.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__functional/operations.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/is_volatile.h>
+#  include <cuda/std/__type_traits/make_nbit_int.h>
+#  include <cuda/std/__type_traits/remove_const.h>
+#  include <cuda/std/__type_traits/remove_cvref.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstdint>
+
+#  if _CCCL_ARCH(X86_64)
+#    include <immintrin.h>
+#  endif // _CCCL_ARCH(X86_64)
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Integers have no padding bits, so two of them are equal exactly when their object representations are.
+template <class _Tp>
+inline constexpr bool __is_simd_comparable_v =
+  _CCCL_TRAIT(is_integral, _Tp) && !_CCCL_TRAIT(is_same, _Tp, bool) && sizeof(_Tp) <= sizeof(uint64_t);
+
+template <class _Iter>
+inline constexpr bool __is_simd_pointer_v = false;
+
+template <class _Tp>
+inline constexpr bool __is_simd_pointer_v<_Tp*> =
+  !_CCCL_TRAIT(is_volatile, _Tp) && __is_simd_comparable_v<remove_const_t<_Tp>>;
+
+// Whether _Pred compares two _Tp with their operator==
+template <class _Pred, class _Tp>
+inline constexpr bool __is_simd_equal_predicate_v =
+  _CCCL_TRAIT(is_same, _Pred, __equal_to) || _CCCL_TRAIT(is_same, _Pred, equal_to<_Tp>)
+  || _CCCL_TRAIT(is_same, _Pred, equal_to<void>);
+
+// Whether the ranges of _Iter1 and _Iter2 can be compared a vector at a time when _Pred is used to compare elements
+template <class _Iter1, class _Iter2, class _Pred>
+inline constexpr bool __is_simd_equal_ranges_v = false;
+
+template <class _Tp, class _Up, class _Pred>
+inline constexpr bool __is_simd_equal_ranges_v<_Tp*, _Up*, _Pred> =
+  __is_simd_pointer_v<_Tp*> && _CCCL_TRAIT(is_same, remove_const_t<_Tp>, remove_const_t<_Up>)
+  && __is_simd_equal_predicate_v<remove_cvref_t<_Pred>, remove_const_t<_Tp>>;
+
+#  if defined(__AVX2__)
+inline constexpr size_t __simd_vector_bytes = 32;
+#  else // ^^^ __AVX2__ ^^^ / vvv !__AVX2__ vvv
+inline constexpr size_t __simd_vector_bytes = 16;
+#  endif // ^^^ !__AVX2__ ^^^
+
+// Elements are compared as unsigned lanes of the same width, which is all equality needs
+template <class _Tp>
+struct __simd_vector
+{
+  using __lane_t = __make_nbit_uint_t<sizeof(_Tp) * CHAR_BIT>;
+  typedef __lane_t __type __attribute__((__vector_size__(__simd_vector_bytes)));
+
+  static constexpr size_t __size = __simd_vector_bytes / sizeof(_Tp);
+};
+
+template <class _Tp>
+using __simd_vector_t = typename __simd_vector<_Tp>::__type;
+
+template <class _Tp>
+_CCCL_HOST_API inline __simd_vector_t<_Tp> __simd_load(const _Tp* __ptr) noexcept
+{
+  __simd_vector_t<_Tp> __vec;
+  __builtin_memcpy(&__vec, __ptr, sizeof(__vec));
+  return __vec;
+}
+
+template <class _Tp>
+_CCCL_HOST_API inline __simd_vector_t<_Tp> __simd_broadcast(_Tp __value) noexcept
+{
+  return __simd_vector_t<_Tp>{} + static_cast<typename __simd_vector<_Tp>::__lane_t>(__value);
+}
+
+// The result of comparing two vectors, whose lanes are either all ones or all zeros
+template <class _Tp>
+_CCCL_HOST_API inline __simd_vector_t<_Tp> __simd_equal(__simd_vector_t<_Tp> __lhs, __simd_vector_t<_Tp> __rhs) noexcept
+{
+  return reinterpret_cast<__simd_vector_t<_Tp>>(__lhs == __rhs);
+}
+
+template <class _Tp>
+_CCCL_HOST_API inline __simd_vector_t<_Tp>
+__simd_not_equal(__simd_vector_t<_Tp> __lhs, __simd_vector_t<_Tp> __rhs) noexcept
+{
+  return reinterpret_cast<__simd_vector_t<_Tp>>(__lhs != __rhs);
+}
+
+#  if _CCCL_ARCH(X86_64)
+
+// One bit per byte of __mask
+template <class _Tp>
+_CCCL_HOST_API inline uint32_t __simd_movemask(__simd_vector_t<_Tp> __mask) noexcept
+{
+#    if defined(__AVX2__)
+  return static_cast<uint32_t>(_mm256_movemask_epi8(reinterpret_cast<__m256i>(__mask)));
+#    else // ^^^ __AVX2__ ^^^ / vvv !__AVX2__ vvv
+  return static_cast<uint32_t>(_mm_movemask_epi8(reinterpret_cast<__m128i>(__mask)));
+#    endif // ^^^ !__AVX2__ ^^^
+}
+
+template <class _Tp>
+_CCCL_HOST_API inline bool __simd_any(__simd_vector_t<_Tp> __mask) noexcept
+{
+  return _CUDA_VSTD::__simd_movemask<_Tp>(__mask) != 0;
+}
+
+// Returns the first lane of __mask that is set, or __simd_vector<_Tp>::__size if there is none
+template <class _Tp>
+_CCCL_HOST_API inline size_t __simd_find_first_set(__simd_vector_t<_Tp> __mask) noexcept
+{
+  const uint32_t __bits = _CUDA_VSTD::__simd_movemask<_Tp>(__mask);
+  return __bits == 0 ? __simd_vector<_Tp>::__size : static_cast<size_t>(__builtin_ctz(__bits)) / sizeof(_Tp);
+}
+
+#  else // ^^^ _CCCL_ARCH(X86_64) ^^^ / vvv !_CCCL_ARCH(X86_64) vvv
+
+template <class _Tp>
+_CCCL_HOST_API inline bool __simd_any(__simd_vector_t<_Tp> __mask) noexcept
+{
+  uint64_t __words[__simd_vector_bytes / sizeof(uint64_t)];
+  __builtin_memcpy(__words, &__mask, sizeof(__mask));
+  uint64_t __any = 0;
+  for (const uint64_t __word : __words)
+  {
+    __any |= __word;
+  }
+  return __any != 0;
+}
+
+template <class _Tp>
+_CCCL_HOST_API inline size_t __simd_find_first_set(__simd_vector_t<_Tp> __mask) noexcept
+{
+  uint64_t __words[__simd_vector_bytes / sizeof(uint64_t)];
+  __builtin_memcpy(__words, &__mask, sizeof(__mask));
+  for (size_t __i = 0; __i < __simd_vector_bytes / sizeof(uint64_t); ++__i)
+  {
+    if (__words[__i] != 0)
+    {
+      return (__i * 64 + static_cast<size_t>(__builtin_ctzll(__words[__i]))) / (sizeof(_Tp) * CHAR_BIT);
+    }
+  }
+  return __simd_vector<_Tp>::__size;
+}
+
+#  endif // ^^^ !_CCCL_ARCH(X86_64) ^^^
+
+// Returns the first element of [__first, __last) that equals __value, or __last
+template <class _Tp>
+_CCCL_HOST_API inline const _Tp* __simd_find(const _Tp* __first, const _Tp* __last, _Tp __value) noexcept
+{
+  constexpr ptrdiff_t __n = __simd_vector<_Tp>::__size;
+  const auto __needle     = _CUDA_VSTD::__simd_broadcast(__value);
+  // Test four vectors at once, so that moving the masks out of the vector registers is amortized
+  for (; __last - __first >= 4 * __n; __first += 4 * __n)
+  {
+    const auto __m0 = _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first), __needle);
+    const auto __m1 = _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + __n), __needle);
+    const auto __m2 = _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + 2 * __n), __needle);
+    const auto __m3 = _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + 3 * __n), __needle);
+    if (_CUDA_VSTD::__simd_any<_Tp>(__m0 | __m1 | __m2 | __m3))
+    {
+      const __simd_vector_t<_Tp> __masks[] = {__m0, __m1, __m2, __m3};
+      for (const auto& __mask : __masks)
+      {
+        const size_t __i = _CUDA_VSTD::__simd_find_first_set<_Tp>(__mask);
+        if (__i != __n)
+        {
+          return __first + __i;
+        }
+        __first += __n;
+      }
+    }
+  }
+  for (; __last - __first >= __n; __first += __n)
+  {
+    const size_t __i =
+      _CUDA_VSTD::__simd_find_first_set<_Tp>(_CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first), __needle));
+    if (__i != __n)
+    {
+      return __first + __i;
+    }
+  }
+  for (; __first != __last; ++__first)
+  {
+    if (*__first == __value)
+    {
+      break;
+    }
+  }
+  return __first;
+}
+
+// Returns the number of elements of [__first, __last) that equal __value
+template <class _Tp>
+_CCCL_HOST_API inline ptrdiff_t __simd_count(const _Tp* __first, const _Tp* __last, _Tp __value) noexcept
+{
+  using __lane_t          = typename __simd_vector<_Tp>::__lane_t;
+  constexpr ptrdiff_t __n = __simd_vector<_Tp>::__size;
+  // Every lane of the accumulator counts up to 4 matches per step and 252 in total, so that even bytes do not overflow
+  constexpr ptrdiff_t __max_steps = 63;
+
+  const auto __needle = _CUDA_VSTD::__simd_broadcast(__value);
+  ptrdiff_t __result  = 0;
+  while (__last - __first >= __n)
+  {
+    __simd_vector_t<_Tp> __counts{};
+    const ptrdiff_t __steps = (_CUDA_VSTD::min)((__last - __first) / (4 * __n), __max_steps);
+    for (ptrdiff_t __i = 0; __i < __steps; ++__i, __first += 4 * __n)
+    {
+      // the matching lanes are all ones, that is minus one
+      __counts -= _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first), __needle)
+                + _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + __n), __needle)
+                + _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + 2 * __n), __needle)
+                + _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first + 3 * __n), __needle);
+    }
+    if (__steps < __max_steps)
+    {
+      // at most three vectors are left
+      for (; __last - __first >= __n; __first += __n)
+      {
+        __counts -= _CUDA_VSTD::__simd_equal<_Tp>(_CUDA_VSTD::__simd_load(__first), __needle);
+      }
+    }
+    __lane_t __lanes[__n];
+    __builtin_memcpy(__lanes, &__counts, sizeof(__counts));
+    for (const __lane_t __lane : __lanes)
+    {
+      __result += static_cast<ptrdiff_t>(__lane);
+    }
+  }
+  for (; __first != __last; ++__first)
+  {
+    if (*__first == __value)
+    {
+      ++__result;
+    }
+  }
+  return __result;
+}
+
+// Returns the first position at which [__first1, __first1 + __len) and [__first2, __first2 + __len) differ, or __len
+template <class _Tp>
+_CCCL_HOST_API inline size_t __simd_mismatch(const _Tp* __first1, const _Tp* __first2, size_t __len) noexcept
+{
+  constexpr size_t __n = __simd_vector<_Tp>::__size;
+  size_t __pos         = 0;
+  for (; __len - __pos >= 4 * __n; __pos += 4 * __n)
+  {
+    const auto __m0 = _CUDA_VSTD::__simd_not_equal<_Tp>(
+      _CUDA_VSTD::__simd_load(__first1 + __pos), _CUDA_VSTD::__simd_load(__first2 + __pos));
+    const auto __m1 = _CUDA_VSTD::__simd_not_equal<_Tp>(
+      _CUDA_VSTD::__simd_load(__first1 + __pos + __n), _CUDA_VSTD::__simd_load(__first2 + __pos + __n));
+    const auto __m2 = _CUDA_VSTD::__simd_not_equal<_Tp>(
+      _CUDA_VSTD::__simd_load(__first1 + __pos + 2 * __n), _CUDA_VSTD::__simd_load(__first2 + __pos + 2 * __n));
+    const auto __m3 = _CUDA_VSTD::__simd_not_equal<_Tp>(
+      _CUDA_VSTD::__simd_load(__first1 + __pos + 3 * __n), _CUDA_VSTD::__simd_load(__first2 + __pos + 3 * __n));
+    if (_CUDA_VSTD::__simd_any<_Tp>(__m0 | __m1 | __m2 | __m3))
+    {
+      const __simd_vector_t<_Tp> __masks[] = {__m0, __m1, __m2, __m3};
+      for (const auto& __mask : __masks)
+      {
+        const size_t __i = _CUDA_VSTD::__simd_find_first_set<_Tp>(__mask);
+        if (__i != __n)
+        {
+          return __pos + __i;
+        }
+        __pos += __n;
+      }
+    }
+  }
+  for (; __len - __pos >= __n; __pos += __n)
+  {
+    const size_t __i = _CUDA_VSTD::__simd_find_first_set<_Tp>(_CUDA_VSTD::__simd_not_equal<_Tp>(
+      _CUDA_VSTD::__simd_load(__first1 + __pos), _CUDA_VSTD::__simd_load(__first2 + __pos)));
+    if (__i != __n)
+    {
+      return __pos + __i;
+    }
+  }
+  for (; __pos != __len; ++__pos)
+  {
+    if (__first1[__pos] != __first2[__pos])
+    {
+      break;
+    }
+  }
+  return __pos;
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
+
+#endif // _LIBCUDACXX___ALGORITHM_SIMD_UTILS_H
@@ -0,0 +1,870 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_SORT_H
+#define _LIBCUDACXX___ALGORITHM_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Comparators which are known to compare arithmetic values without side effects, so that the small sorting networks
+// and the partition can select instead of branching on their results.
+template <class _Compare>
+struct __is_simple_comparator : false_type
+{};
+
+template <>
+struct __is_simple_comparator<__less> : true_type
+{};
+
+template <class _Tp>
+struct __is_simple_comparator<less<_Tp>> : true_type
+{};
+
+template <class _Tp>
+struct __is_simple_comparator<greater<_Tp>> : true_type
+{};
+
+template <class _Compare, class _Iter, class _Tp = typename iterator_traits<_Iter>::value_type>
+using __use_branchless_sort =
+  integral_constant<bool,
+                    __is_cpp17_contiguous_iterator<_Iter>::value && sizeof(_Tp) <= sizeof(void*)
+                      && _CCCL_TRAIT(is_arithmetic, _Tp) && __is_simple_comparator<remove_cvref_t<_Compare>>::value>;
+
+// Sorts *__x, *__y and *__z, and returns the number of swaps it took. Stable, 2-3 compares, 0-2 swaps.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _ForwardIterator>
+_CCCL_API constexpr unsigned __sort3(_ForwardIterator __x, _ForwardIterator __y, _ForwardIterator __z, _Compare __c)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  if (!__c(*__y, *__x)) // x <= y
+  {
+    if (!__c(*__z, *__y)) // y <= z
+    {
+      return 0;
+    }
+    _Ops::iter_swap(__y, __z); // x <= z && y < z
+    if (__c(*__y, *__x))
+    {
+      _Ops::iter_swap(__x, __y);
+      return 2;
+    }
+    return 1;
+  }
+  if (__c(*__z, *__y)) // x > y && y > z
+  {
+    _Ops::iter_swap(__x, __z);
+    return 1;
+  }
+  _Ops::iter_swap(__x, __y); // x > y && y <= z
+  if (__c(*__z, *__y))
+  {
+    _Ops::iter_swap(__y, __z);
+    return 2;
+  }
+  return 1;
+}
+
+// Stable, 3-6 compares, 0-5 swaps
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _ForwardIterator>
+_CCCL_API constexpr void
+__sort4(_ForwardIterator __x1, _ForwardIterator __x2, _ForwardIterator __x3, _ForwardIterator __x4, _Compare __c)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__x1, __x2, __x3, __c);
+  if (__c(*__x4, *__x3))
+  {
+    _Ops::iter_swap(__x3, __x4);
+    if (__c(*__x3, *__x2))
+    {
+      _Ops::iter_swap(__x2, __x3);
+      if (__c(*__x2, *__x1))
+      {
+        _Ops::iter_swap(__x1, __x2);
+      }
+    }
+  }
+}
+
+// Stable, 4-10 compares, 0-9 swaps
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _ForwardIterator>
+_CCCL_API constexpr void __sort5(
+  _ForwardIterator __x1,
+  _ForwardIterator __x2,
+  _ForwardIterator __x3,
+  _ForwardIterator __x4,
+  _ForwardIterator __x5,
+  _Compare __c)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  _CUDA_VSTD::__sort4<_AlgPolicy, _Compare>(__x1, __x2, __x3, __x4, __c);
+  if (__c(*__x5, *__x4))
+  {
+    _Ops::iter_swap(__x4, __x5);
+    if (__c(*__x4, *__x3))
+    {
+      _Ops::iter_swap(__x3, __x4);
+      if (__c(*__x3, *__x2))
+      {
+        _Ops::iter_swap(__x2, __x3);
+        if (__c(*__x2, *__x1))
+        {
+          _Ops::iter_swap(__x1, __x2);
+        }
+      }
+    }
+  }
+}
+
+// Orders *__x and *__y with selects instead of a branch on the result of the comparison.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __cond_swap(_RandomAccessIterator __x, _RandomAccessIterator __y, _Compare __c)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  bool __r         = __c(*__x, *__y);
+  value_type __tmp = __r ? *__x : *__y;
+  *__y             = __r ? *__y : *__x;
+  *__x             = __tmp;
+}
+
+// Orders *__x, *__y and *__z without branches, given that *__y and *__z are ordered already.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __partially_sorted_swap(
+  _RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __c)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  bool __r         = __c(*__z, *__x);
+  value_type __tmp = __r ? *__z : *__x;
+  *__z             = __r ? *__x : *__z;
+  __r              = __c(__tmp, *__y);
+  *__x             = __r ? *__x : *__y;
+  *__y             = __r ? *__y : __tmp;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __sort3_maybe_branchless(
+  _RandomAccessIterator __x1, _RandomAccessIterator __x2, _RandomAccessIterator __x3, _Compare __c)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x3, __c);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x1, __x2, __x3, __c);
+  }
+  else
+  {
+    (void) _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__x1, __x2, __x3, __c);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __sort4_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _Compare __c)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x3, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x4, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x3, __x4, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x3, __c);
+  }
+  else
+  {
+    _CUDA_VSTD::__sort4<_AlgPolicy, _Compare>(__x1, __x2, __x3, __x4, __c);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void __sort5_maybe_branchless(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _RandomAccessIterator __x5,
+  _Compare __c)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x4, __x5, __c);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x3, __x4, __x5, __c);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x5, __c);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x1, __x3, __x4, __c);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x2, __x3, __x4, __c);
+  }
+  else
+  {
+    _CUDA_VSTD::__sort5<_AlgPolicy, _Compare>(__x1, __x2, __x3, __x4, __x5, __c);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_CCCL_API constexpr void
+__insertion_sort(_BidirectionalIterator __first, _BidirectionalIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_BidirectionalIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+  _BidirectionalIterator __i = __first;
+  for (++__i; __i != __last; ++__i)
+  {
+    _BidirectionalIterator __j = __i;
+    --__j;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _BidirectionalIterator __k = __j;
+      __j                        = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Insertion sort of a range which is not the leftmost part of the whole sequence, so that *(__first - 1) is known to
+// be no greater than any element of the range, and stops the inner loop without a bounds check.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr void
+__insertion_sort_unguarded(_RandomAccessIterator const __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  if (__first == __last)
+  {
+    return;
+  }
+  for (_RandomAccessIterator __i = __first + difference_type(1); __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - difference_type(1);
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Sorts the range if it takes few moves, and otherwise gives up after 8 of them. Returns whether the range is sorted.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_CCCL_API constexpr bool
+__insertion_sort_incomplete(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  switch (__last - __first)
+  {
+    case 0:
+    case 1:
+      return true;
+    case 2:
+      if (__comp(*--__last, *__first))
+      {
+        _Ops::iter_swap(__first, __last);
+      }
+      return true;
+    case 3:
+      _CUDA_VSTD::__sort3_maybe_branchless<_AlgPolicy, _Compare>(
+        __first, __first + difference_type(1), --__last, __comp);
+      return true;
+    case 4:
+      _CUDA_VSTD::__sort4_maybe_branchless<_AlgPolicy, _Compare>(
+        __first, __first + difference_type(1), __first + difference_type(2), --__last, __comp);
+      return true;
+    case 5:
+      _CUDA_VSTD::__sort5_maybe_branchless<_AlgPolicy, _Compare>(
+        __first,
+        __first + difference_type(1),
+        __first + difference_type(2),
+        __first + difference_type(3),
+        --__last,
+        __comp);
+      return true;
+  }
+  _RandomAccessIterator __j = __first + difference_type(2);
+  _CUDA_VSTD::__sort3_maybe_branchless<_AlgPolicy, _Compare>(__first, __first + difference_type(1), __j, __comp);
+  constexpr unsigned __limit = 8;
+  unsigned __count           = 0;
+  for (_RandomAccessIterator __i = __j + difference_type(1); __i != __last; ++__i)
+  {
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+      if (++__count == __limit)
+      {
+        return ++__i == __last;
+      }
+    }
+    __j = __i;
+  }
+  return true;
+}
+
+// The bitset partition compares a block of elements on each side against the pivot into a bitset, and then swaps the
+// elements which are on the wrong side in pairs, so that the comparisons do not feed branches.
+inline constexpr int __sort_block_size = sizeof(uint64_t) * 8;
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator>
+_CCCL_API constexpr void __swap_bitmap_pos(
+  _RandomAccessIterator __first, _RandomAccessIterator __last, uint64_t& __left_bitset, uint64_t& __right_bitset)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  // swap one pair per iteration as long as both bitsets have an element left
+  while (__left_bitset != 0 && __right_bitset != 0)
+  {
+    difference_type __tz_left = _CUDA_VSTD::countr_zero(__left_bitset);
+    __left_bitset &= __left_bitset - 1;
+    difference_type __tz_right = _CUDA_VSTD::countr_zero(__right_bitset);
+    __right_bitset &= __right_bitset - 1;
+    _Ops::iter_swap(__first + __tz_left, __last - __tz_right);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator, class _ValueType>
+_CCCL_API constexpr void __populate_left_bitset(
+  _RandomAccessIterator __first, _Compare __comp, _ValueType& __pivot, uint64_t& __left_bitset)
+{
+  // The loop vectorizes when the target has the instructions for it
+  _RandomAccessIterator __iter = __first;
+  for (int __j = 0; __j < __sort_block_size; ++__j, ++__iter)
+  {
+    bool __comp_result = !__comp(*__iter, __pivot);
+    __left_bitset |= (static_cast<uint64_t>(__comp_result) << __j);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator, class _ValueType>
+_CCCL_API constexpr void __populate_right_bitset(
+  _RandomAccessIterator __lm1, _Compare __comp, _ValueType& __pivot, uint64_t& __right_bitset)
+{
+  _RandomAccessIterator __iter = __lm1;
+  for (int __j = 0; __j < __sort_block_size; ++__j, --__iter)
+  {
+    bool __comp_result = __comp(*__iter, __pivot);
+    __right_bitset |= (static_cast<uint64_t>(__comp_result) << __j);
+  }
+}
+
+// Partitions the less than two blocks which are left in [__first, __lm1].
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _ValueType>
+_CCCL_API constexpr void __bitset_partition_partial_blocks(
+  _RandomAccessIterator& __first,
+  _RandomAccessIterator& __lm1,
+  _Compare __comp,
+  _ValueType& __pivot,
+  uint64_t& __left_bitset,
+  uint64_t& __right_bitset)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  difference_type __remaining_len = __lm1 - __first + 1;
+  difference_type __l_size = 0;
+  difference_type __r_size = 0;
+  if (__left_bitset == 0 && __right_bitset == 0)
+  {
+    __l_size = __remaining_len / 2;
+    __r_size = __remaining_len - __l_size;
+  }
+  else if (__left_bitset == 0)
+  {
+    // at least one side is a full block
+    __l_size = __remaining_len - __sort_block_size;
+    __r_size = __sort_block_size;
+  }
+  else
+  {
+    __l_size = __sort_block_size;
+    __r_size = __remaining_len - __sort_block_size;
+  }
+  if (__left_bitset == 0)
+  {
+    _RandomAccessIterator __iter = __first;
+    for (int __j = 0; __j < __l_size; ++__j, ++__iter)
+    {
+      bool __comp_result = !__comp(*__iter, __pivot);
+      __left_bitset |= (static_cast<uint64_t>(__comp_result) << __j);
+    }
+  }
+  if (__right_bitset == 0)
+  {
+    _RandomAccessIterator __iter = __lm1;
+    for (int __j = 0; __j < __r_size; ++__j, --__iter)
+    {
+      bool __comp_result = __comp(*__iter, __pivot);
+      __right_bitset |= (static_cast<uint64_t>(__comp_result) << __j);
+    }
+  }
+  _CUDA_VSTD::__swap_bitmap_pos<_AlgPolicy, _RandomAccessIterator>(__first, __lm1, __left_bitset, __right_bitset);
+  __first += (__left_bitset == 0) ? __l_size : 0;
+  __lm1 -= (__right_bitset == 0) ? __r_size : 0;
+}
+
+// Moves the elements left in the one non-empty bitset to the other end of its block.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator>
+_CCCL_API constexpr void __swap_bitmap_pos_within(
+  _RandomAccessIterator& __first, _RandomAccessIterator& __lm1, uint64_t& __left_bitset, uint64_t& __right_bitset)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  // the set positions are visited from the highest to the lowest
+  if (__left_bitset)
+  {
+    while (__left_bitset != 0)
+    {
+      difference_type __tz_left = __sort_block_size - 1 - _CUDA_VSTD::countl_zero(__left_bitset);
+      __left_bitset &= (static_cast<uint64_t>(1) << __tz_left) - 1;
+      _RandomAccessIterator __it = __first + __tz_left;
+      if (__it != __lm1)
+      {
+        _Ops::iter_swap(__it, __lm1);
+      }
+      --__lm1;
+    }
+    __first = __lm1 + difference_type(1);
+  }
+  else if (__right_bitset)
+  {
+    while (__right_bitset != 0)
+    {
+      difference_type __tz_right = __sort_block_size - 1 - _CUDA_VSTD::countl_zero(__right_bitset);
+      __right_bitset &= (static_cast<uint64_t>(1) << __tz_right) - 1;
+      _RandomAccessIterator __it = __lm1 - __tz_right;
+      if (__it != __first)
+      {
+        _Ops::iter_swap(__it, __first);
+      }
+      ++__first;
+    }
+  }
+}
+
+// Partitions [__first, __last) around the pivot *__first into [__first, __pivot_pos) < *__pivot_pos and
+// *__pivot_pos <= [__pivot_pos + 1, __last), and returns __pivot_pos and whether the range was partitioned already.
+// A median-of-three has to have been moved to *__first, so that the element greater than it guards the scans.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr pair<_RandomAccessIterator, bool>
+__bitset_partition(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  // the first element greater than or equal to the pivot
+  while (__comp(*++__first, __pivot))
+    ;
+  // the last element less than the pivot
+  if (__begin == __first - difference_type(1))
+  {
+    while (__first < __last && !__comp(*--__last, __pivot))
+      ;
+  }
+  else
+  {
+    while (!__comp(*--__last, __pivot))
+      ;
+  }
+
+  // nothing to swap if the scans crossed
+  bool __already_partitioned = __first >= __last;
+  if (!__already_partitioned)
+  {
+    _Ops::iter_swap(__first, __last);
+    ++__first;
+  }
+
+  // from here on [__first, __lm1] is the range left to partition
+  _RandomAccessIterator __lm1 = __last - difference_type(1);
+  uint64_t __left_bitset      = 0;
+  uint64_t __right_bitset     = 0;
+
+  while (__lm1 - __first >= 2 * __sort_block_size - 1)
+  {
+    if (__left_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_left_bitset<_Compare>(__first, __comp, __pivot, __left_bitset);
+    }
+    if (__right_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_right_bitset<_Compare>(__lm1, __comp, __pivot, __right_bitset);
+    }
+    _CUDA_VSTD::__swap_bitmap_pos<_AlgPolicy, _RandomAccessIterator>(__first, __lm1, __left_bitset, __right_bitset);
+    // a side moves on once all of its misplaced elements were swapped
+    __first += (__left_bitset == 0) ? difference_type(__sort_block_size) : difference_type(0);
+    __lm1 -= (__right_bitset == 0) ? difference_type(__sort_block_size) : difference_type(0);
+  }
+  _CUDA_VSTD::__bitset_partition_partial_blocks<_AlgPolicy, _Compare>(
+    __first, __lm1, __comp, __pivot, __left_bitset, __right_bitset);
+  _CUDA_VSTD::__swap_bitmap_pos_within<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// The same partition as __bitset_partition, with a branch per element.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr pair<_RandomAccessIterator, bool>
+__partition_with_equals_on_right(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  while (__comp(*++__first, __pivot))
+    ;
+  if (__begin == __first - difference_type(1))
+  {
+    while (__first < __last && !__comp(*--__last, __pivot))
+      ;
+  }
+  else
+  {
+    while (!__comp(*--__last, __pivot))
+      ;
+  }
+
+  bool __already_partitioned = __first >= __last;
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    while (__comp(*++__first, __pivot))
+      ;
+    while (!__comp(*--__last, __pivot))
+      ;
+  }
+
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// Partitions [__first, __last) into [__first, __pivot_pos] <= *__first < [__pivot_pos + 1, __last), and returns
+// __pivot_pos + 1. Used when the pivot equals the greatest element to the left of the range, so that the elements
+// equal to it need no further sorting.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr _RandomAccessIterator
+__partition_with_equals_on_left(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  if (__comp(__pivot, *(__last - difference_type(1))))
+  {
+    while (!__comp(__pivot, *++__first))
+      ;
+  }
+  else
+  {
+    while (++__first < __last && !__comp(__pivot, *__first))
+      ;
+  }
+  if (__first < __last)
+  {
+    while (__comp(__pivot, *--__last))
+      ;
+  }
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    while (!__comp(__pivot, *++__first))
+      ;
+    while (__comp(__pivot, *--__last))
+      ;
+  }
+
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return __first;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, bool _UseBitSetPartition, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr pair<_RandomAccessIterator, bool>
+__introsort_partition(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  if constexpr (_UseBitSetPartition)
+  {
+    return _CUDA_VSTD::__bitset_partition<_AlgPolicy>(__first, __last, __comp);
+  }
+  else
+  {
+    return _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy>(__first, __last, __comp);
+  }
+}
+
+// Introsort in the manner of pdqsort: sorting networks for up to 5 elements, insertion sort below 24, a median of
+// three or Tukey's ninther as the pivot, an early exit through insertion sort when a partition swapped nothing, and
+// heap sort once __depth partitions did not shrink the range enough.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, bool _UseBitSetPartition>
+_CCCL_API constexpr void __introsort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __depth,
+  bool __leftmost = true)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  constexpr difference_type __limit             = 24;
+  constexpr difference_type __ninther_threshold = 128;
+
+  while (true)
+  {
+    difference_type __len = __last - __first;
+    switch (__len)
+    {
+      case 0:
+      case 1:
+        return;
+      case 2:
+        if (__comp(*--__last, *__first))
+        {
+          _Ops::iter_swap(__first, __last);
+        }
+        return;
+      case 3:
+        _CUDA_VSTD::__sort3_maybe_branchless<_AlgPolicy, _Compare>(
+          __first, __first + difference_type(1), --__last, __comp);
+        return;
+      case 4:
+        _CUDA_VSTD::__sort4_maybe_branchless<_AlgPolicy, _Compare>(
+          __first, __first + difference_type(1), __first + difference_type(2), --__last, __comp);
+        return;
+      case 5:
+        _CUDA_VSTD::__sort5_maybe_branchless<_AlgPolicy, _Compare>(
+          __first,
+          __first + difference_type(1),
+          __first + difference_type(2),
+          __first + difference_type(3),
+          --__last,
+          __comp);
+        return;
+    }
+    if (__len < __limit)
+    {
+      if (__leftmost)
+      {
+        _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      else
+      {
+        _CUDA_VSTD::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      return;
+    }
+    if (__depth == 0)
+    {
+      (void) _CUDA_VSTD::__partial_sort<_AlgPolicy>(__first, __last, __last, __comp);
+      return;
+    }
+    --__depth;
+    {
+      difference_type __half_len = __len / 2;
+      if (__len > __ninther_threshold)
+      {
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + __half_len, __last - difference_type(1), __comp);
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+          __first + difference_type(1), __first + (__half_len - 1), __last - difference_type(2), __comp);
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+          __first + difference_type(2), __first + (__half_len + 1), __last - difference_type(3), __comp);
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+          __first + (__half_len - 1), __first + __half_len, __first + (__half_len + 1), __comp);
+        _Ops::iter_swap(__first, __first + __half_len);
+      }
+      else
+      {
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + __half_len, __first, __last - difference_type(1), __comp);
+      }
+    }
+    // The elements left of a range which is not the leftmost are sorted already and no greater than it. If the pivot
+    // equals the greatest of them, then so do all the elements which partition to its left, and they need no sorting.
+    if (!__leftmost && !__comp(*(__first - difference_type(1)), *__first))
+    {
+      __first = _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy>(__first, __last, __comp);
+      continue;
+    }
+    auto __ret = _CUDA_VSTD::__introsort_partition<_AlgPolicy, _UseBitSetPartition>(__first, __last, __comp);
+    _RandomAccessIterator __i = __ret.first;
+    // [__first, __i) < *__i <= [__i + 1, __last)
+    // a partition which swapped nothing hints that both sides are close to sorted
+    if (__ret.second)
+    {
+      bool __fs = _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__first, __i, __comp);
+      if (_CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__i + difference_type(1), __last, __comp))
+      {
+        if (__fs)
+        {
+          return;
+        }
+        __last = __i;
+        continue;
+      }
+      if (__fs)
+      {
+        __first = ++__i;
+        continue;
+      }
+    }
+    // recurse into the left part and loop on the right one
+    _CUDA_VSTD::__introsort<_AlgPolicy, _Compare, _RandomAccessIterator, _UseBitSetPartition>(
+      __first, __i, __comp, __depth, __leftmost);
+    __leftmost = false;
+    __first    = ++__i;
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr void __sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len = __last - __first;
+  if (__len <= 1)
+  {
+    return;
+  }
+  // twice the depth of a balanced partitioning
+  const difference_type __depth_limit =
+    2 * (_CUDA_VSTD::bit_width(static_cast<make_unsigned_t<difference_type>>(__len)) - 1);
+  _CUDA_VSTD::__introsort<_AlgPolicy,
+                          __comp_ref_type<_Compare>,
+                          _RandomAccessIterator,
+                          __use_branchless_sort<_Compare, _RandomAccessIterator>::value>(
+    __first, __last, __comp, __depth_limit);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RandomAccessIterator, class _Compare>
+_CCCL_API constexpr void sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__sort_impl<_ClassicAlgPolicy>(_CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_CCCL_API constexpr void sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_SORT_H
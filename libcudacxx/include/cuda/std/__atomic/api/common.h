@@ -27,7 +27,7 @@
 #define _LIBCUDACXX_ATOMIC_COMMON_IMPL(_CONST, _VOLATILE)                                                           \
   _CCCL_HOST_DEVICE inline bool is_lock_free() const _VOLATILE noexcept                                             \
   {                                                                                                                 \
-    return _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(sizeof(_Tp));                                                            \
+    return __atomic_is_lock_free_dispatch(sizeof(_Tp));                                                             \
   }                                                                                                                 \
   _CCCL_HOST_DEVICE inline void store(_Tp __d, memory_order __m = memory_order_seq_cst)                             \
     _CONST _VOLATILE noexcept _LIBCUDACXX_CHECK_STORE_MEMORY_ORDER(__m)                                             \
@@ -29,5 +29,6 @@
 
 // Host atomics
 #include <cuda/std/__atomic/functions/host.h>
+#include <cuda/std/__atomic/functions/host_128.h>
 
 #endif // __LIBCUDACXX___ATOMIC_FUNCTIONS_H
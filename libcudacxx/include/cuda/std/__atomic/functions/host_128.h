@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_FUNCTIONS_HOST_128_H
+#define _LIBCUDACXX___ATOMIC_FUNCTIONS_HOST_128_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Define LIBCUDACXX_ENABLE_HOST_ATOMIC_128 to make host threads operate on 16-byte atomics, which the compilers do not
+// make lock-free, without the embedded lock. On x86-64 processors whose vector moves are atomic, loads and stores are
+// aligned 16-byte vector moves, and the other operations retry cmpxchg16b. On AArch64 targets with the LSE atomics
+// (__ARM_FEATURE_ATOMICS, e.g. -march=armv8.1-a), all operations are built on casp. Device threads keep taking the
+// lock, so such an atomic must not be accessed by host and device threads concurrently.
+#if defined(LIBCUDACXX_ENABLE_HOST_ATOMIC_128) && !_CCCL_COMPILER(NVRTC) && !_CCCL_COMPILER(MSVC)
+#  if _CCCL_ARCH(X86_64) || (_CCCL_ARCH(ARM64) && defined(__ARM_FEATURE_ATOMICS))
+#    define _LIBCUDACXX_HAS_HOST_ATOMIC_128
+#  endif // _CCCL_ARCH(X86_64) || (_CCCL_ARCH(ARM64) && __ARM_FEATURE_ATOMICS)
+#endif // LIBCUDACXX_ENABLE_HOST_ATOMIC_128 && !_CCCL_COMPILER(NVRTC) && !_CCCL_COMPILER(MSVC)
+
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/cstdint>
+
+#  if _CCCL_ARCH(X86_64)
+#    include <cpuid.h>
+#    include <emmintrin.h>
+#  endif // _CCCL_ARCH(X86_64)
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+using __atomic_128_t = __uint128_t;
+
+#  if _CCCL_ARCH(X86_64)
+
+// Intel and AMD guarantee that aligned 16-byte vector loads and stores are atomic on processors with AVX, which all
+// have cmpxchg16b as well. Without that guarantee, a load would have to be a compare-and-swap, which writes to the
+// object, so the lock is used instead.
+_CCCL_HOST_API inline bool __atomic_128_detect_host_lock_free() noexcept
+{
+  unsigned __eax = 0, __ebx = 0, __ecx = 0, __edx = 0;
+  if (!::__get_cpuid(0, &__eax, &__ebx, &__ecx, &__edx))
+  {
+    return false;
+  }
+  bool const __intel_or_amd = __ebx == signature_INTEL_ebx || __ebx == signature_AMD_ebx;
+  if (!::__get_cpuid(1, &__eax, &__ebx, &__ecx, &__edx))
+  {
+    return false;
+  }
+  return __intel_or_amd && (__ecx & bit_AVX) != 0 && (__ecx & bit_CMPXCHG16B) != 0;
+}
+
+_CCCL_HOST_API inline bool __atomic_is_lock_free_128_host() noexcept
+{
+  static bool const __lock_free = __atomic_128_detect_host_lock_free();
+  return __lock_free;
+}
+
+// Replaces the 16 bytes at __a with __desired if they hold *__expected, and otherwise loads them into *__expected. The
+// compare-and-swap is a full barrier. __a must be aligned to 16 bytes.
+_CCCL_HOST_API inline bool
+__atomic_compare_exchange_128_host(void volatile* __a, __atomic_128_t* __expected, __atomic_128_t __desired) noexcept
+{
+  uint64_t __lo = static_cast<uint64_t>(*__expected);
+  uint64_t __hi = static_cast<uint64_t>(*__expected >> 64);
+  bool __ret;
+  __asm__ __volatile__("lock cmpxchg16b %1\n\tsete %0"
+                       : "=q"(__ret), "+m"(*static_cast<__atomic_128_t volatile*>(__a)), "+a"(__lo), "+d"(__hi)
+                       : "b"(static_cast<uint64_t>(__desired)), "c"(static_cast<uint64_t>(__desired >> 64))
+                       : "memory", "cc");
+  *__expected = (static_cast<__atomic_128_t>(__hi) << 64) | __lo;
+  return __ret;
+}
+
+// Loads are at least acquire and stores at least release on x86-64, so only seq_cst stores need a fence.
+_CCCL_HOST_API inline __atomic_128_t __atomic_load_128_host(void const volatile* __a) noexcept
+{
+  __m128i __v;
+  __asm__ __volatile__("movdqa %1, %0" : "=x"(__v) : "m"(*static_cast<__atomic_128_t const volatile*>(__a)) : "memory");
+  __atomic_128_t __ret;
+  __builtin_memcpy(&__ret, &__v, sizeof(__ret));
+  return __ret;
+}
+
+_CCCL_HOST_API inline void
+__atomic_store_128_host(void volatile* __a, __atomic_128_t __val, memory_order __order) noexcept
+{
+  __m128i __v;
+  __builtin_memcpy(&__v, &__val, sizeof(__v));
+  __asm__ __volatile__("movdqa %1, %0" : "=m"(*static_cast<__atomic_128_t volatile*>(__a)) : "x"(__v) : "memory");
+  if (__order == memory_order_seq_cst)
+  {
+    __asm__ __volatile__("mfence" ::: "memory");
+  }
+}
+
+#  else // ^^^ _CCCL_ARCH(X86_64) ^^^ / vvv _CCCL_ARCH(ARM64) vvv
+
+// The compiler was told that the target has casp, so there is nothing to detect.
+_CCCL_HOST_API inline bool __atomic_is_lock_free_128_host() noexcept
+{
+  return true;
+}
+
+// Replaces the 16 bytes at __a with __desired if they hold *__expected, and otherwise loads them into *__expected. The
+// compare-and-swap is sequentially consistent. __a must be aligned to 16 bytes.
+_CCCL_HOST_API inline bool
+__atomic_compare_exchange_128_host(void volatile* __a, __atomic_128_t* __expected, __atomic_128_t __desired) noexcept
+{
+  return __atomic_compare_exchange_n(
+    static_cast<__atomic_128_t volatile*>(__a), __expected, __desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+// AArch64 makes 16-byte loads single-copy atomic only from Armv8.4, so a load is a compare-and-swap. If it matches, it
+// writes back the value it found, so the atomic must not live in read-only memory.
+_CCCL_HOST_API inline __atomic_128_t __atomic_load_128_host(void const volatile* __a) noexcept
+{
+  __atomic_128_t __ret = 0;
+  __atomic_compare_exchange_128_host(const_cast<void volatile*>(__a), &__ret, 0);
+  return __ret;
+}
+
+_CCCL_HOST_API inline void
+__atomic_store_128_host(void volatile* __a, __atomic_128_t __val, memory_order /*__order*/) noexcept
+{
+  __atomic_128_t __expected = __atomic_load_128_host(__a);
+  while (!__atomic_compare_exchange_128_host(__a, &__expected, __val))
+  {
+  }
+}
+
+#  endif // _CCCL_ARCH(ARM64)
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
+
+#endif // _LIBCUDACXX___ATOMIC_FUNCTIONS_HOST_128_H
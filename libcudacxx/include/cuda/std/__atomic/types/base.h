@@ -66,6 +66,14 @@ struct __atomic_storage
   }
 };
 
+_CCCL_HOST_DEVICE inline bool __atomic_is_lock_free_dispatch(size_t __size) noexcept
+{
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  NV_IF_TARGET(NV_IS_HOST, (if (__size == sizeof(__atomic_128_t)) { return __atomic_is_lock_free_128_host(); }))
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
+  return _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__size);
+}
+
 _CCCL_HOST_DEVICE inline void __atomic_thread_fence_dispatch(memory_order __order)
 {
   NV_DISPATCH_TARGET(
@@ -21,6 +21,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__atomic/functions/host_128.h>
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
 #include <cuda/std/__atomic/types/base.h>
@@ -32,13 +33,21 @@
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 // Locked atomics must override the dispatch to be able to implement RMW primitives around the embedded lock.
+//
+// With LIBCUDACXX_ENABLE_HOST_ATOMIC_128, host threads operate on 16-byte types without the lock, which needs the value
+// to be aligned to 16 bytes. It is aligned on all platforms then, keeping the layout the same for host and device.
+// Otherwise the layout stays as it was, since the alignment changes the ABI of such atomics.
 template <typename _Tp>
 struct __atomic_locked_storage
 {
   using __underlying_t                = _Tp;
   static constexpr __atomic_tag __tag = __atomic_tag::__atomic_locked_tag;
 
+#if defined(LIBCUDACXX_ENABLE_HOST_ATOMIC_128)
+  alignas(sizeof(_Tp) == 16 ? 16 : alignof(_Tp)) _Tp __a_value;
+#else // ^^^ LIBCUDACXX_ENABLE_HOST_ATOMIC_128 ^^^ / vvv !LIBCUDACXX_ENABLE_HOST_ATOMIC_128 vvv
   _Tp __a_value;
+#endif // !LIBCUDACXX_ENABLE_HOST_ATOMIC_128
   mutable __atomic_storage<_LIBCUDACXX_ATOMIC_FLAG_TYPE> __a_lock;
 
   _CCCL_HIDE_FROM_ABI explicit constexpr __atomic_locked_storage() noexcept = default;
@@ -52,13 +61,21 @@ struct __atomic_locked_storage
   _CCCL_HOST_DEVICE inline void __lock(_Sco) const volatile noexcept
   {
     while (1 == __atomic_exchange_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    {
+      // waits for the lock to be released without writing to it
+      while (1 == __atomic_load_dispatch(&__a_lock, memory_order_relaxed, _Sco{}))
+        /*spin*/;
+    }
   }
   template <typename _Sco>
   _CCCL_HOST_DEVICE inline void __lock(_Sco) const noexcept
   {
     while (1 == __atomic_exchange_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    {
+      // waits for the lock to be released without writing to it
+      while (1 == __atomic_load_dispatch(&__a_lock, memory_order_relaxed, _Sco{}))
+        /*spin*/;
+    }
   }
   template <typename _Sco>
   _CCCL_HOST_DEVICE inline void __unlock(_Sco) const volatile noexcept
@@ -72,6 +89,80 @@ struct __atomic_locked_storage
   }
 };
 
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+
+template <typename _Tp>
+_CCCL_HOST_API inline __atomic_128_t __atomic_to_128_host(_Tp const& __val) noexcept
+{
+  static_assert(sizeof(_Tp) == sizeof(__atomic_128_t), "");
+  __atomic_128_t __ret;
+  _CUDA_VSTD::memcpy(&__ret, &__val, sizeof(__ret));
+  return __ret;
+}
+
+template <typename _Tp>
+_CCCL_HOST_API inline _Tp __atomic_from_128_host(__atomic_128_t __val) noexcept
+{
+  static_assert(sizeof(_Tp) == sizeof(__atomic_128_t), "");
+  _Tp __ret;
+  _CUDA_VSTD::memcpy(&__ret, &__val, sizeof(__ret));
+  return __ret;
+}
+
+template <typename _Tp, typename _Fn>
+_CCCL_HOST_API inline _Tp __atomic_locked_update_128_host(_Tp volatile* __a, _Fn& __fn) noexcept
+{
+  __atomic_128_t __expected = __atomic_load_128_host(__a);
+  while (!__atomic_compare_exchange_128_host(
+    __a, &__expected, __atomic_to_128_host(_Tp(__fn(__atomic_from_128_host<_Tp>(__expected))))))
+    ;
+  return __atomic_from_128_host<_Tp>(__expected);
+}
+
+// The locked compare-and-exchange compares values with ==, which may hold for different bytes, so the exchange is
+// retried with the bytes found as long as they compare equal to *__expected.
+template <typename _Tp, typename _Up>
+_CCCL_HOST_API inline bool __atomic_locked_compare_exchange_128_host(_Tp volatile* __a, _Up* __expected, _Up __value)
+{
+  __atomic_128_t __found         = __atomic_to_128_host<_Tp>(*__expected);
+  __atomic_128_t const __desired = __atomic_to_128_host<_Tp>(__value);
+  while (!__atomic_compare_exchange_128_host(__a, &__found, __desired))
+  {
+    _Tp const __current = __atomic_from_128_host<_Tp>(__found);
+    if (!(__current == *__expected))
+    {
+      *__expected = __current;
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
+
+// Replaces the value of a locked atomic with __fn(value), and returns the value it replaced.
+template <typename _Sto, typename _Fn, typename _Sco>
+_CCCL_HOST_DEVICE inline auto __atomic_locked_update(_Sto* __a, _Fn __fn, _Sco) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  if constexpr (sizeof(_Tp) == sizeof(__atomic_128_t))
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_is_lock_free_128_host()) {
+                   return __atomic_locked_update_128_host(&__a->__a_value, __fn);
+                 }))
+  }
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
+  _Tp __old;
+  __a->__lock(_Sco{});
+  __atomic_assign_volatile(&__old, __a->__a_value);
+  _Tp const __new = __fn(__old);
+  __atomic_assign_volatile(&__a->__a_value, __new);
+  __a->__unlock(_Sco{});
+  return __old;
+}
+
 template <typename _Sto, typename _Up, __atomic_storage_is_locked<_Sto> = 0>
 _CCCL_HOST_DEVICE inline void __atomic_init_dispatch(_Sto* __a, _Up __val)
 {
@@ -79,8 +170,21 @@ _CCCL_HOST_DEVICE inline void __atomic_init_dispatch(_Sto* __a, _Up __val)
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
-_CCCL_HOST_DEVICE inline void __atomic_store_dispatch(_Sto* __a, _Up __val, memory_order, _Sco = {})
+_CCCL_HOST_DEVICE inline void __atomic_store_dispatch(_Sto* __a, _Up __val, memory_order __order, _Sco = {})
 {
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  using _Tp = __atomic_underlying_t<_Sto>;
+  if constexpr (sizeof(_Tp) == sizeof(__atomic_128_t))
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_is_lock_free_128_host()) {
+                   __atomic_store_128_host(&__a->__a_value, __atomic_to_128_host<_Tp>(__val), __order);
+                   return;
+                 }))
+  }
+#else // ^^^ _LIBCUDACXX_HAS_HOST_ATOMIC_128 ^^^ / vvv !_LIBCUDACXX_HAS_HOST_ATOMIC_128 vvv
+  (void) __order;
+#endif // !_LIBCUDACXX_HAS_HOST_ATOMIC_128
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__a->__a_value, __val);
   __a->__unlock(_Sco{});
@@ -91,6 +195,15 @@ _CCCL_HOST_DEVICE inline auto __atomic_load_dispatch(const _Sto* __a, memory_ord
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  if constexpr (sizeof(_Tp) == sizeof(__atomic_128_t))
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_is_lock_free_128_host()) {
+                   return __atomic_from_128_host<_Tp>(__atomic_load_128_host(&__a->__a_value));
+                 }))
+  }
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
   _Tp __old;
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__old, __a->__a_value);
@@ -103,12 +216,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_exchange_dispatch(_Sto* __a, _Up __value,
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, __value);
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const&) {
+      return __value;
+    },
+    _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -116,6 +229,15 @@ _CCCL_HOST_DEVICE inline bool __atomic_compare_exchange_strong_dispatch(
   _Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
 {
   using _Tp = __atomic_underlying_t<_Sto>;
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  if constexpr (sizeof(_Tp) == sizeof(__atomic_128_t))
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_is_lock_free_128_host()) {
+                   return __atomic_locked_compare_exchange_128_host(&__a->__a_value, __expected, __value);
+                 }))
+  }
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
   _Tp __temp;
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__temp, __a->__a_value);
@@ -137,6 +259,15 @@ _CCCL_HOST_DEVICE inline bool
 __atomic_compare_exchange_weak_dispatch(_Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
 {
   using _Tp = __atomic_underlying_t<_Sto>;
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  if constexpr (sizeof(_Tp) == sizeof(__atomic_128_t))
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_is_lock_free_128_host()) {
+                   return __atomic_locked_compare_exchange_128_host(&__a->__a_value, __expected, __value);
+                 }))
+  }
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
   _Tp __temp;
   __a->__lock(_Sco{});
   __atomic_assign_volatile(&__temp, __a->__a_value);
@@ -158,12 +289,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_add_dispatch(_Sto* __a, _Up __delta
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old + __delta));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const& __old) {
+      return _Tp(__old + __delta);
+    },
+    _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -171,12 +302,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_sub_dispatch(_Sto* __a, _Up __delta
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old - __delta));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const& __old) {
+      return _Tp(__old - __delta);
+    },
+    _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -184,12 +315,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_and_dispatch(_Sto* __a, _Up __patte
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old & __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const& __old) {
+      return _Tp(__old & __pattern);
+    },
+    _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -197,12 +328,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_or_dispatch(_Sto* __a, _Up __patter
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old | __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const& __old) {
+      return _Tp(__old | __pattern);
+    },
+    _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -210,12 +341,12 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_xor_dispatch(_Sto* __a, _Up __patte
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old ^ __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(
+    __a,
+    [&](_Tp const& __old) {
+      return _Tp(__old ^ __pattern);
+    },
+    _Sco{});
 }
 
 _LIBCUDACXX_END_NAMESPACE_STD
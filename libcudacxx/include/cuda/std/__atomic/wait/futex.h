@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
+#define _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Host threads blocked in atomic wait sleep in the kernel on Linux, and are woken by notify_one and notify_all:
+// 32-bit words are waited on directly with a futex, and the waiters on other objects share the futex of an entry of a
+// table indexed by the address they wait on. Define _LIBCUDACXX_NO_FUTEX_WAIT to poll with backoff instead.
+#if _CCCL_OS(LINUX) && !_CCCL_COMPILER(NVRTC) && defined(_LIBCUDACXX_HAS_THREAD_API_PTHREAD) \
+  && !defined(_LIBCUDACXX_NO_FUTEX_WAIT)
+#  define _LIBCUDACXX_HAS_FUTEX_WAIT
+#endif // _CCCL_OS(LINUX) && !_CCCL_COMPILER(NVRTC) && _LIBCUDACXX_HAS_THREAD_API_PTHREAD && !_LIBCUDACXX_NO_FUTEX_WAIT
+
+#if defined(_LIBCUDACXX_HAS_FUTEX_WAIT)
+
+#  include <cuda/std/__atomic/functions/host.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <time.h>
+#  include <unistd.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// A waiter on a system scope object may be waiting for a write from a device, which cannot wake it, so it sleeps at
+// most this long before checking the object again.
+inline constexpr long __cccl_futex_system_scope_timeout_ns = 1'000'000;
+
+// The futex operations are not private to the process, so that objects in shared memory can be waited on and
+// notified from different processes.
+_CCCL_HOST_API inline void __cccl_futex_wait(int32_t const volatile* __addr, int32_t __expected, bool __timed) noexcept
+{
+  timespec __timeout{0, __cccl_futex_system_scope_timeout_ns};
+  // the wait returns early when the word no longer holds __expected, on a signal, or after the timeout
+  ::syscall(
+    SYS_futex, const_cast<int32_t*>(__addr), FUTEX_WAIT, __expected, __timed ? &__timeout : nullptr, nullptr, 0);
+}
+
+_CCCL_HOST_API inline void __cccl_futex_wake(int32_t const volatile* __addr, int32_t __count) noexcept
+{
+  ::syscall(SYS_futex, const_cast<int32_t*>(__addr), FUTEX_WAKE, __count, nullptr, nullptr, 0);
+}
+
+// The waiters on the objects whose addresses map to an entry. Notifiers skip the system call when there are none, and
+// waiters on objects which are not 32-bit words wait on the version, which notifiers bump before waking them.
+struct alignas(64) __cccl_futex_waiter_entry
+{
+  int32_t __waiters;
+  int32_t __version;
+};
+
+inline constexpr size_t __cccl_futex_waiter_table_size = 256;
+
+// The table has default visibility, so that a waiter and a notifier in different shared objects find the same entry.
+_CCCL_HOST _CCCL_VISIBILITY_DEFAULT inline __cccl_futex_waiter_entry&
+__cccl_futex_waiter_entry_for(void const volatile* __addr) noexcept
+{
+  static __cccl_futex_waiter_entry __table[__cccl_futex_waiter_table_size];
+
+  const auto __key = reinterpret_cast<uintptr_t>(__addr) >> 2;
+  return __table[(__key ^ (__key >> 8)) % __cccl_futex_waiter_table_size];
+}
+
+// Blocks until a notification for __addr, or a spurious wake-up, unless __still_waiting() returns false once the
+// calling thread is registered as a waiter. __addr is waited on directly when it is a 32-bit word.
+template <typename _Up, typename _Fn>
+_CCCL_HOST_API inline void __cccl_futex_wait_on(_Up const volatile* __addr, _Fn __still_waiting, bool __timed) noexcept
+{
+  __cccl_futex_waiter_entry& __entry = __cccl_futex_waiter_entry_for(__addr);
+  __atomic_fetch_add_host(&__entry.__waiters, 1, memory_order_seq_cst);
+
+  if constexpr (sizeof(_Up) == sizeof(int32_t) && alignof(_Up) >= alignof(int32_t))
+  {
+    auto const __word        = reinterpret_cast<int32_t const volatile*>(__addr);
+    int32_t const __expected = __atomic_load_host(__word, memory_order_seq_cst);
+    if (__still_waiting())
+    {
+      __cccl_futex_wait(__word, __expected, __timed);
+    }
+  }
+  else
+  {
+    int32_t const __expected = __atomic_load_host(&__entry.__version, memory_order_seq_cst);
+    if (__still_waiting())
+    {
+      __cccl_futex_wait(&__entry.__version, __expected, __timed);
+    }
+  }
+
+  __atomic_fetch_sub_host(&__entry.__waiters, 1, memory_order_relaxed);
+}
+
+// Wakes at least one of the threads blocked on __addr, or all of them.
+template <typename _Up>
+_CCCL_HOST_API inline void __cccl_futex_notify(_Up const volatile* __addr, bool __all) noexcept
+{
+  __cccl_futex_waiter_entry& __entry = __cccl_futex_waiter_entry_for(__addr);
+
+  // orders the write the waiters are waiting for before the check for waiters, which pairs with the increment of the
+  // waiters before a waiter checks the object
+  __atomic_thread_fence_host(memory_order_seq_cst);
+  if (__atomic_load_host(&__entry.__waiters, memory_order_relaxed) == 0)
+  {
+    return;
+  }
+
+  if constexpr (sizeof(_Up) == sizeof(int32_t) && alignof(_Up) >= alignof(int32_t))
+  {
+    __cccl_futex_wake(reinterpret_cast<int32_t const volatile*>(__addr), __all ? INT_MAX : 1);
+  }
+  else
+  {
+    // the entry is shared with the waiters on other objects, which may be the ones woken by a single wake-up
+    __atomic_fetch_add_host(&__entry.__version, 1, memory_order_seq_cst);
+    __cccl_futex_wake(&__entry.__version, INT_MAX);
+  }
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_FUTEX_WAIT
+
+#endif // _LIBCUDACXX___ATOMIC_WAIT_FUTEX_H
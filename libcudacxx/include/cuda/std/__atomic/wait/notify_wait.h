@@ -23,7 +23,10 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types/common.h>
+#include <cuda/std/__atomic/wait/futex.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -32,35 +35,93 @@ _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return _CUDA_VSTD::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
+#if defined(_LIBCUDACXX_HAS_FUTEX_WAIT)
+
+// The object host threads wait on: the value itself, which for small types is the 32-bit word holding it.
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+_CCCL_HOST_API inline auto __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+_CCCL_HOST_API inline auto __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+_CCCL_HOST_API inline auto __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return &__a->__a_value;
+}
+
+// The caller checks the object again with the requested order after each wake-up, so the check made here only needs to
+// be ordered after the registration of the waiter.
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order, _Sco)
+{
+  _CUDA_VSTD::__cccl_futex_wait_on(
+    _CUDA_VSTD::__atomic_wait_address(__a),
+    [&] {
+      return _CUDA_VSTD::__nonatomic_compare_equal(__atomic_load_dispatch(__a, memory_order_seq_cst, _Sco{}), __val);
+    },
+    _CCCL_TRAIT(is_same, _Sco, __thread_scope_system_tag));
+}
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline void __atomic_notify_host(_Tp const volatile* __a, bool __all, _Sco)
+{
+  _CUDA_VSTD::__cccl_futex_notify(_CUDA_VSTD::__atomic_wait_address(__a), __all);
+}
+
+#else // ^^^ _LIBCUDACXX_HAS_FUTEX_WAIT ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX_WAIT vvv
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline void __atomic_notify_host(_Tp const volatile*, bool, _Sco)
+{}
+
+#endif // !_LIBCUDACXX_HAS_FUTEX_WAIT
+
 template <typename _Tp, typename _Sco>
 _CCCL_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_API inline void __atomic_notify_one(_Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, false, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
-{
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+_CCCL_API inline void __atomic_notify_all(_Tp const volatile* __a, _Sco)
 {
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return _CUDA_VSTD::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, true, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
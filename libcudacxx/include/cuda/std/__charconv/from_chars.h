@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_FROM_CHARS_H
+#define _LIBCUDACXX___CHARCONV_FROM_CHARS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_integer.h>
+#include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Returns the value of the digit __c, or 36 if __c is not a digit in any base.
+[[nodiscard]] _CCCL_API constexpr int __from_chars_char_to_value(char __c) noexcept
+{
+  if (__c >= '0' && __c <= '9')
+  {
+    return __c - '0';
+  }
+  else if (__c >= 'a' && __c <= 'z')
+  {
+    return __c - 'a' + 10;
+  }
+  else if (__c >= 'A' && __c <= 'Z')
+  {
+    return __c - 'A' + 10;
+  }
+  return 36;
+}
+
+// Parses the digits at the front of [__first, __last) into __value. Returns the end of the digits and whether they fit
+// into __max.
+template <class _Up>
+_CCCL_API constexpr const char* __from_chars_uint(
+  const char* __first, const char* __last, _Up& __value, _Up __max, int __base, bool& __overflow) noexcept
+{
+  const auto __ubase   = static_cast<_Up>(__base);
+  const _Up __max_quot = __max / __ubase;
+  const _Up __max_rem  = __max % __ubase;
+
+  _Up __v    = 0;
+  __overflow = false;
+  for (; __first != __last; ++__first)
+  {
+    const int __d = _CUDA_VSTD::__from_chars_char_to_value(*__first);
+    if (__d >= __base)
+    {
+      break;
+    }
+    const auto __ud = static_cast<_Up>(__d);
+    if (__v > __max_quot || (__v == __max_quot && __ud > __max_rem))
+    {
+      __overflow = true;
+    }
+    __v = __v * __ubase + __ud;
+  }
+  __value = __v;
+  return __first;
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(_CCCL_TRAIT(__cccl_is_integer, _Tp))
+_CCCL_API constexpr from_chars_result
+from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 10) noexcept
+{
+  _CCCL_ASSERT(__base >= 2 && __base <= 36, "base must be in the range [2, 36]");
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  using _Up = make_unsigned_t<_Tp>;
+
+  const char* __it = __first;
+  bool __negative  = false;
+  if constexpr (_CCCL_TRAIT(is_signed, _Tp))
+  {
+    if (__it != __last && *__it == '-')
+    {
+      __negative = true;
+      ++__it;
+    }
+  }
+
+  // The magnitude of a negative value may be one larger than the maximum.
+  const _Up __max = static_cast<_Up>(numeric_limits<_Tp>::max()) + static_cast<_Up>(__negative);
+
+  _Up __uvalue{};
+  bool __overflow          = false;
+  const char* __digits_end = _CUDA_VSTD::__from_chars_uint(__it, __last, __uvalue, __max, __base, __overflow);
+  if (__digits_end == __it)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  if (__overflow)
+  {
+    return {__digits_end, errc::result_out_of_range};
+  }
+  __value = static_cast<_Tp>(__negative ? _Up(_Up{0} - __uvalue) : __uvalue);
+  return {__digits_end, errc{}};
+}
+
+_CCCL_API constexpr from_chars_result
+from_chars(const char* __first, const char* __last, char& __value, int __base = 10) noexcept
+{
+  using _Cp = conditional_t<_CCCL_TRAIT(is_signed, char), signed char, unsigned char>;
+
+  _Cp __v{};
+  const auto __result = _CUDA_VSTD::from_chars(__first, __last, __v, __base);
+  if (__result.ec == errc{})
+  {
+    __value = static_cast<char>(__v);
+  }
+  return __result;
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_FROM_CHARS_H
@@ -0,0 +1,881 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_tables.h>
+#include <cuda/std/__charconv/from_chars.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__charconv/mul_128.h>
+#include <cuda/std/__floating_point/constants.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/mask.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <class _Tp>
+struct __from_chars_fp_limits;
+
+template <>
+struct __from_chars_fp_limits<float>
+{
+  // Any 19 digit mantissa times a power of ten outside of [__min_pow10, __max_pow10] rounds to zero or infinity.
+  static constexpr int __min_pow10 = -64;
+  static constexpr int __max_pow10 = 38;
+  // Only products with a power of ten in [__min_round_even, __max_round_even] can be halfway between two values.
+  static constexpr int __min_round_even = -17;
+  static constexpr int __max_round_even = 10;
+  // The largest power of ten that is exactly representable.
+  static constexpr int __max_exact_pow10 = 10;
+};
+
+template <>
+struct __from_chars_fp_limits<double>
+{
+  static constexpr int __min_pow10       = -342;
+  static constexpr int __max_pow10       = 308;
+  static constexpr int __min_round_even  = -4;
+  static constexpr int __max_round_even  = 23;
+  static constexpr int __max_exact_pow10 = 22;
+};
+
+_CCCL_GLOBAL_CONSTANT double __from_chars_exact_pow10[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// The explicit mantissa bits and the biased exponent of a floating point value.
+struct __from_chars_fp_bits
+{
+  uint64_t __mantissa_;
+  int __exponent_;
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const __from_chars_fp_bits& __lhs, const __from_chars_fp_bits& __rhs) noexcept
+  {
+    return __lhs.__mantissa_ == __rhs.__mantissa_ && __lhs.__exponent_ == __rhs.__exponent_;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator!=(const __from_chars_fp_bits& __lhs, const __from_chars_fp_bits& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+};
+
+// Rounds __w * 10^__q to the nearest value of _Tp with the Eisel-Lemire algorithm. A truncated product of __w with the
+// 128 most significant bits of 5^__q is always precise enough to round correctly (Mushtak & Lemire, "Fast number
+// parsing without fallback"), the only input it cannot handle is a mantissa that was already truncated.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits __from_chars_eisel_lemire(int __q, uint64_t __w) noexcept
+{
+  using _Limits = __from_chars_fp_limits<_Tp>;
+
+  constexpr auto __fmt       = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fmt>;
+  constexpr int __inf_exp    = (1 << __fp_exp_nbits_v<__fmt>) - 1;
+
+  if (__w == 0 || __q < _Limits::__min_pow10)
+  {
+    return {0, 0};
+  }
+  if (__q > _Limits::__max_pow10)
+  {
+    return {0, __inf_exp};
+  }
+
+  const int __lz = _CUDA_VSTD::countl_zero(__w);
+  __w <<= __lz;
+
+  // We need the implicit bit, a rounding bit and one more bit that may be lost to normalization below.
+  constexpr uint64_t __precision_mask = ~uint64_t{0} >> (__mant_nbits + 3);
+
+  const auto& __pow5 = __eisel_lemire_pow5_128[__q - __eisel_lemire_min_pow10];
+  auto __product     = _CUDA_VSTD::__charconv_mul_128(__w, __pow5[0]);
+  if ((__product.__high_ & __precision_mask) == __precision_mask)
+  {
+    const auto __second = _CUDA_VSTD::__charconv_mul_128(__w, __pow5[1]);
+    __product.__low_ += __second.__high_;
+    if (__second.__high_ > __product.__low_)
+    {
+      ++__product.__high_;
+    }
+  }
+
+  const int __upper_bit = static_cast<int>(__product.__high_ >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_nbits - 3;
+  uint64_t __mantissa   = __product.__high_ >> __shift;
+
+  // floor(__q * log2(10)) + 63 is the binary exponent of the normalized product.
+  int __exponent = (((152170 + 65536) * __q) >> 16) + 63 + __upper_bit - __lz + __fp_exp_bias_v<__fmt>;
+  if (__exponent <= 0)
+  {
+    // The value is subnormal, or rounds up to the smallest normal value.
+    if (-__exponent + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __mantissa >>= -__exponent + 1;
+    __mantissa += __mantissa & 1;
+    __mantissa >>= 1;
+    const int __biased_exp = (__mantissa < (uint64_t{1} << __mant_nbits)) ? 0 : 1;
+    return {__mantissa & __fp_mant_mask_v<__fmt>, __biased_exp};
+  }
+
+  // The product was exact and lies exactly halfway between two values, so round to even instead of up.
+  if (__product.__low_ <= 1 && __q >= _Limits::__min_round_even && __q <= _Limits::__max_round_even
+      && (__mantissa & 3) == 1 && (__mantissa << __shift) == __product.__high_)
+  {
+    __mantissa &= ~uint64_t{1};
+  }
+
+  __mantissa += __mantissa & 1;
+  __mantissa >>= 1;
+  if (__mantissa >= (uint64_t{2} << __mant_nbits))
+  {
+    __mantissa = uint64_t{1} << __mant_nbits;
+    ++__exponent;
+  }
+  if (__exponent >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+  return {__mantissa & __fp_mant_mask_v<__fmt>, __exponent};
+}
+
+// An arbitrary precision decimal 0.d[0]d[1]...d[n-1] * 10^__decimal_point_, used for the rare inputs with more
+// significant digits than the fast paths can handle. The conversion shifts the value by powers of two until it is in
+// [1/2, 1), which gives the binary exponent, and then shifts the mantissa bits in front of the decimal point. 800
+// digits are enough to represent the halfway point between any two doubles exactly.
+struct __from_chars_big_decimal
+{
+  static constexpr int __max_digits = 800;
+  // 10 * 2^60 still fits into 64 bits.
+  static constexpr int __max_shift = 60;
+
+  int __num_digits_    = 0;
+  int __decimal_point_ = 0;
+  bool __truncated_    = false;
+  // A left shift by __max_shift adds at most 19 digits in front of the current ones.
+  uint8_t __digits_[__max_digits + 19]{};
+
+  // Assigns the digits in [__first, __last), which may contain a single decimal point, times 10^__exp10.
+  _CCCL_API constexpr void __assign(const char* __first, const char* __last, int64_t __exp10) noexcept
+  {
+    int64_t __decimal_point = 0;
+    bool __saw_dot          = false;
+    for (; __first != __last; ++__first)
+    {
+      if (*__first == '.')
+      {
+        __saw_dot = true;
+        continue;
+      }
+      const auto __d = static_cast<uint8_t>(*__first - '0');
+      if (__num_digits_ == 0 && __d == 0)
+      {
+        __decimal_point -= __saw_dot;
+        continue;
+      }
+      __decimal_point += !__saw_dot;
+      if (__num_digits_ < __max_digits)
+      {
+        __digits_[__num_digits_++] = __d;
+      }
+      else if (__d != 0)
+      {
+        __truncated_ = true;
+      }
+    }
+    // Anything outside of this range over- or underflows anyway.
+    __decimal_point += __exp10;
+    __decimal_point  = __decimal_point < -100000 ? -100000 : __decimal_point;
+    __decimal_point_ = static_cast<int>(__decimal_point > 100000 ? 100000 : __decimal_point);
+    __trim();
+  }
+
+  _CCCL_API constexpr void __trim() noexcept
+  {
+    while (__num_digits_ > 0 && __digits_[__num_digits_ - 1] == 0)
+    {
+      --__num_digits_;
+    }
+    if (__num_digits_ == 0)
+    {
+      __decimal_point_ = 0;
+    }
+  }
+
+  _CCCL_API constexpr void __shift_left(int __k) noexcept
+  {
+    // Multiply from the back, writing the new digits 19 places further right, and move them to the front afterwards.
+    int __w       = __num_digits_ + 19;
+    uint64_t __n  = 0;
+    for (int __r = __num_digits_ - 1; __r >= 0; --__r)
+    {
+      __n += static_cast<uint64_t>(__digits_[__r]) << __k;
+      const uint64_t __quot = __n / 10;
+      __digits_[--__w]      = static_cast<uint8_t>(__n - 10 * __quot);
+      __n                   = __quot;
+    }
+    while (__n > 0)
+    {
+      const uint64_t __quot = __n / 10;
+      __digits_[--__w]      = static_cast<uint8_t>(__n - 10 * __quot);
+      __n                   = __quot;
+    }
+    int __num_digits = __num_digits_ + 19 - __w;
+    __decimal_point_ += __num_digits - __num_digits_;
+    for (int __i = 0; __i < __num_digits; ++__i)
+    {
+      __digits_[__i] = __digits_[__w + __i];
+    }
+    for (; __num_digits > __max_digits; --__num_digits)
+    {
+      __truncated_ |= __digits_[__num_digits - 1] != 0;
+    }
+    __num_digits_ = __num_digits;
+    __trim();
+  }
+
+  _CCCL_API constexpr void __shift_right(int __k) noexcept
+  {
+    // Pick up enough leading digits to cover the first shift.
+    int __r      = 0;
+    int __w      = 0;
+    uint64_t __n = 0;
+    for (; (__n >> __k) == 0; ++__r)
+    {
+      if (__r >= __num_digits_)
+      {
+        if (__n == 0)
+        {
+          __num_digits_ = 0;
+          __trim();
+          return;
+        }
+        while ((__n >> __k) == 0)
+        {
+          __n *= 10;
+          ++__r;
+        }
+        break;
+      }
+      __n = __n * 10 + __digits_[__r];
+    }
+    __decimal_point_ -= __r - 1;
+
+    // Pick up a digit, put down a digit.
+    const uint64_t __mask = (uint64_t{1} << __k) - 1;
+    for (; __r < __num_digits_; ++__r)
+    {
+      const uint8_t __c = __digits_[__r];
+      __digits_[__w++]  = static_cast<uint8_t>(__n >> __k);
+      __n               = (__n & __mask) * 10 + __c;
+    }
+
+    // Put down the remaining digits.
+    while (__n > 0)
+    {
+      const auto __d = static_cast<uint8_t>(__n >> __k);
+      __n            = (__n & __mask) * 10;
+      if (__w < __max_digits)
+      {
+        __digits_[__w++] = __d;
+      }
+      else if (__d > 0)
+      {
+        __truncated_ = true;
+      }
+    }
+    __num_digits_ = __w;
+    __trim();
+  }
+
+  // Multiplies the value by 2^__k.
+  _CCCL_API constexpr void __shift(int __k) noexcept
+  {
+    if (__num_digits_ == 0)
+    {
+      return;
+    }
+    if (__k > 0)
+    {
+      for (; __k > __max_shift; __k -= __max_shift)
+      {
+        __shift_left(__max_shift);
+      }
+      __shift_left(__k);
+    }
+    else if (__k < 0)
+    {
+      for (; __k < -__max_shift; __k += __max_shift)
+      {
+        __shift_right(__max_shift);
+      }
+      __shift_right(-__k);
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __should_round_up(int __nd) const noexcept
+  {
+    if (__nd < 0 || __nd >= __num_digits_)
+    {
+      return false;
+    }
+    if (__digits_[__nd] == 5 && __nd + 1 == __num_digits_)
+    {
+      // Exactly halfway, unless digits were dropped, so round to even.
+      return __truncated_ || (__nd > 0 && __digits_[__nd - 1] % 2 == 1);
+    }
+    return __digits_[__nd] >= 5;
+  }
+
+  // Returns the integer part of the value, rounded to nearest.
+  [[nodiscard]] _CCCL_API constexpr uint64_t __rounded_integer() const noexcept
+  {
+    if (__decimal_point_ > 20)
+    {
+      return ~uint64_t{0};
+    }
+    uint64_t __n = 0;
+    int __i      = 0;
+    for (; __i < __decimal_point_ && __i < __num_digits_; ++__i)
+    {
+      __n = __n * 10 + __digits_[__i];
+    }
+    for (; __i < __decimal_point_; ++__i)
+    {
+      __n *= 10;
+    }
+    return __n + __should_round_up(__decimal_point_);
+  }
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits
+__from_chars_big_decimal_to_bits(__from_chars_big_decimal& __d) noexcept
+{
+  constexpr auto __fmt       = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fmt>;
+  constexpr int __inf_exp    = (1 << __fp_exp_nbits_v<__fmt>) - 1;
+  constexpr int __bias       = __fp_exp_bias_v<__fmt>;
+
+  // The largest power of two that can be shifted without losing a digit in front of the decimal point, indexed by the
+  // number of digits in front of it.
+  constexpr int __pow2_steps[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+  constexpr int __num_steps    = static_cast<int>(sizeof(__pow2_steps) / sizeof(int));
+
+  if (__d.__num_digits_ == 0 || __d.__decimal_point_ < -330)
+  {
+    return {0, 0};
+  }
+  if (__d.__decimal_point_ > 310)
+  {
+    return {0, __inf_exp};
+  }
+
+  // Scale into [1/2, 1).
+  int __exp = 0;
+  while (__d.__decimal_point_ > 0)
+  {
+    const int __n = __d.__decimal_point_ >= __num_steps ? 27 : __pow2_steps[__d.__decimal_point_];
+    __d.__shift(-__n);
+    __exp += __n;
+  }
+  while (__d.__decimal_point_ < 0 || (__d.__decimal_point_ == 0 && __d.__digits_[0] < 5))
+  {
+    const int __n = -__d.__decimal_point_ >= __num_steps ? 27 : __pow2_steps[-__d.__decimal_point_];
+    __d.__shift(__n);
+    __exp -= __n;
+  }
+
+  // The value is in [1, 2) * 2^__exp now, which may be below the smallest normal exponent.
+  --__exp;
+  if (__exp < 1 - __bias)
+  {
+    const int __n = 1 - __bias - __exp;
+    __d.__shift(-__n);
+    __exp += __n;
+  }
+  if (__exp + __bias >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+
+  __d.__shift(1 + __mant_nbits);
+  uint64_t __mantissa = __d.__rounded_integer();
+  if (__mantissa == (uint64_t{2} << __mant_nbits))
+  {
+    __mantissa >>= 1;
+    if (++__exp + __bias >= __inf_exp)
+    {
+      return {0, __inf_exp};
+    }
+  }
+  const int __biased_exp = (__mantissa & (uint64_t{1} << __mant_nbits)) ? __exp + __bias : 0;
+  return {__mantissa & __fp_mant_mask_v<__fmt>, __biased_exp};
+}
+
+// Rounds (__mantissa + __sticky * epsilon) * 2^__exp2 to the nearest value of _Tp.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits
+__from_chars_round_binary(uint64_t __mantissa, int64_t __exp2, bool __sticky) noexcept
+{
+  constexpr auto __fmt       = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fmt>;
+  constexpr int __inf_exp    = (1 << __fp_exp_nbits_v<__fmt>) - 1;
+  constexpr int __bias       = __fp_exp_bias_v<__fmt>;
+
+  if (__mantissa == 0)
+  {
+    return {0, 0};
+  }
+
+  // The value is in [2^__exp, 2^(__exp + 1)).
+  const int __msb     = 63 - _CUDA_VSTD::countl_zero(__mantissa);
+  const int64_t __exp = __msb + __exp2;
+  if (__exp > __bias)
+  {
+    return {0, __inf_exp};
+  }
+  const bool __normal = __exp >= 1 - __bias;
+  int64_t __shift     = __msb - __mant_nbits + (__normal ? 0 : 1 - __bias - __exp);
+
+  uint64_t __m = 0;
+  if (__shift <= 0)
+  {
+    __m = __mantissa << -__shift;
+  }
+  else if (__shift <= 64)
+  {
+    const uint64_t __rem  = __shift == 64 ? __mantissa : __mantissa & ((uint64_t{1} << __shift) - 1);
+    const uint64_t __half = uint64_t{1} << (__shift - 1);
+    __m                   = __shift == 64 ? 0 : __mantissa >> __shift;
+    __m += __rem > __half || (__rem == __half && (__sticky || (__m & 1)));
+  }
+
+  // Carries out of the mantissa propagate into the exponent field, which also turns the largest subnormal into the
+  // smallest normal value and the largest finite value into infinity.
+  const uint64_t __bits = (static_cast<uint64_t>(__normal ? __exp + __bias - 1 : 0) << __mant_nbits) + __m;
+  const int __biased    = static_cast<int>(__bits >> __mant_nbits);
+  if (__biased >= __inf_exp)
+  {
+    return {0, __inf_exp};
+  }
+  return {__bits & __fp_mant_mask_v<__fmt>, __biased};
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_is_digit(char __c) noexcept
+{
+  return static_cast<unsigned char>(__c - '0') < 10;
+}
+
+[[nodiscard]] _CCCL_API constexpr char __from_chars_to_lower(char __c) noexcept
+{
+  return (__c >= 'A' && __c <= 'Z') ? static_cast<char>(__c - 'A' + 'a') : __c;
+}
+
+// Returns whether [__first, __last) starts with the lowercase __str, ignoring case.
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_starts_with(const char* __first, const char* __last, const char* __str, int __len) noexcept
+{
+  if (__last - __first < __len)
+  {
+    return false;
+  }
+  for (int __i = 0; __i < __len; ++__i)
+  {
+    if (_CUDA_VSTD::__from_chars_to_lower(__first[__i]) != __str[__i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Parses an optionally signed decimal exponent after the exponent character at __first. Returns __first if there are
+// no digits, which leaves the exponent character unparsed. Saturates far outside of the range of any floating point
+// type.
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_exponent(const char* __first, const char* __last, int64_t& __exp) noexcept
+{
+  const char* __it = __first + 1;
+  bool __negative  = false;
+  if (__it != __last && (*__it == '+' || *__it == '-'))
+  {
+    __negative = *__it == '-';
+    ++__it;
+  }
+  if (__it == __last || !_CUDA_VSTD::__from_chars_is_digit(*__it))
+  {
+    return __first;
+  }
+  int64_t __e = 0;
+  for (; __it != __last && _CUDA_VSTD::__from_chars_is_digit(*__it); ++__it)
+  {
+    if (__e < 100000000)
+    {
+      __e = __e * 10 + (*__it - '0');
+    }
+  }
+  __exp = __negative ? -__e : __e;
+  return __it;
+}
+
+// Parses "inf", "infinity", "nan" and "nan(n-char-sequence)", ignoring case.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_inf_nan(const char* __first, const char* __last, __fp_storage_of_t<_Tp>& __bits) noexcept
+{
+  constexpr auto __fmt = __fp_format_of_v<_Tp>;
+
+  if (_CUDA_VSTD::__from_chars_starts_with(__first, __last, "inf", 3))
+  {
+    __bits = _CUDA_VSTD::__fp_inf<__fmt>();
+    __first += 3;
+    return _CUDA_VSTD::__from_chars_starts_with(__first, __last, "inity", 5) ? __first + 5 : __first;
+  }
+  if (_CUDA_VSTD::__from_chars_starts_with(__first, __last, "nan", 3))
+  {
+    __bits = _CUDA_VSTD::__fp_nan<__fmt>();
+    __first += 3;
+    if (__first != __last && *__first == '(')
+    {
+      for (const char* __it = __first + 1; __it != __last; ++__it)
+      {
+        const char __c = _CUDA_VSTD::__from_chars_to_lower(*__it);
+        if (__c == ')')
+        {
+          return __it + 1;
+        }
+        if (!_CUDA_VSTD::__from_chars_is_digit(__c) && !(__c >= 'a' && __c <= 'z') && __c != '_')
+        {
+          break;
+        }
+      }
+    }
+    return __first;
+  }
+  return nullptr;
+}
+
+// Parses the hexadecimal significand and binary exponent of chars_format::hex.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_hex(const char* __first, const char* __last, __from_chars_fp_bits& __result, bool& __is_zero) noexcept
+{
+  uint64_t __mantissa = 0;
+  int64_t __exp2      = 0;
+  int __num_digits    = 0;
+  bool __sticky       = false;
+  bool __any_digit    = false;
+  bool __saw_dot      = false;
+
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__saw_dot)
+    {
+      __saw_dot = true;
+      continue;
+    }
+    const int __d = _CUDA_VSTD::__from_chars_char_to_value(*__it);
+    if (__d >= 16)
+    {
+      break;
+    }
+    __any_digit = true;
+    if (__mantissa == 0 && __d == 0)
+    {
+      __exp2 -= 4 * __saw_dot;
+    }
+    else if (__num_digits < 16)
+    {
+      __mantissa = __mantissa * 16 + static_cast<uint64_t>(__d);
+      __exp2 -= 4 * __saw_dot;
+      ++__num_digits;
+    }
+    else
+    {
+      __exp2 += 4 * !__saw_dot;
+      __sticky |= __d != 0;
+    }
+  }
+  if (!__any_digit)
+  {
+    return nullptr;
+  }
+
+  if (__it != __last && (*__it == 'p' || *__it == 'P'))
+  {
+    int64_t __exp = 0;
+    __it          = _CUDA_VSTD::__from_chars_exponent(__it, __last, __exp);
+    __exp2 += __exp;
+  }
+  __is_zero = __mantissa == 0;
+  __result  = _CUDA_VSTD::__from_chars_round_binary<_Tp>(__mantissa, __exp2, __sticky);
+  return __it;
+}
+
+// Loads 8 characters with the first one in the least significant byte, which compilers turn into a single load.
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_load_8(const char* __p) noexcept
+{
+  uint64_t __v = 0;
+  for (int __i = 0; __i < 8; ++__i)
+  {
+    __v |= static_cast<uint64_t>(static_cast<unsigned char>(__p[__i])) << (8 * __i);
+  }
+  return __v;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_is_8_digits(uint64_t __v) noexcept
+{
+  return (((__v + 0x4646464646464646) | (__v - 0x3030303030303030)) & 0x8080808080808080) == 0;
+}
+
+// Converts 8 digits loaded by __from_chars_load_8 by combining pairs, quadruples and octets with multiplications.
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_parse_8_digits(uint64_t __v) noexcept
+{
+  constexpr uint64_t __mask = 0x000000FF000000FF;
+  constexpr uint64_t __mul1 = 0x000F424000000064; // 100 + (1000000 << 32)
+  constexpr uint64_t __mul2 = 0x0000271000000001; // 1 + (10000 << 32)
+  __v -= 0x3030303030303030;
+  __v = (__v * 10) + (__v >> 8);
+  return static_cast<uint32_t>((((__v & __mask) * __mul1) + (((__v >> 16) & __mask) * __mul2)) >> 32);
+}
+
+// Accumulates the digits at the front of [__first, __last) into __mantissa, eight at a time while possible.
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_parse_digits(const char* __first, const char* __last, uint64_t& __mantissa) noexcept
+{
+  while (__last - __first >= 8)
+  {
+    const uint64_t __v = _CUDA_VSTD::__from_chars_load_8(__first);
+    if (!_CUDA_VSTD::__from_chars_is_8_digits(__v))
+    {
+      break;
+    }
+    __mantissa = __mantissa * 100000000 + _CUDA_VSTD::__from_chars_parse_8_digits(__v);
+    __first += 8;
+  }
+  for (; __first != __last && _CUDA_VSTD::__from_chars_is_digit(*__first); ++__first)
+  {
+    __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__first - '0');
+  }
+  return __first;
+}
+
+// Parses a decimal number of chars_format::general, fixed or scientific.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char* __from_chars_decimal(
+  const char* __first, const char* __last, chars_format __fmt, __from_chars_fp_bits& __result, bool& __is_zero) noexcept
+{
+  using _Limits = __from_chars_fp_limits<_Tp>;
+
+  constexpr auto __fp_fmt             = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits          = __fp_mant_nbits_v<__fp_fmt>;
+  constexpr int __max_mantissa_digits = 19;
+
+  // Accumulate all digits, which only overflows for more than 19 significant ones.
+  uint64_t __mantissa      = 0;
+  const char* __it         = _CUDA_VSTD::__from_chars_parse_digits(__first, __last, __mantissa);
+  const char* __int_last   = __it;
+  const char* __frac_first = __it;
+  int64_t __num_digits     = __int_last - __first;
+  int64_t __exp10          = 0;
+  if (__it != __last && *__it == '.')
+  {
+    __frac_first = ++__it;
+    __it         = _CUDA_VSTD::__from_chars_parse_digits(__it, __last, __mantissa);
+    __exp10      = __frac_first - __it;
+    __num_digits -= __exp10;
+  }
+  if (__num_digits == 0)
+  {
+    return nullptr;
+  }
+  const char* __digits_last = __it;
+
+  // The exponent is mandatory for scientific and not allowed for fixed.
+  const bool __allow_exp = (__fmt & chars_format::scientific) == chars_format::scientific;
+  const bool __need_exp  = __allow_exp && (__fmt & chars_format::fixed) != chars_format::fixed;
+  int64_t __exp          = 0;
+  if (__allow_exp && __it != __last && (*__it == 'e' || *__it == 'E'))
+  {
+    __it = _CUDA_VSTD::__from_chars_exponent(__it, __last, __exp);
+  }
+  if (__need_exp && __it == __digits_last)
+  {
+    return nullptr;
+  }
+
+  bool __truncated = false;
+  if (__num_digits > __max_mantissa_digits)
+  {
+    // Leading zeros are not significant.
+    for (const char* __p = __first; __p != __digits_last && (*__p == '0' || *__p == '.'); ++__p)
+    {
+      __num_digits -= *__p == '0';
+    }
+    if (__num_digits > __max_mantissa_digits)
+    {
+      // Keep the first 19 significant digits only.
+      constexpr uint64_t __min_19_digits = 1000000000000000000;
+
+      __truncated     = true;
+      __mantissa      = 0;
+      const char* __p = __first;
+      for (; __mantissa < __min_19_digits && __p != __int_last; ++__p)
+      {
+        __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__p - '0');
+      }
+      if (__mantissa >= __min_19_digits)
+      {
+        __exp10 = __int_last - __p;
+      }
+      else
+      {
+        for (__p = __frac_first; __mantissa < __min_19_digits && __p != __digits_last; ++__p)
+        {
+          __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__p - '0');
+        }
+        __exp10 = __frac_first - __p;
+      }
+    }
+  }
+
+  __is_zero = __mantissa == 0;
+  if (__is_zero)
+  {
+    __result = {0, 0};
+    return __it;
+  }
+  __exp10 += __exp;
+
+  // Clinger's fast path: both the mantissa and the power of ten are exact, so a single rounding gives the result.
+  if (!__truncated && __mantissa <= (uint64_t{2} << __mant_nbits) && __exp10 >= -_Limits::__max_exact_pow10
+      && __exp10 <= _Limits::__max_exact_pow10)
+  {
+    _Tp __v = static_cast<_Tp>(__mantissa);
+    if (__exp10 < 0)
+    {
+      __v /= static_cast<_Tp>(__from_chars_exact_pow10[-__exp10]);
+    }
+    else
+    {
+      __v *= static_cast<_Tp>(__from_chars_exact_pow10[__exp10]);
+    }
+    const auto __bits = _CUDA_VSTD::__fp_get_storage(__v);
+    __result          = {__bits & __fp_mant_mask_v<__fp_fmt>, static_cast<int>(__bits >> __mant_nbits)};
+    return __it;
+  }
+
+  const int __q = static_cast<int>(__exp10 < -100000 ? -100000 : (__exp10 > 100000 ? 100000 : __exp10));
+  __result      = _CUDA_VSTD::__from_chars_eisel_lemire<_Tp>(__q, __mantissa);
+
+  // The dropped digits put the exact value somewhere between __mantissa and __mantissa + 1. If both round the same,
+  // so does the value, otherwise take the slow path over all digits.
+  if (__truncated && __result != _CUDA_VSTD::__from_chars_eisel_lemire<_Tp>(__q, __mantissa + 1))
+  {
+    __from_chars_big_decimal __big{};
+    __big.__assign(__first, __digits_last, __exp);
+    __result = _CUDA_VSTD::__from_chars_big_decimal_to_bits<_Tp>(__big);
+  }
+  return __it;
+}
+
+template <class _Tp>
+_CCCL_API constexpr from_chars_result
+__from_chars_floating_point(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format::general || __fmt == chars_format::fixed || __fmt == chars_format::scientific
+                 || __fmt == chars_format::hex,
+               "invalid chars_format");
+
+  using _Storage = __fp_storage_of_t<_Tp>;
+
+  constexpr auto __fp_fmt    = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fp_fmt>;
+  constexpr int __inf_exp    = (1 << __fp_exp_nbits_v<__fp_fmt>) - 1;
+
+  const char* __it      = __first;
+  const bool __negative = __it != __last && *__it == '-';
+  __it += __negative;
+
+  const _Storage __sign = __negative ? __fp_sign_mask_v<__fp_fmt> : _Storage{0};
+  const char __lead     = __it != __last ? _CUDA_VSTD::__from_chars_to_lower(*__it) : '\0';
+  if (__lead == 'i' || __lead == 'n')
+  {
+    _Storage __bits{};
+    const char* __end = _CUDA_VSTD::__from_chars_inf_nan<_Tp>(__it, __last, __bits);
+    if (__end == nullptr)
+    {
+      return {__first, errc::invalid_argument};
+    }
+    __value = _CUDA_VSTD::__fp_from_storage<_Tp>(static_cast<_Storage>(__bits | __sign));
+    return {__end, errc{}};
+  }
+
+  __from_chars_fp_bits __result{};
+  bool __is_zero    = false;
+  const char* __end = __fmt == chars_format::hex
+                      ? _CUDA_VSTD::__from_chars_hex<_Tp>(__it, __last, __result, __is_zero)
+                      : _CUDA_VSTD::__from_chars_decimal<_Tp>(__it, __last, __fmt, __result, __is_zero);
+  if (__end == nullptr)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  // A nonzero input that rounds to zero or infinity is out of range.
+  if (__result.__exponent_ == __inf_exp || (!__is_zero && __result.__mantissa_ == 0 && __result.__exponent_ == 0))
+  {
+    return {__end, errc::result_out_of_range};
+  }
+  const auto __exp_bits = static_cast<_Storage>(static_cast<_Storage>(__result.__exponent_) << __mant_nbits);
+  __value = _CUDA_VSTD::__fp_from_storage<_Tp>(static_cast<_Storage>(__exp_bits | __result.__mantissa_ | __sign));
+  return {__end, errc{}};
+}
+
+_CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST from_chars_result from_chars(
+  const char* __first, const char* __last, float& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  return _CUDA_VSTD::__from_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST from_chars_result from_chars(
+  const char* __first, const char* __last, double& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  return _CUDA_VSTD::__from_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
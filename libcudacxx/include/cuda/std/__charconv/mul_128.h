@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_MUL_128_H
+#define _LIBCUDACXX___CHARCONV_MUL_128_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+struct __charconv_uint128
+{
+  uint64_t __low_;
+  uint64_t __high_;
+};
+
+// Full 64 x 64 -> 128 bit product, which the floating point conversions are built on.
+[[nodiscard]] _CCCL_API constexpr __charconv_uint128 __charconv_mul_128(uint64_t __a, uint64_t __b) noexcept
+{
+#if _CCCL_HAS_INT128()
+  const __uint128_t __r = static_cast<__uint128_t>(__a) * __b;
+  return {static_cast<uint64_t>(__r), static_cast<uint64_t>(__r >> 64)};
+#else // ^^^ _CCCL_HAS_INT128() ^^^ / vvv !_CCCL_HAS_INT128() vvv
+  const uint64_t __a_lo = static_cast<uint32_t>(__a);
+  const uint64_t __a_hi = __a >> 32;
+  const uint64_t __b_lo = static_cast<uint32_t>(__b);
+  const uint64_t __b_hi = __b >> 32;
+
+  const uint64_t __ll  = __a_lo * __b_lo;
+  const uint64_t __lh  = __a_lo * __b_hi;
+  const uint64_t __hl  = __a_hi * __b_lo;
+  const uint64_t __hh  = __a_hi * __b_hi;
+  const uint64_t __mid = (__ll >> 32) + static_cast<uint32_t>(__lh) + static_cast<uint32_t>(__hl);
+  return {(__mid << 32) | static_cast<uint32_t>(__ll), __hh + (__lh >> 32) + (__hl >> 32) + (__mid >> 32)};
+#endif // ^^^ !_CCCL_HAS_INT128() ^^^
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_MUL_128_H
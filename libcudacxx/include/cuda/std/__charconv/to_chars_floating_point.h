@@ -0,0 +1,586 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_tables.h>
+#include <cuda/std/__charconv/mul_128.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/mask.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+_CCCL_GLOBAL_CONSTANT char __to_chars_digit_pairs[] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+_CCCL_GLOBAL_CONSTANT uint64_t __to_chars_pow10_u64[20] = {
+  1ull,
+  10ull,
+  100ull,
+  1000ull,
+  10000ull,
+  100000ull,
+  1000000ull,
+  10000000ull,
+  100000000ull,
+  1000000000ull,
+  10000000000ull,
+  100000000000ull,
+  1000000000000ull,
+  10000000000000ull,
+  100000000000000ull,
+  1000000000000000ull,
+  10000000000000000ull,
+  100000000000000000ull,
+  1000000000000000000ull,
+  10000000000000000000ull};
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_decimal_length(uint64_t __v) noexcept
+{
+  // floor(log10(2^bit_width)) is either the number of digits or one less. Zero has one digit, like one.
+  __v           = __v | 1;
+  const int __n = ((64 - _CUDA_VSTD::countl_zero(__v)) * 1233) >> 12;
+  return __n + (__v >= __to_chars_pow10_u64[__n]);
+}
+
+// Writes the __n least significant decimal digits of __v, including leading zeros, in front of __last.
+_CCCL_API constexpr void __to_chars_write_digits(char* __last, uint64_t __v, int __n) noexcept
+{
+  for (; __n >= 2; __n -= 2)
+  {
+    const uint64_t __quot = __v / 100;
+    const auto __pair     = static_cast<int>(__v - 100 * __quot);
+    __last -= 2;
+    __last[0] = __to_chars_digit_pairs[2 * __pair];
+    __last[1] = __to_chars_digit_pairs[2 * __pair + 1];
+    __v       = __quot;
+  }
+  if (__n == 1)
+  {
+    *--__last = static_cast<char>('0' + __v % 10);
+  }
+}
+
+// A value of the form __mantissa_ * 10^__exponent_.
+struct __ryu_decimal
+{
+  uint64_t __mantissa_;
+  int __exponent_;
+};
+
+// ceil(log2(5^__e)) for __e > 0, or 1 for __e == 0.
+[[nodiscard]] _CCCL_API constexpr int __ryu_pow5_bits(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 1217359u) >> 19) + 1;
+}
+
+// floor(log10(2^__e))
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow2(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 78913u) >> 18);
+}
+
+// floor(log10(5^__e))
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow5(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 732923u) >> 20);
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow5(uint64_t __v, int __p) noexcept
+{
+  int __count = 0;
+  for (; __v % 5 == 0; __v /= 5)
+  {
+    ++__count;
+  }
+  return __count >= __p;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow2(uint64_t __v, int __p) noexcept
+{
+  return (__v & ((uint64_t{1} << __p) - 1)) == 0;
+}
+
+// (__m * __mul) >> __j, where __mul is a 128 bit table entry.
+[[nodiscard]] _CCCL_API constexpr uint64_t __ryu_mul_shift(uint64_t __m, const uint64_t (&__mul)[2], int __j) noexcept
+{
+  _CCCL_ASSERT(__j > 64 && __j < 128, "shift out of range");
+  const auto __b0       = _CUDA_VSTD::__charconv_mul_128(__m, __mul[0]);
+  const auto __b2       = _CUDA_VSTD::__charconv_mul_128(__m, __mul[1]);
+  const uint64_t __low  = __b2.__low_ + __b0.__high_;
+  const uint64_t __high = __b2.__high_ + (__low < __b2.__low_);
+  const int __shift     = __j - 64;
+  return (__high << (64 - __shift)) | (__low >> __shift);
+}
+
+// Computes the shortest decimal that rounds back to the nonzero finite value with the given mantissa and biased
+// exponent, and the closest one among those, following Ulf Adams, "Ryu: fast float-to-string conversion". Both float
+// and double use the double precision tables.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __ryu_decimal __ryu_shortest(uint64_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  constexpr auto __fmt       = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fmt>;
+  constexpr int __bias       = __fp_exp_bias_v<__fmt>;
+
+  // Subtract 2 more from the exponent so that the bounds computation has 2 additional bits.
+  const bool __subnormal = __ieee_exponent == 0;
+  const int __e2         = (__subnormal ? 1 : __ieee_exponent) - __bias - __mant_nbits - 2;
+  const uint64_t __m2    = __subnormal ? __ieee_mantissa : (uint64_t{1} << __mant_nbits) | __ieee_mantissa;
+
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  // The halfway points to the neighboring values are (__mv - 1 - __mm_shift) / 4 and (__mv + 2) / 4, where the lower
+  // neighbor is closer if the value is a power of two.
+  const uint64_t __mv       = 4 * __m2;
+  const uint64_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+  // Convert the value and the halfway points to a decimal power base.
+  uint64_t __vr            = 0;
+  uint64_t __vp            = 0;
+  uint64_t __vm            = 0;
+  int __e10                = 0;
+  bool __vm_trailing_zeros = false;
+  bool __vr_trailing_zeros = false;
+  if (__e2 >= 0)
+  {
+    const int __q = _CUDA_VSTD::__ryu_log10_pow2(__e2) - (__e2 > 3);
+    const int __k = __ryu_pow5_inv_bitcount + _CUDA_VSTD::__ryu_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    __e10         = __q;
+    __vr          = _CUDA_VSTD::__ryu_mul_shift(__mv, __ryu_pow5_inv_split[__q], __i);
+    __vp          = _CUDA_VSTD::__ryu_mul_shift(__mv + 2, __ryu_pow5_inv_split[__q], __i);
+    __vm          = _CUDA_VSTD::__ryu_mul_shift(__mv - 1 - __mm_shift, __ryu_pow5_inv_split[__q], __i);
+    if (__q <= 21)
+    {
+      // Only one of __mp, __mv and __mm can be a multiple of 5, if any.
+      if (__mv % 5 == 0)
+      {
+        __vr_trailing_zeros = _CUDA_VSTD::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_trailing_zeros = _CUDA_VSTD::__ryu_multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+      }
+      else
+      {
+        __vp -= _CUDA_VSTD::__ryu_multiple_of_pow5(__mv + 2, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = _CUDA_VSTD::__ryu_log10_pow5(-__e2) - (-__e2 > 1);
+    const int __i = -__e2 - __q;
+    const int __k = _CUDA_VSTD::__ryu_pow5_bits(__i) - __ryu_pow5_bitcount;
+    const int __j = __q - __k;
+    __e10         = __q + __e2;
+    __vr          = _CUDA_VSTD::__ryu_mul_shift(__mv, __ryu_pow5_split[__i], __j);
+    __vp          = _CUDA_VSTD::__ryu_mul_shift(__mv + 2, __ryu_pow5_split[__i], __j);
+    __vm          = _CUDA_VSTD::__ryu_mul_shift(__mv - 1 - __mm_shift, __ryu_pow5_split[__i], __j);
+    if (__q <= 1)
+    {
+      // __mv has at least two trailing zero bits, __mm has one iff __mm_shift is 1 and __mp always has one.
+      __vr_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 63)
+    {
+      __vr_trailing_zeros = _CUDA_VSTD::__ryu_multiple_of_pow2(__mv, __q);
+    }
+  }
+
+  // Remove digits while the bounds still differ, keeping track of the last removed digit for rounding.
+  int __removed           = 0;
+  uint64_t __last_removed = 0;
+  uint64_t __output       = 0;
+  if (__vm_trailing_zeros || __vr_trailing_zeros)
+  {
+    // The general case, which is rare.
+    for (; __vp / 10 > __vm / 10; ++__removed)
+    {
+      __vm_trailing_zeros &= __vm % 10 == 0;
+      __vr_trailing_zeros &= __last_removed == 0;
+      __last_removed = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    if (__vm_trailing_zeros)
+    {
+      for (; __vm % 10 == 0; ++__removed)
+      {
+        __vr_trailing_zeros &= __last_removed == 0;
+        __last_removed = __vr % 10;
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+      }
+    }
+    if (__vr_trailing_zeros && __last_removed == 5 && __vr % 2 == 0)
+    {
+      // The exact value is ...50...0, round to even.
+      __last_removed = 4;
+    }
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_trailing_zeros)) || __last_removed >= 5);
+  }
+  else
+  {
+    // The common case, removing two digits at a time while possible.
+    bool __round_up = false;
+    if (__vp / 100 > __vm / 100)
+    {
+      __round_up = __vr % 100 >= 50;
+      __vr /= 100;
+      __vp /= 100;
+      __vm /= 100;
+      __removed += 2;
+    }
+    for (; __vp / 10 > __vm / 10; ++__removed)
+    {
+      __round_up = __vr % 10 >= 5;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    __output = __vr + (__vr == __vm || __round_up);
+  }
+  return {__output, __e10 + __removed};
+}
+
+// Writes the digits of __dec in scientific notation, d[.ddd]e+XX.
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_scientific(char* __first, char* __last, __ryu_decimal __dec, int __olength) noexcept
+{
+  const int __exp       = __dec.__exponent_ + __olength - 1;
+  const int __abs_exp   = __exp < 0 ? -__exp : __exp;
+  const int __exp_len   = __abs_exp >= 100 ? 3 : 2;
+  const ptrdiff_t __len = __olength + (__olength > 1) + 2 + __exp_len;
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  _CUDA_VSTD::__to_chars_write_digits(__first + 1 + __olength, __dec.__mantissa_, __olength);
+  __first[0] = __first[1];
+  if (__olength > 1)
+  {
+    __first[1] = '.';
+    __first += __olength + 1;
+  }
+  else
+  {
+    ++__first;
+  }
+  __first[0] = 'e';
+  __first[1] = __exp < 0 ? '-' : '+';
+  _CUDA_VSTD::__to_chars_write_digits(__first + 2 + __exp_len, static_cast<uint64_t>(__abs_exp), __exp_len);
+  return {__first + 2 + __exp_len, errc{}};
+}
+
+// Writes the digits of __dec in fixed notation.
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fixed(char* __first, char* __last, __ryu_decimal __dec, int __olength) noexcept
+{
+  const int __int_digits = __olength + __dec.__exponent_;
+  if (__dec.__exponent_ >= 0)
+  {
+    // All digits followed by zeros.
+    if (__last - __first < __int_digits)
+    {
+      return {__last, errc::value_too_large};
+    }
+    _CUDA_VSTD::__to_chars_write_digits(__first + __olength, __dec.__mantissa_, __olength);
+    for (char* __it = __first + __olength; __it != __first + __int_digits; ++__it)
+    {
+      *__it = '0';
+    }
+    return {__first + __int_digits, errc{}};
+  }
+  if (__int_digits > 0)
+  {
+    // The decimal point is in between the digits.
+    if (__last - __first < __olength + 1)
+    {
+      return {__last, errc::value_too_large};
+    }
+    _CUDA_VSTD::__to_chars_write_digits(__first + __olength + 1, __dec.__mantissa_, -__dec.__exponent_);
+    _CUDA_VSTD::__to_chars_write_digits(
+      __first + __int_digits, __dec.__mantissa_ / __to_chars_pow10_u64[-__dec.__exponent_], __int_digits);
+    __first[__int_digits] = '.';
+    return {__first + __olength + 1, errc{}};
+  }
+  // 0.00ddd
+  const ptrdiff_t __len = 2 - __int_digits + __olength;
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+  __first[0] = '0';
+  __first[1] = '.';
+  for (char* __it = __first + 2; __it != __first + 2 - __int_digits; ++__it)
+  {
+    *__it = '0';
+  }
+  _CUDA_VSTD::__to_chars_write_digits(__first + __len, __dec.__mantissa_, __olength);
+  return {__first + __len, errc{}};
+}
+
+// Writes the exact decimal digits of the integer __m2 * 2^__e2 with __m2 < 2^53. The shortest round trip digits of
+// large values are padded with zeros in fixed notation, which is not the value itself.
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_exact_integer(char* __first, char* __last, uint64_t __m2, int __e2) noexcept
+{
+  // The largest double is below 2^1024, which has 309 decimal digits.
+  constexpr int __max_limbs  = 34;
+  constexpr int __max_chunks = 35;
+  constexpr uint32_t __chunk = 1000000000;
+
+  uint32_t __limbs[__max_limbs]{};
+  const int __word      = __e2 / 32;
+  const int __bit       = __e2 % 32;
+  const uint64_t __low  = __m2 << __bit;
+  __limbs[__word]       = static_cast<uint32_t>(__low);
+  __limbs[__word + 1]   = static_cast<uint32_t>(__low >> 32);
+  __limbs[__word + 2]   = static_cast<uint32_t>(__bit == 0 ? 0 : __m2 >> (64 - __bit));
+  int __num_limbs       = __word + 3;
+
+  // Split into chunks of 9 decimal digits, least significant first.
+  uint32_t __chunks[__max_chunks]{};
+  int __num_chunks = 0;
+  while (__num_limbs > 0 && __limbs[__num_limbs - 1] == 0)
+  {
+    --__num_limbs;
+  }
+  while (__num_limbs > 0)
+  {
+    uint64_t __rem = 0;
+    for (int __i = __num_limbs - 1; __i >= 0; --__i)
+    {
+      const uint64_t __cur = (__rem << 32) | __limbs[__i];
+      __limbs[__i]         = static_cast<uint32_t>(__cur / __chunk);
+      __rem                = __cur % __chunk;
+    }
+    __chunks[__num_chunks++] = static_cast<uint32_t>(__rem);
+    while (__num_limbs > 0 && __limbs[__num_limbs - 1] == 0)
+    {
+      --__num_limbs;
+    }
+  }
+
+  const int __top_len   = _CUDA_VSTD::__to_chars_decimal_length(__chunks[__num_chunks - 1]);
+  const ptrdiff_t __len = __top_len + 9 * (__num_chunks - 1);
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+  _CUDA_VSTD::__to_chars_write_digits(__first + __top_len, __chunks[__num_chunks - 1], __top_len);
+  __first += __top_len;
+  for (int __i = __num_chunks - 2; __i >= 0; --__i)
+  {
+    __first += 9;
+    _CUDA_VSTD::__to_chars_write_digits(__first, __chunks[__i], 9);
+  }
+  return {__first, errc{}};
+}
+
+// Writes 1.hhhp+d for normal values and 0.hhhp-d for subnormal ones, without trailing zeros.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_hex(char* __first, char* __last, uint64_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  constexpr auto __fmt       = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fmt>;
+  constexpr int __bias       = __fp_exp_bias_v<__fmt>;
+  constexpr int __hex_digits = (__mant_nbits + 3) / 4;
+
+  const bool __is_zero = __ieee_mantissa == 0 && __ieee_exponent == 0;
+  const int __exp      = __is_zero ? 0 : (__ieee_exponent == 0 ? 1 : __ieee_exponent) - __bias;
+  const int __abs_exp  = __exp < 0 ? -__exp : __exp;
+  const int __exp_len  = _CUDA_VSTD::__to_chars_decimal_length(static_cast<uint64_t>(__abs_exp));
+
+  uint64_t __m = __ieee_mantissa << (4 * __hex_digits - __mant_nbits);
+  int __n      = __hex_digits;
+  for (; __n > 0 && (__m & 0xf) == 0; --__n)
+  {
+    __m >>= 4;
+  }
+
+  const ptrdiff_t __len = 1 + (__n > 0 ? __n + 1 : 0) + 2 + __exp_len;
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+  *__first++ = __ieee_exponent == 0 ? '0' : '1';
+  if (__n > 0)
+  {
+    *__first++ = '.';
+    for (int __i = __n - 1; __i >= 0; --__i, __m >>= 4)
+    {
+      const auto __d = static_cast<int>(__m & 0xf);
+      __first[__i]   = static_cast<char>(__d < 10 ? '0' + __d : 'a' + __d - 10);
+    }
+    __first += __n;
+  }
+  __first[0] = 'p';
+  __first[1] = __exp < 0 ? '-' : '+';
+  _CUDA_VSTD::__to_chars_write_digits(__first + 2 + __exp_len, static_cast<uint64_t>(__abs_exp), __exp_len);
+  return {__first + 2 + __exp_len, errc{}};
+}
+
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_literal(char* __first, char* __last, const char* __str, int __len) noexcept
+{
+  if (__last - __first < __len)
+  {
+    return {__last, errc::value_too_large};
+  }
+  for (int __i = 0; __i < __len; ++__i)
+  {
+    __first[__i] = __str[__i];
+  }
+  return {__first + __len, errc{}};
+}
+
+// Converts __value with the shortest representation that round trips, where a __fmt of chars_format{} selects the
+// shorter of fixed and scientific notation.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_floating_point(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format{} || __fmt == chars_format::general || __fmt == chars_format::fixed
+                 || __fmt == chars_format::scientific || __fmt == chars_format::hex,
+               "invalid chars_format");
+
+  constexpr auto __fp_fmt    = __fp_format_of_v<_Tp>;
+  constexpr int __mant_nbits = __fp_mant_nbits_v<__fp_fmt>;
+  constexpr int __bias       = __fp_exp_bias_v<__fp_fmt>;
+  constexpr int __inf_exp    = (1 << __fp_exp_nbits_v<__fp_fmt>) - 1;
+
+  const auto __bits              = _CUDA_VSTD::__fp_get_storage(__value);
+  const uint64_t __ieee_mantissa = __bits & __fp_mant_mask_v<__fp_fmt>;
+  const int __ieee_exponent      = static_cast<int>((__bits & __fp_exp_mask_v<__fp_fmt>) >> __mant_nbits);
+
+  if (__bits & __fp_sign_mask_v<__fp_fmt>)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+  if (__ieee_exponent == __inf_exp)
+  {
+    return _CUDA_VSTD::__to_chars_literal(__first, __last, __ieee_mantissa == 0 ? "inf" : "nan", 3);
+  }
+  if (__fmt == chars_format::hex)
+  {
+    return _CUDA_VSTD::__to_chars_hex<_Tp>(__first, __last, __ieee_mantissa, __ieee_exponent);
+  }
+  if (__ieee_mantissa == 0 && __ieee_exponent == 0)
+  {
+    return __fmt == chars_format::scientific
+           ? _CUDA_VSTD::__to_chars_literal(__first, __last, "0e+00", 5)
+           : _CUDA_VSTD::__to_chars_literal(__first, __last, "0", 1);
+  }
+
+  const auto __dec    = _CUDA_VSTD::__ryu_shortest<_Tp>(__ieee_mantissa, __ieee_exponent);
+  const int __olength = _CUDA_VSTD::__to_chars_decimal_length(__dec.__mantissa_);
+  const int __sci_exp = __dec.__exponent_ + __olength - 1;
+
+  bool __use_fixed = __fmt == chars_format::fixed;
+  if (__fmt == chars_format::general)
+  {
+    // Like %g with a precision of 6, but with the shortest round trip digits.
+    __use_fixed = __sci_exp >= -4 && __sci_exp < 6;
+  }
+  else if (__fmt == chars_format{})
+  {
+    const int __sci_len   = __olength + (__olength > 1) + 2 + ((__sci_exp <= -100 || __sci_exp >= 100) ? 3 : 2);
+    const int __fixed_len = __dec.__exponent_ >= 0 ? __olength + __dec.__exponent_
+                          : __sci_exp >= 0         ? __olength + 1
+                                                   : __olength + 1 - __sci_exp;
+    __use_fixed = __fixed_len <= __sci_len;
+  }
+
+  if (!__use_fixed)
+  {
+    return _CUDA_VSTD::__to_chars_scientific(__first, __last, __dec, __olength);
+  }
+  const int __e2 = __ieee_exponent - __bias - __mant_nbits;
+  if (__dec.__exponent_ > 0 && __e2 > 0)
+  {
+    return _CUDA_VSTD::__to_chars_exact_integer(
+      __first, __last, (uint64_t{1} << __mant_nbits) | __ieee_mantissa, __e2);
+  }
+  return _CUDA_VSTD::__to_chars_fixed(__first, __last, __dec, __olength);
+}
+
+[[nodiscard]] _CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, float __value) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, chars_format{});
+}
+
+[[nodiscard]] _CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, double __value) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, chars_format{});
+}
+
+[[nodiscard]] _CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, float __value, chars_format __fmt) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+[[nodiscard]] _CCCL_API inline _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, double __value, chars_format __fmt) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -20,6 +20,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__charconv/mul_128.h>
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__functional/unary_function.h>
 #include <cuda/std/__fwd/hash.h>
@@ -38,9 +39,7 @@
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
 
-#ifndef __cuda_std__
-
-#  include <cuda/std/__cccl/prologue.h>
+#include <cuda/std/__cccl/prologue.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
@@ -52,335 +51,126 @@ _CCCL_API inline _Size __loadword(const void* __p)
   return __r;
 }
 
-// We use murmur2 when size_t is 32 bits, and cityhash64 when size_t
-// is 64 bits.  This is because cityhash64 uses 64bit x 64bit
-// multiplication, which can be very slow on 32-bit systems.
-template <class _Size, size_t = sizeof(_Size) * CHAR_BIT>
-struct __murmur2_or_cityhash;
-
-template <class _Size>
-struct __murmur2_or_cityhash<_Size, 32>
-{
-  inline _Size operator()(const void* __key, _Size __len) _CCCL_NO_SANITIZE("unsigned-integer-overflow");
-};
-
-// murmur2
-template <class _Size>
-_Size __murmur2_or_cityhash<_Size, 32>::operator()(const void* __key, _Size __len)
-{
-  const _Size __m             = 0x5bd1e995;
-  const _Size __r             = 24;
-  _Size __h                   = __len;
-  const unsigned char* __data = static_cast<const unsigned char*>(__key);
-  for (; __len >= 4; __data += 4, __len -= 4)
-  {
-    _Size __k = __loadword<_Size>(__data);
-    __k *= __m;
-    __k ^= __k >> __r;
-    __k *= __m;
-    __h *= __m;
-    __h ^= __k;
-  }
-  switch (__len)
-  {
-    case 3:
-      __h ^= static_cast<_Size>(__data[2] << 16);
-      [[fallthrough]];
-    case 2:
-      __h ^= static_cast<_Size>(__data[1] << 8);
-      [[fallthrough]];
-    case 1:
-      __h ^= __data[0];
-      __h *= __m;
-  }
-  __h ^= __h >> 13;
-  __h *= __m;
-  __h ^= __h >> 15;
-  return __h;
-}
-
-template <class _Size>
-struct __murmur2_or_cityhash<_Size, 64>
+// The byte hash follows wyhash, whose mixing step folds the full 128 bit product of two 64 bit words. That is a single
+// wide multiplication on the host and two multiplications on the device, which makes it much cheaper per byte than
+// cityhash64. The three lanes of the bulk loop run independently of each other.
+struct __wyhash
 {
-  inline _Size operator()(const void* __key, _Size __len) _CCCL_NO_SANITIZE("unsigned-integer-overflow");
-
-private:
-  // Some primes between 2^63 and 2^64.
-  static const _Size __k0 = 0xc3a5c85c97cb3127ULL;
-  static const _Size __k1 = 0xb492b66fbe98f273ULL;
-  static const _Size __k2 = 0x9ae16a3b2f90404fULL;
-  static const _Size __k3 = 0xc949d7c7509e6557ULL;
+  static constexpr uint64_t __secret0 = 0x2d358dccaa6c78a5ull;
+  static constexpr uint64_t __secret1 = 0x8bb84b93962eacc9ull;
+  static constexpr uint64_t __secret2 = 0x4b33a62ed433d4a3ull;
+  static constexpr uint64_t __secret3 = 0x4d5a2da51de1aa47ull;
 
-  static _Size __rotate(_Size __val, int __shift)
+  [[nodiscard]] _CCCL_API static constexpr uint64_t __mix(uint64_t __a, uint64_t __b) noexcept
   {
-    return __shift == 0 ? __val : ((__val >> __shift) | (__val << (64 - __shift)));
+    const auto __r = _CUDA_VSTD::__charconv_mul_128(__a, __b);
+    return __r.__low_ ^ __r.__high_;
   }
 
-  static _Size __rotate_by_at_least_1(_Size __val, int __shift)
+  [[nodiscard]] _CCCL_API static uint64_t __load_3(const unsigned char* __p, size_t __len) noexcept
   {
-    return (__val >> __shift) | (__val << (64 - __shift));
+    return (static_cast<uint64_t>(__p[0]) << 16) | (static_cast<uint64_t>(__p[__len >> 1]) << 8) | __p[__len - 1];
   }
 
-  static _Size __shift_mix(_Size __val)
+  [[nodiscard]] _CCCL_API static uint64_t __finalize(uint64_t __a, uint64_t __b, uint64_t __seed, size_t __len) noexcept
   {
-    return __val ^ (__val >> 47);
+    const auto __r = _CUDA_VSTD::__charconv_mul_128(__a ^ __secret1, __b ^ __seed);
+    return __mix(__r.__low_ ^ __secret0 ^ __len, __r.__high_ ^ __secret1);
   }
 
-  static _Size __hash_len_16(_Size __u, _Size __v) _CCCL_NO_SANITIZE("unsigned-integer-overflow")
+  [[nodiscard]] _CCCL_API static uint64_t __hash_long(const unsigned char* __p, size_t __len, uint64_t __seed) noexcept
   {
-    const _Size __mul = 0x9ddfea08eb382d69ULL;
-    _Size __a         = (__u ^ __v) * __mul;
-    __a ^= (__a >> 47);
-    _Size __b = (__v ^ __a) * __mul;
-    __b ^= (__b >> 47);
-    __b *= __mul;
-    return __b;
-  }
-
-  static _Size __hash_len_0_to_16(const char* __s, _Size __len) _CCCL_NO_SANITIZE("unsigned-integer-overflow")
-  {
-    if (__len > 8)
-    {
-      const _Size __a = __loadword<_Size>(__s);
-      const _Size __b = __loadword<_Size>(__s + __len - 8);
-      return __hash_len_16(__a, __rotate_by_at_least_1(__b + __len, __len)) ^ __b;
-    }
-    if (__len >= 4)
+    size_t __i = __len;
+    if (__i >= 48)
     {
-      const uint32_t __a = __loadword<uint32_t>(__s);
-      const uint32_t __b = __loadword<uint32_t>(__s + __len - 4);
-      return __hash_len_16(__len + (static_cast<_Size>(__a) << 3), __b);
+      uint64_t __see1 = __seed;
+      uint64_t __see2 = __seed;
+      do
+      {
+        __seed = __mix(__loadword<uint64_t>(__p) ^ __secret1, __loadword<uint64_t>(__p + 8) ^ __seed);
+        __see1 = __mix(__loadword<uint64_t>(__p + 16) ^ __secret2, __loadword<uint64_t>(__p + 24) ^ __see1);
+        __see2 = __mix(__loadword<uint64_t>(__p + 32) ^ __secret3, __loadword<uint64_t>(__p + 40) ^ __see2);
+        __p += 48;
+        __i -= 48;
+      } while (__i >= 48);
+      __seed ^= __see1 ^ __see2;
     }
-    if (__len > 0)
+    for (; __i > 16; __i -= 16, __p += 16)
     {
-      const unsigned char __a = static_cast<unsigned char>(__s[0]);
-      const unsigned char __b = static_cast<unsigned char>(__s[__len >> 1]);
-      const unsigned char __c = static_cast<unsigned char>(__s[__len - 1]);
-      const uint32_t __y      = static_cast<uint32_t>(__a) + (static_cast<uint32_t>(__b) << 8);
-      const uint32_t __z      = __len + (static_cast<uint32_t>(__c) << 2);
-      return __shift_mix(__y * __k2 ^ __z * __k3) * __k2;
+      __seed = __mix(__loadword<uint64_t>(__p) ^ __secret1, __loadword<uint64_t>(__p + 8) ^ __seed);
     }
-    return __k2;
-  }
-
-  static _Size __hash_len_17_to_32(const char* __s, _Size __len) _CCCL_NO_SANITIZE("unsigned-integer-overflow")
-  {
-    const _Size __a = __loadword<_Size>(__s) * __k1;
-    const _Size __b = __loadword<_Size>(__s + 8);
-    const _Size __c = __loadword<_Size>(__s + __len - 8) * __k2;
-    const _Size __d = __loadword<_Size>(__s + __len - 16) * __k0;
-    return __hash_len_16(__rotate(__a - __b, 43) + __rotate(__c, 30) + __d,
-                         __a + __rotate(__b ^ __k3, 20) - __c + __len);
-  }
-
-  // Return a 16-byte hash for 48 bytes.  Quick and dirty.
-  // Callers do best to use "random-looking" values for a and b.
-  static pair<_Size, _Size>
-  __weak_hash_len_32_with_seeds(_Size __w, _Size __x, _Size __y, _Size __z, _Size __a, _Size __b)
-    _CCCL_NO_SANITIZE("unsigned-integer-overflow")
-  {
-    __a += __w;
-    __b             = __rotate(__b + __a + __z, 21);
-    const _Size __c = __a;
-    __a += __x;
-    __a += __y;
-    __b += __rotate(__a, 44);
-    return pair<_Size, _Size>(__a + __z, __b + __c);
-  }
-
-  // Return a 16-byte hash for s[0] ... s[31], a, and b.  Quick and dirty.
-  static pair<_Size, _Size> __weak_hash_len_32_with_seeds(const char* __s, _Size __a, _Size __b)
-    _CCCL_NO_SANITIZE("unsigned-integer-overflow")
-  {
-    return __weak_hash_len_32_with_seeds(
-      __loadword<_Size>(__s),
-      __loadword<_Size>(__s + 8),
-      __loadword<_Size>(__s + 16),
-      __loadword<_Size>(__s + 24),
-      __a,
-      __b);
+    return __finalize(__loadword<uint64_t>(__p + __i - 16), __loadword<uint64_t>(__p + __i - 8), __seed, __len);
   }
 
-  // Return an 8-byte hash for 33 to 64 bytes.
-  static _Size __hash_len_33_to_64(const char* __s, size_t __len) _CCCL_NO_SANITIZE("unsigned-integer-overflow")
+  // Short keys are handled inline, where the mixing of a constant seed folds away
+  [[nodiscard]] _CCCL_API static uint64_t __hash(const void* __key, size_t __len, uint64_t __seed) noexcept
   {
-    _Size __z = __loadword<_Size>(__s + 24);
-    _Size __a = __loadword<_Size>(__s) + (__len + __loadword<_Size>(__s + __len - 16)) * __k0;
-    _Size __b = __rotate(__a + __z, 52);
-    _Size __c = __rotate(__a, 37);
-    __a += __loadword<_Size>(__s + 8);
-    __c += __rotate(__a, 7);
-    __a += __loadword<_Size>(__s + 16);
-    _Size __vf = __a + __z;
-    _Size __vs = __b + __rotate(__a, 31) + __c;
-    __a        = __loadword<_Size>(__s + 16) + __loadword<_Size>(__s + __len - 32);
-    __z += __loadword<_Size>(__s + __len - 8);
-    __b = __rotate(__a + __z, 52);
-    __c = __rotate(__a, 37);
-    __a += __loadword<_Size>(__s + __len - 24);
-    __c += __rotate(__a, 7);
-    __a += __loadword<_Size>(__s + __len - 16);
-    _Size __wf = __a + __z;
-    _Size __ws = __b + __rotate(__a, 31) + __c;
-    _Size __r  = __shift_mix((__vf + __ws) * __k2 + (__wf + __vs) * __k0);
-    return __shift_mix(__r * __k0 + __vs) * __k2;
-  }
-};
-
-// cityhash64
-template <class _Size>
-_Size __murmur2_or_cityhash<_Size, 64>::operator()(const void* __key, _Size __len)
-{
-  const char* __s = static_cast<const char*>(__key);
-  if (__len <= 32)
-  {
-    if (__len <= 16)
+    const unsigned char* __p = static_cast<const unsigned char*>(__key);
+    __seed ^= __mix(__seed ^ __secret0, __secret1);
+    if (__len > 16)
     {
-      return __hash_len_0_to_16(__s, __len);
+      return __hash_long(__p, __len, __seed);
     }
-    else
+    uint64_t __a = 0;
+    uint64_t __b = 0;
+    if (__len >= 8)
     {
-      return __hash_len_17_to_32(__s, __len);
+      __a = __loadword<uint64_t>(__p);
+      __b = __loadword<uint64_t>(__p + __len - 8);
     }
-  }
-  else if (__len <= 64)
-  {
-    return __hash_len_33_to_64(__s, __len);
-  }
-
-  // For strings over 64 bytes we hash the end first, and then as we
-  // loop we keep 56 bytes of state: v, w, x, y, and z.
-  _Size __x = __loadword<_Size>(__s + __len - 40);
-  _Size __y = __loadword<_Size>(__s + __len - 16) + __loadword<_Size>(__s + __len - 56);
-  _Size __z = __hash_len_16(__loadword<_Size>(__s + __len - 48) + __len, __loadword<_Size>(__s + __len - 24));
-  pair<_Size, _Size> __v = __weak_hash_len_32_with_seeds(__s + __len - 64, __len, __z);
-  pair<_Size, _Size> __w = __weak_hash_len_32_with_seeds(__s + __len - 32, __y + __k1, __x);
-  __x                    = __x * __k1 + __loadword<_Size>(__s);
-
-  // Decrease len to the nearest multiple of 64, and operate on 64-byte chunks.
-  __len = (__len - 1) & ~static_cast<_Size>(63);
-  do
-  {
-    __x = __rotate(__x + __y + __v.first + __loadword<_Size>(__s + 8), 37) * __k1;
-    __y = __rotate(__y + __v.second + __loadword<_Size>(__s + 48), 42) * __k1;
-    __x ^= __w.second;
-    __y += __v.first + __loadword<_Size>(__s + 40);
-    __z = __rotate(__z + __w.first, 33) * __k1;
-    __v = __weak_hash_len_32_with_seeds(__s, __v.second * __k1, __x + __w.first);
-    __w = __weak_hash_len_32_with_seeds(__s + 32, __z + __w.second, __y + __loadword<_Size>(__s + 16));
-    _CUDA_VSTD::swap(__z, __x);
-    __s += 64;
-    __len -= 64;
-  } while (__len != 0);
-  return __hash_len_16(__hash_len_16(__v.first, __w.first) + __shift_mix(__y) * __k1 + __z,
-                       __hash_len_16(__v.second, __w.second) + __x);
-}
-
-template <class _Tp, size_t = sizeof(_Tp) / sizeof(size_t)>
-struct __scalar_hash;
-
-template <class _Tp>
-struct __scalar_hash<_Tp, 0> : public __unary_function<_Tp, size_t>
-{
-  _CCCL_API inline size_t operator()(_Tp __v) const noexcept
-  {
-    union
+    else if (__len >= 4)
     {
-      _Tp __t;
-      size_t __a;
-    } __u;
-    __u.__a = 0;
-    __u.__t = __v;
-    return __u.__a;
-  }
-};
-
-template <class _Tp>
-struct __scalar_hash<_Tp, 1> : public __unary_function<_Tp, size_t>
-{
-  _CCCL_API inline size_t operator()(_Tp __v) const noexcept
-  {
-    union
+      __a = __loadword<uint32_t>(__p);
+      __b = __loadword<uint32_t>(__p + __len - 4);
+    }
+    else if (__len > 0)
     {
-      _Tp __t;
-      size_t __a;
-    } __u;
-    __u.__t = __v;
-    return __u.__a;
+      __a = __load_3(__p, __len);
+    }
+    return __finalize(__a, __b, __seed, __len);
   }
 };
 
-template <class _Tp>
-struct __scalar_hash<_Tp, 2> : public __unary_function<_Tp, size_t>
+// Hashes the object representation of __len bytes at __key
+[[nodiscard]] _CCCL_API inline size_t __hash_memory(const void* __key, size_t __len, size_t __seed = 0) noexcept
 {
-  _CCCL_API inline size_t operator()(_Tp __v) const noexcept
-  {
-    union
-    {
-      _Tp __t;
-      struct
-      {
-        size_t __a;
-        size_t __b;
-      } __s;
-    } __u;
-    __u.__t = __v;
-    return __murmur2_or_cityhash<size_t>()(&__u, sizeof(__u));
-  }
-};
+  return static_cast<size_t>(__wyhash::__hash(__key, __len, __seed));
+}
 
-template <class _Tp>
-struct __scalar_hash<_Tp, 3> : public __unary_function<_Tp, size_t>
+// Mixes all bits of a single word into all bits of the result. This is the murmur3 finalizer, which is a bijection, so
+// distinct words never collide.
+[[nodiscard]] _CCCL_API constexpr size_t __hash_mix(uint64_t __v) noexcept
 {
-  _CCCL_API inline size_t operator()(_Tp __v) const noexcept
-  {
-    union
-    {
-      _Tp __t;
-      struct
-      {
-        size_t __a;
-        size_t __b;
-        size_t __c;
-      } __s;
-    } __u;
-    __u.__t = __v;
-    return __murmur2_or_cityhash<size_t>()(&__u, sizeof(__u));
-  }
-};
+  __v ^= __v >> 33;
+  __v *= 0xff51afd7ed558ccdull;
+  __v ^= __v >> 33;
+  __v *= 0xc4ceb9fe1a85ec53ull;
+  __v ^= __v >> 33;
+  return static_cast<size_t>(__v);
+}
 
 template <class _Tp>
-struct __scalar_hash<_Tp, 4> : public __unary_function<_Tp, size_t>
+struct __scalar_hash : public __unary_function<_Tp, size_t>
 {
   _CCCL_API inline size_t operator()(_Tp __v) const noexcept
   {
-    union
+    if constexpr (sizeof(_Tp) <= sizeof(uint64_t))
     {
-      _Tp __t;
-      struct
-      {
-        size_t __a;
-        size_t __b;
-        size_t __c;
-        size_t __d;
-      } __s;
-    } __u;
-    __u.__t = __v;
-    return __murmur2_or_cityhash<size_t>()(&__u, sizeof(__u));
+      uint64_t __a = 0;
+      _CUDA_VSTD::memcpy(&__a, &__v, sizeof(_Tp));
+      return _CUDA_VSTD::__hash_mix(__a);
+    }
+    else
+    {
+      return _CUDA_VSTD::__hash_memory(&__v, sizeof(_Tp));
+    }
   }
 };
 
-struct _PairT
+// Combines two hash values such that the result depends on their order
+[[nodiscard]] _CCCL_API constexpr size_t __hash_combine(size_t __lhs, size_t __rhs) noexcept
 {
-  size_t first;
-  size_t second;
-};
-
-_CCCL_API inline size_t __hash_combine(size_t __lhs, size_t __rhs) noexcept
-{
-  using _HashT     = __scalar_hash<_PairT>;
-  const _PairT __p = {__lhs, __rhs};
-  return _HashT()(__p);
+  return static_cast<size_t>(__wyhash::__mix(__lhs ^ __wyhash::__secret0, __rhs ^ __wyhash::__secret1));
 }
 
 template <class _Tp>
@@ -388,13 +178,7 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<_Tp*> : public __unary_function<_Tp*,
 {
   _CCCL_API inline size_t operator()(_Tp* __v) const noexcept
   {
-    union
-    {
-      _Tp* __t;
-      size_t __a;
-    } __u;
-    __u.__t = __v;
-    return __murmur2_or_cityhash<size_t>()(&__u, sizeof(__u));
+    return _CUDA_VSTD::__hash_mix(reinterpret_cast<uintptr_t>(__v));
   }
 };
 
@@ -516,14 +300,24 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<unsigned long> : public __unary_functi
 };
 
 template <>
-struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<long long> : public __scalar_hash<long long>
-{};
+struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<long long> : public __unary_function<long long, size_t>
+{
+  _CCCL_API inline size_t operator()(long long __v) const noexcept
+  {
+    return static_cast<size_t>(__v);
+  }
+};
 
 template <>
-struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<unsigned long long> : public __scalar_hash<unsigned long long>
-{};
+struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<unsigned long long> : public __unary_function<unsigned long long, size_t>
+{
+  _CCCL_API inline size_t operator()(unsigned long long __v) const noexcept
+  {
+    return static_cast<size_t>(__v);
+  }
+};
 
-#  if _CCCL_HAS_INT128()
+#if _CCCL_HAS_INT128()
 
 template <>
 struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<__int128_t> : public __scalar_hash<__int128_t>
@@ -533,7 +327,7 @@ template <>
 struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<__uint128_t> : public __scalar_hash<__uint128_t>
 {};
 
-#  endif // _CCCL_HAS_INT128()
+#endif // _CCCL_HAS_INT128()
 
 template <>
 struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<float> : public __scalar_hash<float>
@@ -573,7 +367,7 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<long double> : public __scalar_hash<lo
     {
       return 0;
     }
-#  if _CCCL_ARCH(X86_64) && _CCCL_OS(LINUX)
+#if _CCCL_ARCH(X86_64) && _CCCL_OS(LINUX)
     // Zero out padding bits
     union
     {
@@ -587,10 +381,10 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT hash<long double> : public __scalar_hash<lo
     __u.__s.__a = 0;
     __u.__s.__b = 0;
     __u.__t     = __v;
-    return __u.__s.__a ^ __u.__s.__b;
-#  else
+    return _CUDA_VSTD::__hash_combine(__u.__s.__a, __u.__s.__b);
+#else
     return __scalar_hash<long double>::operator()(__v);
-#  endif
+#endif
   }
 };
 
@@ -643,8 +437,6 @@ using __enable_hash_helper _CCCL_NODEBUG_ALIAS =
 
 _LIBCUDACXX_END_NAMESPACE_STD
 
-#  include <cuda/std/__cccl/epilogue.h>
-
-#endif // __cuda_std__
+#include <cuda/std/__cccl/epilogue.h>
 
 #endif // _LIBCUDACXX___FUNCTIONAL_HASH_H
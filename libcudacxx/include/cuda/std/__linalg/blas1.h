@@ -0,0 +1,347 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_BLAS1_HPP
+#define _LIBCUDACXX___LINALG_BLAS1_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/conjugated.h>
+#include <cuda/std/__linalg/helpers.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/limits>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg
+{
+
+namespace __detail
+{
+
+template <class _Ext1, class _Ext2>
+[[nodiscard]] _CCCL_API constexpr bool __compatible_static_extents(size_t __r1, size_t __r2) noexcept
+{
+  return _Ext1::static_extent(__r1) == dynamic_extent || _Ext2::static_extent(__r2) == dynamic_extent
+      || _Ext1::static_extent(__r1) == _Ext2::static_extent(__r2);
+}
+
+// Whether two vectors or matrices of the same rank can have the same extents
+template <class _Ext1, class _Ext2>
+[[nodiscard]] _CCCL_API constexpr bool __compatible_static_extents() noexcept
+{
+  static_assert(_Ext1::rank() == _Ext2::rank(), "linalg: the arguments must have the same rank");
+  for (size_t __r = 0; __r < _Ext1::rank(); ++__r)
+  {
+    if (!__detail::__compatible_static_extents<_Ext1, _Ext2>(__r, __r))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class _InObj1, class _InObj2>
+[[nodiscard]] _CCCL_API constexpr bool __same_extents(const _InObj1& __x, const _InObj2& __y) noexcept
+{
+  for (size_t __r = 0; __r < _InObj1::rank(); ++__r)
+  {
+    if (static_cast<size_t>(__x.extent(__r)) != static_cast<size_t>(__y.extent(__r)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Host code keeps four partial sums, which hides the latency of the additions and lets the compiler use vector
+// registers. Device code sums in order, since every thread already runs its own reduction.
+template <class _Scalar, class _IndexType, class _Term>
+[[nodiscard]] _CCCL_HOST_API inline _Scalar __accumulate_unrolled(_IndexType __n, _Scalar __init, _Term& __term)
+{
+  _Scalar __sum0 = __init;
+  _Scalar __sum1{};
+  _Scalar __sum2{};
+  _Scalar __sum3{};
+  _IndexType __i = 0;
+  for (; __n - __i >= 4; __i += 4)
+  {
+    __sum0 = __sum0 + __term(__i);
+    __sum1 = __sum1 + __term(__i + 1);
+    __sum2 = __sum2 + __term(__i + 2);
+    __sum3 = __sum3 + __term(__i + 3);
+  }
+  for (; __i < __n; ++__i)
+  {
+    __sum0 = __sum0 + __term(__i);
+  }
+  return (__sum0 + __sum1) + (__sum2 + __sum3);
+}
+
+// Returns __init plus the sum of __term(__i) for all __i in [0, __n)
+template <class _Scalar, class _IndexType, class _Term>
+[[nodiscard]] _CCCL_API inline _Scalar __accumulate(_IndexType __n, _Scalar __init, _Term __term)
+{
+  NV_IF_TARGET(NV_IS_HOST, (return __detail::__accumulate_unrolled(__n, __init, __term);))
+  for (_IndexType __i = 0; __i < __n; ++__i)
+  {
+    __init = __init + __term(__i);
+  }
+  return __init;
+}
+
+// The magnitude used by vector_abs_sum and vector_idx_abs_max, which is |re| + |im| for complex numbers as in the BLAS
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_sum_magnitude(const _Tp& __t)
+{
+  if constexpr (_CCCL_TRAIT(is_arithmetic, _Tp))
+  {
+    return __detail::__abs_if_needed(__t);
+  }
+  else
+  {
+    return __detail::__abs_if_needed(__detail::__real_if_needed(__t))
+         + __detail::__abs_if_needed(__detail::__imag_if_needed(__t));
+  }
+  _CCCL_UNREACHABLE();
+}
+
+// Two-norm that rescales the running sum of squares so that it neither overflows nor underflows
+template <class _InVec, class _Scalar>
+[[nodiscard]] _CCCL_API inline _Scalar __vector_two_norm_scaled(const _InVec& __v, _Scalar __init)
+{
+  _Scalar __scale = 0;
+  _Scalar __ssq   = 1;
+  auto __add      = [&](_Scalar __x) {
+    const _Scalar __ax = __detail::__abs_if_needed(__x);
+    if (__ax != _Scalar(0))
+    {
+      if (__scale < __ax)
+      {
+        const _Scalar __ratio = __scale / __ax;
+        __ssq                 = _Scalar(1) + __ssq * __ratio * __ratio;
+        __scale               = __ax;
+      }
+      else
+      {
+        const _Scalar __ratio = __ax / __scale;
+        __ssq                 = __ssq + __ratio * __ratio;
+      }
+    }
+  };
+  __add(__init);
+  for (typename _InVec::index_type __i = 0; __i < __v.extent(0); ++__i)
+  {
+    __add(static_cast<_Scalar>(__v(__i)));
+  }
+  return __scale * _CUDA_VSTD::sqrt(__ssq);
+}
+
+} // namespace __detail
+
+// [linalg.algs.blas1.copy]
+_CCCL_TEMPLATE(class _InObj, class _OutObj)
+_CCCL_REQUIRES(__detail::__in_object<_InObj> _CCCL_AND __detail::__out_object<_OutObj>)
+_CCCL_API inline void copy(_InObj __x, _OutObj __y)
+{
+  static_assert(__detail::__compatible_static_extents<typename _InObj::extents_type, typename _OutObj::extents_type>(),
+                "linalg::copy: x and y must have compatible extents");
+  _CCCL_ASSERT(__detail::__same_extents(__x, __y), "linalg::copy: x and y must have the same extents");
+  __detail::__for_each_index(__y, [&](auto... __idx) {
+    __y(__idx...) = __x(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.swap]
+_CCCL_TEMPLATE(class _InOutObj1, class _InOutObj2)
+_CCCL_REQUIRES(__detail::__inout_object<_InOutObj1> _CCCL_AND __detail::__inout_object<_InOutObj2>)
+_CCCL_API inline void swap_elements(_InOutObj1 __x, _InOutObj2 __y)
+{
+  static_assert(
+    __detail::__compatible_static_extents<typename _InOutObj1::extents_type, typename _InOutObj2::extents_type>(),
+    "linalg::swap_elements: x and y must have compatible extents");
+  _CCCL_ASSERT(__detail::__same_extents(__x, __y), "linalg::swap_elements: x and y must have the same extents");
+  __detail::__for_each_index(__x, [&](auto... __idx) {
+    using _CUDA_VSTD::swap;
+    swap(__x(__idx...), __y(__idx...));
+  });
+}
+
+// [linalg.algs.blas1.scal]
+_CCCL_TEMPLATE(class _Scalar, class _InOutObj)
+_CCCL_REQUIRES(__detail::__inout_object<_InOutObj>)
+_CCCL_API inline void scale(_Scalar __alpha, _InOutObj __x)
+{
+  __detail::__for_each_index(__x, [&](auto... __idx) {
+    __x(__idx...) = __alpha * __x(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.add]
+_CCCL_TEMPLATE(class _InObj1, class _InObj2, class _OutObj)
+_CCCL_REQUIRES(__detail::__in_object<_InObj1> _CCCL_AND __detail::__in_object<_InObj2> _CCCL_AND
+                 __detail::__out_object<_OutObj>)
+_CCCL_API inline void add(_InObj1 __x, _InObj2 __y, _OutObj __z)
+{
+  static_assert(__detail::__compatible_static_extents<typename _InObj1::extents_type, typename _OutObj::extents_type>()
+                  && __detail::__compatible_static_extents<typename _InObj2::extents_type,
+                                                           typename _OutObj::extents_type>(),
+                "linalg::add: x, y and z must have compatible extents");
+  _CCCL_ASSERT(__detail::__same_extents(__x, __z) && __detail::__same_extents(__y, __z),
+               "linalg::add: x, y and z must have the same extents");
+  __detail::__for_each_index(__z, [&](auto... __idx) {
+    __z(__idx...) = __x(__idx...) + __y(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.dot]
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API inline _Scalar dot(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  static_assert(__detail::__compatible_static_extents<typename _InVec1::extents_type, typename _InVec2::extents_type>(),
+                "linalg::dot: v1 and v2 must have compatible extents");
+  _CCCL_ASSERT(__v1.extent(0) == __v2.extent(0), "linalg::dot: v1 and v2 must have the same extents");
+  return __detail::__accumulate(__v1.extent(0), __init, [&](typename _InVec1::index_type __i) {
+    return __v1(__i) * __v2(__i);
+  });
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API inline auto dot(_InVec1 __v1, _InVec2 __v2)
+{
+  using __result_type = decltype(_CUDA_VSTD::declval<typename _InVec1::value_type>()
+                                 * _CUDA_VSTD::declval<typename _InVec2::value_type>());
+  return linalg::dot(__v1, __v2, __result_type{});
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API inline _Scalar dotc(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  return linalg::dot(linalg::conjugated(__v1), __v2, __init);
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API inline auto dotc(_InVec1 __v1, _InVec2 __v2)
+{
+  using __result_type = decltype(conj_if_needed(_CUDA_VSTD::declval<typename _InVec1::value_type>())
+                                 * _CUDA_VSTD::declval<typename _InVec2::value_type>());
+  return linalg::dotc(__v1, __v2, __result_type{});
+}
+
+// [linalg.algs.blas1.nrm2]
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API inline _Scalar vector_two_norm(_InVec __v, _Scalar __init)
+{
+  using __value_type = typename _InVec::value_type;
+  if constexpr (_CCCL_TRAIT(is_floating_point, _Scalar) && _CCCL_TRAIT(is_arithmetic, __value_type))
+  {
+    // Sum the squares directly and only rescale when the sum overflowed, or is so small that the squares of some
+    // elements may have lost precision
+    const _Scalar __ssq =
+      __detail::__accumulate(__v.extent(0), __init * __init, [&](typename _InVec::index_type __i) {
+        const _Scalar __x = static_cast<_Scalar>(__v(__i));
+        return __x * __x;
+      });
+    constexpr _Scalar __min = numeric_limits<_Scalar>::min() / numeric_limits<_Scalar>::epsilon();
+    constexpr _Scalar __max = numeric_limits<_Scalar>::max();
+    if (__ssq >= __min && __ssq <= __max)
+    {
+      return _CUDA_VSTD::sqrt(__ssq);
+    }
+    return __detail::__vector_two_norm_scaled(__v, __init);
+  }
+  else
+  {
+    using _CUDA_VSTD::sqrt;
+    return sqrt(__detail::__accumulate(__v.extent(0), __init * __init, [&](typename _InVec::index_type __i) {
+      const auto __x = __detail::__abs_if_needed(__v(__i));
+      return __x * __x;
+    }));
+  }
+  _CCCL_UNREACHABLE();
+}
+
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API inline auto vector_two_norm(_InVec __v)
+{
+  using __result_type = decltype(__detail::__abs_if_needed(_CUDA_VSTD::declval<typename _InVec::value_type>()));
+  return linalg::vector_two_norm(__v, __result_type{});
+}
+
+// [linalg.algs.blas1.asum]
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API inline _Scalar vector_abs_sum(_InVec __v, _Scalar __init)
+{
+  return __detail::__accumulate(__v.extent(0), __init, [&](typename _InVec::index_type __i) {
+    return __detail::__abs_sum_magnitude(__v(__i));
+  });
+}
+
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API inline auto vector_abs_sum(_InVec __v)
+{
+  return linalg::vector_abs_sum(__v, typename _InVec::value_type{});
+}
+
+// [linalg.algs.blas1.iamax]
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API inline typename _InVec::extents_type::size_type vector_idx_abs_max(_InVec __v)
+{
+  using __size_type = typename _InVec::extents_type::size_type;
+  if (__v.extent(0) == 0)
+  {
+    return numeric_limits<__size_type>::max();
+  }
+  __size_type __max_idx = 0;
+  auto __max_val        = __detail::__abs_sum_magnitude(__v(0));
+  for (typename _InVec::index_type __i = 1; __i < __v.extent(0); ++__i)
+  {
+    const auto __val = __detail::__abs_sum_magnitude(__v(__i));
+    if (__max_val < __val)
+    {
+      __max_idx = static_cast<__size_type>(__i);
+      __max_val = __val;
+    }
+  }
+  return __max_idx;
+}
+
+} // end namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___LINALG_BLAS1_HPP
@@ -0,0 +1,237 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_BLAS2_HPP
+#define _LIBCUDACXX___LINALG_BLAS2_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/blas1.h>
+#include <cuda/std/__linalg/helpers.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg
+{
+
+namespace __detail
+{
+
+template <class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void __check_matrix_vector_extents(const _InMat& __A, const _InVec& __x, const _OutVec& __y)
+{
+  using __mat_extents = typename _InMat::extents_type;
+  static_assert(__detail::__compatible_static_extents<__mat_extents, typename _InVec::extents_type>(1, 0)
+                  && __detail::__compatible_static_extents<__mat_extents, typename _OutVec::extents_type>(0, 0),
+                "linalg: the extents of the matrix and the vectors are not compatible");
+  _CCCL_ASSERT(static_cast<size_t>(__A.extent(1)) == static_cast<size_t>(__x.extent(0))
+                 && static_cast<size_t>(__A.extent(0)) == static_cast<size_t>(__y.extent(0)),
+               "linalg: the extents of the matrix and the vectors do not match");
+}
+
+// y += A * x for a matrix whose columns are contiguous. Four columns are combined per pass over y, which quarters the
+// loads and stores of y.
+template <class _InMat, class _InVec, class _InOutVec>
+_CCCL_HOST_API inline void
+__matrix_vector_product_column_major(const _InMat& __A, const _InVec& __x, const _InOutVec& __y)
+{
+  using __index_type     = typename _InMat::index_type;
+  const __index_type __m = __A.extent(0);
+  const __index_type __n = __A.extent(1);
+  __index_type __j       = 0;
+  for (; __n - __j >= 4; __j += 4)
+  {
+    const auto __x0 = __x(__j);
+    const auto __x1 = __x(__j + 1);
+    const auto __x2 = __x(__j + 2);
+    const auto __x3 = __x(__j + 3);
+    for (__index_type __i = 0; __i < __m; ++__i)
+    {
+      __y(__i) = __y(__i)
+               + ((__A(__i, __j) * __x0 + __A(__i, __j + 1) * __x1)
+                  + (__A(__i, __j + 2) * __x2 + __A(__i, __j + 3) * __x3));
+    }
+  }
+  for (; __j < __n; ++__j)
+  {
+    const auto __xj = __x(__j);
+    for (__index_type __i = 0; __i < __m; ++__i)
+    {
+      __y(__i) = __y(__i) + __A(__i, __j) * __xj;
+    }
+  }
+}
+
+// y += A * x
+template <class _InMat, class _InVec, class _InOutVec>
+_CCCL_API inline void __matrix_vector_product(const _InMat& __A, const _InVec& __x, const _InOutVec& __y)
+{
+  using __index_type = typename _InMat::index_type;
+  using __value_type = typename _InOutVec::value_type;
+  NV_IF_TARGET(NV_IS_HOST, ({
+                 if (__detail::__is_column_major(__A.mapping()))
+                 {
+                   __detail::__matrix_vector_product_column_major(__A, __x, __y);
+                   return;
+                 }
+               }))
+  for (__index_type __i = 0; __i < __A.extent(0); ++__i)
+  {
+    __y(__i) = __detail::__accumulate(__A.extent(1), static_cast<__value_type>(__y(__i)), [&](__index_type __j) {
+      return __A(__i, __j) * __x(__j);
+    });
+  }
+}
+
+// Solves A * x = b with x and b being allowed to be the same vector
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec>
+_CCCL_API inline void __triangular_matrix_vector_solve(const _InMat& __A, const _InVec& __b, const _OutVec& __x)
+{
+  using __index_type             = typename _InMat::index_type;
+  using __value_type             = typename _OutVec::value_type;
+  constexpr bool __lower         = _CCCL_TRAIT(is_same, _Triangle, lower_triangle_t);
+  constexpr bool __explicit_diag = _CCCL_TRAIT(is_same, _DiagonalStorage, explicit_diagonal_t);
+  const __index_type __n         = __A.extent(0);
+
+  // Column-major matrices are solved a column at a time, which subtracts the contribution of each solved element from
+  // the remaining ones down a contiguous column
+  NV_IF_TARGET(
+    NV_IS_HOST, ({
+      if (__detail::__is_column_major(__A.mapping()))
+      {
+        for (__index_type __i = 0; __i < __n; ++__i)
+        {
+          __x(__i) = __b(__i);
+        }
+        for (__index_type __k = 0; __k < __n; ++__k)
+        {
+          const __index_type __j = __lower ? __k : __n - 1 - __k;
+          if constexpr (__explicit_diag)
+          {
+            __x(__j) = __x(__j) / __A(__j, __j);
+          }
+          const __value_type __xj   = __x(__j);
+          const __index_type __from = __lower ? __j + 1 : 0;
+          const __index_type __to   = __lower ? __n : __j;
+          for (__index_type __i = __from; __i < __to; ++__i)
+          {
+            __x(__i) = __x(__i) - __A(__i, __j) * __xj;
+          }
+        }
+        return;
+      }
+    }))
+
+  for (__index_type __k = 0; __k < __n; ++__k)
+  {
+    const __index_type __i    = __lower ? __k : __n - 1 - __k;
+    const __index_type __from = __lower ? 0 : __i + 1;
+    const __index_type __to   = __lower ? __i : __n;
+    __value_type __sum        = __b(__i);
+    for (__index_type __j = __from; __j < __to; ++__j)
+    {
+      __sum = __sum - __A(__i, __j) * __x(__j);
+    }
+    if constexpr (__explicit_diag)
+    {
+      __sum = __sum / __A(__i, __i);
+    }
+    __x(__i) = __sum;
+  }
+}
+
+} // namespace __detail
+
+// [linalg.algs.blas2.gemv]
+_CCCL_TEMPLATE(class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec> _CCCL_AND
+                 __detail::__out_vector<_OutVec>)
+_CCCL_API inline void matrix_vector_product(_InMat __A, _InVec __x, _OutVec __y)
+{
+  __detail::__check_matrix_vector_extents(__A, __x, __y);
+  for (typename _OutVec::index_type __i = 0; __i < __y.extent(0); ++__i)
+  {
+    __y(__i) = typename _OutVec::value_type{};
+  }
+  __detail::__matrix_vector_product(__A, __x, __y);
+}
+
+_CCCL_TEMPLATE(class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2> _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_API inline void matrix_vector_product(_InMat __A, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  __detail::__check_matrix_vector_extents(__A, __x, __z);
+  linalg::copy(__y, __z);
+  __detail::__matrix_vector_product(__A, __x, __z);
+}
+
+// [linalg.algs.blas2.rank1]
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2> _CCCL_AND
+                 __detail::__inout_matrix<_InOutMat>)
+_CCCL_API inline void matrix_rank_1_update(_InVec1 __x, _InVec2 __y, _InOutMat __A)
+{
+  using __mat_extents = typename _InOutMat::extents_type;
+  static_assert(__detail::__compatible_static_extents<__mat_extents, typename _InVec1::extents_type>(0, 0)
+                  && __detail::__compatible_static_extents<__mat_extents, typename _InVec2::extents_type>(1, 0),
+                "linalg::matrix_rank_1_update: the extents of A, x and y are not compatible");
+  _CCCL_ASSERT(static_cast<size_t>(__A.extent(0)) == static_cast<size_t>(__x.extent(0))
+                 && static_cast<size_t>(__A.extent(1)) == static_cast<size_t>(__y.extent(0)),
+               "linalg::matrix_rank_1_update: the extents of A, x and y do not match");
+  __detail::__for_each_index(__A, [&](auto __i, auto __j) {
+    __A(__i, __j) = __A(__i, __j) + __x(__i) * __y(__j);
+  });
+}
+
+// [linalg.algs.blas2.trsv]
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__in_vector<_InVec>
+                   _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_API inline void triangular_matrix_vector_solve(_InMat __A, _Triangle, _DiagonalStorage, _InVec __b, _OutVec __x)
+{
+  using __mat_extents = typename _InMat::extents_type;
+  static_assert(__detail::__compatible_static_extents<__mat_extents, __mat_extents>(0, 1),
+                "linalg::triangular_matrix_vector_solve: A must be square");
+  __detail::__check_matrix_vector_extents(__A, __b, __x);
+  _CCCL_ASSERT(__A.extent(0) == __A.extent(1), "linalg::triangular_matrix_vector_solve: A must be square");
+  __detail::__triangular_matrix_vector_solve<_InMat, _Triangle, _DiagonalStorage>(__A, __b, __x);
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__inout_vector<_InOutVec>)
+_CCCL_API inline void triangular_matrix_vector_solve(_InMat __A, _Triangle __t, _DiagonalStorage __d, _InOutVec __b)
+{
+  linalg::triangular_matrix_vector_solve(__A, __t, __d, __b, __b);
+}
+
+} // end namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___LINALG_BLAS2_HPP
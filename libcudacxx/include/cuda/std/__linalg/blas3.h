@@ -0,0 +1,409 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_BLAS3_HPP
+#define _LIBCUDACXX___LINALG_BLAS3_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/blas1.h>
+#include <cuda/std/__linalg/helpers.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__memory/temporary_buffer.h>
+#include <cuda/std/__memory/unique_ptr.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg
+{
+
+namespace __detail
+{
+
+// Blocking of the host matrix product. The micro-kernel keeps a __mr x __nr tile of C in registers, with each row of
+// the tile filling a 32-byte vector register. A __kc-deep slice of __mc rows of A stays in the L2 cache and the
+// matching slice of __nc columns of B in the L3 cache.
+template <class _Tp>
+struct __gemm_blocking
+{
+  static constexpr size_t __mr = 8;
+  static constexpr size_t __nr = (sizeof(_Tp) < 32) ? 32 / sizeof(_Tp) : 1;
+  static constexpr size_t __kc = 256;
+  static constexpr size_t __mc = 8 * __mr;
+  static constexpr size_t __nc = 128 * __nr;
+
+  // Products with fewer multiplications than this do not amortize copying the blocks of A and B
+  static constexpr size_t __min_flops = 32 * 32 * 32;
+
+  [[nodiscard]] _CCCL_API static constexpr size_t __round_up(size_t __x, size_t __multiple) noexcept
+  {
+    return (__x + __multiple - 1) / __multiple * __multiple;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr size_t __buffer_size(size_t __m, size_t __n, size_t __k) noexcept
+  {
+    const size_t __mc = (_CUDA_VSTD::min)(__gemm_blocking::__mc, __round_up(__m, __mr));
+    const size_t __nc = (_CUDA_VSTD::min)(__gemm_blocking::__nc, __round_up(__n, __nr));
+    const size_t __kc = (_CUDA_VSTD::min)(__gemm_blocking::__kc, __k);
+    return (__mc + __nc) * __kc;
+  }
+};
+
+template <class _InMat1, class _InMat2, class _OutMat>
+inline constexpr bool __is_blocked_gemm_v = _CCCL_TRAIT(is_floating_point, typename _OutMat::value_type)
+                                         && _CCCL_TRAIT(is_arithmetic, typename _InMat1::value_type)
+                                         && _CCCL_TRAIT(is_arithmetic, typename _InMat2::value_type);
+
+// Multiplies a __mr x __kc block of A by a __kc x __nr block of B, both packed by __gemm_blocked
+template <class _Tp, size_t _Mr, size_t _Nr>
+_CCCL_HOST_API inline void
+__gemm_micro_kernel(size_t __kc, const _Tp* __a, const _Tp* __b, _Tp (&__acc)[_Mr][_Nr]) noexcept
+{
+  for (size_t __p = 0; __p < __kc; ++__p, __a += _Mr, __b += _Nr)
+  {
+    _Tp __b_row[_Nr];
+    for (size_t __j = 0; __j < _Nr; ++__j)
+    {
+      __b_row[__j] = __b[__j];
+    }
+    for (size_t __i = 0; __i < _Mr; ++__i)
+    {
+      const _Tp __a_ip = __a[__i];
+      for (size_t __j = 0; __j < _Nr; ++__j)
+      {
+        __acc[__i][__j] += __a_ip * __b_row[__j];
+      }
+    }
+  }
+}
+
+// Calls __update_c(i, j, v) with v being the sum over p of __get_a(i, p) * __get_b(p, j), a block of p at a time.
+// Blocks of A and B are first copied into __buffer in the order the micro-kernel reads them, which makes every layout
+// and accessor look contiguous to it. Edges are padded with zeros.
+template <class _Tp, class _GetA, class _GetB, class _UpdateC>
+_CCCL_HOST_API inline void __gemm_blocked(
+  _Tp* __buffer, size_t __m, size_t __n, size_t __k, _GetA& __get_a, _GetB& __get_b, _UpdateC& __update_c)
+{
+  using __blocking      = __gemm_blocking<_Tp>;
+  constexpr size_t __mr = __blocking::__mr;
+  constexpr size_t __nr = __blocking::__nr;
+  _Tp* const __packed_b = __buffer;
+  _Tp* const __packed_a = __buffer
+                        + (_CUDA_VSTD::min)(__blocking::__nc, __blocking::__round_up(__n, __nr))
+                            * (_CUDA_VSTD::min)(__blocking::__kc, __k);
+
+  for (size_t __jc = 0; __jc < __n; __jc += __blocking::__nc)
+  {
+    const size_t __nc = (_CUDA_VSTD::min)(__blocking::__nc, __n - __jc);
+    for (size_t __pc = 0; __pc < __k; __pc += __blocking::__kc)
+    {
+      const size_t __kc = (_CUDA_VSTD::min)(__blocking::__kc, __k - __pc);
+
+      // B is packed into row-major panels of __nr columns
+      for (size_t __jr = 0; __jr < __nc; __jr += __nr)
+      {
+        _Tp* __dst              = __packed_b + __jr * __kc;
+        const size_t __nr_valid = (_CUDA_VSTD::min)(__nr, __nc - __jr);
+        for (size_t __p = 0; __p < __kc; ++__p)
+        {
+          for (size_t __j = 0; __j < __nr; ++__j)
+          {
+            *__dst++ = (__j < __nr_valid) ? __get_b(__pc + __p, __jc + __jr + __j) : _Tp{};
+          }
+        }
+      }
+
+      for (size_t __ic = 0; __ic < __m; __ic += __blocking::__mc)
+      {
+        const size_t __mc = (_CUDA_VSTD::min)(__blocking::__mc, __m - __ic);
+
+        // A is packed into column-major panels of __mr rows
+        for (size_t __ir = 0; __ir < __mc; __ir += __mr)
+        {
+          _Tp* __dst              = __packed_a + __ir * __kc;
+          const size_t __mr_valid = (_CUDA_VSTD::min)(__mr, __mc - __ir);
+          for (size_t __p = 0; __p < __kc; ++__p)
+          {
+            for (size_t __i = 0; __i < __mr; ++__i)
+            {
+              *__dst++ = (__i < __mr_valid) ? __get_a(__ic + __ir + __i, __pc + __p) : _Tp{};
+            }
+          }
+        }
+
+        for (size_t __jr = 0; __jr < __nc; __jr += __nr)
+        {
+          const size_t __nr_valid = (_CUDA_VSTD::min)(__nr, __nc - __jr);
+          for (size_t __ir = 0; __ir < __mc; __ir += __mr)
+          {
+            const size_t __mr_valid = (_CUDA_VSTD::min)(__mr, __mc - __ir);
+            _Tp __acc[__mr][__nr]   = {};
+            __detail::__gemm_micro_kernel(__kc, __packed_a + __ir * __kc, __packed_b + __jr * __kc, __acc);
+            for (size_t __i = 0; __i < __mr_valid; ++__i)
+            {
+              for (size_t __j = 0; __j < __nr_valid; ++__j)
+              {
+                __update_c(__ic + __ir + __i, __jc + __jr + __j, __acc[__i][__j]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Allocates the buffer of __gemm_blocked for an __m x __n x __k product, or returns null when the product is too small
+// to benefit from blocking or no memory is available
+template <class _Tp>
+[[nodiscard]] _CCCL_HOST_API inline unique_ptr<_Tp, __return_temporary_buffer>
+__gemm_allocate(size_t __m, size_t __n, size_t __k)
+{
+  using __blocking = __gemm_blocking<_Tp>;
+  if (__m * __n * __k < __blocking::__min_flops)
+  {
+    return nullptr;
+  }
+  const size_t __size               = __blocking::__buffer_size(__m, __n, __k);
+  const pair<_Tp*, ptrdiff_t> __buf = _CUDA_VSTD::get_temporary_buffer<_Tp>(static_cast<ptrdiff_t>(__size));
+  unique_ptr<_Tp, __return_temporary_buffer> __holder(__buf.first);
+  if (static_cast<size_t>(__buf.second) < __size)
+  {
+    __holder.reset();
+  }
+  return __holder;
+}
+
+// C += A * B on the host, or false if the product is left to the caller
+template <class _InMat1, class _InMat2, class _InOutMat>
+[[nodiscard]] _CCCL_HOST_API inline bool
+__matrix_product_blocked(const _InMat1& __A, const _InMat2& __B, const _InOutMat& __C)
+{
+  using _Tp        = typename _InOutMat::value_type;
+  const size_t __m = __C.extent(0);
+  const size_t __n = __C.extent(1);
+  const size_t __k = __A.extent(1);
+  auto __buffer    = __detail::__gemm_allocate<_Tp>(__m, __n, __k);
+  if (!__buffer)
+  {
+    return false;
+  }
+  auto __get_a = [&](size_t __i, size_t __p) {
+    return static_cast<_Tp>(__A(__i, __p));
+  };
+  auto __get_b = [&](size_t __p, size_t __j) {
+    return static_cast<_Tp>(__B(__p, __j));
+  };
+  auto __update_c = [&](size_t __i, size_t __j, _Tp __v) {
+    __C(__i, __j) = __C(__i, __j) + __v;
+  };
+  __detail::__gemm_blocked(__buffer.get(), __m, __n, __k, __get_a, __get_b, __update_c);
+  return true;
+}
+
+// C += A * B
+template <class _InMat1, class _InMat2, class _InOutMat>
+_CCCL_API inline void __matrix_product(const _InMat1& __A, const _InMat2& __B, const _InOutMat& __C)
+{
+  using __index_type = typename _InMat1::index_type;
+  using __value_type = typename _InOutMat::value_type;
+  if constexpr (__is_blocked_gemm_v<_InMat1, _InMat2, _InOutMat>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   if (__detail::__matrix_product_blocked(__A, __B, __C))
+                   {
+                     return;
+                   }
+                 }))
+  }
+  __detail::__for_each_index(__C, [&](auto __i, auto __j) {
+    const __value_type __init = __C(__i, __j);
+    __C(__i, __j)             = __detail::__accumulate(__A.extent(1), __init, [&](__index_type __p) {
+      return __A(__i, __p) * __B(__p, __j);
+    });
+  });
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+_CCCL_API constexpr void __check_matrix_product_extents(const _InMat1& __A, const _InMat2& __B, const _OutMat& __C)
+{
+  using __extents1 = typename _InMat1::extents_type;
+  using __extents2 = typename _InMat2::extents_type;
+  using __extents3 = typename _OutMat::extents_type;
+  static_assert(__detail::__compatible_static_extents<__extents1, __extents3>(0, 0)
+                  && __detail::__compatible_static_extents<__extents2, __extents3>(1, 1)
+                  && __detail::__compatible_static_extents<__extents1, __extents2>(1, 0),
+                "linalg: the extents of the matrices are not compatible");
+  _CCCL_ASSERT(static_cast<size_t>(__A.extent(0)) == static_cast<size_t>(__C.extent(0))
+                 && static_cast<size_t>(__B.extent(1)) == static_cast<size_t>(__C.extent(1))
+                 && static_cast<size_t>(__A.extent(1)) == static_cast<size_t>(__B.extent(0)),
+               "linalg: the extents of the matrices do not match");
+}
+
+// Solves the rows [__first, __last) of A * X = B, assuming that X already holds B minus the contributions of all rows
+// of X outside of the range. The rows are solved in dependency order.
+template <bool _Lower, bool _ExplicitDiag, class _InMat, class _InOutMat>
+_CCCL_API inline void
+__triangular_solve_rows(const _InMat& __A, const _InOutMat& __X, size_t __first, size_t __last)
+{
+  using __value_type = typename _InOutMat::value_type;
+  for (size_t __r = 0; __r < __last - __first; ++__r)
+  {
+    const size_t __i    = _Lower ? __first + __r : __last - 1 - __r;
+    const size_t __from = _Lower ? __first : __i + 1;
+    const size_t __to   = _Lower ? __i : __last;
+    for (size_t __j = 0; __j < static_cast<size_t>(__X.extent(1)); ++__j)
+    {
+      __value_type __sum = __X(__i, __j);
+      for (size_t __p = __from; __p < __to; ++__p)
+      {
+        __sum = __sum - __A(__i, __p) * __X(__p, __j);
+      }
+      if constexpr (_ExplicitDiag)
+      {
+        __sum = __sum / __A(__i, __i);
+      }
+      __X(__i, __j) = __sum;
+    }
+  }
+}
+
+// Solves A * X = B on the host a block of rows at a time, where X already holds B. The contributions of the solved
+// rows to a block are subtracted with the blocked matrix product, which leaves only the small triangle on the diagonal
+// to the row by row solve. Returns false if the solve is left to the caller.
+template <bool _Lower, bool _ExplicitDiag, class _InMat, class _InOutMat>
+[[nodiscard]] _CCCL_HOST_API inline bool __triangular_solve_blocked(const _InMat& __A, const _InOutMat& __X)
+{
+  using _Tp             = typename _InOutMat::value_type;
+  constexpr size_t __nb = __gemm_blocking<_Tp>::__mc;
+  const size_t __m      = __A.extent(0);
+  const size_t __n      = __X.extent(1);
+  if (__m <= __nb)
+  {
+    return false;
+  }
+  auto __buffer = __detail::__gemm_allocate<_Tp>(__nb, __n, __m);
+  if (!__buffer)
+  {
+    return false;
+  }
+
+  for (size_t __b = 0; __b < __m; __b += __nb)
+  {
+    const size_t __size   = (_CUDA_VSTD::min)(__nb, __m - __b);
+    const size_t __first  = _Lower ? __b : __m - __b - __size;
+    const size_t __last   = __first + __size;
+    const size_t __solved = _Lower ? 0 : __last;
+
+    // X[first:last, :] -= A[first:last, solved rows] * X[solved rows, :]
+    auto __get_a = [&](size_t __i, size_t __p) {
+      return static_cast<_Tp>(__A(__first + __i, __solved + __p));
+    };
+    auto __get_x = [&](size_t __p, size_t __j) {
+      return static_cast<_Tp>(__X(__solved + __p, __j));
+    };
+    auto __update_x = [&](size_t __i, size_t __j, _Tp __v) {
+      __X(__first + __i, __j) = __X(__first + __i, __j) - __v;
+    };
+    __detail::__gemm_blocked(__buffer.get(), __size, __n, __b, __get_a, __get_x, __update_x);
+
+    __detail::__triangular_solve_rows<_Lower, _ExplicitDiag>(__A, __X, __first, __last);
+  }
+  return true;
+}
+
+} // namespace __detail
+
+// [linalg.algs.blas3.gemm]
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__out_matrix<_OutMat>)
+_CCCL_API inline void matrix_product(_InMat1 __A, _InMat2 __B, _OutMat __C)
+{
+  __detail::__check_matrix_product_extents(__A, __B, __C);
+  __detail::__for_each_index(__C, [&](auto __i, auto __j) {
+    __C(__i, __j) = typename _OutMat::value_type{};
+  });
+  __detail::__matrix_product(__A, __B, __C);
+}
+
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__in_matrix<_InMat3> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API inline void matrix_product(_InMat1 __A, _InMat2 __B, _InMat3 __E, _OutMat __C)
+{
+  __detail::__check_matrix_product_extents(__A, __B, __C);
+  linalg::copy(__E, __C);
+  __detail::__matrix_product(__A, __B, __C);
+}
+
+// [linalg.algs.blas3.trsm]
+_CCCL_TEMPLATE(class _InMat1, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__in_matrix<_InMat2>
+                   _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API inline void
+triangular_matrix_matrix_left_solve(_InMat1 __A, _Triangle, _DiagonalStorage, _InMat2 __B, _OutMat __X)
+{
+  constexpr bool __lower         = _CCCL_TRAIT(is_same, _Triangle, lower_triangle_t);
+  constexpr bool __explicit_diag = _CCCL_TRAIT(is_same, _DiagonalStorage, explicit_diagonal_t);
+  using __mat_extents             = typename _InMat1::extents_type;
+  static_assert(__detail::__compatible_static_extents<__mat_extents, __mat_extents>(0, 1),
+                "linalg::triangular_matrix_matrix_left_solve: A must be square");
+  __detail::__check_matrix_product_extents(__A, __X, __B);
+  _CCCL_ASSERT(__A.extent(0) == __A.extent(1), "linalg::triangular_matrix_matrix_left_solve: A must be square");
+
+  linalg::copy(__B, __X);
+  if constexpr (__detail::__is_blocked_gemm_v<_InMat1, _OutMat, _OutMat>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   if (__detail::__triangular_solve_blocked<__lower, __explicit_diag>(__A, __X))
+                   {
+                     return;
+                   }
+                 }))
+  }
+  __detail::__triangular_solve_rows<__lower, __explicit_diag>(__A, __X, 0, __A.extent(0));
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__inout_matrix<_InOutMat>)
+_CCCL_API inline void
+triangular_matrix_matrix_left_solve(_InMat __A, _Triangle __t, _DiagonalStorage __d, _InOutMat __B)
+{
+  linalg::triangular_matrix_matrix_left_solve(__A, __t, __d, __B, __B);
+}
+
+} // end namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___LINALG_BLAS3_HPP
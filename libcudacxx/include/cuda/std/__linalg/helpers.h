@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_HELPERS_HPP
+#define _LIBCUDACXX___LINALG_HELPERS_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/abs.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstdlib/abs.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_assignable.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/complex>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg
+{
+
+namespace __detail
+{
+
+// [linalg.helpers.concepts]
+template <class _Tp, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>, _Rank> =
+  _Extents::rank() == _Rank;
+
+template <class _Tp>
+inline constexpr bool __is_writable_mdspan_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline constexpr bool __is_writable_mdspan_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>> =
+  _CCCL_TRAIT(is_assignable, typename _Accessor::reference, _ElementType)
+  && _Layout::template mapping<_Extents>::is_always_unique();
+
+template <class _Tp>
+_CCCL_CONCEPT __in_vector = __is_mdspan_of_rank_v<_Tp, 1>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_vector = __is_mdspan_of_rank_v<_Tp, 1> && __is_writable_mdspan_v<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_vector = __out_vector<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_matrix = __is_mdspan_of_rank_v<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_matrix = __is_mdspan_of_rank_v<_Tp, 2> && __is_writable_mdspan_v<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_matrix = __out_matrix<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_object = __is_mdspan_of_rank_v<_Tp, 1> || __is_mdspan_of_rank_v<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_object = __in_object<_Tp> && __is_writable_mdspan_v<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_object = __out_object<_Tp>;
+
+// [linalg.helpers.abs], [linalg.helpers.real] and [linalg.helpers.imag]
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_if_needed(const _Tp& __t)
+{
+  if constexpr (_CCCL_TRAIT(is_unsigned, _Tp))
+  {
+    return __t;
+  }
+  else
+  {
+    using _CUDA_VSTD::abs;
+    return abs(__t);
+  }
+  _CCCL_UNREACHABLE();
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __real_if_needed(const _Tp& __t)
+{
+  if constexpr (_CCCL_TRAIT(is_arithmetic, _Tp))
+  {
+    return __t;
+  }
+  else
+  {
+    using _CUDA_VSTD::real;
+    return real(__t);
+  }
+  _CCCL_UNREACHABLE();
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __imag_if_needed(const _Tp& __t)
+{
+  if constexpr (_CCCL_TRAIT(is_arithmetic, _Tp))
+  {
+    return _Tp{};
+  }
+  else
+  {
+    using _CUDA_VSTD::imag;
+    return imag(__t);
+  }
+  _CCCL_UNREACHABLE();
+}
+
+// Whether neighboring elements of a matrix with the layout mapping __map are closer together down a column than along a
+// row. Loops over such matrices run down the columns in the innermost loop.
+template <class _Mapping>
+[[nodiscard]] _CCCL_API constexpr bool __is_column_major(const _Mapping& __map) noexcept
+{
+  if constexpr (_Mapping::is_always_strided())
+  {
+    return __map.stride(0) < __map.stride(1);
+  }
+  else
+  {
+    return false;
+  }
+  _CCCL_UNREACHABLE();
+}
+
+// Calls __func with every multidimensional index of the vector or matrix __x, in the order of its layout
+template <class _InObj, class _Func>
+_CCCL_API constexpr void __for_each_index(const _InObj& __x, _Func __func)
+{
+  using __index_type = typename _InObj::index_type;
+  if constexpr (_InObj::rank() == 1)
+  {
+    for (__index_type __i = 0; __i < __x.extent(0); ++__i)
+    {
+      __func(__i);
+    }
+  }
+  else if (__detail::__is_column_major(__x.mapping()))
+  {
+    for (__index_type __j = 0; __j < __x.extent(1); ++__j)
+    {
+      for (__index_type __i = 0; __i < __x.extent(0); ++__i)
+      {
+        __func(__i, __j);
+      }
+    }
+  }
+  else
+  {
+    for (__index_type __i = 0; __i < __x.extent(0); ++__i)
+    {
+      for (__index_type __j = 0; __j < __x.extent(1); ++__j)
+      {
+        __func(__i, __j);
+      }
+    }
+  }
+}
+
+} // namespace __detail
+} // end namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___LINALG_HELPERS_HPP
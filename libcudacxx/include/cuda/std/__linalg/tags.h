@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___LINALG_TAGS_HPP
+#define _LIBCUDACXX___LINALG_TAGS_HPP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+namespace linalg
+{
+
+struct upper_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit upper_triangle_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT upper_triangle_t upper_triangle{};
+
+struct lower_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit lower_triangle_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT lower_triangle_t lower_triangle{};
+
+struct implicit_unit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit implicit_unit_diagonal_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT implicit_unit_diagonal_t implicit_unit_diagonal{};
+
+struct explicit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit explicit_diagonal_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT explicit_diagonal_t explicit_diagonal{};
+
+namespace __detail
+{
+
+template <class _Triangle>
+inline constexpr bool __is_triangle_v =
+  _CCCL_TRAIT(is_same, _Triangle, upper_triangle_t) || _CCCL_TRAIT(is_same, _Triangle, lower_triangle_t);
+
+template <class _DiagonalStorage>
+inline constexpr bool __is_diagonal_storage_v = _CCCL_TRAIT(is_same, _DiagonalStorage, implicit_unit_diagonal_t)
+                                             || _CCCL_TRAIT(is_same, _DiagonalStorage, explicit_diagonal_t);
+
+} // namespace __detail
+} // end namespace linalg
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___LINALG_TAGS_HPP
@@ -85,6 +85,16 @@ _CCCL_API inline void return_temporary_buffer(_Tp* __p) noexcept
   _CUDA_VSTD::__cccl_deallocate_unsized((void*) __p, alignof(_Tp));
 }
 
+// Deleter for a buffer from get_temporary_buffer
+struct __return_temporary_buffer
+{
+  template <class _Tp>
+  _CCCL_API inline void operator()(_Tp* __p) const noexcept
+  {
+    _CUDA_VSTD::return_temporary_buffer(__p);
+  }
+};
+
 _LIBCUDACXX_END_NAMESPACE_STD
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -0,0 +1,314 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___RANDOM_MERSENNE_TWISTER_ENGINE_H
+#define _LIBCUDACXX___RANDOM_MERSENNE_TWISTER_ENGINE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__random/is_seed_sequence.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <class _UIntType,
+          size_t __w,
+          size_t __n,
+          size_t __m,
+          size_t __r,
+          _UIntType __a,
+          size_t __u,
+          _UIntType __d,
+          size_t __s,
+          _UIntType __b,
+          size_t __t,
+          _UIntType __c,
+          size_t __l,
+          _UIntType __f>
+class _CCCL_TYPE_VISIBILITY_DEFAULT mersenne_twister_engine
+{
+public:
+  // types
+  using result_type = _UIntType;
+
+private:
+  // The state is regenerated n words at a time, which makes the recurrence a handful of loops without wrap-around that
+  // the compiler can vectorize, and __i_ is the index of the next word to temper
+  result_type __x_[__n];
+  size_t __i_;
+
+  static_assert(0 < __m, "mersenne_twister_engine invalid parameters");
+  static_assert(__m <= __n, "mersenne_twister_engine invalid parameters");
+  static constexpr const result_type _Dt = numeric_limits<result_type>::digits;
+  static_assert(__w <= _Dt, "mersenne_twister_engine invalid parameters");
+  static_assert(2 <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(__r <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(__u <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(__s <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(__t <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(__l <= __w, "mersenne_twister_engine invalid parameters");
+  static_assert(is_unsigned_v<_UIntType>, "_UIntType must be an unsigned integer type");
+
+public:
+  static constexpr const result_type _Min = 0;
+  static constexpr const result_type _Max =
+    __w == _Dt ? result_type(~0) : (result_type(1) << __w) - result_type(1);
+  static_assert(_Min < _Max, "mersenne_twister_engine invalid parameters");
+  static_assert(__a <= _Max, "mersenne_twister_engine invalid parameters");
+  static_assert(__b <= _Max, "mersenne_twister_engine invalid parameters");
+  static_assert(__c <= _Max, "mersenne_twister_engine invalid parameters");
+  static_assert(__d <= _Max, "mersenne_twister_engine invalid parameters");
+  static_assert(__f <= _Max, "mersenne_twister_engine invalid parameters");
+
+  // engine characteristics
+  static constexpr const size_t word_size                      = __w;
+  static constexpr const size_t state_size                     = __n;
+  static constexpr const size_t shift_size                     = __m;
+  static constexpr const size_t mask_bits                      = __r;
+  static constexpr const result_type xor_mask                  = __a;
+  static constexpr const size_t tempering_u                    = __u;
+  static constexpr const result_type tempering_d               = __d;
+  static constexpr const size_t tempering_s                    = __s;
+  static constexpr const result_type tempering_b               = __b;
+  static constexpr const size_t tempering_t                    = __t;
+  static constexpr const result_type tempering_c               = __c;
+  static constexpr const size_t tempering_l                    = __l;
+  static constexpr const result_type initialization_multiplier = __f;
+  [[nodiscard]] _CCCL_API static constexpr result_type min() noexcept
+  {
+    return _Min;
+  }
+  [[nodiscard]] _CCCL_API static constexpr result_type max() noexcept
+  {
+    return _Max;
+  }
+  static constexpr const result_type default_seed = 5489u;
+
+  // constructors and seeding functions
+  _CCCL_API mersenne_twister_engine() noexcept
+      : mersenne_twister_engine(default_seed)
+  {}
+  _CCCL_API explicit mersenne_twister_engine(result_type __sd) noexcept
+  {
+    seed(__sd);
+  }
+  template <class _Sseq, enable_if_t<__is_seed_sequence<_Sseq, mersenne_twister_engine>, int> = 0>
+  _CCCL_API explicit mersenne_twister_engine(_Sseq& __q) noexcept
+  {
+    seed(__q);
+  }
+  _CCCL_API void seed(result_type __sd = default_seed) noexcept
+  {
+    __x_[0] = __sd & _Max;
+    for (size_t __i = 1; __i < __n; ++__i)
+    {
+      __x_[__i] = (__f * (__x_[__i - 1] ^ (__x_[__i - 1] >> (__w - 2))) + static_cast<result_type>(__i)) & _Max;
+    }
+    __i_ = __n;
+  }
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sseq, enable_if_t<__is_seed_sequence<_Sseq, mersenne_twister_engine>, int> = 0>
+  _CCCL_API void seed(_Sseq& __q) noexcept
+  {
+    constexpr size_t __k = (__w + 31) / 32;
+    uint32_t __ar[__n * __k];
+    __q.generate(__ar, __ar + __n * __k);
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      uint64_t __word = __ar[__i * __k];
+      if constexpr (__k > 1)
+      {
+        __word += static_cast<uint64_t>(__ar[__i * __k + 1]) << 32;
+      }
+      __x_[__i] = static_cast<result_type>(__word) & _Max;
+    }
+    // an all-zero state would only ever produce zeros
+    bool __zero = (__x_[0] & __upper_mask()) == 0;
+    for (size_t __i = 1; __i < __n && __zero; ++__i)
+    {
+      __zero = __x_[__i] == 0;
+    }
+    if (__zero)
+    {
+      __x_[0] = result_type(1) << (__w - 1);
+    }
+    __i_ = __n;
+  }
+
+  // generating functions
+  [[nodiscard]] _CCCL_API result_type operator()() noexcept
+  {
+    if (__i_ >= __n)
+    {
+      __twist();
+    }
+    return __temper(__x_[__i_++]);
+  }
+
+  //! Fills [__first, __last) with the next values of the engine, as if by repeatedly calling operator(). The values of
+  //! each block of n words are tempered in a single loop, which the compiler vectorizes on contiguous output.
+  template <class _ForwardIt>
+  _CCCL_API void generate(_ForwardIt __first, _ForwardIt __last) noexcept
+  {
+    if constexpr (__is_cpp17_random_access_iterator<_ForwardIt>::value)
+    {
+      for (auto __size = static_cast<uint64_t>(__last - __first); __size != 0;)
+      {
+        if (__i_ >= __n)
+        {
+          __twist();
+        }
+        const size_t __count = __size < __n - __i_ ? static_cast<size_t>(__size) : __n - __i_;
+        for (size_t __k = 0; __k < __count; ++__k)
+        {
+          __first[__k] = __temper(__x_[__i_ + __k]);
+        }
+        __first += __count;
+        __i_ += __count;
+        __size -= __count;
+      }
+    }
+    else
+    {
+      for (; __first != __last; ++__first)
+      {
+        *__first = (*this)();
+      }
+    }
+  }
+
+  _CCCL_API void discard(uint64_t __z) noexcept
+  {
+    // skipped words are not tempered, and whole blocks are skipped by twisting the state
+    while (__z > __n - __i_)
+    {
+      __z -= __n - __i_;
+      __twist();
+    }
+    __i_ += static_cast<size_t>(__z);
+  }
+
+  [[nodiscard]] _CCCL_API friend bool
+  operator==(const mersenne_twister_engine& __x, const mersenne_twister_engine& __y) noexcept
+  {
+    if (__x.__i_ != __y.__i_)
+    {
+      return false;
+    }
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      if (__x.__x_[__i] != __y.__x_[__i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  [[nodiscard]] _CCCL_API friend bool
+  operator!=(const mersenne_twister_engine& __x, const mersenne_twister_engine& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+
+private:
+  [[nodiscard]] _CCCL_API static constexpr result_type __upper_mask() noexcept
+  {
+    return __r == _Dt ? result_type(0) : (_Max << __r) & _Max;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr result_type __lower_mask() noexcept
+  {
+    return ~__upper_mask() & _Max;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr result_type
+  __next(result_type __current, result_type __following, result_type __shifted) noexcept
+  {
+    const result_type __y = (__current & __upper_mask()) | (__following & __lower_mask());
+    return __shifted ^ (__y >> 1) ^ ((__y & 1) ? __a : result_type(0));
+  }
+
+  // Regenerates all n words. The words read by each loop were either not written yet or written by an earlier loop, so
+  // none of the loops carries a dependency shorter than n - m iterations.
+  _CCCL_API void __twist() noexcept
+  {
+    size_t __k = 0;
+    for (; __k < __n - __m; ++__k)
+    {
+      __x_[__k] = __next(__x_[__k], __x_[__k + 1], __x_[__k + __m]);
+    }
+    for (; __k < __n - 1; ++__k)
+    {
+      __x_[__k] = __next(__x_[__k], __x_[__k + 1], __x_[__k + __m - __n]);
+    }
+    __x_[__n - 1] = __next(__x_[__n - 1], __x_[0], __x_[__m - 1]);
+    __i_          = 0;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr result_type __temper(result_type __z) noexcept
+  {
+    __z ^= (__z >> __u) & __d;
+    __z ^= (__z << __s) & __b;
+    __z ^= (__z << __t) & __c;
+    return (__z ^ (__z >> __l)) & _Max;
+  }
+};
+
+using mt19937 =
+  mersenne_twister_engine<uint_fast32_t,
+                          32,
+                          624,
+                          397,
+                          31,
+                          0x9908b0df,
+                          11,
+                          0xffffffff,
+                          7,
+                          0x9d2c5680,
+                          15,
+                          0xefc60000,
+                          18,
+                          1812433253>;
+using mt19937_64 =
+  mersenne_twister_engine<uint_fast64_t,
+                          64,
+                          312,
+                          156,
+                          31,
+                          0xb5026f5aa96619e9ULL,
+                          29,
+                          0x5555555555555555ULL,
+                          17,
+                          0x71d67fffeda60000ULL,
+                          37,
+                          0xfff7eee000000000ULL,
+                          43,
+                          6364136223846793005ULL>;
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___RANDOM_MERSENNE_TWISTER_ENGINE_H
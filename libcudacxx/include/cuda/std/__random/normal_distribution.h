@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___RANDOM_NORMAL_DISTRIBUTION_H
+#define _LIBCUDACXX___RANDOM_NORMAL_DISTRIBUTION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__random/is_valid.h>
+#include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <class _RealType = double>
+class normal_distribution
+{
+  static_assert(__libcpp_random_is_valid_realtype<_RealType>, "RealType must be a supported floating-point type");
+
+public:
+  // types
+  using result_type = _RealType;
+
+  class param_type
+  {
+    result_type __mean_;
+    result_type __stddev_;
+
+  public:
+    using distribution_type = normal_distribution;
+
+    _CCCL_API explicit param_type(result_type __mean = 0, result_type __stddev = 1) noexcept
+        : __mean_(__mean)
+        , __stddev_(__stddev)
+    {}
+
+    [[nodiscard]] _CCCL_API result_type mean() const noexcept
+    {
+      return __mean_;
+    }
+    [[nodiscard]] _CCCL_API result_type stddev() const noexcept
+    {
+      return __stddev_;
+    }
+
+    [[nodiscard]] _CCCL_API friend bool operator==(const param_type& __x, const param_type& __y) noexcept
+    {
+      return __x.__mean_ == __y.__mean_ && __x.__stddev_ == __y.__stddev_;
+    }
+    [[nodiscard]] _CCCL_API friend bool operator!=(const param_type& __x, const param_type& __y) noexcept
+    {
+      return !(__x == __y);
+    }
+  };
+
+private:
+  param_type __p_;
+  result_type __v_;
+  bool __v_hot_;
+
+public:
+  // constructors and reset functions
+  _CCCL_API normal_distribution() noexcept
+      : normal_distribution(0)
+  {}
+  _CCCL_API explicit normal_distribution(result_type __mean, result_type __stddev = 1) noexcept
+      : __p_(param_type(__mean, __stddev))
+      , __v_(0)
+      , __v_hot_(false)
+  {}
+  _CCCL_API explicit normal_distribution(const param_type& __p) noexcept
+      : __p_(__p)
+      , __v_(0)
+      , __v_hot_(false)
+  {}
+  _CCCL_API void reset() noexcept
+  {
+    __v_hot_ = false;
+  }
+
+  // generating functions
+  template <class _URng>
+  [[nodiscard]] _CCCL_API result_type operator()(_URng& __g) noexcept
+  {
+    return (*this)(__g, __p_);
+  }
+
+  // Marsaglia's polar method, which turns a pair of uniform values in the unit disk into two independent normal values.
+  // The second one is returned by the next call.
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _URng>
+  [[nodiscard]] _CCCL_API result_type operator()(_URng& __g, const param_type& __p) noexcept
+  {
+    static_assert(__libcpp_random_is_valid_urng<_URng>, "");
+    result_type __up;
+    if (__v_hot_)
+    {
+      __v_hot_ = false;
+      __up     = __v_;
+    }
+    else
+    {
+      uniform_real_distribution<result_type> __uni(-1, 1);
+      result_type __u;
+      result_type __v;
+      result_type __s;
+      do
+      {
+        __u = __uni(__g);
+        __v = __uni(__g);
+        __s = __u * __u + __v * __v;
+      } while (__s > 1 || __s == 0);
+      const result_type __fp = _CUDA_VSTD::sqrt(-2 * _CUDA_VSTD::log(__s) / __s);
+      __v_                   = __v * __fp;
+      __v_hot_               = true;
+      __up                   = __u * __fp;
+    }
+    return __up * __p.stddev() + __p.mean();
+  }
+
+  // property functions
+  [[nodiscard]] _CCCL_API result_type mean() const noexcept
+  {
+    return __p_.mean();
+  }
+  [[nodiscard]] _CCCL_API result_type stddev() const noexcept
+  {
+    return __p_.stddev();
+  }
+
+  [[nodiscard]] _CCCL_API param_type param() const noexcept
+  {
+    return __p_;
+  }
+  _CCCL_API void param(const param_type& __p) noexcept
+  {
+    __p_ = __p;
+  }
+
+  [[nodiscard]] _CCCL_API result_type min() const noexcept
+  {
+    return -numeric_limits<result_type>::infinity();
+  }
+  [[nodiscard]] _CCCL_API result_type max() const noexcept
+  {
+    return numeric_limits<result_type>::infinity();
+  }
+
+  [[nodiscard]] _CCCL_API friend bool
+  operator==(const normal_distribution& __x, const normal_distribution& __y) noexcept
+  {
+    return __x.__p_ == __y.__p_ && __x.__v_hot_ == __y.__v_hot_ && (!__x.__v_hot_ || __x.__v_ == __y.__v_);
+  }
+  [[nodiscard]] _CCCL_API friend bool
+  operator!=(const normal_distribution& __x, const normal_distribution& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___RANDOM_NORMAL_DISTRIBUTION_H
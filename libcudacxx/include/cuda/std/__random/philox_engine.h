@@ -0,0 +1,400 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___RANDOM_PHILOX_ENGINE_H
+#define _LIBCUDACXX___RANDOM_PHILOX_ENGINE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/mul_128.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__random/is_seed_sequence.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// [rand.eng.philox]
+// A counter-based engine: the n words of output of each counter value are a keyed bijection of the counter, so any
+// position of the stream is computed without the ones before it, which makes discard constant time.
+template <class _UIntType, size_t __w, size_t __n, size_t __r, _UIntType... _Consts>
+class _CCCL_TYPE_VISIBILITY_DEFAULT philox_engine
+{
+  static_assert(__n == 2 || __n == 4, "philox_engine: the word count must be 2 or 4");
+  static_assert(sizeof...(_Consts) == __n, "philox_engine: there must be one multiplier and one round constant per "
+                                           "pair of words");
+  static_assert(0 < __r, "philox_engine: the round count must be positive");
+  static_assert(0 < __w && __w <= numeric_limits<_UIntType>::digits, "philox_engine invalid parameters");
+  static_assert(__w <= 64, "philox_engine: the word size must be at most 64 bits");
+  static_assert(is_unsigned_v<_UIntType>, "_UIntType must be an unsigned integer type");
+
+  static constexpr size_t __array_size = __n / 2;
+
+public:
+  // types
+  using result_type = _UIntType;
+
+  // engine characteristics
+  static constexpr size_t word_size   = __w;
+  static constexpr size_t word_count  = __n;
+  static constexpr size_t round_count = __r;
+
+  [[nodiscard]] _CCCL_API static constexpr result_type min() noexcept
+  {
+    return 0;
+  }
+  [[nodiscard]] _CCCL_API static constexpr result_type max() noexcept
+  {
+    return __w == numeric_limits<result_type>::digits ? result_type(~result_type(0))
+                                                       : static_cast<result_type>((result_type(1) << __w) - 1u);
+  }
+
+private:
+  [[nodiscard]] _CCCL_API static constexpr result_type __const_at(size_t __i) noexcept
+  {
+    constexpr result_type __consts[] = {_Consts...};
+    return __consts[__i];
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr array<result_type, __array_size> __every_other(size_t __offset) noexcept
+  {
+    if constexpr (__n == 4)
+    {
+      return {{__const_at(__offset), __const_at(__offset + 2)}};
+    }
+    else
+    {
+      return {{__const_at(__offset)}};
+    }
+    _CCCL_UNREACHABLE();
+  }
+
+public:
+  static constexpr array<result_type, __array_size> multipliers  = __every_other(0);
+  static constexpr array<result_type, __array_size> round_consts = __every_other(1);
+
+  static constexpr result_type default_seed = 20111115u;
+
+private:
+  // __x_ is the counter, least significant word first, __k_ the key, and __y_ the output of the previous counter, of
+  // which __j_ is the index of the last word returned
+  result_type __x_[__n];
+  result_type __k_[__array_size];
+  result_type __y_[__n];
+  size_t __j_;
+
+  // The lanes of a bulk generation, which are enough for the compiler to run the rounds of several counters in vector
+  // registers
+  static constexpr size_t __lanes = 8;
+
+  [[nodiscard]] _CCCL_API static constexpr result_type __mask(result_type __v) noexcept
+  {
+    return __v & max();
+  }
+
+  // The high and low __w bits of the 2 * __w bit product of __a and __b
+  _CCCL_API static constexpr void
+  __mulhilo(result_type __a, result_type __b, result_type& __hi, result_type& __lo) noexcept
+  {
+    if constexpr (__w <= 32)
+    {
+      const uint64_t __p = static_cast<uint64_t>(__a) * static_cast<uint64_t>(__b);
+      __hi               = static_cast<result_type>(__p >> __w);
+      __lo               = __mask(static_cast<result_type>(__p));
+    }
+    else
+    {
+      const auto __p = _CUDA_VSTD::__charconv_mul_128(static_cast<uint64_t>(__a), static_cast<uint64_t>(__b));
+      if constexpr (__w == 64)
+      {
+        __hi = static_cast<result_type>(__p.__high_);
+        __lo = static_cast<result_type>(__p.__low_);
+      }
+      else
+      {
+        __hi = static_cast<result_type>((__p.__high_ << (64 - __w)) | (__p.__low_ >> __w));
+        __lo = __mask(static_cast<result_type>(__p.__low_));
+      }
+    }
+  }
+
+  // The r rounds of the bijection. Each round permutes the words, and then multiplies every even word by its multiplier
+  // and mixes the high half of the product with the odd word and the round key.
+  _CCCL_API static constexpr void __rounds(result_type (&__v)[__n], const result_type (&__key)[__array_size]) noexcept
+  {
+    result_type __k[__array_size];
+    for (size_t __i = 0; __i < __array_size; ++__i)
+    {
+      __k[__i] = __key[__i];
+    }
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __q = 0; __q < __r; ++__q)
+    {
+      if constexpr (__n == 4)
+      {
+        const result_type __tmp = __v[0];
+        __v[0]                  = __v[2];
+        __v[2]                  = __tmp;
+      }
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __i = 0; __i < __array_size; ++__i)
+      {
+        result_type __hi{};
+        result_type __lo{};
+        __mulhilo(__v[2 * __i], __const_at(2 * __i), __hi, __lo);
+        __v[2 * __i]     = __hi ^ __k[__i] ^ __v[2 * __i + 1];
+        __v[2 * __i + 1] = __lo;
+        __k[__i]         = __mask(__k[__i] + __const_at(2 * __i + 1));
+      }
+    }
+  }
+
+  // Adds __z to the counter, which wraps around modulo 2^(n * w)
+  _CCCL_API void __advance_counter(uint64_t __z) noexcept
+  {
+    for (size_t __i = 0; __i < __n && __z != 0; ++__i)
+    {
+      uint64_t __carry = 0;
+      if constexpr (__w < 64)
+      {
+        const uint64_t __sum = static_cast<uint64_t>(__x_[__i]) + (__z & static_cast<uint64_t>(max()));
+        __x_[__i]            = __mask(static_cast<result_type>(__sum));
+        __carry              = (__sum >> __w) + (__z >> __w);
+      }
+      else
+      {
+        const uint64_t __sum = static_cast<uint64_t>(__x_[__i]) + __z;
+        __carry              = __sum < __z;
+        __x_[__i]            = static_cast<result_type>(__sum);
+      }
+      __z = __carry;
+    }
+  }
+
+  // Computes the output of the current counter and moves to the next one
+  _CCCL_API void __generate_block() noexcept
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __y_[__i] = __x_[__i];
+    }
+    __rounds(__y_, __k_);
+    __advance_counter(1);
+  }
+
+  // Writes the outputs of the next __blocks counters to __out, __lanes counters at a time. The last block is always
+  // computed on its own, which leaves its output in __y_ as if it had been generated one word at a time.
+  template <class _RandomAccessIt>
+  _CCCL_API void __generate_blocks(_RandomAccessIt __out, uint64_t __blocks) noexcept
+  {
+    for (; __blocks > __lanes; __blocks -= __lanes, __out += __lanes * __n)
+    {
+      result_type __v[__lanes][__n];
+      for (size_t __lane = 0; __lane < __lanes; ++__lane)
+      {
+        for (size_t __i = 0; __i < __n; ++__i)
+        {
+          __v[__lane][__i] = __x_[__i];
+        }
+        __advance_counter(1);
+      }
+      for (size_t __lane = 0; __lane < __lanes; ++__lane)
+      {
+        __rounds(__v[__lane], __k_);
+      }
+      for (size_t __lane = 0; __lane < __lanes; ++__lane)
+      {
+        for (size_t __i = 0; __i < __n; ++__i)
+        {
+          __out[__lane * __n + __i] = __v[__lane][__i];
+        }
+      }
+    }
+    for (; __blocks != 0; --__blocks, __out += __n)
+    {
+      __generate_block();
+      for (size_t __i = 0; __i < __n; ++__i)
+      {
+        __out[__i] = __y_[__i];
+      }
+    }
+  }
+
+public:
+  // constructors and seeding functions
+  _CCCL_API philox_engine() noexcept
+      : philox_engine(default_seed)
+  {}
+  _CCCL_API explicit philox_engine(result_type __value) noexcept
+  {
+    seed(__value);
+  }
+  template <class _Sseq, enable_if_t<__is_seed_sequence<_Sseq, philox_engine>, int> = 0>
+  _CCCL_API explicit philox_engine(_Sseq& __q) noexcept
+  {
+    seed(__q);
+  }
+
+  _CCCL_API void seed(result_type __value = default_seed) noexcept
+  {
+    __k_[0] = __mask(__value);
+    for (size_t __i = 1; __i < __array_size; ++__i)
+    {
+      __k_[__i] = 0;
+    }
+    set_counter({});
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sseq, enable_if_t<__is_seed_sequence<_Sseq, philox_engine>, int> = 0>
+  _CCCL_API void seed(_Sseq& __q) noexcept
+  {
+    constexpr size_t __p = (__w + 31) / 32;
+    uint32_t __a[__array_size * __p];
+    __q.generate(__a, __a + __array_size * __p);
+    for (size_t __i = 0; __i < __array_size; ++__i)
+    {
+      uint64_t __word = __a[__i * __p];
+      if constexpr (__p > 1)
+      {
+        __word += static_cast<uint64_t>(__a[__i * __p + 1]) << 32;
+      }
+      __k_[__i] = __mask(static_cast<result_type>(__word));
+    }
+    set_counter({});
+  }
+
+  //! Sets the counter to `__counter`, most significant word first, so that the next value is the first word of its
+  //! output
+  _CCCL_API void set_counter(const array<result_type, __n>& __counter) noexcept
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __x_[__n - 1 - __i] = __mask(__counter[__i]);
+      __y_[__i]           = 0;
+    }
+    __j_ = __n - 1;
+  }
+
+  // generating functions
+  [[nodiscard]] _CCCL_API result_type operator()() noexcept
+  {
+    if (++__j_ == __n)
+    {
+      __generate_block();
+      __j_ = 0;
+    }
+    return __y_[__j_];
+  }
+
+  //! Fills [__first, __last) with the next values of the engine, as if by repeatedly calling operator(). The counters
+  //! of whole blocks are independent, so several of them are computed at a time.
+  template <class _ForwardIt>
+  _CCCL_API void generate(_ForwardIt __first, _ForwardIt __last) noexcept
+  {
+    if constexpr (__is_cpp17_random_access_iterator<_ForwardIt>::value)
+    {
+      auto __size = static_cast<uint64_t>(__last - __first);
+      for (; __size != 0 && __j_ != __n - 1; --__size, ++__first)
+      {
+        *__first = (*this)();
+      }
+      const uint64_t __blocks = __size / __n;
+      __generate_blocks(__first, __blocks);
+      __first += __blocks * __n;
+      __size -= __blocks * __n;
+      for (; __size != 0; --__size, ++__first)
+      {
+        *__first = (*this)();
+      }
+    }
+    else
+    {
+      for (; __first != __last; ++__first)
+      {
+        *__first = (*this)();
+      }
+    }
+  }
+
+  _CCCL_API void discard(unsigned long long __z) noexcept
+  {
+    const size_t __left = __n - 1 - __j_;
+    if (__z <= __left)
+    {
+      __j_ += static_cast<size_t>(__z);
+      return;
+    }
+    __z -= __left;
+    // skip the counters whose words are all discarded, and compute the one which holds the last discarded word
+    const uint64_t __skipped = (__z - 1) / __n;
+    __advance_counter(__skipped);
+    __generate_block();
+    __j_ = static_cast<size_t>(__z - __skipped * __n - 1);
+  }
+
+  [[nodiscard]] _CCCL_API friend bool operator==(const philox_engine& __x, const philox_engine& __y) noexcept
+  {
+    if (__x.__j_ != __y.__j_)
+    {
+      return false;
+    }
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      if (__x.__x_[__i] != __y.__x_[__i] || __x.__y_[__i] != __y.__y_[__i])
+      {
+        return false;
+      }
+    }
+    for (size_t __i = 0; __i < __array_size; ++__i)
+    {
+      if (__x.__k_[__i] != __y.__k_[__i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  [[nodiscard]] _CCCL_API friend bool operator!=(const philox_engine& __x, const philox_engine& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+};
+
+using philox4x32 = philox_engine<uint_fast32_t, 32, 4, 10, 0xCD9E8D57, 0x9E3779B9, 0xD2511F53, 0xBB67AE85>;
+using philox4x64 =
+  philox_engine<uint_fast64_t,
+                64,
+                4,
+                10,
+                0xCA5A826395121157,
+                0x9E3779B97F4A7C15,
+                0xD2E7470EE14C6C93,
+                0xBB67AE8584CAA73B>;
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___RANDOM_PHILOX_ENGINE_H
@@ -21,6 +21,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__type_traits/is_constant_evaluated.h>
 #include <cuda/std/__type_traits/make_nbit_int.h>
@@ -376,6 +377,15 @@ template <class _Tp>
     using _Up = remove_const_t<_Tp>;
     return const_cast<_Tp*>(reinterpret_cast<_Up*>(::memchr(const_cast<_Up*>(__ptr), static_cast<int>(__c), __n)));
   }
+#  if defined(_LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS)
+  else if constexpr (__is_simd_comparable_v<remove_const_t<_Tp>>)
+  {
+    using _Up           = remove_const_t<_Tp>;
+    const _Up* __last   = __ptr + __n;
+    const _Up* __result = _CUDA_VSTD::__simd_find<_Up>(__ptr, __last, __c);
+    return __result == __last ? nullptr : __ptr + (__result - __ptr);
+  }
+#  endif // _LIBCUDACXX_HAS_HOST_SIMD_ALGORITHMS
   else
   {
     return _CUDA_VSTD::__cccl_memchr_impl_constexpr<_Tp>(__ptr, __c, __n);
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/barrier>
+
+// cuda::tree_barrier synchronizes its participants phase by phase like cuda::std::barrier: the completion function
+// runs once per phase after every arrival, and before any participant leaves wait.
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+#endif
+
+struct count_phases
+{
+  int* phases;
+
+  void operator()() noexcept
+  {
+    ++*phases;
+  }
+};
+
+void test_phases(int participants)
+{
+  constexpr int rounds = 200;
+  int phases           = 0;
+  cuda::tree_barrier<count_phases> barrier(participants, count_phases{&phases});
+  cuda::std::atomic<int> arrived(0);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < participants; ++i)
+  {
+    threads.emplace_back([&] {
+      for (int round = 0; round < rounds; ++round)
+      {
+        arrived.fetch_add(1, cuda::std::memory_order_relaxed);
+        barrier.arrive_and_wait();
+        // every participant arrived in this phase, and the completion ran for it
+        assert(arrived.load(cuda::std::memory_order_relaxed) >= (round + 1) * participants);
+        assert(phases == 2 * round + 1);
+        barrier.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(phases == 2 * rounds);
+  assert(arrived.load() == rounds * participants);
+}
+
+void test_arrive_and_drop()
+{
+  constexpr int participants = 9;
+  int phases                 = 0;
+  cuda::tree_barrier<count_phases> barrier(participants, count_phases{&phases});
+
+  // every round one more participant leaves, until only one is left
+  std::vector<std::thread> threads;
+  for (int i = 0; i < participants; ++i)
+  {
+    threads.emplace_back([&, i] {
+      for (int round = 0; round < i; ++round)
+      {
+        barrier.arrive_and_wait();
+      }
+      barrier.arrive_and_drop();
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(phases == participants);
+}
+
+void test_update()
+{
+  cuda::tree_barrier<> barrier(5);
+
+  std::thread other([&] {
+    barrier.wait(barrier.arrive(2));
+  });
+  auto token = barrier.arrive(3);
+  barrier.wait(cuda::std::move(token));
+  other.join();
+
+  assert(cuda::tree_barrier<>::max() > 0);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (for (int participants : {1, 2, 3, 7, 16, 33, 64}) { test_phases(participants); } test_arrive_and_drop();
+                test_update();))
+
+  return 0;
+}
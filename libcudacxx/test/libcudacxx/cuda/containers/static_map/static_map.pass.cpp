@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+// UNSUPPORTED: nvrtc
+
+#include <cuda/static_map>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+#endif // !__CUDA_ARCH__
+
+void test_owning()
+{
+  cuda::static_map<int, float> map(1000, -1, -1.0f);
+  assert(map.capacity() == 1024);
+  assert(map.size() == 0);
+
+  for (int key = 0; key < 1000; ++key)
+  {
+    assert(map.insert({key, key * 0.5f}));
+  }
+  assert(!map.insert({5, 1.0f}));
+  assert(map.size() == 1000);
+  assert(map.find(5)->second == 2.5f);
+  assert(!map.contains(1000));
+
+  cuda::static_map<int, float> moved(cuda::std::move(map));
+  assert(moved.find(999)->second == 499.5f);
+
+  cuda::static_map<int, float> assigned(1, -1, -1.0f);
+  assigned = cuda::std::move(moved);
+  assert(assigned.size() == 1000);
+  assigned.clear();
+  assert(assigned.size() == 0);
+  assert(assigned.find(5) == assigned.end());
+}
+
+#ifndef __CUDA_ARCH__
+template <class Key, class T>
+void test_concurrent()
+{
+  // threads race to insert the same keys with different values, and every lookup sees the value of the winner
+  constexpr int num_threads = 4;
+  constexpr int num_keys    = 5000;
+  cuda::static_map<Key, T, cuda::thread_scope_system> map(2 * num_keys, Key(-1), T(-1));
+  auto ref = map.ref();
+
+  std::vector<int> inserted(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([ref, t, &inserted] {
+      for (int i = 0; i < num_keys; ++i)
+      {
+        const Key key = Key((i * 7 + t * 13) % num_keys);
+        inserted[t] += ref.insert({key, T(key * 4 + t)});
+        auto it = ref.find(key);
+        assert(it != ref.end());
+        assert(it->second / 4 == T(key));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  int total = 0;
+  for (int count : inserted)
+  {
+    total += count;
+  }
+  assert(total == num_keys);
+  assert(map.size() == num_keys);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_owning(); test_concurrent<int, int>(); test_concurrent<cuda::std::int64_t, cuda::std::int64_t>();))
+  return 0;
+}
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#include <cuda/static_map>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+#endif
+
+template <class Key, class T, class ProbingScheme>
+__host__ __device__ void test_ref()
+{
+  using ref_type = cuda::static_map_ref<Key, T, cuda::thread_scope_thread, cuda::std::equal_to<Key>, ProbingScheme>;
+  using value_type = typename ref_type::value_type;
+  static_assert(cuda::std::is_same<value_type, cuda::std::pair<Key, T>>::value, "");
+  static_assert(cuda::std::is_trivially_copyable<ref_type>::value, "");
+  constexpr cuda::std::size_t capacity = ref_type::valid_capacity(60);
+  static_assert(capacity == 64, "");
+
+  typename ref_type::slot_type slots[capacity];
+  ref_type map(slots, capacity, Key(-1), T(-1));
+  map.initialize();
+  assert(map.size() == 0);
+  assert(map.empty_key_sentinel() == Key(-1));
+  assert(map.empty_value_sentinel() == T(-1));
+  assert(map.find(Key(3)) == map.end());
+
+  for (int i = 0; i < 40; ++i)
+  {
+    assert(map.insert(value_type{Key(i * 3), T(i)}));
+  }
+  assert(map.size() == 40);
+  for (int i = 0; i < 40; ++i)
+  {
+    // the value of a key is never replaced
+    assert(!map.insert(value_type{Key(i * 3), T(i + 1)}));
+    auto it = map.find(Key(i * 3));
+    assert(it != map.end());
+    assert(it->first == Key(i * 3));
+    assert(it->second == T(i));
+  }
+  assert(!map.contains(Key(1)));
+
+  Key next = Key(200);
+  while (map.size() < capacity)
+  {
+    assert(map.insert(value_type{next, T(7)}));
+    ++next;
+  }
+  assert(!map.insert(value_type{next, T(7)}));
+  assert(!map.contains(next));
+  assert(map.find(Key(200))->second == T(7));
+}
+
+__host__ __device__ void test_bulk()
+{
+  using ref_type = cuda::static_map_ref<int, int, cuda::thread_scope_thread, cuda::std::equal_to<int>,
+                                        cuda::double_hashing<2>>;
+  ref_type::slot_type slots[16];
+  ref_type map(slots, 16, -1, -1);
+  map.initialize();
+
+  const cuda::std::pair<int, int> pairs[] = {{1, 10}, {2, 20}, {1, 30}, {3, 30}};
+  assert(map.insert(pairs, pairs + 4) == 3);
+
+  const int keys[] = {3, 4, 1};
+  int values[3]    = {};
+  assert(map.find(keys, keys + 3, values) == values + 3);
+  assert(values[0] == 30 && values[1] == -1 && values[2] == 10);
+
+  bool found[3] = {};
+  map.contains(keys, keys + 3, found);
+  assert(found[0] && !found[1] && found[2]);
+}
+
+__host__ __device__ void test()
+{
+  // keys and values which share a single compare-and-swap
+  static_assert(sizeof(cuda::static_map_ref<int, int>::slot_type) == 8, "");
+  static_assert(alignof(cuda::static_map_ref<int, int>::slot_type) == 8, "");
+  static_assert(alignof(cuda::static_map_ref<short, short>::slot_type) == 4, "");
+  test_ref<int, int, cuda::linear_probing<>>();
+  test_ref<short, short, cuda::double_hashing<4>>();
+  test_ref<cuda::std::uint8_t, cuda::std::uint8_t, cuda::linear_probing<2>>();
+
+  // keys and values which are published one after the other
+  static_assert(sizeof(cuda::static_map_ref<cuda::std::int64_t, cuda::std::int64_t>::slot_type) == 16, "");
+  static_assert(sizeof(cuda::static_map_ref<int, char>::slot_type) == 8, "");
+  test_ref<cuda::std::int64_t, cuda::std::int64_t, cuda::linear_probing<4>>();
+  test_ref<int, cuda::std::int64_t, cuda::double_hashing<>>();
+  test_ref<int, char, cuda::linear_probing<>>();
+
+  test_bulk();
+}
+
+#ifndef __CUDA_ARCH__
+// Lookups which find a key whose value is not yet published wait for it, so they never see the empty value.
+void test_concurrent()
+{
+  using ref_type = cuda::static_map_ref<cuda::std::int64_t, cuda::std::int64_t, cuda::thread_scope_system>;
+  constexpr int keys    = 2000;
+  constexpr int readers = 3;
+
+  std::vector<ref_type::slot_type> slots(ref_type::valid_capacity(2 * keys));
+  ref_type map(slots.data(), slots.size(), -1, -1);
+  map.initialize();
+
+  std::vector<std::thread> pool;
+  for (int r = 0; r < readers; ++r)
+  {
+    pool.emplace_back([&] {
+      for (cuda::std::int64_t key = 0; key < keys; ++key)
+      {
+        ref_type::const_iterator it;
+        while ((it = map.find(key)) == map.end())
+        {
+          std::this_thread::yield();
+        }
+        assert(it->second == key + 1);
+      }
+    });
+  }
+  for (cuda::std::int64_t key = 0; key < keys; ++key)
+  {
+    assert(map.insert({key, key + 1}));
+  }
+  for (auto& thread : pool)
+  {
+    thread.join();
+  }
+  assert(map.size() == keys);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  test();
+  NV_IF_TARGET(NV_IS_HOST, (test_concurrent();))
+  return 0;
+}
@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+#include <cuda/static_set>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/tuple>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <memory>
+#  include <thread>
+#  include <vector>
+#endif // !__CUDA_ARCH__
+
+void test_owning()
+{
+  cuda::static_set<int> set(100, -1);
+  assert(set.capacity() == 128);
+  assert(set.size() == 0);
+  assert(set.empty_key_sentinel() == -1);
+
+  for (int key = 0; key < 100; ++key)
+  {
+    assert(set.insert(key * 3));
+  }
+  assert(!set.insert(0));
+  assert(set.size() == 100);
+  assert(set.contains(297));
+  assert(!set.contains(298));
+  assert(*set.find(42) == 42);
+  assert(set.find(43) == set.end());
+
+  cuda::static_set<int> moved(cuda::std::move(set));
+  assert(moved.size() == 100);
+  assert(moved.contains(297));
+
+  cuda::static_set<int> assigned(1, -1);
+  assigned = cuda::std::move(moved);
+  assert(assigned.capacity() == 128);
+  assert(assigned.contains(3));
+
+  assigned.clear();
+  assert(assigned.size() == 0);
+  assert(!assigned.contains(3));
+}
+
+void test_tuple_keys()
+{
+  // keys are hashed like cuda::hash_combine, so pairs of small integers need no hash of their own
+  using key = cuda::std::pair<short, short>;
+  cuda::static_set<key, cuda::thread_scope_system> set(64, key{-1, -1});
+  assert(set.insert(key{1, 2}));
+  assert(set.insert(key{2, 1}));
+  assert(!set.insert(key{1, 2}));
+  assert(set.contains(key{2, 1}));
+  assert(!set.contains(key{2, 2}));
+}
+
+#ifndef __CUDA_ARCH__
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  int* allocations;
+
+  explicit counting_allocator(int* count)
+      : allocations(count)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other)
+      : allocations(other.allocations)
+  {}
+
+  T* allocate(cuda::std::size_t n)
+  {
+    ++*allocations;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, cuda::std::size_t n)
+  {
+    --*allocations;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+};
+
+void test_allocator()
+{
+  // the allocator is rebound to the slot type
+  int allocations = 0;
+  {
+    using allocator = counting_allocator<int>;
+    cuda::static_set<int, cuda::thread_scope_device, cuda::std::equal_to<int>, cuda::linear_probing<>, allocator> set(
+      10, -1, {}, {}, allocator(&allocations));
+    assert(allocations == 1);
+    assert(set.get_allocator().allocations == &allocations);
+    assert(set.insert(1));
+  }
+  assert(allocations == 0);
+}
+
+void test_concurrent()
+{
+  // every thread inserts all keys, and exactly one insertion of each key succeeds
+  constexpr int num_threads = 4;
+  constexpr int num_keys    = 5000;
+  cuda::static_set<int, cuda::thread_scope_system, cuda::std::equal_to<int>, cuda::double_hashing<4>> set(
+    2 * num_keys, -1);
+  auto ref = set.ref();
+
+  std::vector<int> inserted(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([ref, t, &inserted] {
+      for (int i = 0; i < num_keys; ++i)
+      {
+        const int key = (i * 7 + t * 13) % num_keys;
+        inserted[t] += ref.insert(key);
+        assert(ref.contains(key));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  int total = 0;
+  for (int count : inserted)
+  {
+    total += count;
+  }
+  assert(total == num_keys);
+  assert(set.size() == num_keys);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_owning(); test_allocator(); test_tuple_keys(); test_concurrent();))
+  return 0;
+}
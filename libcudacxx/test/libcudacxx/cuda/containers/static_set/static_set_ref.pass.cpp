@@ -0,0 +1,181 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/static_set>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+template <class Key, class ProbingScheme>
+__host__ __device__ void test_ref()
+{
+  using ref_type = cuda::static_set_ref<Key, cuda::thread_scope_thread, cuda::std::equal_to<Key>, ProbingScheme>;
+  constexpr cuda::std::size_t capacity = ref_type::valid_capacity(30);
+  static_assert(capacity == 32, "");
+  static_assert(cuda::std::is_trivially_copyable<ref_type>::value, "");
+  static_assert(alignof(typename ref_type::slot_type) == sizeof(Key), "");
+
+  typename ref_type::slot_type slots[capacity];
+  const Key empty = static_cast<Key>(-1);
+  ref_type set(slots, capacity, empty);
+  set.initialize();
+  assert(set.capacity() == capacity);
+  assert(set.size() == 0);
+  assert(set.empty_key_sentinel() == empty);
+  assert(set.data() == slots);
+  assert(!set.contains(Key{1}));
+  assert(set.find(Key{1}) == set.end());
+
+  for (Key key = 0; key < 20; ++key)
+  {
+    assert(set.insert(static_cast<Key>(key * 7)));
+  }
+  assert(set.size() == 20);
+  for (Key key = 0; key < 20; ++key)
+  {
+    assert(!set.insert(static_cast<Key>(key * 7)));
+    auto it = set.find(static_cast<Key>(key * 7));
+    assert(it != set.end());
+    assert(*it == static_cast<Key>(key * 7));
+  }
+  assert(!set.contains(Key{1}));
+  assert(set.size() == 20);
+
+  // fill the table, skipping the multiples of 7 which are in it already
+  const Key first = 100;
+  Key next        = first;
+  while (set.size() < capacity)
+  {
+    const bool duplicate = set.contains(next);
+    assert(set.insert(next) == !duplicate);
+    ++next;
+  }
+  assert(!set.insert(next));
+  assert(!set.contains(next));
+  assert(set.find(next) == set.end());
+  assert(set.contains(first) && set.contains(static_cast<Key>(next - 1)));
+
+  // emptying the slots in two interleaved passes clears the table
+  set.initialize(0, 2);
+  set.initialize(1, 2);
+  assert(set.size() == 0);
+}
+
+__host__ __device__ void test_bulk()
+{
+  using ref_type = cuda::static_set_ref<int, cuda::thread_scope_thread>;
+  cuda::std::array<ref_type::slot_type, 16> slots{};
+  ref_type set(slots.data(), slots.size(), -1);
+  set.initialize();
+
+  const int keys[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+  assert(set.insert(keys, keys + 10) == 7);
+  assert(set.size() == 7);
+
+  const int queries[] = {1, 7, 9, 8};
+  bool found[4]       = {};
+  assert(set.contains(queries, queries + 4, found) == found + 4);
+  assert(found[0] && !found[1] && found[2] && !found[3]);
+
+  int values[4] = {};
+  set.find(queries, queries + 4, values);
+  assert(values[0] == 1 && values[1] == -1 && values[2] == 9 && values[3] == -1);
+}
+
+struct modulo_hash
+{
+  __host__ __device__ cuda::std::size_t operator()(int key) const
+  {
+    return static_cast<cuda::std::size_t>(key % 4);
+  }
+};
+
+struct parity_hash
+{
+  __host__ __device__ cuda::std::size_t operator()(int key) const
+  {
+    return static_cast<cuda::std::size_t>(key % 2);
+  }
+};
+
+struct same_parity
+{
+  __host__ __device__ bool operator()(int lhs, int rhs) const
+  {
+    return lhs % 2 == rhs % 2;
+  }
+};
+
+__host__ __device__ void test_custom_functions()
+{
+  // a hash with few distinct values still finds every key with either probing scheme
+  using linear = cuda::static_set_ref<int, cuda::thread_scope_thread, cuda::std::equal_to<int>,
+                                      cuda::linear_probing<1, modulo_hash>>;
+  linear::slot_type linear_slots[64];
+  linear set1(linear_slots, 64, -1);
+  set1.initialize();
+  for (int key = 0; key < 48; ++key)
+  {
+    assert(set1.insert(key));
+  }
+  for (int key = 0; key < 48; ++key)
+  {
+    assert(set1.contains(key));
+  }
+  assert(!set1.contains(48));
+
+  using doubled = cuda::static_set_ref<int, cuda::thread_scope_thread, cuda::std::equal_to<int>,
+                                       cuda::double_hashing<2, modulo_hash, cuda::std::hash<int>>>;
+  doubled::slot_type double_slots[64];
+  doubled set2(double_slots, 64, -1);
+  set2.initialize();
+  for (int key = 0; key < 48; ++key)
+  {
+    assert(set2.insert(key));
+  }
+  for (int key = 0; key < 48; ++key)
+  {
+    assert(set2.contains(key));
+  }
+
+  // the key equality decides which keys are duplicates
+  using parity =
+    cuda::static_set_ref<int, cuda::thread_scope_thread, same_parity, cuda::linear_probing<1, parity_hash>>;
+  parity::slot_type parity_slots[8];
+  parity set3(parity_slots, 8, -1);
+  set3.initialize();
+  assert(set3.insert(2));
+  assert(!set3.insert(4));
+  assert(set3.insert(3));
+  assert(set3.size() == 2);
+}
+
+__host__ __device__ void test()
+{
+  test_ref<int, cuda::linear_probing<>>();
+  test_ref<int, cuda::linear_probing<4>>();
+  test_ref<int, cuda::double_hashing<>>();
+  test_ref<cuda::std::int64_t, cuda::double_hashing<2>>();
+  test_ref<unsigned short, cuda::linear_probing<2>>();
+  test_ref<cuda::std::uint8_t, cuda::double_hashing<4>>();
+  test_bulk();
+  test_custom_functions();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/functional>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+struct Point
+{
+  int x;
+  int y;
+};
+
+template <>
+struct cuda::std::hash<Point>
+{
+  __host__ __device__ cuda::std::size_t operator()(const Point& p) const noexcept
+  {
+    return cuda::hash_combine(0, p.x, p.y);
+  }
+};
+
+__host__ __device__ void test_values()
+{
+  static_assert(cuda::std::is_same<decltype(cuda::hash_combine(0, 1)), cuda::std::size_t>::value, "");
+
+  assert(cuda::hash_combine(42) == 42);
+  assert(cuda::hash_combine(0, 1, 2) == cuda::hash_combine(cuda::hash_combine(0, 1), 2));
+  assert(cuda::hash_combine(0, 1, 2) != cuda::hash_combine(0, 2, 1));
+  assert(cuda::hash_combine(0, 1) != cuda::hash_combine(1, 1));
+  assert(cuda::hash_combine(0, 1.5f) == cuda::hash_combine(0, 1.5f));
+  assert(cuda::hash_combine(0, 0.0) == cuda::hash_combine(0, -0.0));
+
+  // Combining the integers 0, 1, ... must not collide
+  constexpr int n = 128;
+  cuda::std::size_t hashes[n];
+  for (int i = 0; i < n; ++i)
+  {
+    hashes[i] = cuda::hash_combine(0, i / 16, i % 16);
+    for (int j = 0; j < i; ++j)
+    {
+      assert(hashes[i] != hashes[j]);
+    }
+  }
+}
+
+__host__ __device__ void test_tuples()
+{
+  const cuda::std::tuple<int, double, char> t{1, 2.5, 'c'};
+  const cuda::std::pair<int, double> p{1, 2.5};
+  assert(cuda::hash_combine(0, t) == cuda::hash_combine(0, cuda::std::make_tuple(1, 2.5, 'c')));
+  assert(cuda::hash_combine(0, t) != cuda::hash_combine(0, cuda::std::make_tuple(1, 2.5, 'd')));
+  assert(cuda::hash_combine(0, p) == cuda::hash_combine(0, cuda::std::make_tuple(1, 2.5)));
+  assert(cuda::hash_combine(0, p) != cuda::hash_combine(0, cuda::std::make_pair(2.5, 1)));
+  assert(cuda::hash_combine(0, cuda::std::make_tuple(p, t)) == cuda::hash_combine(0, cuda::std::make_tuple(p, t)));
+  assert(cuda::hash_combine(0, cuda::std::tuple<>{}) == cuda::hash_combine(0, cuda::std::tuple<>{}));
+
+  // User defined types are hashed with their cuda::std::hash specialization
+  assert(cuda::hash_combine(0, Point{1, 2}) == cuda::hash_combine(0, cuda::hash_combine(0, 1, 2)));
+  assert(cuda::hash_combine(0, Point{1, 2}) != cuda::hash_combine(0, Point{2, 1}));
+}
+
+__host__ __device__ void test_arrays()
+{
+  int a[40];
+  int b[40];
+  for (int i = 0; i < 40; ++i)
+  {
+    a[i] = i * i;
+    b[i] = i * i;
+  }
+  const cuda::std::size_t h = cuda::hash_combine(0, a);
+  assert(h == cuda::hash_combine(0, b));
+  for (int i = 0; i < 40; ++i)
+  {
+    ++b[i];
+    assert(h != cuda::hash_combine(0, b));
+    --b[i];
+  }
+
+  // cuda::std::array and cuda::std::span hash like built-in arrays with the same elements
+  cuda::std::array<int, 40> arr{};
+  for (int i = 0; i < 40; ++i)
+  {
+    arr[i] = a[i];
+  }
+  assert(cuda::hash_combine(0, arr) == h);
+  assert(cuda::hash_combine(0, cuda::std::span<int>{a}) == h);
+  assert(cuda::hash_combine(0, cuda::std::span<const int, 40>{b}) == h);
+  assert(cuda::hash_combine(0, cuda::std::span<int>{a, 39}) != h);
+
+  // Arrays of other types combine the hashes of their elements
+  const Point points[3] = {{1, 2}, {3, 4}, {5, 6}};
+  const Point others[3] = {{1, 2}, {3, 4}, {6, 5}};
+  assert(cuda::hash_combine(0, points) == cuda::hash_combine(0, cuda::std::span<const Point>{points}));
+  assert(cuda::hash_combine(0, points) != cuda::hash_combine(0, others));
+
+  const double d[2][2] = {{1.0, 2.0}, {3.0, 4.0}};
+  const double e[2][2] = {{1.0, 2.0}, {4.0, 3.0}};
+  assert(cuda::hash_combine(0, d) != cuda::hash_combine(0, e));
+}
+
+__host__ __device__ void test()
+{
+  test_values();
+  test_tuples();
+  test_arrays();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
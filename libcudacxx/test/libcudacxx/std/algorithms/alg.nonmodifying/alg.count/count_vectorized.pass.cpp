@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// count on contiguous ranges of integers, which the host counts a vector at a time
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <class T, int N>
+__host__ __device__ constexpr void test_type()
+{
+  T arr[N + 4] = {};
+  for (int offset = 0; offset < 4; ++offset)
+  {
+    for (int len = 0; len <= N; ++len)
+    {
+      T* first = arr + offset;
+      T* last  = first + len;
+      int ones = 0;
+      for (int i = 0; i < len; ++i)
+      {
+        first[i] = T(i % 3 == 0);
+        ones += i % 3 == 0;
+      }
+      assert(cuda::std::count(first, last, T(1)) == ones);
+      assert(cuda::std::count(static_cast<const T*>(first), static_cast<const T*>(last), 0) == len - ones);
+      assert(cuda::std::count(first, last, T(2)) == 0);
+    }
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<unsigned char, N>();
+  test_type<short, N>();
+  test_type<int, N>();
+  test_type<unsigned long long, N>();
+  test_type<char16_t, N>();
+  test_type<char32_t, N>();
+
+  { // the value is converted like the elements when they are compared
+    unsigned char uc[N] = {};
+    uc[N - 1]           = 255;
+    assert(cuda::std::count(uc, uc + N, -1) == 0);
+    assert(cuda::std::count(uc, uc + N, 255) == 1);
+  }
+
+  return true;
+}
+
+// More matches than a byte can count
+__host__ __device__ void test_long()
+{
+  constexpr int N = 20000;
+  char* arr       = new char[N];
+  for (int i = 0; i < N; ++i)
+  {
+    arr[i] = 'x';
+  }
+  arr[N / 2] = 'y';
+  assert(cuda::std::count(arr, arr + N, 'x') == N - 1);
+  assert(cuda::std::count(arr + 1, arr + N, 'y') == 1);
+  delete[] arr;
+}
+
+int main(int, char**)
+{
+  test<200>();
+  test_long();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// equal on contiguous ranges of integers, which the host compares byte-wise
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_macros.h"
+
+template <class T, int N>
+__host__ __device__ constexpr void test_type()
+{
+  T lhs[N + 4] = {};
+  T rhs[N + 4] = {};
+  for (int i = 0; i < N + 4; ++i)
+  {
+    lhs[i] = T(i);
+    rhs[i] = T(i);
+  }
+  for (int offset = 0; offset < 4; ++offset)
+  {
+    for (int len = 0; len <= N; ++len)
+    {
+      T* first1 = lhs + offset;
+      T* last1  = first1 + len;
+      T* first2 = rhs + offset;
+      assert(cuda::std::equal(first1, last1, first2));
+      assert(cuda::std::equal(static_cast<const T*>(first1), static_cast<const T*>(last1), first2));
+      assert(cuda::std::equal(first1, last1, first2, cuda::std::equal_to<T>()));
+      // only the elements of the range are compared
+      assert(cuda::std::equal(first1, last1, first2 + 1) == (len == 0));
+      for (int pos = 0; pos < len; ++pos)
+      {
+        // the first, the last and every byte in between differ in turn
+        for (int byte = 0; byte < int(sizeof(T)); ++byte)
+        {
+          const T saved = first2[pos];
+          first2[pos]   = T(saved ^ (T(1) << (8 * byte)));
+          assert(!cuda::std::equal(first1, last1, first2));
+          assert(!cuda::std::equal(first1, last1, first2, cuda::std::equal_to<>()));
+          first2[pos] = saved;
+        }
+      }
+    }
+  }
+}
+
+// Ranges of different types are compared with operator==, which converts the elements first, so they may be equal
+// when their bytes differ and differ when their bytes are the same.
+template <int N>
+__host__ __device__ constexpr void test_mixed()
+{
+  int i[N]                  = {};
+  unsigned u[N]             = {};
+  short s[N]                = {};
+  long long ll[N]           = {};
+  signed char sc[N]         = {};
+  unsigned char uc[N]       = {};
+  unsigned long long ull[N] = {};
+  for (int k = 0; k < N; ++k)
+  {
+    i[k]   = -k;
+    u[k]   = static_cast<unsigned>(-k);
+    s[k]   = static_cast<short>(-k);
+    ll[k]  = -k;
+    sc[k]  = static_cast<signed char>(-k);
+    uc[k]  = static_cast<unsigned char>(-k);
+    ull[k] = static_cast<unsigned long long>(-k);
+  }
+
+  assert(cuda::std::equal(i, i + N, u));
+  assert(cuda::std::equal(u, u + N, i));
+  assert(cuda::std::equal(s, s + N, i));
+  assert(cuda::std::equal(i, i + N, ll));
+  assert(cuda::std::equal(ll, ll + N, i, i + N));
+  assert(cuda::std::equal(ll, ll + N, ull));
+  assert(cuda::std::equal(sc, sc + N, ll));
+  // the same bytes, but -1 != 255
+  assert(!cuda::std::equal(sc + N - 1, sc + N, uc + N - 1));
+  assert(!cuda::std::equal(uc + N - 1, uc + N, sc + N - 1, sc + N));
+  // -1 converts to 0xFFFFFFFF, which is not 0xFFFFFFFFFFFFFFFF
+  assert(!cuda::std::equal(u + N - 1, u + N, ull + N - 1));
+  // the low bytes are the same
+  ll[N - 1] += 1LL << 32;
+  assert(!cuda::std::equal(i, i + N, ll));
+  assert(!cuda::std::equal(ll, ll + N, i, i + N));
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<signed char, N>();
+  test_type<unsigned char, N>();
+  test_type<short, N>();
+  test_type<int, N>();
+  test_type<unsigned, N>();
+  test_type<unsigned long long, N>();
+  test_type<char16_t, N>();
+  test_type<char32_t, N>();
+  test_mixed<N>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<100>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
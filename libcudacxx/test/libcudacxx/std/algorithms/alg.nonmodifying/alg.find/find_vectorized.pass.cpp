@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// find on contiguous ranges of integers, which the host searches a vector at a time
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <class T, int N>
+__host__ __device__ constexpr void test_type()
+{
+  T arr[N + 4] = {};
+  for (int offset = 0; offset < 4; ++offset)
+  {
+    for (int len = 0; len <= N; ++len)
+    {
+      T* first = arr + offset;
+      T* last  = first + len;
+      for (int i = 0; i < N + 4; ++i)
+      {
+        arr[i] = T(1);
+      }
+      assert(cuda::std::find(first, last, T(2)) == last);
+      for (int pos = len - 1; pos >= 0; --pos)
+      {
+        first[pos] = T(2);
+        assert(cuda::std::find(first, last, T(2)) == first + pos);
+        assert(cuda::std::find(static_cast<const T*>(first), static_cast<const T*>(last), 2) == first + pos);
+      }
+    }
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<signed char, N>();
+  test_type<unsigned char, N>();
+  test_type<short, N>();
+  test_type<int, N>();
+  test_type<unsigned, N>();
+  test_type<long long, N>();
+  test_type<char16_t, N>();
+  test_type<char32_t, N>();
+
+  { // the value is converted like the elements when they are compared
+    unsigned char uc[N + 1] = {};
+    uc[N]                   = 255;
+    assert(cuda::std::find(uc, uc + N + 1, -1) == uc + N + 1);
+    assert(cuda::std::find(uc, uc + N + 1, 255) == uc + N);
+    assert(cuda::std::find(uc, uc + N + 1, 511) == uc + N + 1);
+
+    signed char sc[N + 1] = {};
+    sc[N]                 = -1;
+    assert(cuda::std::find(sc, sc + N + 1, 255) == sc + N + 1);
+    assert(cuda::std::find(sc, sc + N + 1, -1L) == sc + N);
+
+    unsigned ui[N + 1] = {};
+    ui[N]              = 0xFFFFFFFFu;
+    assert(cuda::std::find(ui, ui + N + 1, -1) == ui + N);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<200>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
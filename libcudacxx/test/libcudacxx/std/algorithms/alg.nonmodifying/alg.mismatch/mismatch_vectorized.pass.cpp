@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// mismatch and equal on contiguous ranges of integers, which the host compares a vector at a time
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_macros.h"
+
+template <class T, int N>
+__host__ __device__ constexpr void test_type()
+{
+  T lhs[N + 4] = {};
+  T rhs[N + 4] = {};
+  for (int i = 0; i < N + 4; ++i)
+  {
+    lhs[i] = T(i);
+    rhs[i] = T(i);
+  }
+  for (int offset = 0; offset < 4; ++offset)
+  {
+    for (int len = 0; len <= N; ++len)
+    {
+      T* first1 = lhs + offset;
+      T* last1  = first1 + len;
+      T* first2 = rhs + offset;
+      T* last2  = first2 + len;
+      assert(cuda::std::mismatch(first1, last1, first2) == cuda::std::make_pair(last1, last2));
+      assert(cuda::std::equal(first1, last1, first2));
+      assert(cuda::std::equal(first1, last1, first2, last2));
+      for (int pos = len - 1; pos >= 0; pos -= 7)
+      {
+        ++first2[pos];
+        assert(cuda::std::mismatch(first1, last1, first2) == cuda::std::make_pair(first1 + pos, first2 + pos));
+        assert(cuda::std::mismatch(first1, last1, first2, last2, cuda::std::equal_to<T>())
+               == cuda::std::make_pair(first1 + pos, first2 + pos));
+        assert(cuda::std::mismatch(static_cast<const T*>(first1), static_cast<const T*>(last1), first2, last2)
+               == cuda::std::make_pair(static_cast<const T*>(first1 + pos), first2 + pos));
+        assert(!cuda::std::equal(first1, last1, first2));
+        assert(!cuda::std::equal(first1, last1, first2, last2, cuda::std::equal_to<>()));
+        --first2[pos];
+      }
+      // the shorter range ends the comparison
+      assert(cuda::std::mismatch(first1, last1 + 1, first2, last2) == cuda::std::make_pair(last1, last2));
+      assert(!cuda::std::equal(first1, last1 + 1, first2, last2));
+    }
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<signed char, N>();
+  test_type<short, N>();
+  test_type<int, N>();
+  test_type<unsigned long long, N>();
+  test_type<char16_t, N>();
+  test_type<char32_t, N>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<200>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
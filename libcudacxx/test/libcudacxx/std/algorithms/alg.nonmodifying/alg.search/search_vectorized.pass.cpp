@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// search on contiguous ranges of integers, which the host looks for the first element of the pattern a vector at a
+// time
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <class T, int N>
+__host__ __device__ constexpr void test_type()
+{
+  T arr[N] = {};
+  // 0 1 0 1 1 0 1 1 1 0 1 1 1 1 ...
+  for (int i = 0, run = 1; i < N; run += 1)
+  {
+    arr[i++] = T(0);
+    for (int j = 0; j < run && i < N; ++j)
+    {
+      arr[i++] = T(1);
+    }
+  }
+  const T pattern[] = {T(0), T(1), T(1), T(1), T(1), T(1), T(0)};
+  for (int len = 0; len <= 7; ++len)
+  {
+    for (int offset = 0; offset < 4; ++offset)
+    {
+      const T* first = arr + offset;
+      const T* last  = arr + N;
+      const T* it    = cuda::std::search(first, last, pattern, pattern + len);
+      // the reference is the generic algorithm
+      const T* ref = first;
+      for (; ref + len <= last; ++ref)
+      {
+        int i = 0;
+        while (i < len && ref[i] == pattern[i])
+        {
+          ++i;
+        }
+        if (i == len)
+        {
+          break;
+        }
+      }
+      assert(it == (ref + len <= last ? ref : last));
+    }
+  }
+  assert(cuda::std::search(arr, arr + 3, pattern, pattern + 4) == arr + 3);
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<unsigned char, N>();
+  test_type<short, N>();
+  test_type<int, N>();
+  test_type<long long, N>();
+  test_type<char32_t, N>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<300>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<30>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
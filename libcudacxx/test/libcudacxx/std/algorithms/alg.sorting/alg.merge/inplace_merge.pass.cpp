@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<BidirectionalIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   void
+//   inplace_merge(Iter first, Iter middle, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int max_size = 200;
+
+template <class T, class Iter>
+__host__ __device__ void test()
+{
+  int orig[max_size] = {};
+  T work[max_size]   = {};
+  for (int n = 0; n <= max_size; n += (n < 20 ? 1 : 29))
+  {
+    for (int m = 0; m <= n; m += (m < 10 ? 1 : 13))
+    {
+      unsigned state = 12345u + static_cast<unsigned>(n);
+      for (int i = 0; i < n; ++i)
+      {
+        state   = state * 1664525u + 1013904223u;
+        orig[i] = static_cast<int>((state >> 8) % 100);
+      }
+      cuda::std::sort(orig, orig + m);
+      cuda::std::sort(orig + m, orig + n);
+      for (int i = 0; i < n; ++i)
+      {
+        work[i] = T(orig[i]);
+      }
+      cuda::std::inplace_merge(Iter(work), Iter(work + m), Iter(work + n));
+      assert(cuda::std::is_sorted(work, work + n));
+      assert(cuda::std::is_permutation(work, work + n, orig));
+    }
+  }
+}
+
+__host__ __device__ bool test()
+{
+  int i = 42;
+  cuda::std::inplace_merge(&i, &i, &i); // no-op
+  assert(i == 42);
+
+  test<int, bidirectional_iterator<int*>>();
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+  test<MoveOnly, bidirectional_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<BidirectionalIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   void
+//   inplace_merge(Iter first, Iter middle, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int max_size = 200;
+
+// Elements with equal keys have to keep their order, with those of the first range first.
+struct keyed
+{
+  int key;
+  int index;
+};
+
+struct key_greater
+{
+  __host__ __device__ bool operator()(const keyed& lhs, const keyed& rhs) const
+  {
+    return lhs.key > rhs.key;
+  }
+};
+
+template <class Iter>
+__host__ __device__ void test()
+{
+  keyed work[max_size] = {};
+  for (int n = 0; n <= max_size; n += (n < 20 ? 1 : 29))
+  {
+    for (int m = 0; m <= n; m += (m < 10 ? 1 : 13))
+    {
+      unsigned state = 12345u + static_cast<unsigned>(n);
+      for (int i = 0; i < n; ++i)
+      {
+        state   = state * 1664525u + 1013904223u;
+        work[i] = keyed{static_cast<int>((state >> 8) % 10), 0};
+      }
+      cuda::std::sort(work, work + m, key_greater{});
+      cuda::std::sort(work + m, work + n, key_greater{});
+      for (int i = 0; i < n; ++i)
+      {
+        work[i].index = i;
+      }
+      cuda::std::inplace_merge(Iter(work), Iter(work + m), Iter(work + n), key_greater{});
+      for (int i = 1; i < n; ++i)
+      {
+        assert(work[i - 1].key >= work[i].key);
+        if (work[i - 1].key == work[i].key)
+        {
+          assert(work[i - 1].index < work[i].index);
+        }
+      }
+    }
+  }
+}
+
+__host__ __device__ bool test()
+{
+  test<bidirectional_iterator<keyed*>>();
+  test<random_access_iterator<keyed*>>();
+  test<keyed*>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++20
+//   nth_element(Iter first, Iter nth, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class T, class Iter, int N>
+__host__ __device__ constexpr void test()
+{
+  int orig[N] = {};
+  T work[N]   = {};
+  for (int distinct = 1; distinct <= N; distinct *= 4)
+  {
+    unsigned state = 12345u + static_cast<unsigned>(distinct);
+    for (int i = 0; i < N; ++i)
+    {
+      state   = state * 1664525u + 1013904223u;
+      orig[i] = static_cast<int>((state >> 8) % distinct);
+    }
+    for (int n = 0; n <= N; n += (n < 20 ? 1 : 23))
+    {
+      for (int m = 0; m < n; m += (m < 10 ? 1 : 7))
+      {
+        for (int i = 0; i < n; ++i)
+        {
+          work[i] = T(orig[i]);
+        }
+        cuda::std::nth_element(Iter(work), Iter(work + m), Iter(work + n), cuda::std::greater<T>());
+        assert(cuda::std::is_permutation(work, work + n, orig));
+        // No element before nth is less than it, and no element after it is greater.
+        for (int i = 0; i < m; ++i)
+        {
+          assert(!(work[m] > work[i]));
+        }
+        for (int i = m + 1; i < n; ++i)
+        {
+          assert(!(work[i] > work[m]));
+        }
+      }
+    }
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::nth_element(&i, &i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>, N>();
+  test<int, int*, N>();
+  test<MoveOnly, MoveOnly*, N>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<300>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
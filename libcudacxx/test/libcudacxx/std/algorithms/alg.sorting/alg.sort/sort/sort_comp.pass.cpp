@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++20
+//   sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// Fills orig and work with one of several patterns: random values, few distinct values, sorted, reversed, all equal,
+// and organ pipe, which exercise the sorting networks, the insertion sorts, the partitions and their early exits.
+template <class T>
+__host__ __device__ constexpr void fill(int* orig, T* work, int n, int pattern)
+{
+  unsigned state = 12345u + static_cast<unsigned>(n);
+  for (int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    int v = 0;
+    switch (pattern)
+    {
+      case 0:
+        v = static_cast<int>(state >> 8);
+        break;
+      case 1:
+        v = static_cast<int>(state >> 28);
+        break;
+      case 2:
+        v = i;
+        break;
+      case 3:
+        v = n - i;
+        break;
+      case 4:
+        v = 7;
+        break;
+      default:
+        v = i < n / 2 ? i : n - i;
+        break;
+    }
+    orig[i] = v;
+    work[i] = T(v);
+  }
+}
+
+template <class T, class Iter, int N>
+__host__ __device__ constexpr void test()
+{
+  int orig[N] = {};
+  T work[N]   = {};
+  for (int n = 0; n <= N; n += (n < 40 ? 1 : 37))
+  {
+    for (int pattern = 0; pattern < 6; ++pattern)
+    {
+      fill(orig, work, n, pattern);
+      cuda::std::sort(Iter(work), Iter(work + n), cuda::std::greater<T>());
+      assert(cuda::std::is_sorted(work, work + n, cuda::std::greater<T>()));
+      assert(cuda::std::is_permutation(work, work + n, orig));
+    }
+  }
+}
+
+struct indirect_less
+{
+  const int* keys;
+
+  __host__ __device__ constexpr bool operator()(int lhs, int rhs) const
+  {
+    return keys[lhs] < keys[rhs];
+  }
+};
+
+template <int N>
+__host__ __device__ constexpr void test_indirect()
+{
+  int keys[N]    = {};
+  int indices[N] = {};
+  fill(keys, indices, N, 1);
+  for (int i = 0; i < N; ++i)
+  {
+    indices[i] = i;
+  }
+  cuda::std::sort(indices, indices + N, indirect_less{keys});
+  for (int i = 1; i < N; ++i)
+  {
+    assert(keys[indices[i - 1]] <= keys[indices[i]]);
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::sort(&i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>, N>();
+  test<int, int*, N>();
+  test<double, double*, N>();
+  test<MoveOnly, MoveOnly*, N>();
+  test_indirect<N>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<600>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
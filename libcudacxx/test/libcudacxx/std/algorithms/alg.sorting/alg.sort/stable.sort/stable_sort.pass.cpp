@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   void
+//   stable_sort(Iter first, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int max_size = 600;
+
+template <class T, class Iter>
+__host__ __device__ void test()
+{
+  int orig[max_size] = {};
+  T work[max_size]   = {};
+  for (int n = 0; n <= max_size; n += (n < 40 ? 1 : 37))
+  {
+    unsigned state = 12345u + static_cast<unsigned>(n);
+    for (int i = 0; i < n; ++i)
+    {
+      state   = state * 1664525u + 1013904223u;
+      orig[i] = static_cast<int>(state >> 8);
+      work[i] = T(orig[i]);
+    }
+    cuda::std::stable_sort(Iter(work), Iter(work + n));
+    assert(cuda::std::is_sorted(work, work + n));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+  }
+}
+
+__host__ __device__ bool test()
+{
+  int i = 42;
+  cuda::std::stable_sort(&i, &i); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter> && CopyConstructible<Compare>
+//   void
+//   stable_sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int max_size = 600;
+
+// Elements with equal keys have to keep the order of their indices.
+template <class Index>
+struct keyed
+{
+  int key;
+  Index index;
+};
+
+struct key_less
+{
+  template <class Index>
+  __host__ __device__ bool operator()(const keyed<Index>& lhs, const keyed<Index>& rhs) const
+  {
+    return lhs.key < rhs.key;
+  }
+};
+
+template <class Index, class Iter>
+__host__ __device__ void test(int distinct_keys)
+{
+  keyed<Index> work[max_size] = {};
+  for (int n = 0; n <= max_size; n += (n < 40 ? 1 : 37))
+  {
+    unsigned state = 12345u + static_cast<unsigned>(n);
+    for (int i = 0; i < n; ++i)
+    {
+      state   = state * 1664525u + 1013904223u;
+      work[i] = keyed<Index>{static_cast<int>((state >> 8) % distinct_keys), Index(i)};
+    }
+    cuda::std::stable_sort(Iter(work), Iter(work + n), key_less{});
+    for (int i = 1; i < n; ++i)
+    {
+      assert(work[i - 1].key <= work[i].key);
+      if (work[i - 1].key == work[i].key)
+      {
+        assert(work[i - 1].index < work[i].index);
+      }
+    }
+  }
+}
+
+__host__ __device__ bool test()
+{
+  for (int distinct_keys : {1, 3, 50, 1 << 20})
+  {
+    test<int, random_access_iterator<keyed<int>*>>(distinct_keys);
+    test<int, keyed<int>*>(distinct_keys);
+    // not trivially copyable, which skips the insertion sort for short ranges
+    test<MoveOnly, keyed<MoveOnly>*>(distinct_keys);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, pre-sm-60
+// UNSUPPORTED: windows && pre-sm-70
+
+// <cuda/std/atomic>
+
+// Without LIBCUDACXX_ENABLE_HOST_ATOMIC_128, atomics on 16-byte types take the embedded lock on the host as well, and
+// keep the alignment of the type.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+struct tagged_pair
+{
+  cuda::std::uint64_t value;
+  cuda::std::uint64_t tag;
+
+  __host__ __device__ friend bool operator==(const tagged_pair& lhs, const tagged_pair& rhs)
+  {
+    return lhs.value == rhs.value && lhs.tag == rhs.tag;
+  }
+};
+
+static_assert(sizeof(tagged_pair) == 16, "");
+static_assert(alignof(cuda::std::atomic<tagged_pair>) == alignof(tagged_pair), "");
+
+__host__ __device__ void test()
+{
+  cuda::std::atomic<tagged_pair> a(tagged_pair{1, 2});
+  assert(!a.is_lock_free());
+  assert((a.load() == tagged_pair{1, 2}));
+
+  a.store(tagged_pair{3, 4});
+  assert((a.exchange(tagged_pair{5, 6}) == tagged_pair{3, 4}));
+
+  tagged_pair expected{5, 6};
+  assert(a.compare_exchange_strong(expected, tagged_pair{7, 8}));
+  assert((a.load() == tagged_pair{7, 8}));
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, pre-sm-60
+// UNSUPPORTED: windows && pre-sm-70
+
+// <cuda/std/atomic>
+
+// The AArch64 path of LIBCUDACXX_ENABLE_HOST_ATOMIC_128 needs the LSE atomics, which the default -march lacks. GCC
+// enables them here for the rest of the file, so that the path is compiled even where it cannot be run.
+
+#if defined(__aarch64__) && defined(__GNUC__) && !defined(__clang__) && !defined(__CUDA_ARCH__) \
+  && !defined(__ARM_FEATURE_ATOMICS)
+#  pragma GCC target("+lse")
+#endif
+
+#define LIBCUDACXX_ENABLE_HOST_ATOMIC_128
+
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS) && !defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+#  error "16-byte host atomics are not lock-free on AArch64 with LSE"
+#endif
+
+struct tagged_pair
+{
+  cuda::std::uint64_t value;
+  cuda::std::uint64_t tag;
+
+  __host__ __device__ friend bool operator==(const tagged_pair& lhs, const tagged_pair& rhs)
+  {
+    return lhs.value == rhs.value && lhs.tag == rhs.tag;
+  }
+};
+
+static_assert(alignof(cuda::std::atomic<tagged_pair>) >= 16, "");
+
+__host__ __device__ tagged_pair use(cuda::std::atomic<tagged_pair>& a)
+{
+  a.store(tagged_pair{1, 2});
+  tagged_pair expected = a.exchange(tagged_pair{3, 4});
+  a.compare_exchange_strong(expected, tagged_pair{5, 6});
+  a.compare_exchange_weak(expected, tagged_pair{7, 8});
+  return a.load();
+}
+
+int main(int, char**)
+{
+  return 0;
+}
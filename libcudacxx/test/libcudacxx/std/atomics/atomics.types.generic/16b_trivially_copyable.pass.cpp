@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, pre-sm-60
+// UNSUPPORTED: windows && pre-sm-70
+
+// <cuda/std/atomic>
+
+// Atomics on 16-byte types, which are lock-free on x86-64 and AArch64 LSE hosts with LIBCUDACXX_ENABLE_HOST_ATOMIC_128,
+// are never observed torn, and their compare-and-exchange compares with operator==.
+
+#define LIBCUDACXX_ENABLE_HOST_ATOMIC_128
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+#endif
+
+struct tagged_pair
+{
+  cuda::std::uint64_t value;
+  cuda::std::uint64_t tag;
+
+  __host__ __device__ friend bool operator==(const tagged_pair& lhs, const tagged_pair& rhs)
+  {
+    return lhs.value == rhs.value && lhs.tag == rhs.tag;
+  }
+};
+
+// compares equal whatever its padding holds
+struct padded
+{
+  cuda::std::uint64_t value;
+  cuda::std::uint32_t small;
+
+  __host__ __device__ friend bool operator==(const padded& lhs, const padded& rhs)
+  {
+    return lhs.value == rhs.value && lhs.small == rhs.small;
+  }
+};
+
+static_assert(sizeof(tagged_pair) == 16, "");
+static_assert(sizeof(padded) == 16, "");
+
+template <class A>
+__host__ __device__ void test_operations()
+{
+  A a(tagged_pair{1, 2});
+  static_assert(alignof(A) >= 16, "");
+  assert((a.load() == tagged_pair{1, 2}));
+
+  a.store(tagged_pair{3, 4});
+  assert((a.load() == tagged_pair{3, 4}));
+  a.store(tagged_pair{5, 6}, cuda::std::memory_order_release);
+  assert((a.load(cuda::std::memory_order_acquire) == tagged_pair{5, 6}));
+
+  assert((a.exchange(tagged_pair{7, 8}) == tagged_pair{5, 6}));
+  assert((a.load() == tagged_pair{7, 8}));
+
+  tagged_pair expected{0, 0};
+  assert(!a.compare_exchange_strong(expected, tagged_pair{9, 10}));
+  assert((expected == tagged_pair{7, 8}));
+  assert(a.compare_exchange_strong(expected, tagged_pair{9, 10}));
+  assert((a.load() == tagged_pair{9, 10}));
+
+  expected = tagged_pair{9, 10};
+  while (!a.compare_exchange_weak(expected, tagged_pair{11, 12}))
+  {
+    assert((expected == tagged_pair{9, 10}));
+  }
+  assert((a.load() == tagged_pair{11, 12}));
+}
+
+__host__ __device__ void test_padding()
+{
+  padded initial;
+  cuda::std::memset(&initial, 0xff, sizeof(initial));
+  initial.value = 1;
+  initial.small = 2;
+  cuda::std::atomic<padded> a(initial);
+
+  // the padding of expected differs from the padding of the stored value
+  padded expected;
+  cuda::std::memset(&expected, 0, sizeof(expected));
+  expected.value = 1;
+  expected.small = 2;
+  assert(a.compare_exchange_strong(expected, padded{3, 4}));
+  assert((a.load() == padded{3, 4}));
+}
+
+#ifndef __CUDA_ARCH__
+// Every update increments both halves of the pair, so they stay equal unless a load or an update is torn.
+void test_concurrent()
+{
+  constexpr int threads    = 4;
+  constexpr int increments = 20000;
+  cuda::std::atomic<tagged_pair> a(tagged_pair{0, 0});
+
+  std::vector<std::thread> pool;
+  for (int i = 0; i < threads; ++i)
+  {
+    pool.emplace_back([&] {
+      for (int j = 0; j < increments; ++j)
+      {
+        tagged_pair expected = a.load(cuda::std::memory_order_relaxed);
+        assert(expected.value == expected.tag);
+        while (!a.compare_exchange_weak(expected, tagged_pair{expected.value + 1, expected.tag + 1}))
+        {
+          assert(expected.value == expected.tag);
+        }
+      }
+    });
+  }
+  for (auto& thread : pool)
+  {
+    thread.join();
+  }
+  assert((a.load() == tagged_pair{threads * increments, threads * increments}));
+}
+
+void test_lock_free()
+{
+#  if defined(__x86_64__) && !defined(_MSC_VER)
+  cuda::std::atomic<tagged_pair> a(tagged_pair{0, 0});
+  assert(a.is_lock_free() == (__builtin_cpu_supports("avx") && __builtin_cpu_supports("cmpxchg16b")));
+#  elif defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS) && !defined(_MSC_VER)
+  cuda::std::atomic<tagged_pair> a(tagged_pair{0, 0});
+  assert(a.is_lock_free());
+#  endif
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  test_operations<cuda::std::atomic<tagged_pair>>();
+  test_operations<cuda::std::atomic<tagged_pair> volatile>();
+  test_padding();
+  NV_IF_TARGET(NV_IS_HOST, (test_concurrent(); test_lock_free();))
+
+  return 0;
+}
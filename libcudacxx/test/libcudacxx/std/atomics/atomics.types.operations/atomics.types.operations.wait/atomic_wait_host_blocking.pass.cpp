@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// Host threads blocked in wait are woken by notify_one and notify_all, for objects which are waited on directly and
+// for objects which share a waiter entry with others. A lost wake-up makes the test hang.
+
+#include <cuda/atomic>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <chrono>
+#  include <thread>
+#  include <vector>
+#endif
+
+template <class A, class T>
+void test_ping_pong()
+{
+  constexpr int rounds = 1000;
+  A a(T(0));
+
+  std::thread other([&] {
+    for (int i = 0; i < rounds; ++i)
+    {
+      a.wait(T(0));
+      assert(a.load() == T(1));
+      a.store(T(0));
+      a.notify_one();
+    }
+  });
+
+  for (int i = 0; i < rounds; ++i)
+  {
+    a.store(T(1));
+    a.notify_one();
+    a.wait(T(1));
+  }
+
+  other.join();
+}
+
+template <class A, class T>
+void test_notify_all()
+{
+  constexpr int waiters = 4;
+  A a(T(0));
+  A woken(T(0));
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < waiters; ++i)
+  {
+    threads.emplace_back([&] {
+      a.wait(T(0));
+      woken.fetch_add(T(1));
+    });
+  }
+
+  // let the waiters block before waking them
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  assert(woken.load() == T(0));
+
+  a.store(T(2));
+  a.notify_all();
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(woken.load() == T(waiters));
+}
+
+template <class T>
+void test_ref()
+{
+  T value(0);
+  cuda::atomic_ref<T, cuda::thread_scope_device> a(value);
+
+  std::thread waiter([&] {
+    cuda::atomic_ref<T, cuda::thread_scope_device>(value).wait(T(0));
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  // a different reference to the same object notifies the waiter
+  a.store(T(1));
+  a.notify_one();
+  waiter.join();
+}
+
+template <class T>
+void test()
+{
+  test_ping_pong<cuda::std::atomic<T>, T>();
+  test_ping_pong<cuda::atomic<T, cuda::thread_scope_device>, T>();
+  test_notify_all<cuda::std::atomic<T>, T>();
+  test_notify_all<cuda::atomic<T, cuda::thread_scope_block>, T>();
+  test_ref<T>();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test<signed char>(); test<short>(); test<int>(); test<unsigned int>(); test<long long>();
+                test<float>();
+                test<double>();))
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/limits>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+namespace linalg = cuda::std::linalg;
+
+using E1 = cuda::std::dextents<int, 1>;
+using E2 = cuda::std::dextents<int, 2>;
+
+__host__ __device__ void test_copy_scale_add_swap()
+{
+  double x[5] = {1, 2, 3, 4, 5};
+  double y[5] = {};
+  double z[5] = {};
+  cuda::std::mdspan<double, E1> vx(x, 5);
+  cuda::std::mdspan<double, E1> vy(y, 5);
+  cuda::std::mdspan<double, E1> vz(z, 5);
+
+  linalg::copy(vx, vy);
+  for (int i = 0; i < 5; ++i)
+  {
+    assert(y[i] == x[i]);
+  }
+
+  linalg::scale(2.0, vy);
+  linalg::add(vx, vy, vz);
+  for (int i = 0; i < 5; ++i)
+  {
+    assert(y[i] == 2 * (i + 1));
+    assert(z[i] == 3 * (i + 1));
+  }
+
+  linalg::swap_elements(vx, vz);
+  for (int i = 0; i < 5; ++i)
+  {
+    assert(x[i] == 3 * (i + 1));
+    assert(z[i] == i + 1);
+  }
+
+  // Rank-2 objects in different layouts
+  int a[6] = {1, 2, 3, 4, 5, 6};
+  int b[6] = {};
+  cuda::std::mdspan<int, E2, cuda::std::layout_right> ma(a, 2, 3);
+  cuda::std::mdspan<int, E2, cuda::std::layout_left> mb(b, 2, 3);
+  linalg::copy(linalg::scaled(2, ma), mb);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      assert(mb(i, j) == 2 * ma(i, j));
+    }
+  }
+}
+
+__host__ __device__ void test_dot()
+{
+  double x[5] = {1, 2, 3, 4, 5};
+  double y[5] = {5, 4, 3, 2, 1};
+  cuda::std::mdspan<double, E1> vx(x, 5);
+  cuda::std::mdspan<double, E1> vy(y, 5);
+
+  static_assert(cuda::std::is_same_v<decltype(linalg::dot(vx, vy)), double>);
+  assert(linalg::dot(vx, vy) == 35.0);
+  assert(linalg::dot(vx, vy, 1.0) == 36.0);
+  assert(linalg::dot(vx, linalg::scaled(2.0, vy)) == 70.0);
+  assert(linalg::dotc(vx, vy) == 35.0);
+
+  int ix[3] = {1, 2, 3};
+  cuda::std::mdspan<int, cuda::std::extents<int, 3>> vix(ix);
+  static_assert(cuda::std::is_same_v<decltype(linalg::dot(vix, vix)), int>);
+  assert(linalg::dot(vix, vix) == 14);
+  assert(linalg::dot(vix, vix, 0.5) == 14.5);
+
+  using C = cuda::std::complex<double>;
+  C cx[2] = {C(1, 2), C(3, -1)};
+  C cy[2] = {C(2, 1), C(0, 1)};
+  cuda::std::mdspan<C, E1> vcx(cx, 2);
+  cuda::std::mdspan<C, E1> vcy(cy, 2);
+  // (1 + 2i)(2 + i) + (3 - i)i
+  assert(linalg::dot(vcx, vcy) == C(1, 8));
+  // (1 - 2i)(2 + i) + (3 + i)i
+  assert(linalg::dotc(vcx, vcy) == C(3, 0));
+
+  cuda::std::mdspan<double, E1> empty(x, 0);
+  assert(linalg::dot(empty, empty) == 0.0);
+}
+
+__host__ __device__ void test_norms()
+{
+  double x[4] = {3, -4, 12, 0};
+  cuda::std::mdspan<double, E1> vx(x, 4);
+  assert(linalg::vector_two_norm(vx) == 13.0);
+  assert(linalg::vector_two_norm(vx, 84.0) == 85.0);
+  assert(linalg::vector_abs_sum(vx) == 19.0);
+  assert(linalg::vector_abs_sum(vx, 1.0) == 20.0);
+  assert(linalg::vector_idx_abs_max(vx) == 2);
+
+  // The two-norm neither overflows nor underflows
+  double big[2] = {3e300, 4e300};
+  cuda::std::mdspan<double, E1> vbig(big, 2);
+  assert(cuda::std::fabs(linalg::vector_two_norm(vbig) / 5e300 - 1.0) < 1e-15);
+  double tiny[2] = {3e-300, 4e-300};
+  cuda::std::mdspan<double, E1> vtiny(tiny, 2);
+  assert(cuda::std::fabs(linalg::vector_two_norm(vtiny) / 5e-300 - 1.0) < 1e-15);
+  float fbig[2] = {3e30f, 4e30f};
+  cuda::std::mdspan<float, E1> vfbig(fbig, 2);
+  assert(cuda::std::fabs(linalg::vector_two_norm(vfbig) / 5e30f - 1.0f) < 1e-6f);
+
+  double zeros[3] = {};
+  cuda::std::mdspan<double, E1> vzeros(zeros, 3);
+  assert(linalg::vector_two_norm(vzeros) == 0.0);
+  assert(linalg::vector_idx_abs_max(vzeros) == 0);
+
+  const double inf = cuda::std::numeric_limits<double>::infinity();
+  double with_inf[2] = {1.0, -inf};
+  cuda::std::mdspan<double, E1> vinf(with_inf, 2);
+  assert(linalg::vector_two_norm(vinf) == inf);
+
+  using C = cuda::std::complex<double>;
+  C c[2] = {C(3, 4), C(-5, 0)};
+  cuda::std::mdspan<C, E1> vc(c, 2);
+  static_assert(cuda::std::is_same_v<decltype(linalg::vector_two_norm(vc)), double>);
+  assert(cuda::std::fabs(linalg::vector_two_norm(vc) - cuda::std::sqrt(50.0)) < 1e-14);
+  // The BLAS measures complex numbers by |re| + |im| in asum and iamax
+  assert(linalg::vector_abs_sum(vc) == C(12, 0));
+  assert(linalg::vector_idx_abs_max(vc) == 0);
+
+  int ints[4] = {1, -7, 7, 2};
+  cuda::std::mdspan<int, E1> vints(ints, 4);
+  assert(linalg::vector_abs_sum(vints) == 17);
+  assert(linalg::vector_idx_abs_max(vints) == 1);
+
+  cuda::std::mdspan<double, E1> empty(x, 0);
+  assert(linalg::vector_idx_abs_max(empty) == cuda::std::numeric_limits<E1::size_type>::max());
+}
+
+int main(int, char**)
+{
+  test_copy_scale_add_swap();
+  test_dot();
+  test_norms();
+  return 0;
+}
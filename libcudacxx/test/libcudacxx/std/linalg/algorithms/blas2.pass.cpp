@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+namespace linalg = cuda::std::linalg;
+
+using E1 = cuda::std::dextents<int, 1>;
+using E2 = cuda::std::dextents<int, 2>;
+
+constexpr int M = 5;
+constexpr int N = 7;
+
+template <class Layout>
+__host__ __device__ auto make_matrix(double* data, int rows, int cols)
+{
+  if constexpr (cuda::std::is_same_v<Layout, cuda::std::layout_stride>)
+  {
+    // Every other element of a row-major matrix
+    return cuda::std::mdspan<double, E2, cuda::std::layout_stride>(
+      data, cuda::std::layout_stride::mapping<E2>(E2(rows, cols), cuda::std::array<int, 2>{2 * cols, 2}));
+  }
+  else
+  {
+    return cuda::std::mdspan<double, E2, Layout>(data, rows, cols);
+  }
+}
+
+template <class Layout>
+__host__ __device__ void test_matrix_vector_product()
+{
+  double a[2 * M * N] = {};
+  double x[N];
+  double y[M];
+  double z[M];
+  auto A = make_matrix<Layout>(a, M, N);
+  cuda::std::mdspan<double, E1> vx(x, N);
+  cuda::std::mdspan<double, E1> vy(y, M);
+  cuda::std::mdspan<double, E1> vz(z, M);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      A(i, j) = i * N + j - 10;
+    }
+    z[i] = i;
+  }
+  for (int j = 0; j < N; ++j)
+  {
+    x[j] = j % 3 - 1;
+  }
+
+  linalg::matrix_vector_product(A, vx, vy);
+  for (int i = 0; i < M; ++i)
+  {
+    double expected = 0;
+    for (int j = 0; j < N; ++j)
+    {
+      expected += A(i, j) * x[j];
+    }
+    assert(y[i] == expected);
+  }
+
+  // z = z + 2 * A * x
+  linalg::matrix_vector_product(linalg::scaled(2.0, A), vx, vz, vz);
+  for (int i = 0; i < M; ++i)
+  {
+    assert(z[i] == i + 2 * y[i]);
+  }
+
+  // x = A^T * z
+  linalg::matrix_vector_product(linalg::transposed(A), vz, vx);
+  for (int j = 0; j < N; ++j)
+  {
+    double expected = 0;
+    for (int i = 0; i < M; ++i)
+    {
+      expected += A(i, j) * z[i];
+    }
+    assert(x[j] == expected);
+  }
+
+  // A = A + y * x^T
+  double a_copy[M * N];
+  cuda::std::mdspan<double, E2> A_copy(a_copy, M, N);
+  linalg::copy(A, A_copy);
+  linalg::matrix_rank_1_update(vy, vx, A);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      assert(A(i, j) == A_copy(i, j) + y[i] * x[j]);
+    }
+  }
+}
+
+template <class Layout, class Triangle, class DiagonalStorage>
+__host__ __device__ void test_triangular_matrix_vector_solve()
+{
+  constexpr bool lower = cuda::std::is_same_v<Triangle, linalg::lower_triangle_t>;
+  constexpr bool unit  = cuda::std::is_same_v<DiagonalStorage, linalg::implicit_unit_diagonal_t>;
+
+  double a[2 * N * N] = {};
+  auto A              = make_matrix<Layout>(a, N, N);
+  double x[N];
+  double b[N];
+  cuda::std::mdspan<double, E1> vx(x, N);
+  cuda::std::mdspan<double, E1> vb(b, N);
+
+  // Integer entries, a diagonal of powers of two and a solution of integers keep all arithmetic exact. The elements
+  // outside of the triangle and the implicit diagonal must not be read.
+  for (int i = 0; i < N; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      const bool in_triangle = lower ? j < i : j > i;
+      A(i, j)                = in_triangle ? (i + 2 * j) % 5 - 2 : 1000.0;
+    }
+    A(i, i) = unit ? 1000.0 : double(1 << (i % 3));
+  }
+  for (int i = 0; i < N; ++i)
+  {
+    double sum = 0;
+    for (int j = 0; j < N; ++j)
+    {
+      const bool in_triangle = lower ? j < i : j > i;
+      const double solution  = j - 3;
+      if (in_triangle)
+      {
+        sum += A(i, j) * solution;
+      }
+      else if (i == j)
+      {
+        sum += (unit ? 1.0 : A(i, i)) * solution;
+      }
+    }
+    b[i] = sum;
+  }
+
+  linalg::triangular_matrix_vector_solve(A, Triangle{}, DiagonalStorage{}, vb, vx);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(x[i] == i - 3);
+  }
+
+  linalg::triangular_matrix_vector_solve(A, Triangle{}, DiagonalStorage{}, vb);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(b[i] == i - 3);
+  }
+}
+
+template <class Layout>
+__host__ __device__ void test_layout()
+{
+  test_matrix_vector_product<Layout>();
+  test_triangular_matrix_vector_solve<Layout, linalg::lower_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular_matrix_vector_solve<Layout, linalg::lower_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular_matrix_vector_solve<Layout, linalg::upper_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular_matrix_vector_solve<Layout, linalg::upper_triangle_t, linalg::implicit_unit_diagonal_t>();
+}
+
+int main(int, char**)
+{
+  test_layout<cuda::std::layout_right>();
+  test_layout<cuda::std::layout_left>();
+  test_layout<cuda::std::layout_stride>();
+  return 0;
+}
@@ -0,0 +1,255 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+namespace linalg = cuda::std::linalg;
+
+using E2 = cuda::std::dextents<int, 2>;
+
+template <class Layout, class T>
+__host__ __device__ auto make_matrix(T* data, int rows, int cols)
+{
+  if constexpr (cuda::std::is_same_v<Layout, cuda::std::layout_stride>)
+  {
+    // Every other element of a row-major matrix
+    return cuda::std::mdspan<T, E2, cuda::std::layout_stride>(
+      data, cuda::std::layout_stride::mapping<E2>(E2(rows, cols), cuda::std::array<int, 2>{2 * cols, 2}));
+  }
+  else
+  {
+    return cuda::std::mdspan<T, E2, Layout>(data, rows, cols);
+  }
+}
+
+// Small integers keep all sums exact, so the results must match exactly no matter in which order they are added
+template <class LayoutA, class LayoutB, class LayoutC, class T>
+__host__ __device__ void test_matrix_product(T* a, T* b, T* c, T* e, int m, int n, int k)
+{
+  auto A = make_matrix<LayoutA>(a, m, k);
+  auto B = make_matrix<LayoutB>(b, k, n);
+  auto C = make_matrix<LayoutC>(c, m, n);
+  auto E = make_matrix<LayoutC>(e, m, n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int p = 0; p < k; ++p)
+    {
+      A(i, p) = T((i * 7 + p * 3) % 11 - 5);
+    }
+  }
+  for (int p = 0; p < k; ++p)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      B(p, j) = T((p * 5 + j * 2) % 9 - 4);
+    }
+  }
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      E(i, j) = T(i - j);
+    }
+  }
+
+  auto product = [&](int i, int j) {
+    T sum = 0;
+    for (int p = 0; p < k; ++p)
+    {
+      sum += A(i, p) * B(p, j);
+    }
+    return sum;
+  };
+
+  linalg::matrix_product(A, B, C);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == product(i, j));
+    }
+  }
+
+  // C^T = B^T * A^T + 2 * E^T
+  linalg::matrix_product(
+    linalg::transposed(B), linalg::transposed(A), linalg::scaled(T(2), linalg::transposed(E)), linalg::transposed(C));
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == product(i, j) + 2 * E(i, j));
+    }
+  }
+
+  // C = C + A * B
+  linalg::matrix_product(A, B, C, C);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(C(i, j) == 2 * product(i, j) + 2 * E(i, j));
+    }
+  }
+}
+
+template <class LayoutA, class LayoutB, class Triangle, class DiagonalStorage>
+__host__ __device__ void test_triangular_matrix_matrix_left_solve(double* a, double* b, double* x, int m, int n)
+{
+  constexpr bool lower = cuda::std::is_same_v<Triangle, linalg::lower_triangle_t>;
+  constexpr bool unit  = cuda::std::is_same_v<DiagonalStorage, linalg::implicit_unit_diagonal_t>;
+
+  auto A = make_matrix<LayoutA>(a, m, m);
+  auto B = make_matrix<LayoutB>(b, m, n);
+  auto X = make_matrix<LayoutB>(x, m, n);
+
+  // The solution is X(i, j) == (i + j) % 5 - 2. The elements outside of the triangle and the implicit diagonal must
+  // not be read. Nonzeros only on the two diagonals nearest to the main one keep all values small and exact.
+  auto in_triangle = [&](int i, int p) {
+    return lower ? p < i : p > i;
+  };
+  auto in_band = [&](int i, int p) {
+    return in_triangle(i, p) && (i - p < 3) && (p - i < 3);
+  };
+  for (int i = 0; i < m; ++i)
+  {
+    for (int p = 0; p < m; ++p)
+    {
+      A(i, p) = in_band(i, p) ? double((i + p) % 3 - 1) : (in_triangle(i, p) ? 0.0 : 1000.0);
+    }
+    A(i, i) = unit ? 1000.0 : double(1 << (i % 2));
+  }
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      double sum = (unit ? 1.0 : A(i, i)) * ((i + j) % 5 - 2);
+      for (int p = 0; p < m; ++p)
+      {
+        if (in_band(i, p))
+        {
+          sum += A(i, p) * ((p + j) % 5 - 2);
+        }
+      }
+      B(i, j) = sum;
+    }
+  }
+
+  linalg::triangular_matrix_matrix_left_solve(A, Triangle{}, DiagonalStorage{}, B, X);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(X(i, j) == (i + j) % 5 - 2);
+    }
+  }
+
+  linalg::triangular_matrix_matrix_left_solve(A, Triangle{}, DiagonalStorage{}, B);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(B(i, j) == X(i, j));
+    }
+  }
+}
+
+template <int M, int N, int K, class T>
+__host__ __device__ void test_all_matrix_products(T* a, T* b, T* c, T* e)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::layout_stride;
+  test_matrix_product<layout_right, layout_right, layout_right>(a, b, c, e, M, N, K);
+  test_matrix_product<layout_left, layout_right, layout_left>(a, b, c, e, M, N, K);
+  test_matrix_product<layout_stride, layout_left, layout_right>(a, b, c, e, M, N, K);
+  test_matrix_product<layout_right, layout_stride, layout_stride>(a, b, c, e, M, N, K);
+}
+
+template <int M, int N>
+__host__ __device__ void test_all_solves(double* a, double* b, double* x)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::layout_stride;
+  test_triangular_matrix_matrix_left_solve<layout_right, layout_right, linalg::lower_triangle_t,
+                                           linalg::explicit_diagonal_t>(a, b, x, M, N);
+  test_triangular_matrix_matrix_left_solve<layout_left, layout_right, linalg::upper_triangle_t,
+                                           linalg::explicit_diagonal_t>(a, b, x, M, N);
+  test_triangular_matrix_matrix_left_solve<layout_stride, layout_left, linalg::lower_triangle_t,
+                                           linalg::implicit_unit_diagonal_t>(a, b, x, M, N);
+  test_triangular_matrix_matrix_left_solve<layout_left, layout_stride, linalg::upper_triangle_t,
+                                           linalg::implicit_unit_diagonal_t>(a, b, x, M, N);
+}
+
+__host__ __device__ void test_small()
+{
+  constexpr int M = 5;
+  constexpr int N = 6;
+  constexpr int K = 7;
+  double a[2 * M * K];
+  double b[2 * K * N];
+  double c[2 * M * N];
+  double e[2 * M * N];
+  test_all_matrix_products<M, N, K>(a, b, c, e);
+
+  int ia[2 * M * K];
+  int ib[2 * K * N];
+  int ic[2 * M * N];
+  int ie[2 * M * N];
+  test_all_matrix_products<M, N, K>(ia, ib, ic, ie);
+
+  double ta[2 * K * K];
+  double x[2 * K * N];
+  test_all_solves<K, N>(ta, b, x);
+}
+
+// Large enough for the blocked host algorithms, with edges that do not fill a whole block
+void test_large()
+{
+  constexpr int M = 139;
+  constexpr int N = 75;
+  constexpr int K = 300;
+  double* a = new double[2 * M * K];
+  double* b = new double[2 * K * N];
+  double* c = new double[2 * M * N];
+  double* e = new double[2 * M * N];
+  test_all_matrix_products<M, N, K>(a, b, c, e);
+
+  float* fa = new float[2 * M * K];
+  float* fb = new float[2 * K * N];
+  float* fc = new float[2 * M * N];
+  float* fe = new float[2 * M * N];
+  test_all_matrix_products<M, N, K>(fa, fb, fc, fe);
+
+  double* ta = new double[2 * K * K];
+  double* tx = new double[2 * K * N];
+  test_all_solves<K, N>(ta, b, tx);
+
+  delete[] a;
+  delete[] b;
+  delete[] c;
+  delete[] e;
+  delete[] fa;
+  delete[] fb;
+  delete[] fc;
+  delete[] fe;
+  delete[] ta;
+  delete[] tx;
+}
+
+int main(int, char**)
+{
+  test_small();
+  NV_IF_TARGET(NV_IS_HOST, (test_large();))
+  return 0;
+}
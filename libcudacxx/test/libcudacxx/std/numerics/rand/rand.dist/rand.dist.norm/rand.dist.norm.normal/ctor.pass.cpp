@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template<class RealType = double>
+// class normal_distribution
+
+// normal_distribution() : normal_distribution(0.0) {}
+// explicit normal_distribution(RealType mean, RealType stddev = 1.0);
+// explicit normal_distribution(const param_type& parm);
+// param_type param() const;
+// void param(const param_type& parm);
+// bool operator==(const normal_distribution& x, const normal_distribution& y);
+
+#include <cuda/std/__random_>
+#include <cuda/std/cassert>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "make_implicit.h"
+#include "test_convertible.h"
+#include "test_macros.h"
+
+template <class T>
+__host__ __device__ void test_implicit()
+{
+  using D = cuda::std::normal_distribution<T>;
+  static_assert(test_convertible<D>(), "");
+  assert(D(0) == make_implicit<D>());
+  static_assert(!test_convertible<D, T>(), "");
+  static_assert(!test_convertible<D, T, T>(), "");
+}
+
+__host__ __device__ void test()
+{
+  using D = cuda::std::normal_distribution<>;
+  using P = D::param_type;
+  static_assert(cuda::std::is_same<D::result_type, double>::value, "");
+  static_assert(cuda::std::is_same<P::distribution_type, D>::value, "");
+  {
+    D d;
+    assert(d.mean() == 0.0);
+    assert(d.stddev() == 1.0);
+    assert(d.min() == -cuda::std::numeric_limits<double>::infinity());
+    assert(d.max() == cuda::std::numeric_limits<double>::infinity());
+  }
+  {
+    D d(14.5);
+    assert(d.mean() == 14.5);
+    assert(d.stddev() == 1.0);
+  }
+  {
+    D d(14.5, 5.25);
+    assert(d.mean() == 14.5);
+    assert(d.stddev() == 5.25);
+    assert(d.param() == P(14.5, 5.25));
+    assert(d == D(P(14.5, 5.25)));
+    d.param(P(1, 2));
+    assert(d.param() == P(1, 2));
+    assert(d != D(14.5, 5.25));
+  }
+  {
+    // the second value of each pair is kept, so copies compare equal until one of them is used
+    cuda::std::minstd_rand0 g;
+    D d1(2, 3);
+    (void) d1(g);
+    D d2 = d1;
+    assert(d1 == d2);
+    assert(d1 != D(2, 3));
+    const double x = d1(g);
+    assert(d1 != d2);
+    assert(d2(g) == x);
+    assert(d1 == d2);
+    d1.reset();
+    assert(d1 == D(2, 3));
+  }
+}
+
+int main(int, char**)
+{
+  test();
+  test_implicit<float>();
+  test_implicit<double>();
+  return 0;
+}
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// REQUIRES: long_tests
+
+// <random>
+
+// template<class RealType = double>
+// class normal_distribution
+
+// template<class _URng> result_type operator()(_URng& g);
+// template<class _URng> result_type operator()(_URng& g, const param_type& parm);
+
+#include <cuda/std/__random_>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/numeric>
+
+#include "test_macros.h"
+
+template <class T>
+__host__ __device__ inline T sqr(T x)
+{
+  return x * x;
+}
+
+template <class D, class G>
+__host__ __device__ void test_statistics(D& d, G& g, const typename D::param_type& p)
+{
+  using T         = typename D::result_type;
+  constexpr int N = 10000;
+  cuda::std::array<T, N> u;
+  for (int i = 0; i < N; ++i)
+  {
+    u[i] = d(g, p);
+  }
+  T mean     = cuda::std::accumulate(u.begin(), u.end(), T(0)) / u.size();
+  T var      = 0;
+  T skew     = 0;
+  T kurtosis = 0;
+  for (cuda::std::size_t i = 0; i < u.size(); ++i)
+  {
+    T dbl = (u[i] - mean);
+    T d2  = sqr(dbl);
+    var += d2;
+    skew += dbl * d2;
+    kurtosis += d2 * d2;
+  }
+  var /= u.size();
+  T dev = cuda::std::sqrt(var);
+  skew /= u.size() * dev * var;
+  kurtosis /= u.size() * var * var;
+  kurtosis -= 3;
+  T x_mean = p.mean();
+  T x_var  = sqr(p.stddev());
+  // about five standard errors of each estimate for N samples
+  assert(cuda::std::abs((mean - x_mean) / x_mean) < 0.04);
+  assert(cuda::std::abs((var - x_var) / x_var) < 0.07);
+  assert(cuda::std::abs(skew) < 0.12);
+  assert(cuda::std::abs(kurtosis) < 0.25);
+}
+
+template <class T, class G>
+__host__ __device__ void test()
+{
+  using D = cuda::std::normal_distribution<T>;
+  G g;
+  D d(5, 4);
+  test_statistics(d, g, d.param());
+  test_statistics(d, g, typename D::param_type(-10, 0.5));
+}
+
+int main(int, char**)
+{
+  test<double, cuda::std::minstd_rand0>();
+  test<double, cuda::std::mt19937>();
+  test<double, cuda::std::philox4x64>();
+  test<float, cuda::std::philox4x32>();
+  test<float, cuda::std::mt19937_64>();
+  return 0;
+}
@@ -129,10 +129,12 @@ int main(int, char**)
 {
   test_statistics<cuda::std::minstd_rand0>();
 
-#if 0 // not implemented
-  test_statistics<int, cuda::std::minstd_rand>();
   test_statistics<int, cuda::std::mt19937>();
   test_statistics<int, cuda::std::mt19937_64>();
+  test_statistics<int, cuda::std::philox4x32>();
+  test_statistics<int, cuda::std::philox4x64>();
+#if 0 // not implemented
+  test_statistics<int, cuda::std::minstd_rand>();
   test_statistics<int, cuda::std::ranlux24_base>();
   test_statistics<int, cuda::std::ranlux48_base>();
   test_statistics<int, cuda::std::ranlux24>();
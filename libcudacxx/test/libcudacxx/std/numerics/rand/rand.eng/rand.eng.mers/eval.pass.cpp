@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template <class UIntType, size_t w, size_t n, size_t m, size_t r,
+//           UIntType a, size_t u, UIntType d, size_t s,
+//           UIntType b, size_t t, UIntType c, size_t l, UIntType f>
+// class mersenne_twister_engine;
+
+// result_type operator()();
+// void discard(unsigned long long z);
+// template <class ForwardIt> void generate(ForwardIt first, ForwardIt last); // extension
+
+#include <cuda/std/__random_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class E>
+__host__ __device__ void test_eval(typename E::result_type expected)
+{
+  // [rand.predef]: the 10000th consecutive invocation of a default-constructed engine
+  E e;
+  for (int i = 0; i < 9999; ++i)
+  {
+    (void) e();
+  }
+  assert(e() == expected);
+
+  E d;
+  d.discard(9999);
+  assert(d() == expected);
+  assert(d == e);
+}
+
+template <class E>
+__host__ __device__ void test_generate()
+{
+  using T                    = typename E::result_type;
+  constexpr cuda::std::size_t N = 1500;
+  T expected[N];
+  T actual[N];
+  const cuda::std::size_t sizes[] = {0, 1, 7, 311, 312, 313, 624, 625, 1400};
+  for (cuda::std::size_t skip = 0; skip < 3; ++skip)
+  {
+    for (cuda::std::size_t size : sizes)
+    {
+      E e1;
+      E e2;
+      e1.discard(skip * 300);
+      e2.discard(skip * 300);
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        expected[i] = e1();
+      }
+      e2.generate(actual, actual + size);
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(actual[i] == expected[i]);
+      }
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+
+  // iterators which are not random access take the path one value at a time
+  E e1;
+  E e2;
+  e2.generate(forward_iterator<T*>(actual), forward_iterator<T*>(actual + 100));
+  for (cuda::std::size_t i = 0; i < 100; ++i)
+  {
+    assert(actual[i] == e1());
+  }
+  assert(e1 == e2);
+}
+
+__host__ __device__ void test_discard()
+{
+  cuda::std::mt19937 e1;
+  cuda::std::mt19937 e2 = e1;
+  for (int i = 0; i < 700; ++i)
+  {
+    (void) e1();
+  }
+  e2.discard(3);
+  e2.discard(697);
+  assert(e1 == e2);
+  e2.discard(0);
+  assert(e1 == e2);
+}
+
+__host__ __device__ void test()
+{
+  test_eval<cuda::std::mt19937>(4123659995u);
+  test_eval<cuda::std::mt19937_64>(9981545732273789042ull);
+  test_generate<cuda::std::mt19937>();
+  test_generate<cuda::std::mt19937_64>();
+  test_discard();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template <class UIntType, size_t w, size_t n, size_t m, size_t r,
+//           UIntType a, size_t u, UIntType d, size_t s,
+//           UIntType b, size_t t, UIntType c, size_t l, UIntType f>
+// class mersenne_twister_engine;
+
+// explicit mersenne_twister_engine(result_type s = default_seed);
+// template<class Sseq> explicit mersenne_twister_engine(Sseq& q);
+// void seed(result_type s = default_seed);
+// template<class Sseq> void seed(Sseq& q);
+
+#include <cuda/std/__random_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+struct seed_sequence
+{
+  using result_type = cuda::std::uint32_t;
+
+  cuda::std::uint32_t value;
+
+  template <class It>
+  __host__ __device__ void generate(It first, It last)
+  {
+    for (; first != last; ++first)
+    {
+      *first = value;
+    }
+  }
+};
+
+template <class E>
+__host__ __device__ void test()
+{
+  E e1;
+  E e2(E::default_seed);
+  assert(e1 == e2);
+
+  E e3(5);
+  assert(e1 != e3);
+  e1.seed(5);
+  assert(e1 == e3);
+  assert(e1() == e3());
+  e1.seed();
+  assert(e1 == e2);
+
+  seed_sequence q1{42};
+  seed_sequence q2{42};
+  E e4(q1);
+  E e5;
+  e5.seed(q2);
+  assert(e4 == e5);
+  assert(e4 != e2);
+  assert(e4() == e5());
+
+  // a seed sequence of zeros would leave an all-zero state, which is replaced by one with a single bit set
+  seed_sequence zeros{0};
+  E e6(zeros);
+  bool nonzero = false;
+  for (int i = 0; i < 1000; ++i)
+  {
+    nonzero |= e6() != 0;
+  }
+  assert(nonzero);
+
+  E e7 = e4;
+  assert(e7 == e4);
+  (void) e7();
+  assert(e7 != e4);
+}
+
+__host__ __device__ void test_values()
+{
+  using E = cuda::std::mt19937;
+  static_assert(E::word_size == 32, "");
+  static_assert(E::state_size == 624, "");
+  static_assert(E::shift_size == 397, "");
+  static_assert(E::mask_bits == 31, "");
+  static_assert(E::xor_mask == 0x9908b0df, "");
+  static_assert(E::default_seed == 5489u, "");
+  static_assert((E::min)() == 0, "");
+  static_assert((E::max)() == 0xFFFFFFFF, "");
+
+  using E64 = cuda::std::mt19937_64;
+  static_assert(E64::word_size == 64, "");
+  static_assert(E64::state_size == 312, "");
+  static_assert(E64::initialization_multiplier == 6364136223846793005ull, "");
+  static_assert((E64::max)() == 0xFFFFFFFFFFFFFFFFull, "");
+}
+
+int main(int, char**)
+{
+  test<cuda::std::mt19937>();
+  test<cuda::std::mt19937_64>();
+  test_values();
+  return 0;
+}
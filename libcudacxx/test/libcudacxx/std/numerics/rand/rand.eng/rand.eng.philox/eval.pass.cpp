@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template<class UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+// class philox_engine;
+
+// result_type operator()();
+// void discard(unsigned long long z);
+// void set_counter(const array<result_type, n>& counter);
+// template <class ForwardIt> void generate(ForwardIt first, ForwardIt last); // extension
+
+#include <cuda/std/__random_>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+using philox2x32 = cuda::std::philox_engine<cuda::std::uint32_t, 32, 2, 10, 0xD256D193, 0x9E3779B9>;
+
+template <class E>
+__host__ __device__ void test_eval(typename E::result_type expected)
+{
+  // [rand.predef]: the 10000th consecutive invocation of a default-constructed engine
+  E e;
+  for (int i = 0; i < 9999; ++i)
+  {
+    (void) e();
+  }
+  assert(e() == expected);
+
+  E d;
+  d.discard(9999);
+  assert(d() == expected);
+  assert(d == e);
+}
+
+template <class E>
+__host__ __device__ void test_discard()
+{
+  for (unsigned long long skip = 0; skip < 40; ++skip)
+  {
+    for (unsigned long long z = 0; z < 40; ++z)
+    {
+      E e1;
+      E e2;
+      e1.discard(skip);
+      e2.discard(skip);
+      for (unsigned long long i = 0; i < z; ++i)
+      {
+        (void) e1();
+      }
+      e2.discard(z);
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+
+  // discarding 2^63 values skips 2^61 counters, which carries into the second word of a 32-bit counter
+  using T = typename E::result_type;
+  E e1;
+  e1.discard(1ull << 62);
+  e1.discard(1ull << 62);
+  E e2;
+  if constexpr (E::word_size == 32)
+  {
+    e2.set_counter({0, 0, T(1) << 29, 0});
+  }
+  else
+  {
+    e2.set_counter({0, 0, 0, T(1) << 61});
+  }
+  assert(e1() == e2());
+}
+
+template <class E>
+__host__ __device__ void test_counter()
+{
+  using T         = typename E::result_type;
+  constexpr T max = (E::max)();
+
+  // the counter carries into its next word, most significant word first in set_counter
+  E e1;
+  e1.set_counter({0, 0, 0, max});
+  for (int i = 0; i < 4; ++i)
+  {
+    (void) e1();
+  }
+  E e2;
+  e2.set_counter({0, 0, 1, 0});
+  assert(e1() == e2());
+
+  E e3;
+  e3.set_counter({max, max, max, max});
+  E e4;
+  e4.set_counter({0, 0, 0, 0});
+  e3.discard(4);
+  assert(e3() == e4());
+
+  // set_counter does not change the key
+  E e5(7);
+  E e6(7);
+  (void) e5();
+  e5.set_counter({0, 0, 0, 0});
+  assert(e5 == e6);
+}
+
+template <class E>
+__host__ __device__ void test_generate()
+{
+  using T                       = typename E::result_type;
+  constexpr cuda::std::size_t N = 300;
+  T expected[N];
+  T actual[N];
+  const cuda::std::size_t sizes[] = {0, 1, 3, 4, 5, 31, 32, 33, 36, 37, 299};
+  for (cuda::std::size_t skip = 0; skip < 5; ++skip)
+  {
+    for (cuda::std::size_t size : sizes)
+    {
+      E e1;
+      E e2;
+      e1.discard(skip);
+      e2.discard(skip);
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        expected[i] = e1();
+      }
+      e2.generate(actual, actual + size);
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(actual[i] == expected[i]);
+      }
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+
+  E e1;
+  E e2;
+  e2.generate(forward_iterator<T*>(actual), forward_iterator<T*>(actual + 10));
+  for (cuda::std::size_t i = 0; i < 10; ++i)
+  {
+    assert(actual[i] == e1());
+  }
+  assert(e1 == e2);
+}
+
+__host__ __device__ void test()
+{
+  test_eval<cuda::std::philox4x32>(1955073260u);
+  test_eval<cuda::std::philox4x64>(3409172418970261260ull);
+  test_discard<cuda::std::philox4x32>();
+  test_discard<cuda::std::philox4x64>();
+  test_counter<cuda::std::philox4x32>();
+  test_counter<cuda::std::philox4x64>();
+  test_generate<cuda::std::philox4x32>();
+  test_generate<cuda::std::philox4x64>();
+  test_generate<philox2x32>();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template<class UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+// class philox_engine;
+
+// explicit philox_engine(result_type value = default_seed);
+// template<class Sseq> explicit philox_engine(Sseq& q);
+// void seed(result_type value = default_seed);
+// template<class Sseq> void seed(Sseq& q);
+
+#include <cuda/std/__random_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+struct seed_sequence
+{
+  using result_type = cuda::std::uint32_t;
+
+  cuda::std::uint32_t value;
+
+  template <class It>
+  __host__ __device__ void generate(It first, It last)
+  {
+    for (; first != last; ++first)
+    {
+      *first = value++;
+    }
+  }
+};
+
+template <class E>
+__host__ __device__ void test()
+{
+  E e1;
+  E e2(E::default_seed);
+  assert(e1 == e2);
+
+  E e3(5);
+  assert(e1 != e3);
+  e1.seed(5);
+  assert(e1 == e3);
+  assert(e1() == e3());
+  e1.seed();
+  assert(e1 == e2);
+
+  seed_sequence q1{42};
+  seed_sequence q2{42};
+  E e4(q1);
+  E e5;
+  e5.seed(q2);
+  assert(e4 == e5);
+  assert(e4 != e2);
+  assert(e4() == e5());
+
+  E e6 = e4;
+  assert(e6 == e4);
+  (void) e6();
+  assert(e6 != e4);
+}
+
+__host__ __device__ void test_values()
+{
+  using E = cuda::std::philox4x32;
+  static_assert(E::word_size == 32, "");
+  static_assert(E::word_count == 4, "");
+  static_assert(E::round_count == 10, "");
+  static_assert(E::multipliers[0] == 0xCD9E8D57, "");
+  static_assert(E::multipliers[1] == 0xD2511F53, "");
+  static_assert(E::round_consts[0] == 0x9E3779B9, "");
+  static_assert(E::round_consts[1] == 0xBB67AE85, "");
+  static_assert(E::default_seed == 20111115u, "");
+  static_assert((E::min)() == 0, "");
+  static_assert((E::max)() == 0xFFFFFFFF, "");
+
+  using E64 = cuda::std::philox4x64;
+  static_assert(E64::word_size == 64, "");
+  static_assert(E64::multipliers[0] == 0xCA5A826395121157, "");
+  static_assert(E64::round_consts[1] == 0xBB67AE8584CAA73B, "");
+  static_assert((E64::max)() == 0xFFFFFFFFFFFFFFFFull, "");
+
+  using E2 = cuda::std::philox_engine<cuda::std::uint_fast64_t, 48, 2, 7, 0xD2B74407B1CE, 0x9E3779B97F4A>;
+  static_assert(E2::multipliers.size() == 1, "");
+  static_assert(E2::multipliers[0] == 0xD2B74407B1CE, "");
+  static_assert((E2::max)() == 0xFFFFFFFFFFFF, "");
+}
+
+int main(int, char**)
+{
+  test<cuda::std::philox4x32>();
+  test<cuda::std::philox4x64>();
+  test<cuda::std::philox_engine<cuda::std::uint_fast64_t, 48, 2, 7, 0xD2B74407B1CE, 0x9E3779B97F4A>>();
+  test_values();
+  return 0;
+}
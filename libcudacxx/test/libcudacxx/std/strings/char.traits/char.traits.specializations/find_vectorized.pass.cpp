@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// char_traits::find on wide characters, which the host searches a vector at a time
+
+#include <cuda/std/__string_>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <class CharT, int N>
+__host__ __device__ constexpr void test_type()
+{
+  using traits = cuda::std::char_traits<CharT>;
+
+  // the largest character has the sign bit of its lane set
+  const CharT needles[] = {CharT(2), CharT(~CharT(0)), CharT(CharT(1) << (8 * sizeof(CharT) - 1))};
+  CharT s[N + 4]        = {};
+  for (const CharT needle : needles)
+  {
+    for (int offset = 0; offset < 4; ++offset)
+    {
+      for (int len = 0; len <= N; ++len)
+      {
+        CharT* first = s + offset;
+        for (int i = 0; i < N + 4; ++i)
+        {
+          s[i] = CharT(1);
+        }
+        // a match past the end is not found
+        first[len] = needle;
+        assert(traits::find(first, len, needle) == nullptr);
+        // a character that differs from the needle in a single byte does not match
+        first[0] = CharT(needle ^ CharT(1));
+        assert(traits::find(first, len, needle) == nullptr);
+        for (int pos = len - 1; pos >= 0; --pos)
+        {
+          first[pos] = needle;
+          assert(traits::find(first, len, needle) == first + pos);
+        }
+      }
+    }
+  }
+}
+
+template <int N>
+__host__ __device__ constexpr bool test()
+{
+  test_type<char, N>();
+  test_type<char16_t, N>();
+  test_type<char32_t, N>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t, N>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<100>();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test<20>(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
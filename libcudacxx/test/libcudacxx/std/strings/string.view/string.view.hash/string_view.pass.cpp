@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<> struct hash<string_view>;
+// template<> struct hash<u16string_view>;
+// template<> struct hash<u32string_view>;
+// template<> struct hash<wstring_view>;
+
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class CharT>
+__host__ __device__ void test()
+{
+  using SV = cuda::std::basic_string_view<CharT>;
+  static_assert(cuda::std::is_same<decltype(cuda::std::hash<SV>{}(SV{})), cuda::std::size_t>::value, "");
+  static_assert(noexcept(cuda::std::hash<SV>{}(SV{})), "");
+
+  // Hash all lengths that take a different path through the byte hash, and make sure that every character of the
+  // string contributes to the hash
+  constexpr int n = 150;
+  CharT str[n]    = {};
+  CharT copy[n]   = {};
+  for (int i = 0; i < n; ++i)
+  {
+    str[i]  = static_cast<CharT>('a' + i % 26);
+    copy[i] = str[i];
+  }
+
+  const cuda::std::hash<SV> h{};
+  assert(h(SV{}) == h(SV{copy, 0}));
+  for (int len = 0; len <= n; ++len)
+  {
+    const cuda::std::size_t hash = h(SV{str, static_cast<cuda::std::size_t>(len)});
+    assert(hash == h(SV{copy, static_cast<cuda::std::size_t>(len)}));
+    if (len > 0)
+    {
+      assert(hash != h(SV{str, static_cast<cuda::std::size_t>(len - 1)}));
+      assert(hash != h(SV{str + 1, static_cast<cuda::std::size_t>(len - 1)}));
+    }
+    for (int i = 0; i < len; ++i)
+    {
+      copy[i] = static_cast<CharT>(copy[i] ^ 1);
+      assert(hash != h(SV{copy, static_cast<cuda::std::size_t>(len)}));
+      copy[i] = str[i];
+    }
+  }
+}
+
+__host__ __device__ void test()
+{
+  test<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+#if _CCCL_HAS_CHAR8_T()
+  test<char8_t>();
+#endif // _CCCL_HAS_CHAR8_T()
+  test<char16_t>();
+  test<char32_t>();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
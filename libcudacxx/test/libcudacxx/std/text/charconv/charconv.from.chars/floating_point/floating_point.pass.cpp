@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/bit>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+template <class T>
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::errc ec;
+  cuda::std::size_t len;
+  T val;
+};
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST bool same_value(T lhs, T rhs)
+{
+  using U = cuda::std::conditional_t<sizeof(T) == 4, cuda::std::uint32_t, cuda::std::uint64_t>;
+  return cuda::std::bit_cast<U>(lhs) == cuda::std::bit_cast<U>(rhs);
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_from_chars(const TestItem<T>& item)
+{
+  using cuda::std::declval;
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       declval<const char*>(), declval<const char*>(), declval<T&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(declval<const char*>(), declval<const char*>(), declval<T&>())));
+
+  constexpr T sentinel = T(42.0);
+
+  T value           = sentinel;
+  const auto len    = cuda::std::strlen(item.str);
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.len);
+  assert(same_value(value, (item.ec == cuda::std::errc{}) ? item.val : sentinel));
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_common()
+{
+  constexpr auto general    = cuda::std::chars_format::general;
+  constexpr auto scientific = cuda::std::chars_format::scientific;
+  constexpr auto fixed      = cuda::std::chars_format::fixed;
+  constexpr auto hex        = cuda::std::chars_format::hex;
+  constexpr auto ok         = cuda::std::errc{};
+  constexpr auto invalid    = cuda::std::errc::invalid_argument;
+  constexpr auto range      = cuda::std::errc::result_out_of_range;
+
+  const T inf = cuda::std::numeric_limits<T>::infinity();
+
+  const TestItem<T> items[] = {
+    {"0", general, ok, 1, T(0.0)},
+    {"-0", general, ok, 2, -T(0.0)},
+    {"1", general, ok, 1, T(1.0)},
+    {"-2.5", general, ok, 4, T(-2.5)},
+    {"0.25e1", general, ok, 6, T(2.5)},
+    {"1e3x", general, ok, 3, T(1000.0)},
+    {"12.5e", general, ok, 4, T(12.5)},
+    {"1e+", general, ok, 1, T(1.0)},
+    {".5", general, ok, 2, T(0.5)},
+    {"5.", general, ok, 2, T(5.0)},
+    {"0000000000000000000000000000000001.5", general, ok, 36, T(1.5)},
+    {"1.5e2", fixed, ok, 3, T(1.5)},
+    {"1.5e2", scientific, ok, 5, T(150.0)},
+    {"1.5", scientific, invalid, 0, T{}},
+    {"1.8p1", hex, ok, 5, T(3.0)},
+    {"-a.8", hex, ok, 4, T(-10.5)},
+    {"0x1p1", hex, ok, 1, T(0.0)},
+    {"", general, invalid, 0, T{}},
+    {"+1", general, invalid, 0, T{}},
+    {".", general, invalid, 0, T{}},
+    {"-", general, invalid, 0, T{}},
+    {"e5", general, invalid, 0, T{}},
+    {"inf", general, ok, 3, inf},
+    {"-INFINITY", general, ok, 9, -inf},
+    {"infinit", general, ok, 3, inf},
+    {"1e999999", general, range, 8, T{}},
+    {"1e-999999", general, range, 9, T{}},
+    {"0e999999", general, ok, 8, T(0.0)},
+  };
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  T value           = T(1.0);
+  const char nan[]  = "nan(abc_1)x";
+  const auto result = cuda::std::from_chars(nan, nan + sizeof(nan) - 1, value);
+  assert(result.ec == ok);
+  assert(result.ptr == nan + 10);
+  assert(value != value);
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_float()
+{
+  constexpr auto general = cuda::std::chars_format::general;
+  constexpr auto hex     = cuda::std::chars_format::hex;
+  constexpr auto ok      = cuda::std::errc{};
+  constexpr auto range   = cuda::std::errc::result_out_of_range;
+
+  const TestItem<float> items[] = {
+    {"0.1", general, ok, 3, 0.1f},
+    {"3.4028235e38", general, ok, 12, 3.4028235e38f},
+    {"3.4028236e38", general, range, 12, 0.0f},
+    {"1e-45", general, ok, 5, 1e-45f},
+    {"8e-46", general, ok, 5, 1e-45f},
+    {"7e-46", general, range, 5, 0.0f},
+    // Exactly halfway between 1 and the next float, ties to even
+    {"1.000000059604644775390625", general, ok, 26, 1.0f},
+    // Just above halfway, only visible in the last of many digits
+    {"1.00000005960464477539062500000000000000000000000000000000000001", general, ok, 64, 1.00000012f},
+    {"16777217", general, ok, 8, 16777216.0f},
+    {"1.fffffep127", hex, ok, 12, 3.4028235e38f},
+    {"0.000002p-126", hex, ok, 13, 1e-45f},
+  };
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_double()
+{
+  constexpr auto general = cuda::std::chars_format::general;
+  constexpr auto hex     = cuda::std::chars_format::hex;
+  constexpr auto ok      = cuda::std::errc{};
+  constexpr auto range   = cuda::std::errc::result_out_of_range;
+
+  const TestItem<double> items[] = {
+    {"0.1", general, ok, 3, 0.1},
+    {"0.30000000000000004", general, ok, 19, 0.30000000000000004},
+    {"1.7976931348623157e308", general, ok, 22, 1.7976931348623157e308},
+    {"1.8e308", general, range, 7, 0.0},
+    {"5e-324", general, ok, 6, 5e-324},
+    {"2e-324", general, range, 6, 0.0},
+    {"2.2250738585072014e-308", general, ok, 23, 2.2250738585072014e-308},
+    {"9007199254740993", general, ok, 16, 9007199254740992.0},
+    {"9007199254740993.0000000000000000000001", general, ok, 39, 9007199254740994.0},
+    {"123456789012345678901234567890", general, ok, 30, 1.2345678901234568e29},
+    // Exactly halfway between the two smallest subnormals above zero, ties to even
+    {"7.41098468761869816264853189302332058547589703921487146638378523751013260905313127797949754542453988"
+     "5696948470431685765963899850655339096945981621940161728171894510697854671067917687257517734731555330"
+     "7795408549809608457500958111373034747658096871009590975442271004757307809711118935784838675653998783"
+     "5030152280559340465937397917907387238682993958184816601691220194564999312897984113620624844986787135"
+     "7218035220901702390328579173252022052897402080290685402160661237554998340267130003581248647904138574"
+     "3401875520901590172592547146296175134159774938718574737870961645638908718119841271673056017045493004"
+     "7052695901657637768849082679869725733665217655679410725087643375608460039849049721491174630855395563"
+     "54188641513168478436313080237596295773983001708984375e-324",
+     general,
+     ok,
+     758,
+     1e-323},
+    {"1.fffffffffffffp1023", hex, ok, 20, 1.7976931348623157e308},
+    {"0.0000000000001p-1022", hex, ok, 21, 5e-324},
+  };
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST bool test()
+{
+  test_common<float>();
+  test_common<double>();
+  test_float();
+  test_double();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _LIBCUDACXX_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _LIBCUDACXX_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+template <class T>
+__host__ __device__ constexpr void
+test_from_chars(const char* str, int base, cuda::std::errc ec, cuda::std::size_t len, T expected = T{})
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<T&>(),
+                                       int{}))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<T&>(), int{})));
+
+  constexpr T sentinel = T(42);
+
+  T value           = sentinel;
+  const auto result = cuda::std::from_chars(str, str + cuda::std::strlen(str), value, base);
+  assert(result.ec == ec);
+  assert(result.ptr == str + len);
+  assert(value == ((ec == cuda::std::errc{}) ? expected : sentinel));
+}
+
+template <class T>
+__host__ __device__ constexpr void test_type()
+{
+  constexpr auto ok      = cuda::std::errc{};
+  constexpr auto invalid = cuda::std::errc::invalid_argument;
+  constexpr auto range   = cuda::std::errc::result_out_of_range;
+
+  test_from_chars<T>("0", 10, ok, 1, T(0));
+  test_from_chars<T>("0000000000000000000000000000000000000000127", 10, ok, 43, T(127));
+  test_from_chars<T>("12ab", 10, ok, 2, T(12));
+  test_from_chars<T>("7ag", 16, ok, 2, T(0x7a));
+  test_from_chars<T>("7A", 16, ok, 2, T(0x7a));
+  test_from_chars<T>("101", 2, ok, 3, T(5));
+  test_from_chars<T>("z", 36, ok, 1, T(35));
+  test_from_chars<T>("z", 35, invalid, 0);
+  test_from_chars<T>("", 10, invalid, 0);
+  test_from_chars<T>("+1", 10, invalid, 0);
+  test_from_chars<T>(" 1", 10, invalid, 0);
+  test_from_chars<T>("0x1f", 16, ok, 1, T(0));
+  test_from_chars<T>("99999999999999999999999999999999999999999999x", 10, range, 44);
+
+  if constexpr (cuda::std::is_signed_v<T>)
+  {
+    test_from_chars<T>("-12", 10, ok, 3, T(-12));
+    test_from_chars<T>("-0", 10, ok, 2, T(0));
+    test_from_chars<T>("-", 10, invalid, 0);
+    test_from_chars<T>("--1", 10, invalid, 0);
+    test_from_chars<T>("-128", 10, ok, 4, T(-128));
+  }
+  else
+  {
+    test_from_chars<T>("-12", 10, invalid, 0);
+  }
+
+  // Check the limits and the first values beyond them
+  constexpr cuda::std::size_t buff_size = 150;
+  char buff[buff_size]{};
+
+  const T max = cuda::std::numeric_limits<T>::max();
+  auto result = cuda::std::to_chars(buff, buff + buff_size, max, 10);
+  *result.ptr = '\0';
+  test_from_chars<T>(buff, 10, ok, result.ptr - buff, max);
+
+  // Bump the last digit, which never is a 9 for the maximum of an integer type
+  ++result.ptr[-1];
+  test_from_chars<T>(buff, 10, range, result.ptr - buff);
+
+  const T min = cuda::std::numeric_limits<T>::min();
+  result      = cuda::std::to_chars(buff, buff + buff_size, min, 16);
+  *result.ptr = '\0';
+  test_from_chars<T>(buff, 16, ok, result.ptr - buff, min);
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test_type<char>();
+  test_type<signed char>();
+  test_type<unsigned char>();
+  test_type<short>();
+  test_type<unsigned short>();
+  test_type<int>();
+  test_type<unsigned int>();
+  test_type<long>();
+  test_type<unsigned long>();
+  test_type<long long>();
+  test_type<unsigned long long>();
+#if _CCCL_HAS_INT128()
+  test_type<__int128_t>();
+  test_type<__uint128_t>();
+#endif // _CCCL_HAS_INT128()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,255 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+// The reference strings are the output of std::to_chars from libstdc++ for the plain, scientific, fixed, general and
+// hex formats, in this order.
+template <class T>
+struct TestItem
+{
+  T val;
+  const char* strs[5];
+};
+
+__host__ __device__ constexpr cuda::std::chars_format get_format(int fmt_idx)
+{
+  switch (fmt_idx)
+  {
+    case 1:
+      return cuda::std::chars_format::scientific;
+    case 2:
+      return cuda::std::chars_format::fixed;
+    case 3:
+      return cuda::std::chars_format::general;
+    default:
+      return cuda::std::chars_format::hex;
+  }
+}
+
+__host__ __device__ constexpr cuda::std::array<TestItem<float>, 15> get_float_items()
+{
+  return {{
+    TestItem<float>{0.0f, {"0", "0e+00", "0", "0", "0p+0"}},
+    TestItem<float>{-0.0f, {"-0", "-0e+00", "-0", "-0", "-0p+0"}},
+    TestItem<float>{1.0f, {"1", "1e+00", "1", "1", "1p+0"}},
+    TestItem<float>{-2.5f, {"-2.5", "-2.5e+00", "-2.5", "-2.5", "-1.4p+1"}},
+    TestItem<float>{0.1f, {"0.1", "1e-01", "0.1", "0.1", "1.99999ap-4"}},
+    TestItem<float>{123.456f, {"123.456", "1.23456e+02", "123.456", "123.456", "1.edd2f2p+6"}},
+    TestItem<float>{1e-5f, {"1e-05", "1e-05", "0.00001", "1e-05", "1.4f8b58p-17"}},
+    TestItem<float>{3.0e7f, {"3e+07", "3e+07", "30000000", "3e+07", "1.c9c38p+24"}},
+    TestItem<float>{1.0e10f, {"1e+10", "1e+10", "10000000000", "1e+10", "1.2a05f2p+33"}},
+    TestItem<float>{16777216.0f, {"16777216", "1.6777216e+07", "16777216", "1.6777216e+07", "1p+24"}},
+    TestItem<float>{3.4028235e38f,
+                    {"3.4028235e+38",
+                     "3.4028235e+38",
+                     "340282346638528859811704183484516925440",
+                     "3.4028235e+38",
+                     "1.fffffep+127"}},
+    TestItem<float>{1.17549435e-38f,
+                    {"1.1754944e-38",
+                     "1.1754944e-38",
+                     "0.000000000000000000000000000000000000011754944",
+                     "1.1754944e-38",
+                     "1p-126"}},
+    TestItem<float>{1e-45f,
+                    {"1e-45",
+                     "1e-45",
+                     "0.000000000000000000000000000000000000000000001",
+                     "1e-45",
+                     "0.000002p-126"}},
+    TestItem<float>{0.3333333f, {"0.3333333", "3.333333e-01", "0.3333333", "0.3333333", "1.555554p-2"}},
+    TestItem<float>{-7.0e-39f,
+                    {"-7e-39",
+                     "-7e-39",
+                     "-0.000000000000000000000000000000000000007",
+                     "-7e-39",
+                     "-0.98724ep-126"}},
+  }};
+}
+
+__host__ __device__ constexpr cuda::std::array<TestItem<double>, 17> get_double_items()
+{
+  return {{
+    TestItem<double>{0.0, {"0", "0e+00", "0", "0", "0p+0"}},
+    TestItem<double>{-0.0, {"-0", "-0e+00", "-0", "-0", "-0p+0"}},
+    TestItem<double>{1.0, {"1", "1e+00", "1", "1", "1p+0"}},
+    TestItem<double>{-2.5, {"-2.5", "-2.5e+00", "-2.5", "-2.5", "-1.4p+1"}},
+    TestItem<double>{0.1, {"0.1", "1e-01", "0.1", "0.1", "1.999999999999ap-4"}},
+    TestItem<double>{123.456, {"123.456", "1.23456e+02", "123.456", "123.456", "1.edd2f1a9fbe77p+6"}},
+    TestItem<double>{1e-5, {"1e-05", "1e-05", "0.00001", "1e-05", "1.4f8b588e368f1p-17"}},
+    TestItem<double>{123456.0, {"123456", "1.23456e+05", "123456", "123456", "1.e24p+16"}},
+    TestItem<double>{1234567.0, {"1234567", "1.234567e+06", "1234567", "1.234567e+06", "1.2d687p+20"}},
+    TestItem<double>{1e21, {"1e+21", "1e+21", "1000000000000000000000", "1e+21", "1.b1ae4d6e2ef5p+69"}},
+    TestItem<double>{1e23, {"1e+23", "1e+23", "99999999999999991611392", "1e+23", "1.52d02c7e14af6p+76"}},
+    TestItem<double>{9007199254740993.0,
+                     {"9007199254740992",
+                      "9.007199254740992e+15",
+                      "9007199254740992",
+                      "9.007199254740992e+15",
+                      "1p+53"}},
+    TestItem<double>{5e-324,
+                     {"5e-324",
+                      "5e-324",
+                      "0.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "00000000000000000000000000000000000005",
+                      "5e-324",
+                      "0.0000000000001p-1022"}},
+    TestItem<double>{2.2250738585072014e-308,
+                     {"2.2250738585072014e-308",
+                      "2.2250738585072014e-308",
+                      "0.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "00000000000000000000022250738585072014",
+                      "2.2250738585072014e-308",
+                      "1p-1022"}},
+    TestItem<double>{1.7976931348623157e308,
+                     {"1.7976931348623157e+308",
+                      "1.7976931348623157e+308",
+                      "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766"
+                      "878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328"
+                      "944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881"
+                      "250404026184124858368",
+                      "1.7976931348623157e+308",
+                      "1.fffffffffffffp+1023"}},
+    TestItem<double>{0.30000000000000004,
+                     {"0.30000000000000004",
+                      "3.0000000000000004e-01",
+                      "0.30000000000000004",
+                      "0.30000000000000004",
+                      "1.3333333333334p-2"}},
+    TestItem<double>{-1.2345678901234567e-200,
+                     {"-1.2345678901234567e-200",
+                      "-1.2345678901234567e-200",
+                      "-0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                      "000000000012345678901234567",
+                      "-1.2345678901234567e-200",
+                      "-1.e3d71f622be94p-665"}},
+  }};
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST cuda::std::to_chars_result
+call_to_chars(char* first, char* last, T value, int fmt_idx)
+{
+  return (fmt_idx == 0) ? cuda::std::to_chars(first, last, value)
+                        : cuda::std::to_chars(first, last, value, get_format(fmt_idx));
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_to_chars(const TestItem<T>& item)
+{
+  constexpr cuda::std::size_t buff_size = 400;
+
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), T{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), T{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), T{}, cuda::std::chars_format::general)));
+
+  for (int fmt_idx = 0; fmt_idx < 5; ++fmt_idx)
+  {
+    char buff[buff_size + 1]{};
+    char* buff_start = buff + 1;
+
+    const char* ref_str = item.strs[fmt_idx];
+    const auto ref_len  = cuda::std::strlen(ref_str);
+
+    // Check valid buffer size
+    {
+      const auto result = call_to_chars(buff_start, buff_start + buff_size, item.val, fmt_idx);
+      assert(result.ec == cuda::std::errc{});
+      assert(result.ptr == buff_start + ref_len);
+
+      // Compare with reference string
+      assert(cuda::std::strncmp(buff_start, ref_str, buff_size) == 0);
+
+      // Check that the operation did not underflow the buffer
+      assert(buff[0] == '\0');
+    }
+
+    // Check too small buffer
+    {
+      const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, item.val, fmt_idx);
+      assert(result.ec == cuda::std::errc::value_too_large);
+      assert(result.ptr == buff_start + ref_len - 1);
+    }
+  }
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_special_values()
+{
+  constexpr cuda::std::size_t buff_size = 16;
+  char buff[buff_size]{};
+
+  const T inf = cuda::std::numeric_limits<T>::infinity();
+  const T nan = cuda::std::numeric_limits<T>::quiet_NaN();
+
+  for (int fmt_idx = 0; fmt_idx < 5; ++fmt_idx)
+  {
+    auto result = call_to_chars(buff, buff + buff_size, inf, fmt_idx);
+    assert(result.ec == cuda::std::errc{});
+    assert(cuda::std::strncmp(buff, "inf", result.ptr - buff) == 0 && result.ptr - buff == 3);
+
+    result = call_to_chars(buff, buff + buff_size, -inf, fmt_idx);
+    assert(result.ec == cuda::std::errc{});
+    assert(cuda::std::strncmp(buff, "-inf", result.ptr - buff) == 0 && result.ptr - buff == 4);
+
+    result = call_to_chars(buff, buff + buff_size, nan, fmt_idx);
+    assert(result.ec == cuda::std::errc{});
+    assert(cuda::std::strncmp(buff, "nan", result.ptr - buff) == 0 && result.ptr - buff == 3);
+
+    result = call_to_chars(buff, buff + 2, inf, fmt_idx);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff + 2);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST bool test()
+{
+  constexpr auto float_items = get_float_items();
+  for (const auto& item : float_items)
+  {
+    test_to_chars(item);
+  }
+  constexpr auto double_items = get_double_items();
+  for (const auto& item : double_items)
+  {
+    test_to_chars(item);
+  }
+
+  test_special_values<float>();
+  test_special_values<double>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if _LIBCUDACXX_HAS_CONSTEXPR_BIT_CAST()
+  static_assert(test());
+#endif // _LIBCUDACXX_HAS_CONSTEXPR_BIT_CAST()
+  return 0;
+}
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template <class T>
+// struct hash
+// {
+//     size_t operator()(T val) const;
+// };
+
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/functional>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+enum class Color : short
+{
+  red   = 3,
+  green = -7,
+};
+
+template <class T>
+__host__ __device__ void test_integral()
+{
+  static_assert(cuda::std::is_same<decltype(cuda::std::hash<T>{}(T{})), cuda::std::size_t>::value, "");
+  static_assert(noexcept(cuda::std::hash<T>{}(T{})), "");
+  const cuda::std::hash<T> h{};
+  for (int i = 0; i <= 100; ++i)
+  {
+    const T t = static_cast<T>(i);
+    assert(h(t) == static_cast<cuda::std::size_t>(t));
+  }
+  assert(h(cuda::std::numeric_limits<T>::max()) == static_cast<cuda::std::size_t>(cuda::std::numeric_limits<T>::max()));
+}
+
+// Distinct values should not collide and the low bits of the hash should be spread evenly, so that hash tables with a
+// power of two buckets work well
+template <class T, class Make>
+__host__ __device__ void test_spread(Make make)
+{
+  constexpr int n   = 256;
+  constexpr int low = 64;
+  const cuda::std::hash<T> h{};
+  cuda::std::size_t hashes[n];
+  int buckets[low] = {};
+  for (int i = 0; i < n; ++i)
+  {
+    hashes[i] = h(make(i));
+    ++buckets[hashes[i] % low];
+  }
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < i; ++j)
+    {
+      assert(hashes[i] != hashes[j]);
+    }
+  }
+  for (int i = 0; i < low; ++i)
+  {
+    assert(buckets[i] <= 16);
+  }
+}
+
+template <class T>
+__host__ __device__ void test_floating_point()
+{
+  static_assert(noexcept(cuda::std::hash<T>{}(T{})), "");
+  const cuda::std::hash<T> h{};
+  assert(h(T(0)) == h(-T(0)));
+  assert(h(T(1.5)) == h(T(1.5)));
+  assert(h(T(1)) != h(T(2)));
+  test_spread<T>([](int i) {
+    return static_cast<T>(i);
+  });
+}
+
+__host__ __device__ void test()
+{
+  test_integral<bool>();
+  test_integral<char>();
+  test_integral<signed char>();
+  test_integral<unsigned char>();
+  test_integral<char16_t>();
+  test_integral<char32_t>();
+  test_integral<short>();
+  test_integral<unsigned short>();
+  test_integral<int>();
+  test_integral<unsigned int>();
+  test_integral<long>();
+  test_integral<unsigned long>();
+  test_integral<long long>();
+  test_integral<unsigned long long>();
+
+  test_floating_point<float>();
+  test_floating_point<double>();
+
+  static int objects[256];
+  test_spread<int*>([](int i) {
+    return objects + i;
+  });
+  assert(cuda::std::hash<const int*>{}(objects) == cuda::std::hash<const int*>{}(objects));
+
+#if _CCCL_HAS_INT128()
+  test_spread<__uint128_t>([](int i) {
+    return static_cast<__uint128_t>(i) << 64;
+  });
+#endif // _CCCL_HAS_INT128()
+
+  assert(cuda::std::hash<Color>{}(Color::red) == cuda::std::hash<short>{}(3));
+  assert(cuda::std::hash<Color>{}(Color::green) == cuda::std::hash<short>{}(-7));
+
+  assert(cuda::std::hash<cuda::std::nullptr_t>{}(nullptr) == cuda::std::hash<cuda::std::nullptr_t>{}(nullptr));
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
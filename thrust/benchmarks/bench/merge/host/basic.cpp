@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/merge.h>
+#include <thrust/sort.h>
+
+#include "host_bench_helper.h"
+
+template <typename T>
+static void basic(host_bench::state& state, host_bench::type_list<T>)
+{
+  const auto elements        = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto size_ratio      = static_cast<std::size_t>(state.get_int64("InputSizeRatio"));
+  const std::string& entropy = state.get_string("Entropy");
+  const auto elements_in_lhs = static_cast<std::size_t>(static_cast<double>(size_ratio * elements) / 100.0);
+
+  thrust::device_vector<T> out(elements);
+  thrust::device_vector<T> in = host_bench::generate<T>(elements, entropy);
+  thrust::sort(in.begin(), in.begin() + elements_in_lhs);
+  thrust::sort(in.begin() + elements_in_lhs, in.end());
+
+  state.exec([&] {
+    thrust::merge(
+      thrust::device,
+      in.cbegin(),
+      in.cbegin() + elements_in_lhs,
+      in.cbegin() + elements_in_lhs,
+      in.cend(),
+      out.begin());
+  });
+}
+
+HOST_BENCH_TYPES(basic, host_bench::fundamental_types)
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", host_bench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"})
+  .add_int64_axis("InputSizeRatio", {25, 50, 75});
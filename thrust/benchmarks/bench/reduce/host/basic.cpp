@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+
+#include "host_bench_helper.h"
+
+template <typename T>
+static void basic(host_bench::state& state, host_bench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  thrust::device_vector<T> in = host_bench::generate<T>(elements);
+
+  state.exec([&] {
+    host_bench::do_not_optimize(thrust::reduce(thrust::device, in.begin(), in.end()));
+  });
+}
+
+HOST_BENCH_TYPES(basic, host_bench::fundamental_types)
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", host_bench::range(16, 28, 4));
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+
+#include "host_bench_helper.h"
+
+template <typename T>
+static void basic(host_bench::state& state, host_bench::type_list<T>)
+{
+  const auto elements        = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto size_ratio      = static_cast<std::size_t>(state.get_int64("SizeRatio"));
+  const std::string& entropy = state.get_string("Entropy");
+
+  const auto elements_in_A = static_cast<std::size_t>(static_cast<double>(size_ratio * elements) / 100.0f);
+
+  thrust::device_vector<T> input = host_bench::generate<T>(elements, entropy);
+  thrust::device_vector<T> output(elements);
+
+  thrust::sort(input.begin(), input.begin() + elements_in_A);
+  thrust::sort(input.begin() + elements_in_A, input.end());
+
+  state.exec([&] {
+    thrust::set_intersection(
+      thrust::device,
+      input.cbegin(),
+      input.cbegin() + elements_in_A,
+      input.cbegin() + elements_in_A,
+      input.cend(),
+      output.begin());
+  });
+}
+
+HOST_BENCH_TYPES(basic, host_bench::integral_types)
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", host_bench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"})
+  .add_int64_axis("SizeRatio", {25, 50, 75});
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include "host_bench_helper.h"
+
+template <typename T>
+static void basic(host_bench::state& state, host_bench::type_list<T>)
+{
+  using ValueT = int64_t;
+
+  const auto elements        = static_cast<std::size_t>(state.get_int64("Elements"));
+  const std::string& entropy = state.get_string("Entropy");
+
+  thrust::device_vector<T> in_keys      = host_bench::generate<T>(elements, entropy);
+  thrust::device_vector<ValueT> in_vals = host_bench::generate<ValueT>(elements);
+  thrust::device_vector<T> keys(elements);
+  thrust::device_vector<ValueT> vals(elements);
+
+  state.exec([&](host_bench::timer& timer) {
+    keys = in_keys;
+    vals = in_vals;
+    timer.start();
+    thrust::sort_by_key(thrust::device, keys.begin(), keys.end(), vals.begin());
+    timer.stop();
+  });
+}
+
+HOST_BENCH_TYPES(basic, host_bench::integral_types)
+  .set_name("base")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", host_bench::range(16, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"});
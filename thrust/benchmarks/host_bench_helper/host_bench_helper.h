@@ -0,0 +1,505 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Minimal benchmarking harness for the Thrust host systems (CPP, OMP, TBB).
+//
+// NVBench requires a CUDA device, so the host benchmarks use this harness instead. It only sweeps the axes of a
+// benchmark, including a `Threads` axis for the OMP and TBB systems, and collects the raw samples of every state.
+// The samples are written to a JSON file (`--json <file>`), which `benchmarks/scripts/compare.py` accepts in place of
+// a tuning database and summarizes like NVBench results.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/version.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#endif
+
+namespace host_bench
+{
+
+template <typename... Ts>
+struct type_list
+{};
+
+using integral_types    = type_list<int8_t, int16_t, int32_t, int64_t>;
+using fundamental_types = type_list<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+// Same names as the NVBench type axes of the CUDA benchmarks, so that results can be matched by compare.py.
+template <typename T>
+std::string type_name()
+{
+  return (std::is_floating_point_v<T> ? "F" : std::is_signed_v<T> ? "I" : "U") + std::to_string(sizeof(T) * 8);
+}
+
+inline std::vector<int64_t> range(int64_t first, int64_t last, int64_t step = 1)
+{
+  std::vector<int64_t> result;
+  for (int64_t i = first; i <= last; i += step)
+  {
+    result.push_back(i);
+  }
+  return result;
+}
+
+inline std::string system_name()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return "tbb";
+#else
+  return "cpp";
+#endif
+}
+
+// Limits the parallelism of the device system for the lifetime of the object.
+class thread_limit
+{
+public:
+  explicit thread_limit([[maybe_unused]] int threads)
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+      : m_control(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+#endif
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    m_previous = omp_get_max_threads();
+    omp_set_num_threads(threads);
+#endif
+  }
+
+  ~thread_limit()
+  {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    omp_set_num_threads(m_previous);
+#endif
+  }
+
+  thread_limit(const thread_limit&)            = delete;
+  thread_limit& operator=(const thread_limit&) = delete;
+
+private:
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  int m_previous;
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  tbb::global_control m_control;
+#endif
+};
+
+template <typename T>
+void do_not_optimize(const T& val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(val) : "memory");
+#else
+  static volatile const T* sink;
+  sink = &val;
+#endif
+}
+
+//! Random input data; lower entropy is produced by and-ing several uniformly distributed values, as in nvbench_helper.
+template <typename T>
+thrust::device_vector<T> generate(std::size_t elements, const std::string& entropy = "1.000", unsigned seed = 42)
+{
+  const std::vector<std::string> entropies{"1.000", "0.811", "0.544", "0.337", "0.201"};
+  const auto and_count = std::find(entropies.begin(), entropies.end(), entropy) - entropies.begin() + 1;
+
+  std::mt19937_64 rng(seed);
+  std::vector<T> data(elements);
+  for (auto& val : data)
+  {
+    if constexpr (std::is_floating_point_v<T>)
+    {
+      std::uniform_real_distribution<T> dist(T{0}, T{1});
+      val = dist(rng);
+      for (int i = 1; i < and_count; i++)
+      {
+        val = (std::min) (val, dist(rng));
+      }
+    }
+    else
+    {
+      uint64_t bits = rng();
+      for (int i = 1; i < and_count; i++)
+      {
+        bits &= rng();
+      }
+      val = static_cast<T>(bits);
+    }
+  }
+
+  if (entropy == "0.000")
+  {
+    std::fill(data.begin(), data.end(), data.empty() ? T{} : data.front());
+  }
+
+  return thrust::device_vector<T>(data.begin(), data.end());
+}
+
+//! Sorted keys forming runs of uniformly distributed length in [min_segment_size, max_segment_size].
+template <typename T>
+thrust::device_vector<T> generate_key_segments(
+  std::size_t elements, std::size_t min_segment_size, std::size_t max_segment_size, unsigned seed = 42)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_int_distribution<std::size_t> dist(min_segment_size, max_segment_size);
+  std::vector<T> data(elements);
+  std::size_t segment = 0;
+  for (std::size_t i = 0; i < elements; segment++)
+  {
+    const std::size_t size = (std::min) (dist(rng), elements - i);
+    std::fill(data.begin() + i, data.begin() + i + size, static_cast<T>(segment));
+    i += size;
+  }
+  return thrust::device_vector<T>(data.begin(), data.end());
+}
+
+class timer
+{
+public:
+  void start()
+  {
+    m_start = clock::now();
+  }
+
+  void stop()
+  {
+    m_elapsed += std::chrono::duration<double>(clock::now() - m_start).count();
+  }
+
+  double elapsed() const
+  {
+    return m_elapsed;
+  }
+
+private:
+  using clock = std::chrono::steady_clock;
+  clock::time_point m_start{};
+  double m_elapsed{};
+};
+
+class state
+{
+public:
+  explicit state(std::map<std::string, std::string> axes)
+      : m_axes(std::move(axes))
+  {}
+
+  //! Returns the value of an int64 axis; power-of-two axes are named `Name{io}[pow2]` and hold the exponent.
+  int64_t get_int64(const std::string& name) const
+  {
+    if (auto it = m_axes.find(name + "{io}[pow2]"); it != m_axes.end())
+    {
+      return int64_t{1} << std::stoll(it->second);
+    }
+    return std::stoll(get_string(name));
+  }
+
+  const std::string& get_string(const std::string& name) const
+  {
+    auto it = m_axes.find(name);
+    if (it == m_axes.end())
+    {
+      throw std::runtime_error("unknown axis: " + name);
+    }
+    return it->second;
+  }
+
+  //! Runs \p f repeatedly for at least 10 samples and half a second, and records one sample per invocation. If \p f
+  //! accepts a \p timer, only the region between `timer.start()` and `timer.stop()` is measured, which allows
+  //! excluding per-iteration setup such as input copies.
+  template <typename F>
+  void exec(F&& f)
+  {
+    thread_limit limit(static_cast<int>(get_int64("Threads")));
+
+    run_once(f); // warmup
+    double total = 0;
+    while (m_samples.size() < 1000 && (m_samples.size() < 10 || total < 0.5))
+    {
+      m_samples.push_back(run_once(f));
+      total += m_samples.back();
+    }
+  }
+
+  const std::vector<double>& samples() const
+  {
+    return m_samples;
+  }
+
+private:
+  template <typename F>
+  static double run_once(F& f)
+  {
+    timer t;
+    if constexpr (std::is_invocable_v<F&, timer&>)
+    {
+      f(t);
+    }
+    else
+    {
+      t.start();
+      f();
+      t.stop();
+    }
+    return t.elapsed();
+  }
+
+  std::map<std::string, std::string> m_axes;
+  std::vector<double> m_samples;
+};
+
+struct axis
+{
+  std::string name;
+  std::vector<std::string> values;
+};
+
+class benchmark
+{
+public:
+  benchmark(axis types, std::function<void(state&)> generator)
+      : m_axes{std::move(types)}
+      , m_generator(std::move(generator))
+  {}
+
+  benchmark& set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  benchmark& set_type_axes_names(std::vector<std::string> names)
+  {
+    m_axes.front().name = names.at(0);
+    return *this;
+  }
+
+  benchmark& add_int64_power_of_two_axis(std::string name, const std::vector<int64_t>& exponents)
+  {
+    return add_int64_axis(name + "{io}[pow2]", exponents);
+  }
+
+  benchmark& add_int64_axis(std::string name, const std::vector<int64_t>& values)
+  {
+    axis a{std::move(name), {}};
+    for (int64_t v : values)
+    {
+      a.values.push_back(std::to_string(v));
+    }
+    m_axes.push_back(std::move(a));
+    return *this;
+  }
+
+  benchmark& add_string_axis(std::string name, std::vector<std::string> values)
+  {
+    m_axes.push_back(axis{std::move(name), std::move(values)});
+    return *this;
+  }
+
+  const std::string& name() const
+  {
+    return m_name;
+  }
+
+  const std::vector<axis>& axes() const
+  {
+    return m_axes;
+  }
+
+  void run(state& s) const
+  {
+    m_generator(s);
+  }
+
+private:
+  std::string m_name = "base";
+  std::vector<axis> m_axes; // the type axis comes first
+  std::function<void(state&)> m_generator;
+};
+
+// A deque keeps the references returned by add_benchmark valid while further benchmarks are registered.
+inline std::deque<benchmark>& registry()
+{
+  static std::deque<benchmark> benches;
+  return benches;
+}
+
+template <typename F, typename... Ts>
+benchmark& add_benchmark(F f, type_list<Ts...>)
+{
+  axis types{"T{ct}", {type_name<Ts>()...}};
+  registry().emplace_back(types, [f, types](state& s) {
+    const std::string& type = s.get_string(types.name);
+    ((type == type_name<Ts>() ? f(s, type_list<Ts>{}) : void()), ...);
+  });
+  return registry().back();
+}
+
+// Enumerates the cartesian product of all axis values; the last axis varies fastest.
+template <typename F>
+void for_each_point(const std::vector<axis>& axes, F f, std::map<std::string, std::string> point = {})
+{
+  if (point.size() == axes.size())
+  {
+    f(point);
+    return;
+  }
+  const axis& a = axes[point.size()];
+  for (const auto& value : a.values)
+  {
+    point[a.name] = value;
+    for_each_point(axes, f, point);
+    point.erase(a.name);
+  }
+}
+
+inline std::vector<std::string> split(const std::string& str, char sep)
+{
+  std::vector<std::string> result;
+  std::stringstream ss(str);
+  std::string item;
+  while (std::getline(ss, item, sep))
+  {
+    result.push_back(item);
+  }
+  return result;
+}
+
+//! Usage: [-a <axis>=<v1>,<v2>,...]... [--threads <n1>,<n2>,...] [--json <file>]
+//!
+//! The thread counts default to the powers of two up to the number of cores for the OMP and TBB systems.
+inline int main(int argc, char** argv)
+{
+  std::map<std::string, std::vector<std::string>> restrictions;
+  std::vector<std::string> threads{"1"};
+  if (system_name() != "cpp")
+  {
+    const int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+    for (int t = 2; t < max_threads; t *= 2)
+    {
+      threads.push_back(std::to_string(t));
+    }
+    if (max_threads > 1)
+    {
+      threads.push_back(std::to_string(max_threads));
+    }
+  }
+  std::string json_path;
+
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    const std::string arg = argv[i];
+    const std::string val = argv[i + 1];
+    if (arg == "-a" && val.find('=') != std::string::npos)
+    {
+      restrictions[val.substr(0, val.find('='))] = split(val.substr(val.find('=') + 1), ',');
+    }
+    else if (arg == "--threads")
+    {
+      threads = split(val, ',');
+    }
+    else if (arg == "--json")
+    {
+      json_path = val;
+    }
+    else
+    {
+      throw std::runtime_error("unknown argument: " + arg);
+    }
+  }
+  if (argc % 2 == 0)
+  {
+    throw std::runtime_error(std::string("missing value for ") + argv[argc - 1]);
+  }
+
+  std::ostringstream json;
+  json << "{\"algorithm\": \"" << HOST_BENCH_NAME << "\", \"system\": \"" << system_name() << "\", \"cccl\": \""
+       << THRUST_MAJOR_VERSION << "." << THRUST_MINOR_VERSION << "." << THRUST_SUBMINOR_VERSION
+       << "\", \"benchmarks\": [";
+
+  for (const auto& bench : registry())
+  {
+    auto axes = bench.axes();
+    axes.push_back(axis{"Threads", threads});
+    for (auto& a : axes)
+    {
+      if (auto it = restrictions.find(a.name); it != restrictions.end())
+      {
+        a.values = it->second;
+      }
+    }
+
+    json << (&bench == &registry().front() ? "" : ", ") << "{\"name\": \"" << bench.name() << "\", \"states\": [";
+    const char* sep = "";
+    for_each_point(axes, [&](const std::map<std::string, std::string>& point) {
+      state s(point);
+      bench.run(s);
+
+      std::vector<double> sorted(s.samples());
+      std::sort(sorted.begin(), sorted.end());
+      std::printf("%s.%s", HOST_BENCH_NAME, bench.name().c_str());
+      json << sep << "{\"axes\": {";
+      for (const auto& a : axes)
+      {
+        std::printf(" %s=%s", a.name.c_str(), point.at(a.name).c_str());
+        json << (&a == &axes.front() ? "" : ", ") << "\"" << a.name << "\": \"" << point.at(a.name) << "\"";
+      }
+      std::printf(": %.3f us median of %zu samples\n", sorted[sorted.size() / 2] * 1e6, sorted.size());
+      std::fflush(stdout);
+
+      json << "}, \"samples\": [";
+      for (std::size_t i = 0; i < s.samples().size(); i++)
+      {
+        json << (i ? ", " : "") << s.samples()[i];
+      }
+      json << "]}";
+      sep = ", ";
+    });
+    json << "]}";
+  }
+  json << "]}\n";
+
+  if (!json_path.empty())
+  {
+    std::ofstream(json_path) << json.str();
+  }
+  return 0;
+}
+
+} // namespace host_bench
+
+#define HOST_BENCH_CONCAT_IMPL(a, b) a##b
+#define HOST_BENCH_CONCAT(a, b)      HOST_BENCH_CONCAT_IMPL(a, b)
+
+//! Registers the benchmark function template \p fn, instantiated for every type in \p types.
+#define HOST_BENCH_TYPES(fn, types)                                                       \
+  static ::host_bench::benchmark& HOST_BENCH_CONCAT(host_bench_registration_, __LINE__) = \
+    ::host_bench::add_benchmark(                                                          \
+      [](::host_bench::state& state, auto type_tag) {                                     \
+        fn(state, type_tag);                                                              \
+      },                                                                                  \
+      types{})
@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "host_bench_helper.h"
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return host_bench::main(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::fprintf(stderr, "error: %s\n", e.what());
+    return 1;
+  }
+}
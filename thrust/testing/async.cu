@@ -0,0 +1,167 @@
+#include <thrust/async.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct add_one
+{
+  _CCCL_HOST_DEVICE T operator()(const T& x) const
+  {
+    return static_cast<T>(x + 1);
+  }
+};
+
+static int num_async_launches = 0;
+
+template <typename Task>
+void async_launch(my_tag&, Task task)
+{
+  ++num_async_launches;
+  task();
+}
+
+void TestAsyncLaunchDispatch()
+{
+  num_async_launches = 0;
+
+  auto f = thrust::async::launch(my_tag(), [] {
+    return 13;
+  });
+  auto g = std::move(f).then([](int x) {
+    return x + 1;
+  });
+
+  ASSERT_EQUAL(false, f.valid());
+  ASSERT_EQUAL(14, g.get());
+  // f is ready when then is called, so the continuation is launched as well
+  ASSERT_EQUAL(2, num_async_launches);
+}
+DECLARE_UNITTEST(TestAsyncLaunchDispatch);
+
+template <typename T>
+void TestAsyncSortThenReduce(size_t n)
+{
+  const thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_sorted     = h_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end());
+  const T h_sum = thrust::reduce(h_sorted.begin(), h_sorted.end(), T(0), ::cuda::maximum<T>());
+
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::async::future<T> d_sum =
+    thrust::async::sort(thrust::device, d_data.begin(), d_data.end()).then([&d_data] {
+      return thrust::reduce(thrust::device, d_data.begin(), d_data.end(), T(0), ::cuda::maximum<T>());
+    });
+
+  ASSERT_EQUAL(h_sum, d_sum.get());
+  ASSERT_EQUAL(false, d_sum.valid());
+  ASSERT_EQUAL(h_sorted, d_data);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestAsyncSortThenReduce);
+
+template <typename Vector>
+void TestAsyncTransformThenCopy()
+{
+  using T = typename Vector::value_type;
+
+  Vector input(100);
+  Vector temp(100);
+  Vector output(100);
+  thrust::sequence(input.begin(), input.end());
+
+  auto end = thrust::async::transform(thrust::device, input.begin(), input.end(), temp.begin(), add_one<T>())
+               .then([&](typename Vector::iterator temp_end) {
+                 return thrust::copy(thrust::device, temp.begin(), temp_end, output.begin());
+               });
+
+  Vector ref(100);
+  thrust::sequence(ref.begin(), ref.end(), T(1));
+
+  ASSERT_EQUAL(true, end.get() == output.end());
+  ASSERT_EQUAL(ref, output);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestAsyncTransformThenCopy);
+
+void TestAsyncFutureWaits()
+{
+  bool first_done  = false;
+  bool second_done = false;
+  {
+    thrust::async::future<void> f = thrust::async::launch(thrust::device, [&first_done] {
+      first_done = true;
+    });
+    // assigning to a future or destroying it waits for its operation
+    f = thrust::async::launch(thrust::device, [&second_done] {
+      second_done = true;
+    });
+    ASSERT_EQUAL(true, first_done);
+  }
+  ASSERT_EQUAL(true, second_done);
+
+  const thrust::device_vector<int> data(10000, 1);
+  thrust::async::future<int> sum = thrust::async::reduce(thrust::device, data.begin(), data.end());
+  sum.wait();
+  ASSERT_EQUAL(true, sum.is_ready());
+  ASSERT_EQUAL(10000, sum.get());
+}
+DECLARE_UNITTEST(TestAsyncFutureWaits);
+
+void TestAsyncExceptions()
+{
+  bool continued = false;
+
+  auto f = thrust::async::launch(thrust::device,
+                                 []() -> int {
+                                   throw std::runtime_error("async");
+                                 })
+             .then([&continued](int x) {
+               continued = true;
+               return x;
+             });
+
+  ASSERT_THROWS(f.get(), std::runtime_error);
+  ASSERT_EQUAL(false, continued);
+
+  thrust::async::future<void> empty;
+  ASSERT_EQUAL(false, empty.valid());
+  ASSERT_THROWS(empty.wait(), thrust::event_error);
+}
+DECLARE_UNITTEST(TestAsyncExceptions);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+void TestAsyncOmpThreadPool()
+{
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+
+  // many more operations than threads in the pool
+  std::vector<thrust::async::future<int>> futures;
+  for (int i = 0; i < 16 * THRUST_OMP_ASYNC_NUM_THREADS; ++i)
+  {
+    futures.push_back(thrust::async::launch(thrust::device, [&mutex, &threads, i] {
+      std::lock_guard<std::mutex> lock(mutex);
+      threads.insert(std::this_thread::get_id());
+      return i;
+    }));
+  }
+
+  for (int i = 0; i < static_cast<int>(futures.size()); ++i)
+  {
+    ASSERT_EQUAL(i, futures[i].get());
+  }
+  ASSERT_EQUAL(true, threads.size() <= THRUST_OMP_ASYNC_NUM_THREADS);
+  ASSERT_EQUAL(0u, threads.count(std::this_thread::get_id()));
+}
+DECLARE_UNITTEST(TestAsyncOmpThreadPool);
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
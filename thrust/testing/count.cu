@@ -1,6 +1,8 @@
 #include <thrust/count.h>
 #include <thrust/iterator/retag.h>
 
+#include <cuda/std/cstddef>
+
 #include <unittest/unittest.h>
 
 template <class Vector>
@@ -126,3 +128,75 @@ void TestCountWithBigIndexes()
 #endif
 }
 DECLARE_UNITTEST(TestCountWithBigIndexes);
+
+template <typename T>
+void TestCountAgainstReference(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  for (size_t i = 0; i < n; i += 7)
+  {
+    h_data[i] = T{13};
+  }
+  thrust::device_vector<T> d_data = h_data;
+
+  ::cuda::std::ptrdiff_t expected = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    expected += h_data[i] == T{13};
+  }
+
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), T{13}), expected);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), T{13}), expected);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestCountAgainstReference);
+
+void TestCountMixedTypes()
+{
+  thrust::host_vector<int> h_data(3 << 15, 7);
+  h_data[5]             = -1;
+  h_data[(3 << 15) - 1] = -1;
+
+  thrust::device_vector<int> d_data = h_data;
+
+  // values which do not convert to the element type match no element
+  const long long unrepresentable = (1ll << 32) + 7;
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), unrepresentable), 0);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), unrepresentable), 0);
+
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), 7ll), (3 << 15) - 2);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), 7ll), (3 << 15) - 2);
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), short{-1}), 2);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), short{-1}), 2);
+
+  // -1 converts to the largest unsigned int, which -1 compares equal to
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), 0xFFFFFFFFu), 2);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), 0xFFFFFFFFu), 2);
+}
+DECLARE_UNITTEST(TestCountMixedTypes);
+
+template <typename T, typename U>
+void TestCountNarrowMixedSignsHelper()
+{
+  thrust::host_vector<T> h_data(3 << 15, T{1});
+  h_data[5]             = T(-1);
+  h_data[(3 << 15) - 1] = T(-1);
+
+  thrust::device_vector<T> d_data = h_data;
+
+  // the all-ones value of U converts to T(-1), but both sides are promoted to int before they are compared
+  const U all_ones = U(-1);
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), all_ones), 0);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), all_ones), 0);
+
+  ASSERT_EQUAL(thrust::count(h_data.begin(), h_data.end(), U{1}), (3 << 15) - 2);
+  ASSERT_EQUAL(thrust::count(d_data.begin(), d_data.end(), U{1}), (3 << 15) - 2);
+}
+
+void TestCountNarrowMixedSigns()
+{
+  TestCountNarrowMixedSignsHelper<signed char, unsigned char>();
+  TestCountNarrowMixedSignsHelper<unsigned char, signed char>();
+  TestCountNarrowMixedSignsHelper<short, unsigned short>();
+  TestCountNarrowMixedSignsHelper<unsigned short, short>();
+}
+DECLARE_UNITTEST(TestCountNarrowMixedSigns);
@@ -4,6 +4,8 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
 
+#include <cuda/std/limits>
+
 #include <unittest/unittest.h>
 
 template <class Vector>
@@ -145,3 +147,25 @@ void TestEqualWithBigIndexes()
   TestEqualWithBigIndexesHelper(33);
 }
 DECLARE_UNITTEST(TestEqualWithBigIndexes);
+
+void TestEqualFloatingPoint()
+{
+  // -0.0 and 0.0 compare equal but differ in their object representations, while NaN is not equal to itself
+  thrust::host_vector<float> h_data1(3 << 15, 1.0f);
+  thrust::host_vector<float> h_data2(3 << 15, 1.0f);
+  h_data1[(1 << 15) + 1] = -0.0f;
+  h_data2[(1 << 15) + 1] = 0.0f;
+
+  thrust::device_vector<float> d_data1 = h_data1;
+  thrust::device_vector<float> d_data2 = h_data2;
+
+  ASSERT_EQUAL(thrust::equal(h_data1.begin(), h_data1.end(), h_data2.begin()), true);
+  ASSERT_EQUAL(thrust::equal(d_data1.begin(), d_data1.end(), d_data2.begin()), true);
+
+  h_data1[(2 << 15) + 1] = ::cuda::std::numeric_limits<float>::quiet_NaN();
+  d_data1[(2 << 15) + 1] = ::cuda::std::numeric_limits<float>::quiet_NaN();
+
+  ASSERT_EQUAL(thrust::equal(h_data1.begin(), h_data1.end(), h_data1.begin()), false);
+  ASSERT_EQUAL(thrust::equal(d_data1.begin(), d_data1.end(), d_data1.begin()), false);
+}
+DECLARE_UNITTEST(TestEqualFloatingPoint);
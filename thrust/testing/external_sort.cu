@@ -0,0 +1,154 @@
+#include <thrust/execution_policy.h>
+#include <thrust/external_sort.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <unittest/unittest.h>
+
+// A directory for the files of a test, removed with its contents at the end of the test.
+struct test_directory
+{
+  test_directory()
+      : path(std::filesystem::temp_directory_path() / ("thrust_test_external_sort_" + std::to_string(std::rand())))
+  {
+    std::filesystem::create_directories(path);
+  }
+
+  ~test_directory()
+  {
+    std::error_code ec;
+    std::filesystem::remove_all(path, ec);
+  }
+
+  std::string file(const char* name) const
+  {
+    return (path / name).string();
+  }
+
+  std::filesystem::path path;
+};
+
+template <typename T>
+void write_file(const std::string& path, const thrust::host_vector<T>& data)
+{
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  std::fwrite(thrust::raw_pointer_cast(data.data()), sizeof(T), data.size(), file);
+  std::fclose(file);
+}
+
+template <typename T>
+thrust::host_vector<T> read_file(const std::string& path)
+{
+  thrust::host_vector<T> data(std::filesystem::file_size(path) / sizeof(T));
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  std::fread(thrust::raw_pointer_cast(data.data()), sizeof(T), data.size(), file);
+  std::fclose(file);
+  return data;
+}
+
+template <typename T>
+void TestExternalSort(size_t n)
+{
+  const test_directory directory;
+  const thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  write_file(directory.file("input"), h_data);
+
+  thrust::host_vector<T> h_ref = h_data;
+  thrust::stable_sort(h_ref.begin(), h_ref.end(), ::cuda::std::greater<T>());
+
+  for (bool overlap_io : {false, true})
+  {
+    // a budget of a small part of the input, which sorts many runs and merges them in several passes
+    thrust::external_sort_options options;
+    options.memory_budget       = (std::max) (n / 8, size_t{64}) * sizeof(T);
+    options.temporary_directory = directory.path.string();
+    options.overlap_io          = overlap_io;
+
+    thrust::external_sort<T>(
+      thrust::device, directory.file("input"), directory.file("output"), ::cuda::std::greater<T>(), options);
+
+    ASSERT_EQUAL(h_ref, read_file<T>(directory.file("output")));
+  }
+
+  // sorting in place, with the default options
+  thrust::external_sort<T>(thrust::device, directory.file("input"), directory.file("input"));
+  thrust::stable_sort(h_ref.begin(), h_ref.end());
+  ASSERT_EQUAL(h_ref, read_file<T>(directory.file("input")));
+
+  // only the input and output files remain
+  ASSERT_EQUAL(2, std::distance(std::filesystem::directory_iterator(directory.path), {}));
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestExternalSort);
+
+template <typename T>
+void TestExternalSortByKey(size_t n)
+{
+  const test_directory directory;
+  // few distinct keys, so that the stability of the merge is observable in the values
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+  for (T& key : h_keys)
+  {
+    key = static_cast<T>(key % 8);
+  }
+  thrust::host_vector<unsigned int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  write_file(directory.file("keys"), h_keys);
+  write_file(directory.file("values"), h_values);
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+
+  for (bool overlap_io : {false, true})
+  {
+    thrust::external_sort_options options;
+    options.memory_budget       = (std::max) (n / 8, size_t{64}) * (sizeof(T) + sizeof(unsigned int));
+    options.temporary_directory = directory.path.string();
+    options.overlap_io          = overlap_io;
+
+    thrust::external_sort_by_key<T, unsigned int>(
+      thrust::device,
+      directory.file("keys"),
+      directory.file("values"),
+      directory.file("sorted_keys"),
+      directory.file("sorted_values"),
+      ::cuda::std::less<T>(),
+      options);
+
+    ASSERT_EQUAL(h_keys, read_file<T>(directory.file("sorted_keys")));
+    ASSERT_EQUAL(h_values, read_file<unsigned int>(directory.file("sorted_values")));
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestExternalSortByKey);
+
+void TestExternalSortErrors()
+{
+  const test_directory directory;
+  write_file(directory.file("input"), thrust::host_vector<char>(7));
+  write_file(directory.file("values"), thrust::host_vector<int>(3));
+
+  ASSERT_THROWS(thrust::external_sort<int>(thrust::device, directory.file("missing"), directory.file("output")),
+                thrust::system_error);
+  // the size of the input is not a multiple of the size of the records
+  ASSERT_THROWS(thrust::external_sort<int>(thrust::device, directory.file("input"), directory.file("output")),
+                thrust::system_error);
+  // there are more keys than values
+  ASSERT_THROWS((thrust::external_sort_by_key<char, int>(
+                  thrust::device,
+                  directory.file("input"),
+                  directory.file("values"),
+                  directory.file("sorted_keys"),
+                  directory.file("sorted_values"))),
+                thrust::system_error);
+
+  // an empty input sorts to an empty output
+  write_file(directory.file("empty"), thrust::host_vector<int>());
+  thrust::external_sort<int>(thrust::device, directory.file("empty"), directory.file("output"));
+  ASSERT_EQUAL(0u, std::filesystem::file_size(directory.file("output")));
+}
+DECLARE_UNITTEST(TestExternalSortErrors);
@@ -334,3 +334,95 @@ void TestFindAsymmetricEquality()
   ASSERT_EQUAL(result - dv.begin(), 333);
 }
 DECLARE_UNITTEST(TestFindAsymmetricEquality);
+
+template <typename T>
+void TestFindPositions()
+{
+  // positions on either side of the boundaries at which the host systems split and search ranges
+  const ::cuda::std::ptrdiff_t n           = (1 << 21) + 3;
+  const ::cuda::std::ptrdiff_t positions[] = {
+    0, 1, 255, 256, (1 << 15) - 1, 1 << 15, (1 << 20) - 1, 1 << 20, n - 1};
+  thrust::host_vector<T> h_data(n, T{1});
+  thrust::device_vector<T> d_data(n, T{1});
+
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), T{0}) - h_data.begin(), n);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), T{0}) - d_data.begin(), n);
+
+  for (size_t i = sizeof(positions) / sizeof(positions[0]); i-- > 0;)
+  {
+    h_data[positions[i]] = T{0};
+    d_data[positions[i]] = T{0};
+
+    ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), T{0}) - h_data.begin(), positions[i]);
+    ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), T{0}) - d_data.begin(), positions[i]);
+  }
+}
+
+void TestFindPositionsChar()
+{
+  TestFindPositions<char>();
+}
+DECLARE_UNITTEST(TestFindPositionsChar);
+
+void TestFindPositionsInt()
+{
+  TestFindPositions<int>();
+}
+DECLARE_UNITTEST(TestFindPositionsInt);
+
+void TestFindPositionsFloat()
+{
+  TestFindPositions<float>();
+}
+DECLARE_UNITTEST(TestFindPositionsFloat);
+
+void TestFindMixedTypes()
+{
+  thrust::host_vector<unsigned char> h_data(1000, 1);
+  h_data[500] = 255;
+
+  thrust::device_vector<unsigned char> d_data = h_data;
+
+  // 255 + 256 converts to 255, but does not compare equal to it
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), 255 + 256) - h_data.begin(), 1000);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), 255 + 256) - d_data.begin(), 1000);
+
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), 255) - h_data.begin(), 500);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), 255) - d_data.begin(), 500);
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), 255ull) - h_data.begin(), 500);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), 255ull) - d_data.begin(), 500);
+
+  // bool elements only compare equal to 0 and 1
+  thrust::host_vector<bool> h_flags(1000, false);
+  h_flags[700] = true;
+  ASSERT_EQUAL(thrust::find(h_flags.begin(), h_flags.end(), 2) - h_flags.begin(), 1000);
+  ASSERT_EQUAL(thrust::find(h_flags.begin(), h_flags.end(), 1) - h_flags.begin(), 700);
+}
+DECLARE_UNITTEST(TestFindMixedTypes);
+
+template <typename T, typename U>
+void TestFindNarrowMixedSignsHelper()
+{
+  thrust::host_vector<T> h_data(1000, T{1});
+  h_data[300] = T(-1);
+  h_data[600] = T{127};
+
+  thrust::device_vector<T> d_data = h_data;
+
+  // the all-ones value of U converts to T(-1), but both sides are promoted to int before they are compared
+  const U all_ones = U(-1);
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), all_ones) - h_data.begin(), 1000);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), all_ones) - d_data.begin(), 1000);
+
+  ASSERT_EQUAL(thrust::find(h_data.begin(), h_data.end(), U{127}) - h_data.begin(), 600);
+  ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), U{127}) - d_data.begin(), 600);
+}
+
+void TestFindNarrowMixedSigns()
+{
+  TestFindNarrowMixedSignsHelper<signed char, unsigned char>();
+  TestFindNarrowMixedSignsHelper<unsigned char, signed char>();
+  TestFindNarrowMixedSignsHelper<short, unsigned short>();
+  TestFindNarrowMixedSignsHelper<unsigned short, short>();
+}
+DECLARE_UNITTEST(TestFindNarrowMixedSigns);
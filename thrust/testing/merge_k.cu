@@ -0,0 +1,226 @@
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/merge.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+// convert xxx_vector<T1> to xxx_vector<T2>
+template <class ExampleVector, typename NewType>
+struct vector_like
+{
+  using alloc        = typename ExampleVector::allocator_type;
+  using alloc_traits = typename thrust::detail::allocator_traits<alloc>;
+  using new_alloc    = typename alloc_traits::template rebind_alloc<NewType>;
+  using type         = thrust::detail::vector_base<NewType, new_alloc>;
+};
+
+template <typename Vector>
+void TestMergeKSimple()
+{
+  const Vector keys{1, 4, 7, 2, 5, 0, 3, 3, 6};
+  const typename vector_like<Vector, int>::type offsets{0, 3, 5, 5, 9};
+  const Vector ref{0, 1, 2, 3, 3, 4, 5, 6, 7};
+
+  Vector result(9);
+  const auto end = thrust::merge_k(offsets.begin(), offsets.end(), keys.begin(), result.begin());
+
+  ASSERT_EQUAL_QUIET(result.end(), end);
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_VECTOR_UNITTEST(TestMergeKSimple);
+
+template <typename Vector>
+void TestMergeKNoSegments()
+{
+  const Vector keys{1, 2, 3};
+  Vector result(3, 42);
+
+  // neither an empty sequence of offsets nor a single offset describe any segment
+  typename vector_like<Vector, int>::type offsets;
+  ASSERT_EQUAL_QUIET(result.begin(), thrust::merge_k(offsets.begin(), offsets.end(), keys.begin(), result.begin()));
+
+  offsets.push_back(0);
+  ASSERT_EQUAL_QUIET(result.begin(), thrust::merge_k(offsets.begin(), offsets.end(), keys.begin(), result.begin()));
+
+  ASSERT_EQUAL(Vector(3, 42), result);
+}
+DECLARE_VECTOR_UNITTEST(TestMergeKNoSegments);
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator merge_k(my_system& system, OffsetIterator, OffsetIterator, RandomAccessIterator, OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestMergeKDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::merge_k(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestMergeKDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator merge_k(my_tag, OffsetIterator, OffsetIterator, RandomAccessIterator, OutputIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestMergeKDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::merge_k(thrust::retag<my_tag>(vec.begin()),
+                  thrust::retag<my_tag>(vec.begin()),
+                  thrust::retag<my_tag>(vec.begin()),
+                  thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestMergeKDispatchImplicit);
+
+// Splits n elements into num_segments sorted segments of random sizes, some of them empty.
+template <typename T, typename Compare>
+void make_segments(
+  size_t n, size_t num_segments, thrust::host_vector<T>& keys, thrust::host_vector<int>& offsets, Compare comp)
+{
+  keys = unittest::random_integers<unittest::int8_t>(n);
+
+  thrust::host_vector<unsigned int> cuts = unittest::random_integers<unsigned int>(num_segments - 1);
+  offsets.resize(num_segments + 1);
+  offsets[0]            = 0;
+  offsets[num_segments] = static_cast<int>(n);
+  for (size_t i = 1; i < num_segments; i++)
+  {
+    offsets[i] = static_cast<int>(cuts[i - 1] % (n + 1));
+  }
+  thrust::sort(offsets.begin(), offsets.end());
+
+  for (size_t i = 0; i < num_segments; i++)
+  {
+    thrust::stable_sort(keys.begin() + offsets[i], keys.begin() + offsets[i + 1], comp);
+  }
+}
+
+template <typename T>
+void TestMergeK(size_t n)
+{
+  for (size_t num_segments : {1, 2, 3, 17, 256})
+  {
+    thrust::host_vector<T> h_keys;
+    thrust::host_vector<int> h_offsets;
+    make_segments(n, num_segments, h_keys, h_offsets, ::cuda::std::less<T>());
+
+    // the segments are stored in order, so a stable sort of all keys is the reference
+    thrust::host_vector<T> h_ref = h_keys;
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+
+    const thrust::device_vector<T> d_keys      = h_keys;
+    const thrust::device_vector<int> d_offsets = h_offsets;
+
+    thrust::host_vector<T> h_result(n);
+    thrust::device_vector<T> d_result(n);
+
+    const auto h_end = thrust::merge_k(h_offsets.begin(), h_offsets.end(), h_keys.begin(), h_result.begin());
+    const auto d_end = thrust::merge_k(d_offsets.begin(), d_offsets.end(), d_keys.begin(), d_result.begin());
+
+    ASSERT_EQUAL_QUIET(h_result.end(), h_end);
+    ASSERT_EQUAL_QUIET(d_result.end(), d_end);
+    ASSERT_EQUAL(h_ref, h_result);
+    ASSERT_EQUAL(h_ref, d_result);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeK);
+
+template <typename T>
+void TestMergeKDescending(size_t n)
+{
+  thrust::host_vector<T> h_keys;
+  thrust::host_vector<int> h_offsets;
+  make_segments(n, 9, h_keys, h_offsets, ::cuda::std::greater<T>());
+
+  thrust::host_vector<T> h_ref = h_keys;
+  thrust::stable_sort(h_ref.begin(), h_ref.end(), ::cuda::std::greater<T>());
+
+  const thrust::device_vector<T> d_keys      = h_keys;
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::device_vector<T> d_result(n);
+  thrust::merge_k(d_offsets.begin(), d_offsets.end(), d_keys.begin(), d_result.begin(), ::cuda::std::greater<T>());
+
+  ASSERT_EQUAL(h_ref, d_result);
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeKDescending);
+
+template <typename T>
+void TestMergeKToDiscardIterator(size_t n)
+{
+  thrust::host_vector<T> h_keys;
+  thrust::host_vector<int> h_offsets;
+  make_segments(n, 5, h_keys, h_offsets, ::cuda::std::less<T>());
+
+  const thrust::device_vector<T> d_keys      = h_keys;
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  const auto h_result =
+    thrust::merge_k(h_offsets.begin(), h_offsets.end(), h_keys.begin(), thrust::make_discard_iterator());
+  const auto d_result =
+    thrust::merge_k(d_offsets.begin(), d_offsets.end(), d_keys.begin(), thrust::make_discard_iterator());
+
+  thrust::discard_iterator<> reference(n);
+
+  ASSERT_EQUAL_QUIET(reference, h_result);
+  ASSERT_EQUAL_QUIET(reference, d_result);
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeKToDiscardIterator);
+
+// Compares x / 16 and counts the comparisons.
+struct counting_coarse_less
+{
+  size_t* comparisons;
+
+  bool operator()(int lhs, int rhs) const
+  {
+    ++*comparisons;
+    return lhs / 16 < rhs / 16;
+  }
+};
+
+void TestMergeKComparisons()
+{
+  constexpr int num_segments = 16;
+  constexpr int segment_size = 64;
+  constexpr int n            = num_segments * segment_size;
+
+  // element j of every segment is equivalent to element j of the others, so that the heads of the runs tie in most
+  // matches; equivalent elements are taken from the runs in order, which sorts the keys
+  thrust::host_vector<int> keys(n);
+  thrust::host_vector<int> offsets(num_segments + 1);
+  for (int i = 0; i < n; i++)
+  {
+    keys[i] = (i % segment_size) * num_segments + i / segment_size;
+  }
+  thrust::sequence(offsets.begin(), offsets.end(), 0, segment_size);
+
+  size_t comparisons = 0;
+  thrust::host_vector<int> result(n);
+  thrust::merge_k(
+    thrust::seq, offsets.begin(), offsets.end(), keys.begin(), result.begin(), counting_coarse_less{&comparisons});
+
+  thrust::host_vector<int> ref(n);
+  thrust::sequence(ref.begin(), ref.end());
+  ASSERT_EQUAL(result, ref);
+  // building the tree, then one comparison per level for every element
+  ASSERT_EQUAL(comparisons <= size_t{num_segments - 1 + n * 4}, true);
+}
+DECLARE_UNITTEST(TestMergeKComparisons);
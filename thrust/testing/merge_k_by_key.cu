@@ -0,0 +1,193 @@
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/merge.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#endif
+
+#include <unittest/unittest.h>
+
+// convert xxx_vector<T1> to xxx_vector<T2>
+template <class ExampleVector, typename NewType>
+struct vector_like
+{
+  using alloc        = typename ExampleVector::allocator_type;
+  using alloc_traits = typename thrust::detail::allocator_traits<alloc>;
+  using new_alloc    = typename alloc_traits::template rebind_alloc<NewType>;
+  using type         = thrust::detail::vector_base<NewType, new_alloc>;
+};
+
+template <typename Vector>
+void TestMergeKByKeySimple()
+{
+  const Vector keys{1, 3, 1, 2, 0, 3};
+  const Vector vals{0, 0, 1, 1, 2, 2};
+  const typename vector_like<Vector, int>::type offsets{0, 2, 4, 6};
+  const Vector ref_keys{0, 1, 1, 2, 3, 3};
+  const Vector ref_vals{2, 0, 1, 1, 0, 2};
+
+  Vector result_keys(6), result_vals(6);
+  const auto ends = thrust::merge_k_by_key(
+    offsets.begin(), offsets.end(), keys.begin(), vals.begin(), result_keys.begin(), result_vals.begin());
+
+  ASSERT_EQUAL_QUIET(result_keys.end(), ends.first);
+  ASSERT_EQUAL_QUIET(result_vals.end(), ends.second);
+  ASSERT_EQUAL(ref_keys, result_keys);
+  ASSERT_EQUAL(ref_vals, result_vals);
+}
+DECLARE_VECTOR_UNITTEST(TestMergeKByKeySimple);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  my_system& system,
+  OffsetIterator,
+  OffsetIterator,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  system.validate_dispatch();
+  return thrust::make_pair(keys_result, values_result);
+}
+
+void TestMergeKByKeyDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::merge_k_by_key(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestMergeKByKeyDispatchExplicit);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  my_tag,
+  OffsetIterator,
+  OffsetIterator,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  *keys_result = 13;
+  return thrust::make_pair(keys_result, values_result);
+}
+
+void TestMergeKByKeyDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::merge_k_by_key(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestMergeKByKeyDispatchImplicit);
+
+// Checks that merge_k_by_key is stable, using the position of each key in the input as its value.
+template <typename T>
+void check_merge_k_by_key(const thrust::host_vector<T>& h_keys, const thrust::host_vector<int>& h_offsets)
+{
+  const size_t n = h_keys.size();
+
+  thrust::host_vector<int> h_vals(n);
+  thrust::sequence(h_vals.begin(), h_vals.end());
+
+  thrust::host_vector<T> h_ref_keys   = h_keys;
+  thrust::host_vector<int> h_ref_vals = h_vals;
+  thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_vals.begin());
+
+  const thrust::device_vector<T> d_keys      = h_keys;
+  const thrust::device_vector<int> d_vals    = h_vals;
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::device_vector<T> d_result_keys(n);
+  thrust::device_vector<int> d_result_vals(n);
+
+  const auto ends = thrust::merge_k_by_key(
+    d_offsets.begin(), d_offsets.end(), d_keys.begin(), d_vals.begin(),
+    d_result_keys.begin(),
+    d_result_vals.begin(),
+    ::cuda::std::less<T>());
+
+  ASSERT_EQUAL_QUIET(d_result_keys.end(), ends.first);
+  ASSERT_EQUAL_QUIET(d_result_vals.end(), ends.second);
+  ASSERT_EQUAL(h_ref_keys, d_result_keys);
+  ASSERT_EQUAL(h_ref_vals, d_result_vals);
+}
+
+template <typename T>
+thrust::host_vector<T> sorted_segments(size_t n, const thrust::host_vector<int>& offsets)
+{
+  // few distinct keys, so that most of them are equivalent to keys of other segments
+  thrust::host_vector<T> keys = unittest::random_integers<unittest::int8_t>(n);
+  for (size_t i = 0; i + 1 < offsets.size(); i++)
+  {
+    thrust::sort(keys.begin() + offsets[i], keys.begin() + offsets[i + 1]);
+  }
+  return keys;
+}
+
+template <typename T>
+void TestMergeKByKey(size_t n)
+{
+  for (size_t num_segments : {1, 4, 33})
+  {
+    thrust::host_vector<int> offsets(num_segments + 1);
+    for (size_t i = 0; i <= num_segments; i++)
+    {
+      offsets[i] = static_cast<int>(i * n / num_segments);
+    }
+
+    check_merge_k_by_key(sorted_segments<T>(n, offsets), offsets);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeKByKey);
+
+void TestMergeKByKeyManySegments()
+{
+  // large enough to be split into several parts by the parallel systems
+  const size_t n            = 1 << 18;
+  const size_t num_segments = 100;
+
+  thrust::host_vector<int> offsets(num_segments + 1);
+  for (size_t i = 0; i <= num_segments; i++)
+  {
+    // uneven segment sizes, including empty ones
+    offsets[i] = static_cast<int>((i * i) * n / (num_segments * num_segments));
+  }
+  const thrust::host_vector<int> keys = sorted_segments<int>(n, offsets);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const int previous = omp_get_max_threads();
+  for (int threads : {1, 3, 8})
+  {
+    omp_set_num_threads(threads);
+    check_merge_k_by_key(keys, offsets);
+  }
+  omp_set_num_threads(previous);
+#else
+  check_merge_k_by_key(keys, offsets);
+#endif
+}
+DECLARE_UNITTEST(TestMergeKByKeyManySegments);
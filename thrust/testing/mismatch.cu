@@ -1,6 +1,8 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/mismatch.h>
 
+#include <cuda/std/cstddef>
+
 #include <unittest/unittest.h>
 template <class Vector>
 void TestMismatchSimple()
@@ -59,3 +61,29 @@ void TestMismatchDispatchImplicit()
   ASSERT_EQUAL(13, vec.front());
 }
 DECLARE_UNITTEST(TestMismatchDispatchImplicit);
+
+template <typename T>
+void TestMismatch(const size_t n)
+{
+  thrust::host_vector<T> h_data1 = unittest::random_samples<T>(n);
+  thrust::host_vector<T> h_data2 = h_data1;
+
+  thrust::device_vector<T> d_data1 = h_data1;
+  thrust::device_vector<T> d_data2 = h_data2;
+
+  const ::cuda::std::ptrdiff_t size = n;
+  ASSERT_EQUAL(thrust::mismatch(h_data1.begin(), h_data1.end(), h_data2.begin()).first - h_data1.begin(), size);
+  ASSERT_EQUAL(thrust::mismatch(d_data1.begin(), d_data1.end(), d_data2.begin()).first - d_data1.begin(), size);
+
+  // differences in decreasing order of position, so that each one is the first
+  for (size_t i = n; i > 0; i /= 2)
+  {
+    const ::cuda::std::ptrdiff_t pos = i - 1;
+    h_data2[pos]                     = h_data1[pos] == T{0} ? T{1} : T{0};
+    d_data2[pos]                     = h_data2[pos];
+
+    ASSERT_EQUAL(thrust::mismatch(h_data1.begin(), h_data1.end(), h_data2.begin()).first - h_data1.begin(), pos);
+    ASSERT_EQUAL(thrust::mismatch(d_data1.begin(), d_data1.end(), d_data2.begin()).second - d_data2.begin(), pos);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMismatch);
@@ -0,0 +1,100 @@
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/huge_page.h>
+#include <thrust/mr/pool.h>
+#include <thrust/sequence.h>
+
+#include <unittest/unittest.h>
+
+void TestHugePageResourceSmallAllocation()
+{
+  thrust::mr::huge_page_resource memres;
+
+  for (std::size_t alignment = 16; alignment <= 4 * 1024; alignment <<= 1)
+  {
+    void* ptr = memres.allocate(1024, alignment);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+    char* char_ptr = static_cast<char*>(ptr);
+    thrust::fill(char_ptr, char_ptr + 1024, char{});
+
+    memres.deallocate(ptr, 1024, alignment);
+  }
+}
+DECLARE_UNITTEST(TestHugePageResourceSmallAllocation);
+
+void TestHugePageResourceLargeAllocation()
+{
+  thrust::mr::huge_page_resource memres;
+  const std::size_t huge_page_size = memres.options().huge_page_size;
+
+  const std::size_t sizes[] = {huge_page_size, huge_page_size + 1, 3 * huge_page_size - 7};
+  for (std::size_t size : sizes)
+  {
+    void* ptr = memres.allocate(size);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % huge_page_size, 0u);
+
+    char* char_ptr = static_cast<char*>(ptr);
+    thrust::fill(char_ptr, char_ptr + size, char{42});
+    ASSERT_EQUAL(char_ptr[size - 1], char{42});
+
+    memres.deallocate(ptr, size);
+  }
+
+  // alignments larger than a huge page are honored as well
+  void* ptr = memres.allocate(huge_page_size, 2 * huge_page_size);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % (2 * huge_page_size), 0u);
+  memres.deallocate(ptr, huge_page_size, 2 * huge_page_size);
+}
+DECLARE_UNITTEST(TestHugePageResourceLargeAllocation);
+
+void TestHugePageResourceHugetlbfsFallback()
+{
+  thrust::mr::huge_page_options options = thrust::mr::huge_page_resource::get_default_options();
+  options.threshold                     = 64 * 1024;
+  options.use_hugetlbfs                 = true;
+
+  // the hugetlbfs pool is usually not configured; allocation must still succeed
+  thrust::mr::huge_page_resource memres(options);
+
+  const std::size_t size = 256 * 1024;
+  void* ptr              = memres.allocate(size);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % options.huge_page_size, 0u);
+
+  char* char_ptr = static_cast<char*>(ptr);
+  thrust::fill(char_ptr, char_ptr + size, char{});
+
+  memres.deallocate(ptr, size);
+}
+DECLARE_UNITTEST(TestHugePageResourceHugetlbfsFallback);
+
+void TestHugePageResourceVector()
+{
+  using alloc_t = thrust::mr::stateless_resource_allocator<int, thrust::mr::huge_page_resource>;
+
+  const std::size_t n = (4 << 20) / sizeof(int);
+  thrust::host_vector<int, alloc_t> vec(n);
+  thrust::sequence(vec.begin(), vec.end());
+
+  ASSERT_EQUAL(vec[0], 0);
+  ASSERT_EQUAL(vec[n - 1], static_cast<int>(n - 1));
+
+  vec.resize(16);
+  vec.shrink_to_fit();
+  ASSERT_EQUAL(vec[15], 15);
+}
+DECLARE_UNITTEST(TestHugePageResourceVector);
+
+void TestHugePageResourceAsPoolUpstream()
+{
+  thrust::mr::huge_page_resource upstream;
+  thrust::mr::unsynchronized_pool_resource<thrust::mr::huge_page_resource> pool(&upstream);
+
+  thrust::mr::allocator<int, decltype(pool)> alloc(&pool);
+  thrust::host_vector<int, decltype(alloc)> vec(1 << 20, alloc);
+  thrust::sequence(vec.begin(), vec.end());
+
+  ASSERT_EQUAL(vec[(1 << 20) - 1], (1 << 20) - 1);
+}
+DECLARE_UNITTEST(TestHugePageResourceAsPoolUpstream);
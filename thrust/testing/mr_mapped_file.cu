@@ -0,0 +1,144 @@
+#include <thrust/host_vector.h>
+#include <thrust/mr/mapped_file.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <unittest/unittest.h>
+
+#if !_CCCL_OS(WINDOWS)
+
+// A file of the integers [0, n), removed at the end of the test.
+struct sequence_file
+{
+  explicit sequence_file(int n)
+      : path((std::filesystem::temp_directory_path() / ("thrust_test_mapped_file_" + std::to_string(std::rand())))
+               .string())
+  {
+    thrust::host_vector<int> data(n);
+    thrust::sequence(data.begin(), data.end());
+    write(data);
+  }
+
+  ~sequence_file()
+  {
+    std::remove(path.c_str());
+  }
+
+  void write(const thrust::host_vector<int>& data) const
+  {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(thrust::raw_pointer_cast(data.data()), sizeof(int), data.size(), file);
+    std::fclose(file);
+  }
+
+  thrust::host_vector<int> read() const
+  {
+    thrust::host_vector<int> data(std::filesystem::file_size(path) / sizeof(int));
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    std::fread(thrust::raw_pointer_cast(data.data()), sizeof(int), data.size(), file);
+    std::fclose(file);
+    return data;
+  }
+
+  std::string path;
+};
+
+void TestMappedFileResourceReadOnly()
+{
+  const int n = 100000;
+  const sequence_file file(n);
+
+  thrust::mr::mapped_file_options options = thrust::mr::mapped_file_resource::get_default_options();
+  options.advice                          = thrust::mr::mapped_file_advice::sequential;
+  thrust::mr::mapped_file_resource memres(file.path, options);
+  ASSERT_EQUAL(n * sizeof(int), memres.file_size());
+
+  const thrust::mr::mapped_file_vector<int> vec = thrust::mr::open_mapped_file_vector<int>(memres);
+  ASSERT_EQUAL(static_cast<std::size_t>(n), vec.size());
+  ASSERT_EQUAL(file.read(), vec);
+  ASSERT_EQUAL(static_cast<long long>(n) * (n - 1) / 2, thrust::reduce(vec.begin(), vec.end(), 0ll));
+
+  // a read-only file cannot back more memory than it holds
+  ASSERT_THROWS((void) memres.allocate(n * sizeof(int) + 1), std::bad_alloc);
+}
+DECLARE_UNITTEST(TestMappedFileResourceReadOnly);
+
+void TestMappedFileResourceCopyOnWrite()
+{
+  const int n = 1000;
+  const sequence_file file(n);
+
+  thrust::mr::mapped_file_options options = thrust::mr::mapped_file_resource::get_default_options();
+  options.mode                            = thrust::mr::mapped_file_mode::copy_on_write;
+  options.populate                        = true;
+  thrust::mr::mapped_file_resource memres(file.path, options);
+
+  thrust::mr::mapped_file_vector<int> vec = thrust::mr::open_mapped_file_vector<int>(memres);
+  thrust::sort(vec.begin(), vec.end(), ::cuda::std::greater<int>());
+  ASSERT_EQUAL(n - 1, vec[0]);
+
+  // the vector grows beyond the end of the file, keeping its modified contents
+  vec.resize(3 * n, 7);
+  ASSERT_EQUAL(n - 1, vec[0]);
+  ASSERT_EQUAL(0, vec[n - 1]);
+  ASSERT_EQUAL(7, vec[3 * n - 1]);
+
+  // the file is unchanged
+  thrust::host_vector<int> ref(n);
+  thrust::sequence(ref.begin(), ref.end());
+  ASSERT_EQUAL(ref, file.read());
+}
+DECLARE_UNITTEST(TestMappedFileResourceCopyOnWrite);
+
+void TestMappedFileResourceReadWrite()
+{
+  const int n = 1000;
+  const sequence_file file(n);
+
+  thrust::mr::mapped_file_options options = thrust::mr::mapped_file_resource::get_default_options();
+  options.mode                            = thrust::mr::mapped_file_mode::read_write;
+  options.advice                          = thrust::mr::mapped_file_advice::will_need;
+  thrust::mr::mapped_file_resource memres(file.path, options);
+
+  std::size_t capacity = 0;
+  {
+    thrust::mr::mapped_file_vector<int> vec = thrust::mr::open_mapped_file_vector<int>(memres);
+    thrust::sort(vec.begin(), vec.end(), ::cuda::std::greater<int>());
+    // growing the vector extends the file to its capacity
+    vec.push_back(-1);
+    capacity = vec.capacity();
+  }
+
+  thrust::host_vector<int> ref(n + 1);
+  thrust::sequence(ref.begin(), ref.end(), n - 1, -1);
+  thrust::host_vector<int> result = file.read();
+  ASSERT_EQUAL(capacity, result.size());
+  result.resize(n + 1);
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_UNITTEST(TestMappedFileResourceReadWrite);
+
+void TestMappedFileResourceErrors()
+{
+  ASSERT_THROWS(thrust::mr::mapped_file_resource("/nonexistent/thrust_test_mapped_file"), thrust::system_error);
+
+  const sequence_file file(0);
+  thrust::mr::mapped_file_resource memres(file.path);
+
+  const thrust::mr::mapped_file_vector<int> vec = thrust::mr::open_mapped_file_vector<int>(memres);
+  ASSERT_EQUAL(0u, vec.size());
+
+  void* ptr = memres.allocate(0);
+  memres.deallocate(ptr, 0);
+
+  ASSERT_THROWS((void) memres.allocate(0, 2 * ::sysconf(_SC_PAGESIZE)), std::bad_alloc);
+}
+DECLARE_UNITTEST(TestMappedFileResourceErrors);
+
+#endif // !_CCCL_OS(WINDOWS)
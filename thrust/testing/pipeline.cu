@@ -0,0 +1,271 @@
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pipeline.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct times_three
+{
+  _CCCL_HOST_DEVICE T operator()(const T& x) const
+  {
+    return static_cast<T>(x * 3);
+  }
+};
+
+template <typename T>
+struct is_even
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& x) const
+  {
+    return (x & 1) == 0;
+  }
+};
+
+template <typename Vector>
+void TestPipelineSimple()
+{
+  using T = typename Vector::value_type;
+
+  const Vector input{1, 2, 3, 4, 5, 6, 7, 8};
+  Vector output(8, 0);
+
+  auto end = thrust::pipeline(
+    input.begin(),
+    input.end(),
+    output.begin(),
+    thrust::make_filter_stage(is_even<T>()),
+    thrust::make_transform_stage(times_three<T>()),
+    thrust::make_inclusive_scan_stage(::cuda::std::plus<T>()));
+
+  const Vector ref{6, 18, 36, 60, 0, 0, 0, 0};
+
+  ASSERT_EQUAL(4, end - output.begin());
+  ASSERT_EQUAL(ref, output);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestPipelineSimple);
+
+template <typename Vector>
+void TestPipelineWithoutStages()
+{
+  const Vector input{3, 1, 2};
+  Vector output(3);
+
+  auto end = thrust::pipeline(input.begin(), input.end(), output.begin());
+
+  ASSERT_EQUAL(3, end - output.begin());
+  ASSERT_EQUAL(input, output);
+}
+DECLARE_VECTOR_UNITTEST(TestPipelineWithoutStages);
+
+template <typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(my_system& system, InputIterator, InputIterator, OutputIterator result, const Stages&...)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestPipelineDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::pipeline(sys, vec.begin(), vec.begin(), vec.begin(), thrust::make_filter_stage(is_even<int>()));
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestPipelineDispatchExplicit);
+
+template <typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(my_tag, InputIterator, InputIterator, OutputIterator result, const Stages&...)
+{
+  *result = 13;
+  return result;
+}
+
+void TestPipelineDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::pipeline(thrust::retag<my_tag>(vec.begin()),
+                   thrust::retag<my_tag>(vec.begin()),
+                   thrust::retag<my_tag>(vec.begin()),
+                   thrust::make_filter_stage(is_even<int>()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestPipelineDispatchImplicit);
+
+template <typename T>
+void TestPipelineTransformFilterScan(size_t n)
+{
+  const thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  // the same stages, one algorithm after another
+  thrust::host_vector<T> h_ref(n);
+  auto ref_end = thrust::copy_if(h_input.begin(), h_input.end(), h_ref.begin(), is_even<T>());
+  ref_end      = thrust::transform(h_ref.begin(), ref_end, h_ref.begin(), times_three<T>());
+  ref_end      = thrust::inclusive_scan(h_ref.begin(), ref_end, h_ref.begin(), ::cuda::maximum<T>());
+  h_ref.resize(ref_end - h_ref.begin());
+
+  const thrust::device_vector<T> d_input = h_input;
+  thrust::host_vector<T> h_output(n);
+  thrust::device_vector<T> d_output(n);
+
+  auto h_end = thrust::pipeline(
+    h_input.begin(),
+    h_input.end(),
+    h_output.begin(),
+    thrust::make_filter_stage(is_even<T>()),
+    thrust::make_transform_stage(times_three<T>()),
+    thrust::make_inclusive_scan_stage(::cuda::maximum<T>()));
+  auto d_end = thrust::pipeline(
+    d_input.begin(),
+    d_input.end(),
+    d_output.begin(),
+    thrust::make_filter_stage(is_even<T>()),
+    thrust::make_transform_stage(times_three<T>()),
+    thrust::make_inclusive_scan_stage(::cuda::maximum<T>()));
+  h_output.resize(h_end - h_output.begin());
+  d_output.resize(d_end - d_output.begin());
+
+  ASSERT_EQUAL(h_ref, h_output);
+  ASSERT_EQUAL(h_ref, d_output);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestPipelineTransformFilterScan);
+
+struct is_odd_value
+{
+  _CCCL_HOST_DEVICE bool operator()(const thrust::tuple<int, int>& x) const
+  {
+    return thrust::get<1>(x) % 2 != 0;
+  }
+};
+
+void TestPipelineReduceByKey(size_t n)
+{
+  // runs of equal keys which span several tiles, and short runs
+  for (int run_length : {1, 7, 20000})
+  {
+    thrust::host_vector<int> h_keys(n);
+    thrust::sequence(h_keys.begin(), h_keys.end());
+    thrust::transform(h_keys.begin(),
+                      h_keys.end(),
+                      thrust::make_constant_iterator(run_length),
+                      h_keys.begin(),
+                      ::cuda::std::divides<int>());
+    const thrust::host_vector<int> h_values = unittest::random_integers<unittest::int8_t>(n);
+
+    thrust::host_vector<int> h_filtered_keys(n);
+    thrust::host_vector<int> h_filtered_values(n);
+    const auto filtered_end = thrust::copy_if(
+      thrust::make_zip_iterator(h_keys.begin(), h_values.begin()),
+      thrust::make_zip_iterator(h_keys.end(), h_values.end()),
+      thrust::make_zip_iterator(h_filtered_keys.begin(), h_filtered_values.begin()),
+      is_odd_value());
+    const size_t num_filtered =
+      filtered_end - thrust::make_zip_iterator(h_filtered_keys.begin(), h_filtered_values.begin());
+
+    thrust::host_vector<int> h_keys_ref(n);
+    thrust::host_vector<int> h_values_ref(n);
+    const auto ref_end = thrust::reduce_by_key(
+      h_filtered_keys.begin(),
+      h_filtered_keys.begin() + num_filtered,
+      h_filtered_values.begin(),
+      h_keys_ref.begin(),
+      h_values_ref.begin());
+    h_keys_ref.resize(ref_end.first - h_keys_ref.begin());
+    h_values_ref.resize(ref_end.second - h_values_ref.begin());
+
+    const thrust::device_vector<int> d_keys   = h_keys;
+    const thrust::device_vector<int> d_values = h_values;
+    thrust::device_vector<int> d_keys_result(n);
+    thrust::device_vector<int> d_values_result(n);
+
+    const auto d_end = thrust::pipeline(
+      thrust::make_zip_iterator(d_keys.begin(), d_values.begin()),
+      thrust::make_zip_iterator(d_keys.end(), d_values.end()),
+      thrust::make_zip_iterator(d_keys_result.begin(), d_values_result.begin()),
+      thrust::make_filter_stage(is_odd_value()),
+      thrust::make_reduce_by_key_stage(::cuda::std::equal_to<int>(), ::cuda::std::plus<int>()));
+    const size_t num_runs = d_end - thrust::make_zip_iterator(d_keys_result.begin(), d_values_result.begin());
+    d_keys_result.resize(num_runs);
+    d_values_result.resize(num_runs);
+
+    ASSERT_EQUAL(h_keys_ref, d_keys_result);
+    ASSERT_EQUAL(h_values_ref, d_values_result);
+  }
+}
+DECLARE_SIZED_UNITTEST(TestPipelineReduceByKey);
+
+struct last_digit
+{
+  _CCCL_HOST_DEVICE int operator()(int x) const
+  {
+    return x % 10;
+  }
+};
+
+struct thousands
+{
+  _CCCL_HOST_DEVICE int operator()(int x) const
+  {
+    return x / 1000;
+  }
+};
+
+struct count_by_thousands
+{
+  _CCCL_HOST_DEVICE thrust::tuple<int, int> operator()(int x) const
+  {
+    return thrust::make_tuple(x / 1000, 1);
+  }
+};
+
+void TestPipelineSeveralBarriers(size_t n)
+{
+  // the output of the scan is stored for the stages after it
+  thrust::host_vector<int> h_input(n);
+  thrust::sequence(h_input.begin(), h_input.end());
+
+  thrust::host_vector<int> h_sums(n);
+  thrust::transform(h_input.begin(), h_input.end(), h_sums.begin(), last_digit());
+  thrust::inclusive_scan(h_sums.begin(), h_sums.end(), h_sums.begin());
+  h_sums.erase(thrust::copy_if(h_sums.begin(), h_sums.end(), h_sums.begin(), is_even<int>()), h_sums.end());
+  thrust::transform(h_sums.begin(), h_sums.end(), h_sums.begin(), thousands());
+
+  thrust::host_vector<int> h_keys_ref(n);
+  thrust::host_vector<int> h_counts_ref(n);
+  const auto ref_end = thrust::reduce_by_key(
+    h_sums.begin(), h_sums.end(), thrust::make_constant_iterator(1), h_keys_ref.begin(), h_counts_ref.begin());
+  h_keys_ref.resize(ref_end.first - h_keys_ref.begin());
+  h_counts_ref.resize(ref_end.second - h_counts_ref.begin());
+
+  const thrust::device_vector<int> d_input = h_input;
+  thrust::device_vector<int> d_keys(n);
+  thrust::device_vector<int> d_counts(n);
+
+  const auto d_end = thrust::pipeline(
+    d_input.begin(),
+    d_input.end(),
+    thrust::make_zip_iterator(d_keys.begin(), d_counts.begin()),
+    thrust::make_transform_stage(last_digit()),
+    thrust::make_inclusive_scan_stage(::cuda::std::plus<int>()),
+    thrust::make_filter_stage(is_even<int>()),
+    thrust::make_transform_stage(count_by_thousands()),
+    thrust::make_reduce_by_key_stage(::cuda::std::equal_to<int>(), ::cuda::std::plus<int>()));
+  const size_t num_keys = d_end - thrust::make_zip_iterator(d_keys.begin(), d_counts.begin());
+  d_keys.resize(num_keys);
+  d_counts.resize(num_keys);
+
+  ASSERT_EQUAL(h_keys_ref, d_keys);
+  ASSERT_EQUAL(h_counts_ref, d_counts);
+}
+DECLARE_SIZED_UNITTEST(TestPipelineSeveralBarriers);
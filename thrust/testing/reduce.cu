@@ -3,8 +3,17 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/reduce.h>
 
+#include <thrust/transform_reduce.h>
+
+#include <cstring>
 #include <limits>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#endif
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -198,3 +207,64 @@ void TestReduceWithBigIndexes()
 #endif
 }
 DECLARE_UNITTEST(TestReduceWithBigIndexes);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+template <typename F>
+void run_with_threads(int threads, F f)
+{
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const int previous = omp_get_max_threads();
+  omp_set_num_threads(threads);
+  f();
+  omp_set_num_threads(previous);
+#  else
+  tbb::global_control control(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads));
+  f();
+#  endif
+}
+
+struct square_float
+{
+  _CCCL_HOST_DEVICE float operator()(float x) const
+  {
+    return x * x;
+  }
+};
+
+void TestReduceFloatRunToRunDeterminism()
+{
+  // values spanning many magnitudes, so that any change in the association order changes the rounded result
+  const std::size_t n             = (1 << 20) + 123;
+  thrust::host_vector<float> h_in = unittest::random_samples<float>(n);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    h_in[i] = (h_in[i] - 0.5f) * static_cast<float>(1 << (i % 24));
+  }
+  thrust::device_vector<float> d_in = h_in;
+
+  float reference_sum{};
+  float reference_sum_of_squares{};
+  run_with_threads(1, [&] {
+    reference_sum            = thrust::reduce(d_in.begin(), d_in.end(), 0.0f);
+    reference_sum_of_squares =
+      thrust::transform_reduce(d_in.begin(), d_in.end(), square_float{}, 0.0f, ::cuda::std::plus<float>{});
+  });
+
+  for (int threads : {2, 3, 4, 7, 16})
+  {
+    for (int repetition = 0; repetition < 3; repetition++)
+    {
+      run_with_threads(threads, [&] {
+        const float sum = thrust::reduce(d_in.begin(), d_in.end(), 0.0f);
+        const float sum_of_squares =
+          thrust::transform_reduce(d_in.begin(), d_in.end(), square_float{}, 0.0f, ::cuda::std::plus<float>{});
+
+        // compare bit patterns, not approximately
+        ASSERT_EQUAL(std::memcmp(&sum, &reference_sum, sizeof(float)), 0);
+        ASSERT_EQUAL(std::memcmp(&sum_of_squares, &reference_sum_of_squares, sizeof(float)), 0);
+      });
+    }
+  }
+}
+DECLARE_UNITTEST(TestReduceFloatRunToRunDeterminism);
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
@@ -3,6 +3,10 @@
 #include <thrust/reduce.h>
 #include <thrust/unique.h>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#endif
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -194,6 +198,109 @@ struct TestReduceByKeyToDiscardIterator
 };
 VariableUnitTest<TestReduceByKeyToDiscardIterator, IntegralTypes> TestReduceByKeyToDiscardIteratorInstance;
 
+void TestReduceByKeyLongSegments()
+{
+  using K = int;
+  using V = unsigned int;
+
+  // segments much longer than the intervals a parallel system reduces separately, so that they span several of them
+  const size_t n = 1 << 20;
+
+  for (size_t segment_size : {size_t{1}, size_t{3}, size_t{1000}, size_t{100000}, n})
+  {
+    thrust::host_vector<K> h_keys(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<K>(i / segment_size);
+    }
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    thrust::host_vector<K> h_keys_output(n);
+    thrust::host_vector<V> h_vals_output(n);
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+
+    auto h_last =
+      thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_output.begin(), h_vals_output.begin());
+    auto d_last =
+      thrust::reduce_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin());
+
+    ASSERT_EQUAL((n + segment_size - 1) / segment_size, static_cast<size_t>(d_last.first - d_keys_output.begin()));
+    ASSERT_EQUAL(h_last.second - h_vals_output.begin(), d_last.second - d_vals_output.begin());
+    ASSERT_EQUAL(h_keys_output, d_keys_output);
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+  }
+}
+DECLARE_UNITTEST(TestReduceByKeyLongSegments);
+
+// Keys are equivalent to the first key of their segment if they differ by at most one, which is not transitive, so
+// where a segment ends depends on where it starts.
+struct is_near_reduce_by_key
+{
+  _CCCL_HOST_DEVICE bool operator()(int x, int y) const
+  {
+    return x - y <= 1 && y - x <= 1;
+  }
+};
+
+void check_reduce_by_key_non_transitive(const thrust::host_vector<int>& h_keys, const thrust::host_vector<int>& h_vals)
+{
+  const thrust::device_vector<int> d_keys = h_keys;
+  const thrust::device_vector<int> d_vals = h_vals;
+
+  thrust::host_vector<int> h_keys_output(h_keys.size());
+  thrust::host_vector<int> h_vals_output(h_keys.size());
+  thrust::device_vector<int> d_keys_output(h_keys.size());
+  thrust::device_vector<int> d_vals_output(h_keys.size());
+
+  auto h_last = thrust::reduce_by_key(
+    h_keys.begin(),
+    h_keys.end(),
+    h_vals.begin(),
+    h_keys_output.begin(),
+    h_vals_output.begin(),
+    is_near_reduce_by_key{});
+  auto d_last = thrust::reduce_by_key(
+    d_keys.begin(),
+    d_keys.end(),
+    d_vals.begin(),
+    d_keys_output.begin(),
+    d_vals_output.begin(),
+    is_near_reduce_by_key{});
+
+  ASSERT_EQUAL(h_last.first - h_keys_output.begin(), d_last.first - d_keys_output.begin());
+  ASSERT_EQUAL(h_keys_output, d_keys_output);
+  ASSERT_EQUAL(h_vals_output, d_vals_output);
+}
+
+void TestReduceByKeyNonTransitivePredicate()
+{
+  // longer than the intervals a parallel system reduces separately, whose ends do not line up with the segments
+  const size_t n = 1 << 18;
+
+  thrust::host_vector<int> h_keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>(i / 3);
+  }
+  const thrust::host_vector<int> h_vals = unittest::random_integers<int>(n);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const int previous = omp_get_max_threads();
+  for (int threads : {2, 3, 8})
+  {
+    omp_set_num_threads(threads);
+    check_reduce_by_key_non_transitive(h_keys, h_vals);
+  }
+  omp_set_num_threads(previous);
+#else
+  check_reduce_by_key_non_transitive(h_keys, h_vals);
+#endif
+}
+DECLARE_UNITTEST(TestReduceByKeyNonTransitivePredicate);
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
 thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   my_system& system,
@@ -1,6 +1,7 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/reverse.h>
+#include <thrust/sequence.h>
 
 #include <unittest/unittest.h>
 
@@ -169,3 +170,25 @@ struct TestReverseCopyToDiscardIterator
   }
 };
 VariableUnitTest<TestReverseCopyToDiscardIterator, ReverseTypes> TestReverseCopyToDiscardIteratorInstance;
+
+void TestReverseAgainstReference()
+{
+  // odd and even sizes on either side of the interval size of the host systems
+  const size_t sizes[] = {2 << 15, (2 << 15) + 1, (3 << 15) + 1, 7 << 15};
+  for (size_t n : sizes)
+  {
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+    thrust::device_vector<int> d_data = h_data;
+
+    thrust::reverse(h_data.begin(), h_data.end());
+    thrust::reverse(d_data.begin(), d_data.end());
+
+    thrust::host_vector<int> ref(n);
+    thrust::sequence(ref.begin(), ref.end(), static_cast<int>(n) - 1, -1);
+
+    ASSERT_EQUAL(h_data, ref);
+    ASSERT_EQUAL(d_data, ref);
+  }
+}
+DECLARE_UNITTEST(TestReverseAgainstReference);
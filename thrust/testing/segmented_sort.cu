@@ -0,0 +1,158 @@
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+// convert xxx_vector<T1> to xxx_vector<T2>
+template <class ExampleVector, typename NewType>
+struct vector_like
+{
+  using alloc        = typename ExampleVector::allocator_type;
+  using alloc_traits = typename thrust::detail::allocator_traits<alloc>;
+  using new_alloc    = typename alloc_traits::template rebind_alloc<NewType>;
+  using type         = thrust::detail::vector_base<NewType, new_alloc>;
+};
+
+template <typename Vector>
+void TestSegmentedSortSimple()
+{
+  // the rows of a CSR matrix, one of them empty
+  Vector keys{5, 1, 3, 6, 0, 4, 2};
+  const typename vector_like<Vector, int>::type row_offsets{0, 3, 3, 7};
+  const Vector ref{1, 3, 5, 0, 2, 4, 6};
+
+  thrust::segmented_sort(keys.begin(), keys.end(), row_offsets.begin(), row_offsets.end() - 1, row_offsets.begin() + 1);
+
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortSimple);
+
+template <typename Vector>
+void TestSegmentedSortGaps()
+{
+  // elements outside of the segments stay in place, and the segments need not be in order
+  Vector keys{9, 3, 2, 1, 8, 7, 6, 5, 4};
+  const typename vector_like<Vector, int>::type begin_offsets{5, 1};
+  const typename vector_like<Vector, int>::type end_offsets{8, 4};
+  const Vector ref{9, 1, 2, 3, 8, 5, 6, 7, 4};
+
+  thrust::segmented_sort(keys.begin(), keys.end(), begin_offsets.begin(), begin_offsets.end(), end_offsets.begin());
+
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortGaps);
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  my_system& system, RandomAccessIterator, RandomAccessIterator, OffsetIterator1, OffsetIterator1, OffsetIterator2)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_sort(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  my_tag, RandomAccessIterator first, RandomAccessIterator, OffsetIterator1, OffsetIterator1, OffsetIterator2)
+{
+  *first = 13;
+}
+
+void TestSegmentedSortDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_sort(thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchImplicit);
+
+// Splits n elements into num_segments segments of random sizes, some of them empty.
+inline thrust::host_vector<int> make_offsets(size_t n, size_t num_segments)
+{
+  thrust::host_vector<unsigned int> cuts = unittest::random_integers<unsigned int>(num_segments - 1);
+
+  thrust::host_vector<int> offsets(num_segments + 1);
+  offsets[0]            = 0;
+  offsets[num_segments] = static_cast<int>(n);
+  for (size_t i = 1; i < num_segments; i++)
+  {
+    offsets[i] = static_cast<int>(cuts[i - 1] % (n + 1));
+  }
+  thrust::sort(offsets.begin(), offsets.end());
+  return offsets;
+}
+
+template <typename T>
+void TestSegmentedSort(size_t n)
+{
+  // few segments are sorted by all threads together, many segments by one thread each
+  for (size_t num_segments : {1, 2, 3, 17, 1000})
+  {
+    const thrust::host_vector<int> h_offsets = make_offsets(n, num_segments);
+    const thrust::host_vector<T> h_keys      = unittest::random_integers<T>(n);
+
+    thrust::host_vector<T> h_ref = h_keys;
+    for (size_t i = 0; i < num_segments; i++)
+    {
+      thrust::stable_sort(thrust::seq, h_ref.begin() + h_offsets[i], h_ref.begin() + h_offsets[i + 1]);
+    }
+
+    thrust::host_vector<T> h_result            = h_keys;
+    thrust::device_vector<T> d_result          = h_keys;
+    const thrust::device_vector<int> d_offsets = h_offsets;
+
+    thrust::segmented_sort(
+      h_result.begin(), h_result.end(), h_offsets.begin(), h_offsets.end() - 1, h_offsets.begin() + 1);
+    thrust::segmented_sort(
+      d_result.begin(), d_result.end(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1);
+
+    ASSERT_EQUAL(h_ref, h_result);
+    ASSERT_EQUAL(h_ref, d_result);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSort);
+
+template <typename T>
+void TestSegmentedSortDescending(size_t n)
+{
+  const thrust::host_vector<int> h_offsets = make_offsets(n, 9);
+  const thrust::host_vector<T> h_keys      = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_ref = h_keys;
+  for (size_t i = 0; i < 9; i++)
+  {
+    thrust::stable_sort(
+      thrust::seq, h_ref.begin() + h_offsets[i], h_ref.begin() + h_offsets[i + 1], ::cuda::std::greater<T>());
+  }
+
+  thrust::device_vector<T> d_result          = h_keys;
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::segmented_sort(
+    d_result.begin(),
+    d_result.end(),
+    d_offsets.begin(),
+    d_offsets.end() - 1,
+    d_offsets.begin() + 1,
+    ::cuda::std::greater<T>());
+
+  ASSERT_EQUAL(h_ref, d_result);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSortDescending);
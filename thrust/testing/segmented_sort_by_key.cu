@@ -0,0 +1,188 @@
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+// convert xxx_vector<T1> to xxx_vector<T2>
+template <class ExampleVector, typename NewType>
+struct vector_like
+{
+  using alloc        = typename ExampleVector::allocator_type;
+  using alloc_traits = typename thrust::detail::allocator_traits<alloc>;
+  using new_alloc    = typename alloc_traits::template rebind_alloc<NewType>;
+  using type         = thrust::detail::vector_base<NewType, new_alloc>;
+};
+
+template <typename Vector>
+void TestSegmentedSortByKeySimple()
+{
+  // the rows of a CSR matrix, one of them empty
+  Vector keys{5, 1, 3, 6, 0, 4, 2};
+  Vector values{0, 1, 2, 3, 4, 5, 6};
+  const typename vector_like<Vector, int>::type row_offsets{0, 3, 3, 7};
+  const Vector keys_ref{1, 3, 5, 0, 2, 4, 6};
+  const Vector values_ref{1, 2, 0, 4, 6, 5, 3};
+
+  thrust::segmented_sort_by_key(
+    keys.begin(), keys.end(), values.begin(), row_offsets.begin(), row_offsets.end() - 1, row_offsets.begin() + 1);
+
+  ASSERT_EQUAL(keys_ref, keys);
+  ASSERT_EQUAL(values_ref, values);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortByKeySimple);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  my_system& system,
+  RandomAccessIterator1,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OffsetIterator1,
+  OffsetIterator1,
+  OffsetIterator2)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortByKeyDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_sort_by_key(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortByKeyDispatchExplicit);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  my_tag,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OffsetIterator1,
+  OffsetIterator1,
+  OffsetIterator2)
+{
+  *keys_first = 13;
+}
+
+void TestSegmentedSortByKeyDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_sort_by_key(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortByKeyDispatchImplicit);
+
+// Splits n elements into num_segments segments of random sizes, some of them empty.
+inline thrust::host_vector<int> make_offsets(size_t n, size_t num_segments)
+{
+  thrust::host_vector<unsigned int> cuts = unittest::random_integers<unsigned int>(num_segments - 1);
+
+  thrust::host_vector<int> offsets(num_segments + 1);
+  offsets[0]            = 0;
+  offsets[num_segments] = static_cast<int>(n);
+  for (size_t i = 1; i < num_segments; i++)
+  {
+    offsets[i] = static_cast<int>(cuts[i - 1] % (n + 1));
+  }
+  thrust::sort(offsets.begin(), offsets.end());
+  return offsets;
+}
+
+template <typename T>
+void TestSegmentedSortByKey(size_t n)
+{
+  // few segments are sorted by all threads together, many segments by one thread each
+  for (size_t num_segments : {1, 2, 3, 17, 1000})
+  {
+    const thrust::host_vector<int> h_offsets = make_offsets(n, num_segments);
+
+    // the keys repeat, so that the values show whether equivalent keys keep their order
+    thrust::host_vector<T> h_keys = unittest::random_integers<unittest::int8_t>(n);
+    thrust::host_vector<int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+
+    thrust::host_vector<T> h_keys_ref     = h_keys;
+    thrust::host_vector<int> h_values_ref = h_values;
+    for (size_t i = 0; i < num_segments; i++)
+    {
+      thrust::stable_sort_by_key(thrust::seq,
+                                 h_keys_ref.begin() + h_offsets[i],
+                                 h_keys_ref.begin() + h_offsets[i + 1],
+                                 h_values_ref.begin() + h_offsets[i]);
+    }
+
+    thrust::device_vector<T> d_keys            = h_keys;
+    thrust::device_vector<int> d_values        = h_values;
+    const thrust::device_vector<int> d_offsets = h_offsets;
+
+    thrust::segmented_sort_by_key(
+      h_keys.begin(), h_keys.end(), h_values.begin(), h_offsets.begin(), h_offsets.end() - 1, h_offsets.begin() + 1);
+    thrust::segmented_sort_by_key(
+      d_keys.begin(), d_keys.end(), d_values.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1);
+
+    ASSERT_EQUAL(h_keys_ref, h_keys);
+    ASSERT_EQUAL(h_values_ref, h_values);
+    ASSERT_EQUAL(h_keys_ref, d_keys);
+    ASSERT_EQUAL(h_values_ref, d_values);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSortByKey);
+
+template <typename T>
+void TestSegmentedSortByKeyDescending(size_t n)
+{
+  const thrust::host_vector<int> h_offsets = make_offsets(n, 9);
+
+  thrust::host_vector<T> h_keys = unittest::random_integers<unittest::int8_t>(n);
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+
+  thrust::host_vector<T> h_keys_ref     = h_keys;
+  thrust::host_vector<int> h_values_ref = h_values;
+  for (size_t i = 0; i < 9; i++)
+  {
+    thrust::stable_sort_by_key(thrust::seq,
+                               h_keys_ref.begin() + h_offsets[i],
+                               h_keys_ref.begin() + h_offsets[i + 1],
+                               h_values_ref.begin() + h_offsets[i],
+                               ::cuda::std::greater<T>());
+  }
+
+  thrust::device_vector<T> d_keys            = h_keys;
+  thrust::device_vector<int> d_values        = h_values;
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::segmented_sort_by_key(
+    d_keys.begin(),
+    d_keys.end(),
+    d_values.begin(),
+    d_offsets.begin(),
+    d_offsets.end() - 1,
+    d_offsets.begin() + 1,
+    ::cuda::std::greater<T>());
+
+  ASSERT_EQUAL(h_keys_ref, d_keys);
+  ASSERT_EQUAL(h_values_ref, d_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSortByKeyDescending);
@@ -7,6 +7,8 @@
 
 #include <unittest/unittest.h>
 
+#include <algorithm>
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
 OutputIterator set_intersection(
   my_system& system, InputIterator1, InputIterator1, InputIterator2, InputIterator2, OutputIterator result)
@@ -204,6 +206,50 @@ void TestSetIntersectionMultiset(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetIntersectionMultiset);
 
+template <typename T>
+void TestSetIntersectionSkewed(const size_t n)
+{
+  // inputs whose lengths differ enough for the sequential path to gallop, with duplicates in both
+  thrust::host_vector<T> h_small = unittest::random_integers<T>(n / 64 + 1);
+  thrust::host_vector<T> h_large = unittest::random_integers<T>(n);
+  for (size_t i = 0; i < h_small.size(); i++)
+  {
+    h_small[i] = static_cast<T>(h_small[i] % 512);
+  }
+  for (size_t i = 0; i < h_large.size(); i++)
+  {
+    h_large[i] = static_cast<T>(h_large[i] % 512);
+  }
+  thrust::sort(h_small.begin(), h_small.end());
+  thrust::sort(h_large.begin(), h_large.end());
+
+  const thrust::device_vector<T> d_small = h_small;
+  const thrust::device_vector<T> d_large = h_large;
+
+  for (bool small_first : {true, false})
+  {
+    const thrust::host_vector<T>& h_a   = small_first ? h_small : h_large;
+    const thrust::host_vector<T>& h_b   = small_first ? h_large : h_small;
+    const thrust::device_vector<T>& d_a = small_first ? d_small : d_large;
+    const thrust::device_vector<T>& d_b = small_first ? d_large : d_small;
+
+    thrust::host_vector<T> h_ref(h_a.size());
+    h_ref.erase(std::set_intersection(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_ref.begin()), h_ref.end());
+
+    thrust::host_vector<T> h_result(h_a.size());
+    thrust::device_vector<T> d_result(h_a.size());
+
+    auto h_end = thrust::set_intersection(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+    auto d_end = thrust::set_intersection(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+    h_result.erase(h_end, h_result.end());
+    d_result.erase(d_end, d_result.end());
+
+    ASSERT_EQUAL(h_ref, h_result);
+    ASSERT_EQUAL(h_ref, d_result);
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSetIntersectionSkewed);
+
 // FIXME: disabled on Windows, because it causes a failure on the internal CI system in one specific configuration.
 // That failure will be tracked in a new NVBug, this is disabled to unblock submitting all the other changes.
 #if !_CCCL_COMPILER(MSVC)
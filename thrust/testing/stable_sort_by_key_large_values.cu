@@ -52,3 +52,49 @@ void TestStableSortByKeyWithLargeValues()
   _TestStableSortByKeyWithLargeValues<16>();
 }
 DECLARE_UNITTEST(TestStableSortByKeyWithLargeValues);
+
+template <unsigned int N>
+void _TestStableSortByKeyWithLargeValuesStability(size_t n)
+{
+  // few distinct keys, so that the order of the values of equivalent keys is checked
+  thrust::host_vector<unsigned int> h_keys = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<FixedVector<int, N>> h_vals(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_keys[i] %= 64;
+    h_vals[i] = FixedVector<int, N>(static_cast<int>(i));
+  }
+
+  thrust::host_vector<unsigned int> h_keys_ref = h_keys;
+  thrust::host_vector<FixedVector<int, N>> h_vals_ref(n);
+  size_t pos = 0;
+  for (unsigned int key = 0; key < 64; key++)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      if (h_keys[i] == key)
+      {
+        h_vals_ref[pos++] = h_vals[i];
+      }
+    }
+  }
+  thrust::stable_sort(h_keys_ref.begin(), h_keys_ref.end());
+
+  thrust::device_vector<unsigned int> d_keys        = h_keys;
+  thrust::device_vector<FixedVector<int, N>> d_vals = h_vals;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_vals.begin());
+  thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_vals.begin());
+
+  ASSERT_EQUAL_QUIET(h_keys_ref, h_keys);
+  ASSERT_EQUAL_QUIET(h_vals_ref, h_vals);
+  ASSERT_EQUAL_QUIET(h_keys_ref, d_keys);
+  ASSERT_EQUAL_QUIET(h_vals_ref, d_vals);
+}
+
+void TestStableSortByKeyWithLargeValuesStability(size_t n)
+{
+  _TestStableSortByKeyWithLargeValuesStability<2>(n);
+  _TestStableSortByKeyWithLargeValuesStability<16>(n);
+}
+DECLARE_SIZED_UNITTEST(TestStableSortByKeyWithLargeValuesStability);
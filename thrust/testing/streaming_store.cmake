@@ -0,0 +1,2 @@
+# Outputs of more than a few cache lines are written with non-temporal stores.
+target_compile_definitions(${test_target} PRIVATE THRUST_HOST_STREAMING_STORE_THRESHOLD=1024)
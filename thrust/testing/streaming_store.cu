@@ -0,0 +1,107 @@
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+// This test is compiled with a small THRUST_HOST_STREAMING_STORE_THRESHOLD, so that the larger outputs are written
+// with non-temporal stores on the host systems, and compared against the standard algorithms. The outputs start at
+// every offset of a cache line, so that each takes a different split into regular and non-temporal stores.
+
+template <typename T>
+struct saxpy
+{
+  T a;
+
+  _CCCL_HOST_DEVICE T operator()(const T& x, const T& y) const
+  {
+    return static_cast<T>(a * x + y);
+  }
+};
+
+template <typename T>
+void TestStreamingStoreFill(size_t n)
+{
+  for (size_t offset = 0; offset < 64 / sizeof(T) + 1; ++offset)
+  {
+    thrust::host_vector<T> h_data(n + offset, T(1));
+    thrust::device_vector<T> d_data(n + offset, T(1));
+
+    std::fill(h_data.begin() + offset, h_data.end(), T(13));
+    thrust::fill(d_data.begin() + offset, d_data.end(), T(13));
+    ASSERT_EQUAL(h_data, d_data);
+
+    thrust::fill_n(d_data.begin() + offset, n, T(0));
+    std::fill_n(h_data.begin() + offset, n, T(0));
+    ASSERT_EQUAL(h_data, d_data);
+
+    thrust::uninitialized_fill(d_data.begin() + offset, d_data.end(), T(7));
+    std::uninitialized_fill(h_data.begin() + offset, h_data.end(), T(7));
+    ASSERT_EQUAL(h_data, d_data);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestStreamingStoreFill);
+
+template <typename T>
+void TestStreamingStoreCopy(size_t n)
+{
+  const thrust::host_vector<T> h_input = unittest::random_samples<T>(n);
+  const thrust::device_vector<T> d_input = h_input;
+
+  for (size_t offset = 0; offset < 64 / sizeof(T) + 1; ++offset)
+  {
+    thrust::device_vector<T> d_output(n + offset, T(1));
+    thrust::copy(d_input.begin(), d_input.end(), d_output.begin() + offset);
+
+    thrust::host_vector<T> h_output(n + offset, T(1));
+    std::copy(h_input.begin(), h_input.end(), h_output.begin() + offset);
+    ASSERT_EQUAL(h_output, d_output);
+  }
+
+  // overlapping ranges are not written with non-temporal stores
+  thrust::device_vector<T> d_data = d_input;
+  thrust::host_vector<T> h_data   = h_input;
+  if (n > 1)
+  {
+    thrust::copy(d_data.begin() + 1, d_data.end(), d_data.begin());
+    std::copy(h_data.begin() + 1, h_data.end(), h_data.begin());
+  }
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_VARIABLE_UNITTEST(TestStreamingStoreCopy);
+
+template <typename T>
+void TestStreamingStoreTransform(size_t n)
+{
+  const thrust::host_vector<T> h_x = unittest::random_samples<T>(n);
+  const thrust::host_vector<T> h_y = unittest::random_samples<T>(n);
+  const thrust::device_vector<T> d_x = h_x;
+  const thrust::device_vector<T> d_y = h_y;
+
+  for (size_t offset = 0; offset < 64 / sizeof(T) + 1; ++offset)
+  {
+    thrust::host_vector<T> h_result(n + offset);
+    thrust::device_vector<T> d_result(n + offset);
+
+    std::transform(h_x.begin(), h_x.end(), h_result.begin() + offset, ::cuda::std::negate<T>());
+    thrust::transform(d_x.begin(), d_x.end(), d_result.begin() + offset, ::cuda::std::negate<T>());
+    ASSERT_EQUAL(h_result, d_result);
+
+    std::transform(h_x.begin(), h_x.end(), h_y.begin(), h_result.begin() + offset, saxpy<T>{T(3)});
+    thrust::transform(d_x.begin(), d_x.end(), d_y.begin(), d_result.begin() + offset, saxpy<T>{T(3)});
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  // in place
+  thrust::host_vector<T> h_data   = h_x;
+  thrust::device_vector<T> d_data = d_x;
+  std::transform(h_data.begin(), h_data.end(), h_y.begin(), h_data.begin(), saxpy<T>{T(2)});
+  thrust::transform(d_data.begin(), d_data.end(), d_y.begin(), d_data.begin(), saxpy<T>{T(2)});
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_VARIABLE_UNITTEST(TestStreamingStoreTransform);
@@ -0,0 +1,2 @@
+# The algorithm entry points are only instrumented when tracing is enabled. A small buffer lets the tests overflow it.
+target_compile_definitions(${test_target} PRIVATE THRUST_ENABLE_TRACING THRUST_TRACING_BUFFER_SIZE=64)
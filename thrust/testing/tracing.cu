@@ -0,0 +1,406 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tracing.h>
+#include <thrust/transform.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+namespace
+{
+
+// Distinct functor types keep the traced instantiations separate from the ones in the test framework.
+struct tracing_plus
+{
+  _CCCL_HOST_DEVICE int operator()(int a, int b) const
+  {
+    return a + b;
+  }
+};
+
+struct tracing_less
+{
+  _CCCL_HOST_DEVICE bool operator()(int a, int b) const
+  {
+    return a < b;
+  }
+};
+
+struct tracing_negate
+{
+  _CCCL_HOST_DEVICE int operator()(int x) const
+  {
+    return -x;
+  }
+};
+
+struct tracing_is_odd
+{
+  _CCCL_HOST_DEVICE bool operator()(int x) const
+  {
+    return x % 2 != 0;
+  }
+};
+
+// Invokes a traced algorithm from inside another algorithm, in device code for the CUDA system.
+struct tracing_nested_reduce
+{
+  const int* data;
+  int* sums;
+
+  _CCCL_HOST_DEVICE void operator()(int i) const
+  {
+    sums[i] = thrust::reduce(thrust::seq, data, data + i + 1, 0, tracing_plus{});
+  }
+};
+
+std::size_t count_events(const std::vector<thrust::tracing::event>& events, const char* name)
+{
+  std::size_t count = 0;
+  for (const auto& e : events)
+  {
+    count += std::strcmp(e.name, name) == 0 ? 1 : 0;
+  }
+  return count;
+}
+
+const thrust::tracing::event* find_event(const std::vector<thrust::tracing::event>& events, const char* name)
+{
+  for (const auto& e : events)
+  {
+    if (std::strcmp(e.name, name) == 0)
+    {
+      return &e;
+    }
+  }
+  return nullptr;
+}
+
+const char* expected_system()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return "tbb";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+  return "cuda";
+#else
+  return "cpp";
+#endif
+}
+
+} // namespace
+
+void TestTracingRecordsAlgorithms()
+{
+  thrust::host_vector<int> h(1000, 1);
+  thrust::device_vector<int> d(h);
+
+  // constructing the vectors runs algorithms as well
+  thrust::tracing::clear();
+
+  int sum = thrust::reduce(thrust::host, h.begin(), h.end(), 0, tracing_plus{});
+  ASSERT_EQUAL(sum, 1000);
+  sum = thrust::reduce(thrust::device, d.begin(), d.end(), 0, tracing_plus{});
+  ASSERT_EQUAL(sum, 1000);
+
+  const auto events = thrust::tracing::events();
+  ASSERT_EQUAL(events.size() >= 2, true);
+
+  const thrust::tracing::event& host_event = events.front();
+  ASSERT_EQUAL(std::string(host_event.name), "thrust::reduce");
+  ASSERT_EQUAL(std::string(host_event.system), "cpp");
+  ASSERT_EQUAL(host_event.elements, 1000);
+  ASSERT_EQUAL(host_event.depth, 0u);
+
+  bool found_device_event = false;
+  for (const auto& e : events)
+  {
+    if (std::string(e.name) == "thrust::reduce" && std::string(e.system) == expected_system())
+    {
+      ASSERT_EQUAL(e.elements, 1000);
+      found_device_event = true;
+    }
+  }
+  ASSERT_EQUAL(found_device_event, true);
+
+  thrust::tracing::clear();
+  ASSERT_EQUAL(thrust::tracing::events().size(), 0u);
+}
+DECLARE_UNITTEST(TestTracingRecordsAlgorithms);
+
+void TestTracingElementCounts()
+{
+  thrust::tracing::clear();
+
+  thrust::host_vector<int> a(100), b(30), result(130);
+  thrust::fill_n(thrust::host, a.begin(), 100, 0);
+  thrust::fill_n(thrust::host, b.begin(), 30, 1);
+  thrust::merge(thrust::host, a.begin(), a.end(), b.begin(), b.end(), result.begin(), tracing_less{});
+
+  // counting_iterator is random access, so the count is known without traversing the range
+  thrust::counting_iterator<int> first(0);
+  const int sum = thrust::reduce(thrust::host, first, first + 10, 0, tracing_plus{});
+  ASSERT_EQUAL(sum, 45);
+
+  const auto events = thrust::tracing::events();
+
+  const thrust::tracing::event* fill_event = find_event(events, "thrust::fill_n");
+  ASSERT_EQUAL(fill_event != nullptr, true);
+  ASSERT_EQUAL(fill_event->elements, 100);
+
+  const thrust::tracing::event* merge_event = find_event(events, "thrust::merge");
+  ASSERT_EQUAL(merge_event != nullptr, true);
+  ASSERT_EQUAL(merge_event->elements, 130);
+
+  const thrust::tracing::event* reduce_event = find_event(events, "thrust::reduce");
+  ASSERT_EQUAL(reduce_event != nullptr, true);
+  ASSERT_EQUAL(reduce_event->elements, 10);
+}
+DECLARE_UNITTEST(TestTracingElementCounts);
+
+void TestTracingTemporaryStorage()
+{
+  thrust::tracing::clear();
+
+  thrust::device_vector<int> keys = unittest::random_integers<int>(10000);
+  thrust::stable_sort(thrust::device, keys.begin(), keys.end(), tracing_less{});
+  ASSERT_EQUAL(thrust::is_sorted(keys.begin(), keys.end()), true);
+
+  std::uint64_t temporary_bytes = 0;
+  for (const auto& e : thrust::tracing::events())
+  {
+    temporary_bytes += e.temporary_bytes;
+  }
+  // merge sort needs at least a buffer of the size of the input
+  ASSERT_EQUAL(temporary_bytes >= 10000 * sizeof(int), true);
+}
+DECLARE_UNITTEST(TestTracingTemporaryStorage);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+void TestTracingSequentialFallback()
+{
+  thrust::tracing::clear();
+
+  thrust::device_vector<int> vec(1000, 1);
+  thrust::inclusive_scan(thrust::device, vec.begin(), vec.end(), vec.begin(), tracing_plus{});
+  ASSERT_EQUAL(vec.back(), 1000);
+
+  const thrust::tracing::event* scan_event = find_event(thrust::tracing::events(), "thrust::inclusive_scan");
+  ASSERT_EQUAL(scan_event != nullptr, true);
+  ASSERT_EQUAL(std::string(scan_event->system), "omp");
+  ASSERT_EQUAL(scan_event->sequential_fallback, true);
+
+  const auto counters = thrust::tracing::summary();
+  ASSERT_EQUAL(counters.empty(), false);
+}
+DECLARE_UNITTEST(TestTracingSequentialFallback);
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+
+void TestTracingExport()
+{
+  thrust::host_vector<int> vec(64, 2);
+  thrust::tracing::clear();
+
+  thrust::reduce(thrust::host, vec.begin(), vec.end(), 0, tracing_plus{});
+
+  std::ostringstream trace;
+  thrust::tracing::write_chrome_trace(trace);
+  ASSERT_EQUAL(trace.str().find("\"traceEvents\"") != std::string::npos, true);
+  ASSERT_EQUAL(trace.str().find("\"name\":\"thrust::reduce\"") != std::string::npos, true);
+
+  const auto counters = thrust::tracing::summary();
+  ASSERT_EQUAL(counters.size(), 1u);
+  ASSERT_EQUAL(counters[0].calls, 1u);
+  ASSERT_EQUAL(counters[0].elements, 64u);
+
+  std::ostringstream table;
+  thrust::tracing::write_summary(table);
+  ASSERT_EQUAL(table.str().find("| thrust::reduce | cpp | 1 |") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestTracingExport);
+
+void TestTracingForwardingAlgorithms()
+{
+  thrust::host_vector<int> vec(100, 1), result(100);
+  thrust::tracing::clear();
+
+  thrust::transform_n(thrust::host, vec.begin(), 100, result.begin(), tracing_negate{});
+  ASSERT_EQUAL(result[99], -1);
+  thrust::transform_if_n(thrust::host, vec.begin(), 50, result.begin(), tracing_negate{}, tracing_is_odd{});
+
+  // transform_n and transform_if_n forward to transform and transform_if, which must not be recorded a second time
+  std::vector<thrust::tracing::event> events;
+  for (const auto& e : thrust::tracing::events())
+  {
+    ASSERT_EQUAL(std::string(e.name) != "thrust::transform" && std::string(e.name) != "thrust::transform_if", true);
+    if (e.depth == 0)
+    {
+      events.push_back(e);
+    }
+  }
+  ASSERT_EQUAL(events.size(), 2u);
+  ASSERT_EQUAL(std::string(events[0].name), "thrust::transform_n");
+  ASSERT_EQUAL(events[0].elements, 100);
+  ASSERT_EQUAL(std::string(events[1].name), "thrust::transform_if_n");
+  ASSERT_EQUAL(events[1].elements, 50);
+}
+DECLARE_UNITTEST(TestTracingForwardingAlgorithms);
+
+void TestTracingNestedAlgorithms()
+{
+  // fewer calls than THRUST_TRACING_BUFFER_SIZE, so no event is overwritten even if one thread executes all of them
+  constexpr int n = 32;
+  thrust::device_vector<int> data(n, 1), sums(n);
+  thrust::tracing::clear();
+
+  const tracing_nested_reduce op{thrust::raw_pointer_cast(data.data()), thrust::raw_pointer_cast(sums.data())};
+  thrust::for_each_n(thrust::device, thrust::counting_iterator<int>(0), n, op);
+  ASSERT_EQUAL(sums[n - 1], n);
+
+  const auto events = thrust::tracing::events();
+  ASSERT_EQUAL(count_events(events, "thrust::for_each_n"), 1u);
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  // the nested calls are recorded by the threads of the device system, but not in device code
+  ASSERT_EQUAL(count_events(events, "thrust::reduce"), static_cast<std::size_t>(n));
+  for (const auto& e : events)
+  {
+    if (std::strcmp(e.name, "thrust::reduce") == 0)
+    {
+      ASSERT_EQUAL(std::string(e.system), "seq");
+    }
+  }
+#endif // THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+}
+DECLARE_UNITTEST(TestTracingNestedAlgorithms);
+
+void TestTracingSummary()
+{
+  thrust::host_vector<int> vec(60, 1);
+  thrust::tracing::clear();
+
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 10, 0, tracing_plus{});
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 20, 0, tracing_plus{});
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 30, 0, tracing_plus{});
+  thrust::fill_n(thrust::host, vec.begin(), 5, 2);
+  thrust::fill_n(thrust::host, vec.begin(), 7, 3);
+
+  std::uint64_t total_ns = 0;
+  for (const auto& e : thrust::tracing::events())
+  {
+    total_ns += e.duration_ns;
+  }
+
+  const auto counters = thrust::tracing::summary();
+  ASSERT_EQUAL(counters.size(), 2u);
+  ASSERT_EQUAL(counters[0].total_ns >= counters[1].total_ns, true);
+  ASSERT_EQUAL(counters[0].total_ns + counters[1].total_ns, total_ns);
+  for (const auto& c : counters)
+  {
+    ASSERT_EQUAL(std::string(c.system), "cpp");
+    ASSERT_EQUAL(c.sequential_fallbacks, 0u);
+    if (std::string(c.name) == "thrust::reduce")
+    {
+      ASSERT_EQUAL(c.calls, 3u);
+      ASSERT_EQUAL(c.elements, 60u);
+    }
+    else
+    {
+      ASSERT_EQUAL(std::string(c.name), "thrust::fill_n");
+      ASSERT_EQUAL(c.calls, 2u);
+      ASSERT_EQUAL(c.elements, 12u);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTracingSummary);
+
+void TestTracingBufferOverflow()
+{
+  // tracing.cmake shrinks the buffer, so that it overflows quickly
+  static_assert(THRUST_TRACING_BUFFER_SIZE == 64);
+  constexpr int calls = 3 * THRUST_TRACING_BUFFER_SIZE / 2;
+
+  thrust::tracing::clear();
+  thrust::counting_iterator<int> first(0);
+  for (int i = 1; i <= calls; ++i)
+  {
+    thrust::reduce(thrust::host, first, first + i, 0, tracing_plus{});
+  }
+
+  // only the most recent events are retained
+  const auto events = thrust::tracing::events();
+  ASSERT_EQUAL(events.size(), static_cast<std::size_t>(THRUST_TRACING_BUFFER_SIZE));
+  for (std::size_t i = 0; i < events.size(); ++i)
+  {
+    ASSERT_EQUAL(events[i].elements, static_cast<std::int64_t>(calls - THRUST_TRACING_BUFFER_SIZE + 1 + i));
+  }
+
+  thrust::tracing::clear();
+  ASSERT_EQUAL(thrust::tracing::events().size(), 0u);
+  thrust::reduce(thrust::host, first, first + 3, 0, tracing_plus{});
+  ASSERT_EQUAL(thrust::tracing::events().size(), 1u);
+}
+DECLARE_UNITTEST(TestTracingBufferOverflow);
+
+void TestTracingConcurrentExport()
+{
+  thrust::tracing::clear();
+  thrust::counting_iterator<int> first(0);
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int i = 1; i <= 4 * THRUST_TRACING_BUFFER_SIZE; ++i)
+    {
+      thrust::reduce(thrust::host, first, first + i, 0, tracing_plus{});
+    }
+    done = true;
+  });
+
+  // events exported while the writer pushes are complete
+  while (!done)
+  {
+    for (const auto& e : thrust::tracing::events())
+    {
+      ASSERT_EQUAL(std::string(e.name), "thrust::reduce");
+      ASSERT_EQUAL(e.elements > 0 && e.elements <= 4 * THRUST_TRACING_BUFFER_SIZE, true);
+    }
+    thrust::tracing::clear();
+  }
+  writer.join();
+}
+DECLARE_UNITTEST(TestTracingConcurrentExport);
+
+void TestTracingRecyclesThreadBuffers()
+{
+  thrust::tracing::clear();
+  thrust::counting_iterator<int> first(0);
+  for (int i = 1; i <= 8; ++i)
+  {
+    std::thread([&] {
+      thrust::reduce(thrust::host, first, first + i, 0, tracing_plus{});
+    }).join();
+  }
+
+  // every thread appended to the buffer the thread before it left behind
+  const auto events = thrust::tracing::events();
+  ASSERT_EQUAL(events.size(), 8u);
+  for (const auto& e : events)
+  {
+    ASSERT_EQUAL(e.thread, events[0].thread);
+  }
+}
+DECLARE_UNITTEST(TestTracingRecyclesThreadBuffers);
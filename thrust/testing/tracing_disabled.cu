@@ -0,0 +1,29 @@
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/tracing.h>
+#include <thrust/transform.h>
+
+#include <unittest/unittest.h>
+
+struct tracing_disabled_negate
+{
+  _CCCL_HOST_DEVICE int operator()(int x) const
+  {
+    return -x;
+  }
+};
+
+void TestTracingDisabled()
+{
+  static_assert(!thrust::tracing::enabled);
+
+  thrust::host_vector<int> vec(64, 2), result(64);
+  ASSERT_EQUAL(thrust::reduce(thrust::host, vec.begin(), vec.end()), 128);
+  thrust::transform_n(thrust::host, vec.begin(), 64, result.begin(), tracing_disabled_negate{});
+  ASSERT_EQUAL(result[63], -2);
+
+  ASSERT_EQUAL(thrust::tracing::events().size(), 0u);
+  ASSERT_EQUAL(thrust::tracing::summary().size(), 0u);
+}
+DECLARE_UNITTEST(TestTracingDisabled);
@@ -3,6 +3,10 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/unique.h>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#endif
+
 #include <unittest/unittest.h>
 
 template <typename ValueT>
@@ -388,6 +392,122 @@ struct TestUniqueCopyByKeyToDiscardIterator
 };
 VariableUnitTest<TestUniqueCopyByKeyToDiscardIterator, IntegralTypes> TestUniqueCopyByKeyToDiscardIteratorInstance;
 
+void TestUniqueByKeyLongSegments()
+{
+  using K = int;
+  using V = unsigned int;
+
+  // segments much longer than the intervals a parallel system processes separately, so that they span several of them
+  const size_t n = 1 << 20;
+
+  for (size_t segment_size : {size_t{1}, size_t{3}, size_t{1000}, size_t{100000}, n})
+  {
+    thrust::host_vector<K> h_keys(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<K>(i / segment_size);
+    }
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+    auto d_copy_last = thrust::unique_by_key_copy(
+      d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin());
+
+    auto h_last = thrust::unique_by_key(h_keys.begin(), h_keys.end(), h_vals.begin());
+    auto d_last = thrust::unique_by_key(d_keys.begin(), d_keys.end(), d_vals.begin());
+
+    const size_t num_segments = (n + segment_size - 1) / segment_size;
+    ASSERT_EQUAL(num_segments, static_cast<size_t>(d_last.first - d_keys.begin()));
+    ASSERT_EQUAL(num_segments, static_cast<size_t>(d_copy_last.second - d_vals_output.begin()));
+    ASSERT_EQUAL(h_last.second - h_vals.begin(), d_last.second - d_vals.begin());
+
+    h_keys.resize(num_segments);
+    h_vals.resize(num_segments);
+    d_keys.resize(num_segments);
+    d_vals.resize(num_segments);
+    d_keys_output.resize(num_segments);
+    d_vals_output.resize(num_segments);
+
+    ASSERT_EQUAL(h_keys, d_keys);
+    ASSERT_EQUAL(h_vals, d_vals);
+    ASSERT_EQUAL(h_keys, d_keys_output);
+    ASSERT_EQUAL(h_vals, d_vals_output);
+  }
+}
+DECLARE_UNITTEST(TestUniqueByKeyLongSegments);
+
+// Keys are equivalent to the first key of their segment if they differ by at most one, which is not transitive, so
+// where a segment ends depends on where it starts.
+struct is_near_unique_by_key
+{
+  _CCCL_HOST_DEVICE bool operator()(int x, int y) const
+  {
+    return x - y <= 1 && y - x <= 1;
+  }
+};
+
+void check_unique_by_key_non_transitive(
+  const thrust::host_vector<int>& keys, const thrust::host_vector<int>& vals)
+{
+  thrust::host_vector<int> h_keys   = keys;
+  thrust::host_vector<int> h_vals   = vals;
+  thrust::device_vector<int> d_keys = keys;
+  thrust::device_vector<int> d_vals = vals;
+
+  thrust::device_vector<int> d_keys_output(keys.size());
+  thrust::device_vector<int> d_vals_output(keys.size());
+  auto d_copy_last = thrust::unique_by_key_copy(
+    d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin(), is_near_unique_by_key{});
+
+  auto h_last = thrust::unique_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), is_near_unique_by_key{});
+  auto d_last = thrust::unique_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), is_near_unique_by_key{});
+
+  const auto num_segments = h_last.first - h_keys.begin();
+  ASSERT_EQUAL(num_segments, d_last.first - d_keys.begin());
+  ASSERT_EQUAL(num_segments, d_copy_last.first - d_keys_output.begin());
+
+  h_keys.resize(num_segments);
+  h_vals.resize(num_segments);
+  d_keys.resize(num_segments);
+  d_vals.resize(num_segments);
+  d_keys_output.resize(num_segments);
+  d_vals_output.resize(num_segments);
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_vals, d_vals);
+  ASSERT_EQUAL(h_keys, d_keys_output);
+  ASSERT_EQUAL(h_vals, d_vals_output);
+}
+
+void TestUniqueByKeyNonTransitivePredicate()
+{
+  // longer than the intervals a parallel system processes separately, whose ends do not line up with the segments
+  const size_t n = 1 << 18;
+
+  thrust::host_vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>(i / 3);
+  }
+  const thrust::host_vector<int> vals = unittest::random_integers<int>(n);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const int previous = omp_get_max_threads();
+  for (int threads : {2, 3, 8})
+  {
+    omp_set_num_threads(threads);
+    check_unique_by_key_non_transitive(keys, vals);
+  }
+  omp_set_num_threads(previous);
+#else
+  check_unique_by_key_non_transitive(keys, vals);
+#endif
+}
+DECLARE_UNITTEST(TestUniqueByKeyNonTransitivePredicate);
+
 // OpenMP has issues with these tests, NVIDIA/cccl#1715
 #if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_OMP
 
@@ -0,0 +1,407 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file thrust/async.h
+ *  \brief Algorithms which run in the background and return a future
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/async_state.h>
+#include <thrust/detail/event_error.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/type_traits>
+
+#include <memory>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+struct async_future_access;
+
+template <typename T, typename Function>
+struct async_continuation_result
+{
+  using type = ::cuda::std::decay_t<::cuda::std::invoke_result_t<Function&, T>>;
+};
+
+template <typename Function>
+struct async_continuation_result<void, Function>
+{
+  using type = ::cuda::std::decay_t<::cuda::std::invoke_result_t<Function&>>;
+};
+
+template <typename T, typename Function>
+using async_continuation_result_t = typename async_continuation_result<T, Function>::type;
+
+} // end namespace detail
+
+namespace async
+{
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+/*! \p future refers to the result of an operation started by one of the algorithms of \p thrust::async, which runs in
+ *  the background on the thread pool of the system of its execution policy. The omp system runs the operation on one
+ *  of \p THRUST_OMP_ASYNC_NUM_THREADS threads, which use OpenMP for the parallel parts of the operation, and the tbb
+ *  system enqueues it to the TBB scheduler. Other systems complete the operation before returning its \p future.
+ *  Since the threads are shared, an operation should chain on another one with \p then instead of waiting for it.
+ *
+ *  Like a <tt>std::future</tt> returned by <tt>std::async</tt>, a \p future waits for its operation to complete when
+ *  it is destroyed, so that the operation never outlives the data it uses. \p then chains a further operation which
+ *  starts when the operation completes, without blocking the calling thread.
+ *
+ *  Operations on a \p future without a state, such as a default constructed or moved-from one, or one whose result
+ *  has been retrieved with \p get, throw \p thrust::event_error with \p event_errc::no_state.
+ *
+ *  \tparam T The type of the result, or \c void.
+ */
+template <typename T>
+class future
+{
+public:
+  //! The type of the result.
+  using value_type = T;
+
+  /*! Constructs a \p future without a state.
+   */
+  future() = default;
+
+  future(future&& other) noexcept = default;
+
+  /*! Waits for the operation of this \p future to complete, if any, and then takes over the state of \p other.
+   */
+  _CCCL_HOST future& operator=(future&& other)
+  {
+    if (this != &other)
+    {
+      release();
+      m_state  = std::move(other.m_state);
+      m_launch = std::move(other.m_launch);
+    }
+    return *this;
+  }
+
+  /*! Waits for the operation of this \p future to complete, if any.
+   */
+  _CCCL_HOST ~future()
+  {
+    release();
+  }
+
+  /*! \return \c true if this \p future refers to an operation.
+   */
+  _CCCL_HOST bool valid() const noexcept
+  {
+    return static_cast<bool>(m_state);
+  }
+
+  /*! \return \c true if the operation has completed, so that \p get does not block.
+   */
+  _CCCL_HOST bool is_ready() const
+  {
+    validate();
+    return m_state->is_ready();
+  }
+
+  /*! Blocks until the operation has completed.
+   */
+  _CCCL_HOST void wait() const
+  {
+    validate();
+    m_state->wait();
+  }
+
+  /*! Blocks until the operation has completed and returns its result, or rethrows the exception it threw. Afterwards,
+   *  this \p future has no state.
+   */
+  _CCCL_HOST T get()
+  {
+    validate();
+    const std::shared_ptr<thrust::detail::async_state<T>> state = std::move(m_state);
+    return state->get();
+  }
+
+  /*! Chains a continuation to the operation of this \p future and returns a \p future referring to it. When the
+   *  operation completes, the continuation is invoked with its result, or without arguments if \p T is \c void, on the
+   *  thread which completed the operation. If the operation has completed already, the continuation is submitted to
+   *  the same thread pool as the operation. If the operation throws, the continuation is not invoked and the returned
+   *  \p future rethrows the exception. Afterwards, this \p future has no state.
+   *
+   *  \param f The continuation, a \c CopyConstructible function object.
+   *  \return A \p future referring to the result of \p f.
+   */
+  template <typename Function>
+  _CCCL_HOST future<thrust::detail::async_continuation_result_t<T, Function>> then(Function f) &&
+  {
+    using result_type = thrust::detail::async_continuation_result_t<T, Function>;
+
+    validate();
+
+    auto next = std::make_shared<thrust::detail::async_state<result_type>>();
+
+    thrust::detail::async_task task = [prev = m_state, next, f]() mutable {
+      auto step = [&]() -> result_type {
+        if constexpr (::cuda::std::is_void_v<T>)
+        {
+          prev->get();
+          return f();
+        }
+        else
+        {
+          return f(prev->get());
+        }
+      };
+      thrust::detail::run_async_task(*next, step);
+    };
+
+    if (!m_state->defer(task))
+    {
+      m_launch(std::move(task));
+    }
+    m_state.reset();
+
+    return future<result_type>(std::move(next), m_launch);
+  }
+
+private:
+  template <typename>
+  friend class future;
+  friend struct thrust::detail::async_future_access;
+
+  _CCCL_HOST future(std::shared_ptr<thrust::detail::async_state<T>> state, thrust::detail::async_launcher launch)
+      : m_state(std::move(state))
+      , m_launch(std::move(launch))
+  {}
+
+  _CCCL_HOST void validate() const
+  {
+    if (!m_state)
+    {
+      throw thrust::event_error(event_errc::no_state);
+    }
+  }
+
+  _CCCL_HOST void release()
+  {
+    if (m_state)
+    {
+      m_state->wait();
+      m_state.reset();
+    }
+  }
+
+  std::shared_ptr<thrust::detail::async_state<T>> m_state;
+  thrust::detail::async_launcher m_launch;
+};
+
+/*! \p launch invokes \p f in the background on the thread pool of the system of \p exec, and returns a \p future
+ *  referring to its result. Use \p launch to run a sequence of algorithms with the same policy as a single operation.
+ *
+ *  \param exec The execution policy which selects the thread pool.
+ *  \param f A \c CopyConstructible function object invoked without arguments.
+ *  \return A \p future referring to the result of <tt>f()</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *
+ *  The following code snippet demonstrates how to use \p launch and \p future::then to sort and then sum a range on
+ *  the TBB thread pool while the calling thread does other work:
+ *
+ *  \code
+ *  #include <thrust/async.h>
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/system/tbb/execution_policy.h>
+ *  ...
+ *  std::vector<int> v = ...;
+ *
+ *  thrust::async::future<int> sum = thrust::async::sort(thrust::tbb::par, v.begin(), v.end()).then([&] {
+ *    return thrust::reduce(thrust::tbb::par, v.begin(), v.end());
+ *  });
+ *
+ *  // do other work
+ *
+ *  int result = sum.get();
+ *  \endcode
+ */
+template <typename DerivedPolicy, typename Function>
+_CCCL_HOST future<::cuda::std::decay_t<::cuda::std::invoke_result_t<Function&>>>
+launch(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, Function f);
+
+/*! \p for_each is the asynchronous version of \p thrust::for_each. It applies \p f to each element of
+ *  <tt>[first, last)</tt> in the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param f The function object to apply.
+ *  \return A \p future which is ready when \p f has been applied to all elements.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::for_each
+ */
+template <typename DerivedPolicy, typename InputIterator, typename UnaryFunction>
+_CCCL_HOST future<void> for_each(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  UnaryFunction f);
+
+/*! \p copy is the asynchronous version of \p thrust::copy. It copies <tt>[first, last)</tt> to the range beginning at
+ *  \p result in the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to copy.
+ *  \param last The end of the sequence to copy.
+ *  \param result The beginning of the destination sequence.
+ *  \return A \p future referring to the end of the destination sequence.
+ *
+ *  \pre Both sequences shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::copy
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
+_CCCL_HOST future<OutputIterator> copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result);
+
+/*! \p transform is the asynchronous version of \p thrust::transform. It writes <tt>op(x)</tt> for each element \c x
+ *  of <tt>[first, last)</tt> to the range beginning at \p result in the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result The beginning of the output sequence.
+ *  \param op The transformation.
+ *  \return A \p future referring to the end of the output sequence.
+ *
+ *  \pre Both sequences shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::transform
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename UnaryFunction>
+_CCCL_HOST future<OutputIterator> transform(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  UnaryFunction op);
+
+/*! \p reduce is the asynchronous version of \p thrust::reduce. It sums the elements of <tt>[first, last)</tt> in the
+ *  background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \return A \p future referring to the sum.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::reduce
+ */
+template <typename DerivedPolicy, typename InputIterator>
+_CCCL_HOST future<thrust::detail::it_value_t<InputIterator>>
+reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last);
+
+/*! \p reduce is the asynchronous version of \p thrust::reduce. It sums \p init and the elements of
+ *  <tt>[first, last)</tt> in the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param init The initial value.
+ *  \return A \p future referring to the sum.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::reduce
+ */
+template <typename DerivedPolicy, typename InputIterator, typename T>
+_CCCL_HOST future<T> reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init);
+
+/*! \p reduce is the asynchronous version of \p thrust::reduce. It reduces \p init and the elements of
+ *  <tt>[first, last)</tt> with \p binary_op in the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param init The initial value.
+ *  \param binary_op The associative operator of the reduction.
+ *  \return A \p future referring to the reduction.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::reduce
+ */
+template <typename DerivedPolicy, typename InputIterator, typename T, typename BinaryFunction>
+_CCCL_HOST future<T>
+reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+       InputIterator first,
+       InputIterator last,
+       T init,
+       BinaryFunction binary_op);
+
+/*! \p sort is the asynchronous version of \p thrust::sort. It sorts <tt>[first, last)</tt> into ascending order in
+ *  the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \return A \p future which is ready when the sequence is sorted.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST future<void> sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                             RandomAccessIterator first,
+                             RandomAccessIterator last);
+
+/*! \p sort is the asynchronous version of \p thrust::sort. It sorts <tt>[first, last)</tt> with respect to \p comp in
+ *  the background.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param comp The comparison operator.
+ *  \return A \p future which is ready when the sequence is sorted.
+ *
+ *  \pre The sequence shall remain valid until the operation completes.
+ *
+ *  \see \p thrust::sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST future<void> sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+/*! \} // end execution_policies
+ */
+
+} // end namespace async
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/async.inl>
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/system/detail/adl/adjacent_difference.h>
 #include <thrust/system/detail/generic/adjacent_difference.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -40,6 +41,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_TRACE_SCOPE("thrust::adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_TRACE_SCOPE("thrust::adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(
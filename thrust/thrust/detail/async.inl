@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/async.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/adl/async_launch.h>
+#include <thrust/system/detail/generic/async_launch.h>
+#include <thrust/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+struct async_future_access
+{
+  template <typename T>
+  _CCCL_HOST static async::future<T> make(std::shared_ptr<async_state<T>> state, async_launcher launch)
+  {
+    return async::future<T>(std::move(state), std::move(launch));
+  }
+};
+
+template <typename DerivedPolicy>
+_CCCL_HOST async_launcher make_async_launcher(DerivedPolicy policy)
+{
+  return [policy](async_task task) mutable {
+    using thrust::system::detail::generic::async_launch;
+    async_launch(policy, std::move(task));
+  };
+}
+
+} // end namespace detail
+
+namespace async
+{
+
+template <typename DerivedPolicy, typename Function>
+_CCCL_HOST future<::cuda::std::decay_t<::cuda::std::invoke_result_t<Function&>>>
+launch(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, Function f)
+{
+  using result_type = ::cuda::std::decay_t<::cuda::std::invoke_result_t<Function&>>;
+
+  thrust::detail::async_launcher launcher =
+    thrust::detail::make_async_launcher(thrust::detail::derived_cast(thrust::detail::strip_const(exec)));
+
+  auto state = std::make_shared<thrust::detail::async_state<result_type>>();
+  launcher([state, f]() mutable {
+    thrust::detail::run_async_task(*state, f);
+  });
+
+  return thrust::detail::async_future_access::make(std::move(state), std::move(launcher));
+} // end launch()
+
+template <typename DerivedPolicy, typename InputIterator, typename UnaryFunction>
+_CCCL_HOST future<void> for_each(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  UnaryFunction f)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, f] {
+    thrust::for_each(policy, first, last, f);
+  });
+} // end for_each()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
+_CCCL_HOST future<OutputIterator> copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, result] {
+    return thrust::copy(policy, first, last, result);
+  });
+} // end copy()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename UnaryFunction>
+_CCCL_HOST future<OutputIterator> transform(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  UnaryFunction op)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, result, op] {
+    return thrust::transform(policy, first, last, result, op);
+  });
+} // end transform()
+
+template <typename DerivedPolicy, typename InputIterator>
+_CCCL_HOST future<thrust::detail::it_value_t<InputIterator>>
+reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last] {
+    return thrust::reduce(policy, first, last);
+  });
+} // end reduce()
+
+template <typename DerivedPolicy, typename InputIterator, typename T>
+_CCCL_HOST future<T> reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, init] {
+    return thrust::reduce(policy, first, last, init);
+  });
+} // end reduce()
+
+template <typename DerivedPolicy, typename InputIterator, typename T, typename BinaryFunction>
+_CCCL_HOST future<T>
+reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+       InputIterator first,
+       InputIterator last,
+       T init,
+       BinaryFunction binary_op)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, init, binary_op] {
+    return thrust::reduce(policy, first, last, init, binary_op);
+  });
+} // end reduce()
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST future<void> sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                             RandomAccessIterator first,
+                             RandomAccessIterator last)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last] {
+    thrust::sort(policy, first, last);
+  });
+} // end sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST future<void> sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  DerivedPolicy policy = thrust::detail::derived_cast(exec);
+  return async::launch(exec, [policy, first, last, comp] {
+    thrust::sort(policy, first, last, comp);
+  });
+} // end sort()
+
+} // end namespace async
+THRUST_NAMESPACE_END
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/optional>
+#include <cuda/std/type_traits>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// A task submitted to the thread pool of a system.
+using async_task = std::function<void()>;
+
+// Submits a task to the thread pool of the system of the execution policy the launcher was created from.
+using async_launcher = std::function<void(async_task)>;
+
+// The state an asynchronous operation shares with its future. It becomes ready once, when the operation produces a
+// value or throws, and then runs the continuation registered on it, if any, on the thread which made it ready.
+class async_state_base
+{
+public:
+  async_state_base()                        = default;
+  async_state_base(const async_state_base&) = delete;
+  async_state_base& operator=(const async_state_base&) = delete;
+
+  _CCCL_HOST bool is_ready() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_ready;
+  }
+
+  _CCCL_HOST void wait() const
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_ready_cv.wait(lock, [this] {
+      return m_ready;
+    });
+  }
+
+  // Registers continuation to run when the state becomes ready and returns true, or returns false and leaves
+  // continuation alone if the state is ready already.
+  _CCCL_HOST bool defer(async_task& continuation)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_ready)
+    {
+      return false;
+    }
+    m_continuation = std::move(continuation);
+    return true;
+  }
+
+  _CCCL_HOST void set_exception(std::exception_ptr error)
+  {
+    m_error = std::move(error);
+    make_ready();
+  }
+
+protected:
+  ~async_state_base() = default;
+
+  _CCCL_HOST void make_ready()
+  {
+    async_task continuation;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_ready      = true;
+      continuation = std::move(m_continuation);
+    }
+    m_ready_cv.notify_all();
+
+    if (continuation)
+    {
+      continuation();
+    }
+  }
+
+  _CCCL_HOST void rethrow_if_failed() const
+  {
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_ready_cv;
+  bool m_ready = false;
+  async_task m_continuation;
+  std::exception_ptr m_error;
+};
+
+template <typename T>
+class async_state : public async_state_base
+{
+public:
+  _CCCL_HOST void set_value(T value)
+  {
+    m_value.emplace(std::move(value));
+    make_ready();
+  }
+
+  // Waits for the state to become ready, and then moves its value out or rethrows the exception of the operation.
+  _CCCL_HOST T get()
+  {
+    wait();
+    rethrow_if_failed();
+    return std::move(*m_value);
+  }
+
+private:
+  ::cuda::std::optional<T> m_value;
+};
+
+template <>
+class async_state<void> : public async_state_base
+{
+public:
+  _CCCL_HOST void set_value()
+  {
+    make_ready();
+  }
+
+  _CCCL_HOST void get()
+  {
+    wait();
+    rethrow_if_failed();
+  }
+};
+
+// Makes state ready with the result of f() or with the exception it throws.
+template <typename T, typename Function>
+_CCCL_HOST void run_async_task(async_state<T>& state, Function& f)
+{
+  if constexpr (::cuda::std::is_void_v<T>)
+  {
+    try
+    {
+      f();
+    }
+    catch (...)
+    {
+      state.set_exception(std::current_exception());
+      return;
+    }
+    state.set_value();
+  }
+  else
+  {
+    ::cuda::std::optional<T> value;
+    try
+    {
+      value.emplace(f());
+    }
+    catch (...)
+    {
+      state.set_exception(std::current_exception());
+      return;
+    }
+    state.set_value(std::move(*value));
+  }
+}
+
+} // end namespace detail
+THRUST_NAMESPACE_END
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/binary_search.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/binary_search.h>
 #include <thrust/system/detail/generic/binary_search.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_TRACE_SCOPE("thrust::lower_bound", exec, first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_TRACE_SCOPE("thrust::lower_bound", exec, first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -69,6 +72,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_TRACE_SCOPE("thrust::upper_bound", exec, first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -83,6 +87,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_TRACE_SCOPE("thrust::upper_bound", exec, first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -96,6 +101,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_TRACE_SCOPE("thrust::binary_search", exec, first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -110,6 +116,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_TRACE_SCOPE("thrust::binary_search", exec, first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -124,6 +131,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> equal_range(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_TRACE_SCOPE("thrust::equal_range", exec, first, last);
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -137,6 +145,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> equal_range(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_TRACE_SCOPE("thrust::equal_range", exec, first, last);
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -152,6 +161,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_TRACE_SCOPE("thrust::lower_bound", exec, first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -173,6 +183,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_TRACE_SCOPE("thrust::lower_bound", exec, first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -195,6 +206,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_TRACE_SCOPE("thrust::upper_bound", exec, first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -216,6 +228,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_TRACE_SCOPE("thrust::upper_bound", exec, first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -238,6 +251,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_TRACE_SCOPE("thrust::binary_search", exec, first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -259,6 +273,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_TRACE_SCOPE("thrust::binary_search", exec, first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
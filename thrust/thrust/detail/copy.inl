@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/system/detail/adl/copy.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -41,6 +42,7 @@ copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy");
+  _THRUST_TRACE_SCOPE("thrust::copy", exec, first, last);
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -51,6 +53,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy_n");
+  _THRUST_TRACE_SCOPE_N("thrust::copy_n", exec, n);
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/copy_if.h>
 #include <thrust/system/detail/generic/copy_if.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_TRACE_SCOPE("thrust::copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end copy_if()
@@ -62,6 +64,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_TRACE_SCOPE("thrust::copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end copy_if()
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/count.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/count.h>
 #include <thrust/system/detail/generic/count.h>
@@ -42,6 +43,7 @@ count(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
       const EqualityComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::count");
+  _THRUST_TRACE_SCOPE("thrust::count", exec, first, last);
   using thrust::system::detail::generic::count;
   return count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end count()
@@ -55,6 +57,7 @@ count_if(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::count_if");
+  _THRUST_TRACE_SCOPE("thrust::count_if", exec, first, last);
   using thrust::system::detail::generic::count_if;
   return count_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end count_if()
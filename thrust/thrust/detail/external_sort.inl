@@ -0,0 +1,768 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/external_sort.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/sequential/multiway_merge.h>
+#include <thrust/system_error.h>
+
+#include <cuda/std/functional>
+#include <cuda/std/type_traits>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace external_sort_detail
+{
+
+// The blocks the merge reads and writes are not made smaller than this, so that the files are accessed efficiently.
+inline constexpr std::size_t min_block_bytes = std::size_t{1} << 16;
+
+// The Value of external_sort, which sorts keys only.
+struct no_values
+{};
+
+template <typename Value>
+inline constexpr bool has_values = !::cuda::std::is_same_v<Value, no_values>;
+
+template <typename Key, typename Value>
+inline constexpr std::size_t record_bytes = sizeof(Key) + (has_values<Value> ? sizeof(Value) : 0);
+
+[[noreturn]] inline void throw_file_error(int ev, const char* action, const std::filesystem::path& path)
+{
+  throw thrust::system_error(
+    ev, thrust::generic_category(), std::string("external_sort: cannot ") + action + " " + path.string());
+}
+
+class binary_file
+{
+public:
+  binary_file(const std::filesystem::path& path, const char* mode)
+      : m_path(path)
+      , m_file(std::fopen(path.string().c_str(), mode))
+  {
+    if (m_file == nullptr)
+    {
+      throw_file_error(errno, "open", m_path);
+    }
+  }
+
+  binary_file(const binary_file&)            = delete;
+  binary_file& operator=(const binary_file&) = delete;
+
+  ~binary_file()
+  {
+    if (m_file != nullptr)
+    {
+      std::fclose(m_file);
+    }
+  }
+
+  void read(void* data, std::size_t bytes)
+  {
+    if (std::fread(data, 1, bytes, m_file) != bytes)
+    {
+      throw_file_error(EIO, "read", m_path);
+    }
+  }
+
+  void write(const void* data, std::size_t bytes)
+  {
+    if (std::fwrite(data, 1, bytes, m_file) != bytes)
+    {
+      throw_file_error(EIO, "write", m_path);
+    }
+  }
+
+  // Closes the file, reporting the errors of writes which were still buffered.
+  void close()
+  {
+    if (std::fclose(std::exchange(m_file, nullptr)) != 0)
+    {
+      throw_file_error(EIO, "write", m_path);
+    }
+  }
+
+private:
+  std::filesystem::path m_path;
+  std::FILE* m_file;
+};
+
+template <typename T>
+std::uint64_t record_count(const std::filesystem::path& path)
+{
+  std::error_code ec;
+  const std::uint64_t bytes = std::filesystem::file_size(path, ec);
+  if (ec)
+  {
+    throw_file_error(ec.value(), "read", path);
+  }
+  if (bytes % sizeof(T) != 0)
+  {
+    throw_file_error(EINVAL, "sort records of a different size in", path);
+  }
+  return bytes / sizeof(T);
+}
+
+// The files of a sequence of records, holding its keys and, unless Value is no_values, its values.
+struct run_files
+{
+  std::filesystem::path keys;
+  std::filesystem::path values;
+  std::uint64_t size;
+};
+
+// Reads the records of a file front to back in blocks. With read-ahead, the next block is read on another thread while
+// the current one is used.
+template <typename T>
+class block_reader
+{
+public:
+  block_reader(const std::filesystem::path& path, std::uint64_t size, std::size_t block_size, bool read_ahead)
+      : m_file(path, "rb")
+      , m_remaining(size)
+      , m_block_size(block_size)
+      , m_current(new T[block_size])
+      , m_next(read_ahead ? new T[block_size] : nullptr)
+  {
+    if (read_ahead)
+    {
+      start_read();
+    }
+  }
+
+  // Makes the next block of the file current and returns its size, which is 0 at the end of the file.
+  std::size_t next_block()
+  {
+    if (!m_next)
+    {
+      return read_block(m_current.get());
+    }
+
+    const std::size_t size = m_pending.valid() ? m_pending.get() : 0;
+    std::swap(m_current, m_next);
+    start_read();
+    return size;
+  }
+
+  const T* data() const
+  {
+    return m_current.get();
+  }
+
+private:
+  std::size_t read_block(T* buffer)
+  {
+    const auto size = static_cast<std::size_t>((std::min) (m_remaining, std::uint64_t{m_block_size}));
+    m_file.read(buffer, size * sizeof(T));
+    m_remaining -= size;
+    return size;
+  }
+
+  void start_read()
+  {
+    if (m_remaining > 0)
+    {
+      m_pending = std::async(std::launch::async, [this, buffer = m_next.get()] {
+        return read_block(buffer);
+      });
+    }
+  }
+
+  binary_file m_file;
+  std::uint64_t m_remaining;
+  std::size_t m_block_size;
+  std::unique_ptr<T[]> m_current;
+  std::unique_ptr<T[]> m_next;
+  // declared last, so that a pending read completes before the buffers and the file are destroyed
+  std::future<std::size_t> m_pending;
+};
+
+// Writes records to a file in blocks. With write-behind, a block is written on another thread while the next one is
+// filled.
+template <typename T>
+class block_writer
+{
+public:
+  block_writer(const std::filesystem::path& path, std::size_t block_size, bool write_behind)
+      : m_file(path, "wb")
+      , m_block_size(block_size)
+      , m_current(new T[block_size])
+      , m_next(write_behind ? new T[block_size] : nullptr)
+  {}
+
+  void push(const T& x)
+  {
+    m_current[m_size++] = x;
+    if (m_size == m_block_size)
+    {
+      flush();
+    }
+  }
+
+  // Writes the records pushed so far and closes the file.
+  void close()
+  {
+    flush();
+    wait();
+    m_file.close();
+  }
+
+private:
+  void flush()
+  {
+    if (m_size == 0)
+    {
+      return;
+    }
+
+    if (m_next)
+    {
+      wait();
+      std::swap(m_current, m_next);
+      m_pending = std::async(std::launch::async, [this, buffer = m_next.get(), bytes = m_size * sizeof(T)] {
+        m_file.write(buffer, bytes);
+      });
+    }
+    else
+    {
+      m_file.write(m_current.get(), m_size * sizeof(T));
+    }
+    m_size = 0;
+  }
+
+  void wait()
+  {
+    if (m_pending.valid())
+    {
+      m_pending.get();
+    }
+  }
+
+  binary_file m_file;
+  std::size_t m_block_size;
+  std::size_t m_size = 0;
+  std::unique_ptr<T[]> m_current;
+  std::unique_ptr<T[]> m_next;
+  // declared last, so that a pending write completes before the buffers and the file are destroyed
+  std::future<void> m_pending;
+};
+
+// A block of records held in memory.
+template <typename Key, typename Value>
+struct record_block
+{
+  explicit record_block(std::size_t capacity)
+      : keys(new Key[capacity])
+      , values(has_values<Value> ? new Value[capacity] : nullptr)
+  {}
+
+  std::unique_ptr<Key[]> keys;
+  std::unique_ptr<Value[]> values;
+  std::size_t size = 0;
+};
+
+// The input of the sort, read front to back.
+template <typename Key, typename Value>
+class input_files
+{
+public:
+  explicit input_files(const run_files& input)
+      : m_keys(input.keys, "rb")
+      , m_remaining(input.size)
+  {
+    if constexpr (has_values<Value>)
+    {
+      m_values = std::make_unique<binary_file>(input.values, "rb");
+    }
+  }
+
+  std::uint64_t remaining() const
+  {
+    return m_remaining;
+  }
+
+  // Reads up to max_size of the remaining records into block.
+  void read(record_block<Key, Value>& block, std::size_t max_size)
+  {
+    block.size = static_cast<std::size_t>((std::min) (m_remaining, std::uint64_t{max_size}));
+    m_remaining -= block.size;
+    m_keys.read(block.keys.get(), block.size * sizeof(Key));
+    if constexpr (has_values<Value>)
+    {
+      m_values->read(block.values.get(), block.size * sizeof(Value));
+    }
+  }
+
+private:
+  binary_file m_keys;
+  std::unique_ptr<binary_file> m_values;
+  std::uint64_t m_remaining;
+};
+
+template <typename Key, typename Value>
+void write_block(const run_files& output, const record_block<Key, Value>& block)
+{
+  binary_file keys(output.keys, "wb");
+  keys.write(block.keys.get(), block.size * sizeof(Key));
+  keys.close();
+
+  if constexpr (has_values<Value>)
+  {
+    binary_file values(output.values, "wb");
+    values.write(block.values.get(), block.size * sizeof(Value));
+    values.close();
+  }
+}
+
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void sort_block(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                record_block<Key, Value>& block,
+                StrictWeakOrdering comp)
+{
+  Key* keys = block.keys.get();
+  if constexpr (has_values<Value>)
+  {
+    thrust::stable_sort_by_key(exec, keys, keys + block.size, block.values.get(), comp);
+  }
+  else
+  {
+    thrust::stable_sort(exec, keys, keys + block.size, comp);
+  }
+}
+
+// A directory for the files of the sorted runs, which is removed with its contents on destruction.
+class temporary_directory
+{
+public:
+  explicit temporary_directory(const std::string& parent)
+  {
+    std::error_code ec;
+    const std::filesystem::path base =
+      parent.empty() ? std::filesystem::temp_directory_path(ec) : std::filesystem::path(parent);
+    if (ec)
+    {
+      throw_file_error(ec.value(), "find the temporary directory", base);
+    }
+
+    std::random_device random;
+    bool created = false;
+    while (!created)
+    {
+      m_path  = base / ("thrust_external_sort_" + std::to_string(random()) + "_" + std::to_string(random()));
+      created = std::filesystem::create_directory(m_path, ec);
+      if (ec)
+      {
+        throw_file_error(ec.value(), "create", m_path);
+      }
+    }
+  }
+
+  temporary_directory(const temporary_directory&)            = delete;
+  temporary_directory& operator=(const temporary_directory&) = delete;
+
+  ~temporary_directory()
+  {
+    std::error_code ec;
+    std::filesystem::remove_all(m_path, ec);
+  }
+
+  run_files make_run(std::size_t index, std::uint64_t size) const
+  {
+    const std::string name = "run_" + std::to_string(index);
+    return run_files{m_path / (name + ".keys"), m_path / (name + ".values"), size};
+  }
+
+private:
+  std::filesystem::path m_path;
+};
+
+// Sorts the input in runs of run_size records and writes them to files in directory. With overlap_io, the next run is
+// read and the previous one written while a run is sorted, which takes three blocks of memory instead of one.
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+std::vector<run_files> sort_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  const run_files& input,
+  std::size_t run_size,
+  bool overlap_io,
+  const temporary_directory& directory,
+  StrictWeakOrdering comp)
+{
+  const std::size_t num_blocks = overlap_io ? 3 : 1;
+
+  std::vector<record_block<Key, Value>> blocks;
+  blocks.reserve(num_blocks);
+  for (std::size_t i = 0; i < num_blocks; ++i)
+  {
+    blocks.emplace_back(run_size);
+  }
+
+  input_files<Key, Value> input_file(input);
+  std::vector<run_files> runs;
+  // declared after the blocks and the input, so that pending operations complete before those are destroyed
+  std::future<void> pending_read;
+  std::future<void> pending_write;
+
+  input_file.read(blocks[0], run_size);
+  for (std::size_t i = 0; blocks[i % num_blocks].size > 0; ++i)
+  {
+    record_block<Key, Value>& block = blocks[i % num_blocks];
+    record_block<Key, Value>& next  = blocks[(i + 1) % num_blocks];
+
+    if (overlap_io)
+    {
+      // the previous write from next completed before the write of the previous run started
+      next.size = 0;
+      if (input_file.remaining() > 0)
+      {
+        pending_read = std::async(std::launch::async, [&input_file, &next, run_size] {
+          input_file.read(next, run_size);
+        });
+      }
+    }
+
+    sort_block(exec, block, comp);
+
+    runs.push_back(directory.make_run(runs.size(), block.size));
+    if (overlap_io)
+    {
+      if (pending_write.valid())
+      {
+        pending_write.get();
+      }
+      pending_write = std::async(std::launch::async, [run = runs.back(), &block] {
+        write_block(run, block);
+      });
+
+      if (pending_read.valid())
+      {
+        pending_read.get();
+      }
+    }
+    else
+    {
+      write_block(runs.back(), block);
+      input_file.read(next, run_size);
+    }
+  }
+
+  if (pending_write.valid())
+  {
+    pending_write.get();
+  }
+
+  return runs;
+}
+
+// Reads a sorted run record by record.
+template <typename Key, typename Value>
+class run_reader
+{
+public:
+  run_reader(const run_files& run, std::size_t block_size, bool read_ahead)
+      : m_keys(run.keys, run.size, block_size, read_ahead)
+  {
+    if constexpr (has_values<Value>)
+    {
+      m_values = std::make_unique<block_reader<Value>>(run.values, run.size, block_size, read_ahead);
+    }
+  }
+
+  // Moves to the first record of the next block, and returns false at the end of the run.
+  bool next_block()
+  {
+    m_position = 0;
+    m_size     = m_keys.next_block();
+    if constexpr (has_values<Value>)
+    {
+      m_values->next_block();
+    }
+    return m_size > 0;
+  }
+
+  // Moves to the next record, and returns false at the end of the run.
+  bool advance()
+  {
+    return ++m_position < m_size || next_block();
+  }
+
+  bool exhausted() const
+  {
+    return m_position == m_size;
+  }
+
+  const Key& key() const
+  {
+    return m_keys.data()[m_position];
+  }
+
+  const Value& value() const
+  {
+    return m_values->data()[m_position];
+  }
+
+private:
+  block_reader<Key> m_keys;
+  std::unique_ptr<block_reader<Value>> m_values;
+  std::size_t m_position = 0;
+  std::size_t m_size     = 0;
+};
+
+// The runs of a merge, as seen by the loser tree.
+template <typename Key, typename Value, typename StrictWeakOrdering>
+struct reader_runs
+{
+  const std::vector<std::unique_ptr<run_reader<Key, Value>>>& readers;
+  StrictWeakOrdering& comp;
+
+  bool exhausted(std::size_t i) const
+  {
+    return readers[i]->exhausted();
+  }
+
+  bool less(std::size_t a, std::size_t b) const
+  {
+    return comp(readers[a]->key(), readers[b]->key());
+  }
+};
+
+// Merges sorted runs into output with the loser tree of the sequential merge_k, reading every run through a buffered
+// reader. Equivalent keys are taken from the run with the lower index first, so that the merge of consecutive runs of a
+// stable sort is stable.
+template <typename Key, typename Value, typename StrictWeakOrdering>
+void merge_runs(const run_files* runs,
+                std::size_t num_runs,
+                const run_files& output,
+                std::size_t block_size,
+                bool overlap_io,
+                StrictWeakOrdering comp)
+{
+  std::vector<std::unique_ptr<run_reader<Key, Value>>> readers;
+  readers.reserve(num_runs);
+  for (std::size_t i = 0; i < num_runs; ++i)
+  {
+    readers.push_back(std::make_unique<run_reader<Key, Value>>(runs[i], block_size, overlap_io));
+    readers.back()->next_block();
+  }
+
+  block_writer<Key> keys(output.keys, block_size, overlap_io);
+  std::unique_ptr<block_writer<Value>> values;
+  if constexpr (has_values<Value>)
+  {
+    values = std::make_unique<block_writer<Value>>(output.values, block_size, overlap_io);
+  }
+
+  if (num_runs > 0)
+  {
+    reader_runs<Key, Value, StrictWeakOrdering> tree_runs{readers, comp};
+    std::vector<std::size_t> tree(2 * num_runs);
+    std::size_t winner = thrust::system::detail::sequential::build_loser_tree(tree_runs, num_runs, tree.data());
+    while (!readers[winner]->exhausted())
+    {
+      run_reader<Key, Value>& reader = *readers[winner];
+      keys.push(reader.key());
+      if constexpr (has_values<Value>)
+      {
+        values->push(reader.value());
+      }
+      reader.advance();
+      winner = thrust::system::detail::sequential::replay_loser_tree(tree_runs, num_runs, tree.data(), winner);
+    }
+  }
+
+  keys.close();
+  if constexpr (has_values<Value>)
+  {
+    values->close();
+  }
+}
+
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void sort_files(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                const run_files& input,
+                const run_files& output,
+                StrictWeakOrdering comp,
+                const external_sort_options& options)
+{
+  static_assert(::cuda::std::is_trivially_copyable_v<Key>, "external_sort requires trivially copyable keys");
+  static_assert(::cuda::std::is_trivially_copyable_v<Value>, "external_sort requires trivially copyable values");
+
+  constexpr std::size_t bytes_per_record = record_bytes<Key, Value>;
+  const std::size_t buffers_per_stream   = options.overlap_io ? 2 : 1;
+
+  // the blocks of the runs, and the temporary storage of sorting one of them
+  const std::size_t run_size =
+    (std::max) (std::size_t{1}, options.memory_budget / ((options.overlap_io ? 3 : 1) + 1) / bytes_per_record);
+
+  if (input.size <= run_size)
+  {
+    record_block<Key, Value> block(static_cast<std::size_t>(input.size));
+    {
+      input_files<Key, Value> input_file(input);
+      input_file.read(block, static_cast<std::size_t>(input.size));
+    }
+    sort_block(exec, block, comp);
+    write_block(output, block);
+    return;
+  }
+
+  temporary_directory directory(options.temporary_directory);
+  std::vector<run_files> runs =
+    sort_runs<Key, Value>(exec, input, run_size, options.overlap_io, directory, comp);
+
+  // the buffers of the runs and of the output of a merge share the budget
+  const std::size_t min_block_size = (std::max) (std::size_t{1}, min_block_bytes / bytes_per_record);
+  const std::size_t max_fan_in =
+    (std::max) (std::size_t{3}, options.memory_budget / (buffers_per_stream * min_block_size * bytes_per_record)) - 1;
+  auto block_size = [&](std::size_t num_runs) {
+    return (std::max) (min_block_size,
+                       options.memory_budget / ((num_runs + 1) * buffers_per_stream * bytes_per_record));
+  };
+
+  std::size_t num_files = runs.size();
+  while (runs.size() > max_fan_in)
+  {
+    std::vector<run_files> merged_runs;
+    for (std::size_t first = 0; first < runs.size(); first += max_fan_in)
+    {
+      const std::size_t num_runs = (std::min) (max_fan_in, runs.size() - first);
+      if (num_runs == 1)
+      {
+        merged_runs.push_back(runs[first]);
+        continue;
+      }
+
+      std::uint64_t size = 0;
+      for (std::size_t i = first; i < first + num_runs; ++i)
+      {
+        size += runs[i].size;
+      }
+      merged_runs.push_back(directory.make_run(num_files++, size));
+      merge_runs<Key, Value>(
+        runs.data() + first, num_runs, merged_runs.back(), block_size(num_runs), options.overlap_io, comp);
+
+      for (std::size_t i = first; i < first + num_runs; ++i)
+      {
+        std::error_code ec;
+        std::filesystem::remove(runs[i].keys, ec);
+        std::filesystem::remove(runs[i].values, ec);
+      }
+    }
+    runs = std::move(merged_runs);
+  }
+
+  merge_runs<Key, Value>(runs.data(), runs.size(), output, block_size(runs.size()), options.overlap_io, comp);
+}
+
+} // namespace external_sort_detail
+} // end namespace detail
+
+template <typename T, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path,
+                   StrictWeakOrdering comp,
+                   const external_sort_options& options)
+{
+  namespace sort_detail = thrust::detail::external_sort_detail;
+
+  const std::uint64_t size = sort_detail::record_count<T>(input_path);
+  sort_detail::sort_files<T, sort_detail::no_values>(
+    exec, sort_detail::run_files{input_path, {}, size}, sort_detail::run_files{output_path, {}, size}, comp, options);
+} // end external_sort()
+
+template <typename T, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path,
+                   StrictWeakOrdering comp)
+{
+  thrust::external_sort<T>(exec, input_path, output_path, comp, external_sort_options());
+} // end external_sort()
+
+template <typename T, typename DerivedPolicy>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path)
+{
+  thrust::external_sort<T>(exec, input_path, output_path, ::cuda::std::less<T>(), external_sort_options());
+} // end external_sort()
+
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path,
+                          StrictWeakOrdering comp,
+                          const external_sort_options& options)
+{
+  namespace sort_detail = thrust::detail::external_sort_detail;
+
+  const std::uint64_t size = sort_detail::record_count<Key>(keys_input_path);
+  if (sort_detail::record_count<Value>(values_input_path) != size)
+  {
+    sort_detail::throw_file_error(EINVAL, "sort a different number of keys and values in", values_input_path);
+  }
+
+  sort_detail::sort_files<Key, Value>(
+    exec,
+    sort_detail::run_files{keys_input_path, values_input_path, size},
+    sort_detail::run_files{keys_output_path, values_output_path, size},
+    comp,
+    options);
+} // end external_sort_by_key()
+
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path,
+                          StrictWeakOrdering comp)
+{
+  thrust::external_sort_by_key<Key, Value>(
+    exec, keys_input_path, values_input_path, keys_output_path, values_output_path, comp, external_sort_options());
+} // end external_sort_by_key()
+
+template <typename Key, typename Value, typename DerivedPolicy>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path)
+{
+  thrust::external_sort_by_key<Key, Value>(
+    exec,
+    keys_input_path,
+    values_input_path,
+    keys_output_path,
+    values_output_path,
+    ::cuda::std::less<Key>(),
+    external_sort_options());
+} // end external_sort_by_key()
+
+THRUST_NAMESPACE_END
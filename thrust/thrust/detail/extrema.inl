@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/extrema.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/extrema.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_TRACE_SCOPE("thrust::min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end min_element()
@@ -52,6 +54,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_TRACE_SCOPE("thrust::min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end min_element()
@@ -62,6 +65,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_TRACE_SCOPE("thrust::max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end max_element()
@@ -75,6 +79,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_TRACE_SCOPE("thrust::max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end max_element()
@@ -85,6 +90,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> minmax_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_TRACE_SCOPE("thrust::minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end minmax_element()
@@ -98,6 +104,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> minmax_element(
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_TRACE_SCOPE("thrust::minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end minmax_element()
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/fill.h>
@@ -43,6 +44,7 @@ fill(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::fill");
+  _THRUST_TRACE_SCOPE("thrust::fill", exec, first, last);
   using thrust::system::detail::generic::fill;
   return fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end fill()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE OutputIterator
 fill_n(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::fill_n");
+  _THRUST_TRACE_SCOPE_N("thrust::fill_n", exec, n);
   using thrust::system::detail::generic::fill_n;
   return fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, value);
 } // end fill_n()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/find.h>
 #include <thrust/system/detail/generic/find.h>
@@ -41,6 +42,7 @@ find(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find");
+  _THRUST_TRACE_SCOPE("thrust::find", exec, first, last);
   using thrust::system::detail::generic::find;
   return find(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end find()
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE InputIterator find_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find_if");
+  _THRUST_TRACE_SCOPE("thrust::find_if", exec, first, last);
   using thrust::system::detail::generic::find_if;
   return find_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if()
@@ -67,6 +70,7 @@ _CCCL_HOST_DEVICE InputIterator find_if_not(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find_if_not");
+  _THRUST_TRACE_SCOPE("thrust::find_if_not", exec, first, last);
   using thrust::system::detail::generic::find_if_not;
   return find_if_not(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if_not()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/for_each.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE InputIterator for_each(
   UnaryFunction f)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::for_each");
+  _THRUST_TRACE_SCOPE("thrust::for_each", exec, first, last);
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE InputIterator for_each_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, UnaryFunction f)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::for_each_n");
+  _THRUST_TRACE_SCOPE_N("thrust::for_each_n", exec, n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
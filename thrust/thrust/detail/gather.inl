@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/gather.h>
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE OutputIterator gather(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather");
+  _THRUST_TRACE_SCOPE("thrust::gather", exec, map_first, map_last);
   using thrust::system::detail::generic::gather;
   return gather(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_TRACE_SCOPE("thrust::gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
@@ -86,6 +89,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_TRACE_SCOPE("thrust::gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
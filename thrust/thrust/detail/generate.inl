@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/generate.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/generate.h>
@@ -43,6 +44,7 @@ generate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          Generator gen)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::generate");
+  _THRUST_TRACE_SCOPE("thrust::generate", exec, first, last);
   using thrust::system::detail::generic::generate;
   return generate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, gen);
 } // end generate()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE OutputIterator generate_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, Generator gen)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::generate_n");
+  _THRUST_TRACE_SCOPE_N("thrust::generate_n", exec, n);
   using thrust::system::detail::generic::generate_n;
   return generate_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, gen);
 } // end generate_n()
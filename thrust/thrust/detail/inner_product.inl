@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/inner_product.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/inner_product.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   OutputType init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inner_product");
+  _THRUST_TRACE_SCOPE("thrust::inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init);
 } // end inner_product()
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   BinaryFunction2 binary_op2)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inner_product");
+  _THRUST_TRACE_SCOPE("thrust::inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
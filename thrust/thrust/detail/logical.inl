@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/logical.h>
 #include <thrust/system/detail/generic/logical.h>
@@ -41,6 +42,7 @@ all_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("all_of");
+  _THRUST_TRACE_SCOPE("thrust::all_of", exec, first, last);
   using thrust::system::detail::generic::all_of;
   return all_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end all_of()
@@ -54,6 +56,7 @@ any_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("any_of");
+  _THRUST_TRACE_SCOPE("thrust::any_of", exec, first, last);
   using thrust::system::detail::generic::any_of;
   return any_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end any_of()
@@ -67,6 +70,7 @@ none_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("none_of");
+  _THRUST_TRACE_SCOPE("thrust::none_of", exec, first, last);
   using thrust::system::detail::generic::none_of;
   return none_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end none_of()
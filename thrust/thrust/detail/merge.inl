@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/detail/adl/merge.h>
@@ -45,6 +46,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_TRACE_SCOPE_2("thrust::merge", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end merge()
@@ -65,6 +67,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_TRACE_SCOPE_2("thrust::merge", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::merge;
   return merge(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -90,6 +93,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::merge_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -125,6 +129,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::merge_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -273,4 +278,221 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
     values_result);
 } // end merge_by_key()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k");
+  // the number of elements is only known after reading the offsets, which may live in device memory
+  _THRUST_TRACE_SCOPE_N("thrust::merge_k", exec, -1);
+  using thrust::system::detail::generic::merge_k;
+  return merge_k(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result, comp);
+} // end merge_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k");
+  _THRUST_TRACE_SCOPE_N("thrust::merge_k", exec, -1);
+  using thrust::system::detail::generic::merge_k;
+  return merge_k(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result);
+} // end merge_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k_by_key");
+  _THRUST_TRACE_SCOPE_N("thrust::merge_k_by_key", exec, -1);
+  using thrust::system::detail::generic::merge_k_by_key;
+  return merge_k_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    comp);
+} // end merge_k_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k_by_key");
+  _THRUST_TRACE_SCOPE_N("thrust::merge_k_by_key", exec, -1);
+  using thrust::system::detail::generic::merge_k_by_key;
+  return merge_k_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result);
+} // end merge_k_by_key()
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator merge_k(OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::merge_k(select_system(system1, system2, system3), offsets_first, offsets_last, first, result, comp);
+} // end merge_k()
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator
+merge_k(OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::merge_k(select_system(system1, system2, system3), offsets_first, offsets_last, first, result);
+} // end merge_k()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System5 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+  System5 system5;
+
+  return thrust::merge_k_by_key(
+    select_system(system1, system2, system3, system4, system5),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    comp);
+} // end merge_k_by_key()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_k_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System5 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+  System5 system5;
+
+  return thrust::merge_k_by_key(
+    select_system(system1, system2, system3, system4, system5),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result);
+} // end merge_k_by_key()
+
 THRUST_NAMESPACE_END
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/mismatch.h>
 #include <thrust/system/detail/adl/mismatch.h>
@@ -42,6 +43,7 @@ mismatch(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          InputIterator2 first2)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_TRACE_SCOPE("thrust::mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end mismatch()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE thrust::pair<InputIterator1, InputIterator2> mismatch(
   BinaryPredicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_TRACE_SCOPE("thrust::mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, pred);
 } // end mismatch()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/partition.h>
 #include <thrust/system/detail/adl/partition.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_TRACE_SCOPE("thrust::partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_TRACE_SCOPE("thrust::partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -75,6 +78,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> partition_copy(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_TRACE_SCOPE("thrust::partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -97,6 +101,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> partition_copy(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_TRACE_SCOPE("thrust::partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -111,6 +116,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_TRACE_SCOPE("thrust::stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -125,6 +131,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_TRACE_SCOPE("thrust::stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -144,6 +151,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> stable_partitio
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_TRACE_SCOPE("thrust::stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -166,6 +174,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> stable_partitio
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_TRACE_SCOPE("thrust::stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -180,6 +189,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition_point(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_point");
+  _THRUST_TRACE_SCOPE("thrust::partition_point", exec, first, last);
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -193,6 +203,7 @@ _CCCL_HOST_DEVICE bool is_partitioned(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_partitioned");
+  _THRUST_TRACE_SCOPE("thrust::is_partitioned", exec, first, last);
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/tracing.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pipeline.h>
+#include <thrust/system/detail/adl/pipeline.h>
+#include <thrust/system/detail/generic/pipeline.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+_CCCL_HOST_DEVICE OutputIterator pipeline(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::pipeline");
+  _THRUST_TRACE_SCOPE("thrust::pipeline", exec, first, last);
+  using thrust::system::detail::generic::pipeline;
+  return pipeline(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, stages...);
+} // end pipeline()
+
+template <typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(InputIterator first, InputIterator last, OutputIterator result, const Stages&... stages)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::pipeline");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::pipeline(select_system(system1, system2), first, last, result, stages...);
+} // end pipeline()
+
+THRUST_NAMESPACE_END
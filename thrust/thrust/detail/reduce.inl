@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/detail/adl/reduce.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE detail::it_value_t<InputIterator>
 reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_TRACE_SCOPE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -52,6 +54,7 @@ _CCCL_HOST_DEVICE T reduce(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_TRACE_SCOPE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -66,6 +69,7 @@ _CCCL_HOST_DEVICE T reduce(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_TRACE_SCOPE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -124,6 +128,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   OutputIterator2 values_output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_TRACE_SCOPE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -151,6 +156,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_TRACE_SCOPE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -181,6 +187,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_TRACE_SCOPE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/remove.h>
 #include <thrust/system/detail/adl/remove.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove(
   const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove");
+  _THRUST_TRACE_SCOPE("thrust::remove", exec, first, last);
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy(
   const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy");
+  _THRUST_TRACE_SCOPE("thrust::remove_copy", exec, first, last);
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -69,6 +72,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_TRACE_SCOPE("thrust::remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -83,6 +87,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_TRACE_SCOPE("thrust::remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -97,6 +102,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_TRACE_SCOPE("thrust::remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -116,6 +122,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_TRACE_SCOPE("thrust::remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
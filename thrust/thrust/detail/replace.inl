@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/replace.h>
 #include <thrust/system/detail/adl/replace.h>
@@ -43,6 +44,7 @@ replace(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace");
+  _THRUST_TRACE_SCOPE("thrust::replace", exec, first, last);
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -57,6 +59,7 @@ _CCCL_HOST_DEVICE void replace_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_TRACE_SCOPE("thrust::replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -72,6 +75,7 @@ _CCCL_HOST_DEVICE void replace_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_TRACE_SCOPE("thrust::replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
@@ -88,6 +92,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy");
+  _THRUST_TRACE_SCOPE("thrust::replace_copy", exec, first, last);
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
@@ -104,6 +109,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_TRACE_SCOPE("thrust::replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
@@ -126,6 +132,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_TRACE_SCOPE("thrust::replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/adl/scan.h>
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -58,6 +60,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -73,6 +76,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -87,6 +91,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -101,6 +106,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -116,6 +122,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -131,6 +138,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -151,6 +159,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
@@ -173,6 +182,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -194,6 +204,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -210,6 +221,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
@@ -232,6 +244,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
@@ -256,6 +269,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_TRACE_SCOPE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scatter.h>
 #include <thrust/system/detail/adl/scatter.h>
@@ -44,6 +45,7 @@ scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         RandomAccessIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter");
+  _THRUST_TRACE_SCOPE("thrust::scatter", exec, first, last);
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   RandomAccessIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_TRACE_SCOPE("thrust::scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -84,6 +87,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_TRACE_SCOPE("thrust::scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
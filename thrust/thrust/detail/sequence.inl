@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sequence.h>
 #include <thrust/system/detail/adl/sequence.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE void
 sequence(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_TRACE_SCOPE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -49,6 +51,7 @@ _CCCL_HOST_DEVICE void sequence(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_TRACE_SCOPE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -63,6 +66,7 @@ _CCCL_HOST_DEVICE void sequence(
   T step)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_TRACE_SCOPE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
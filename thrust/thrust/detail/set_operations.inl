@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/set_operations.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_TRACE_SCOPE_2("thrust::set_difference", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_TRACE_SCOPE_2("thrust::set_difference", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -89,6 +92,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_difference_
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_difference_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -124,6 +128,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_difference_
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_difference_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -149,6 +154,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_TRACE_SCOPE_2("thrust::set_intersection", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -170,6 +176,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_TRACE_SCOPE_2("thrust::set_intersection", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -193,6 +200,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_intersectio
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_intersection_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -225,6 +233,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_intersectio
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_intersection_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -249,6 +258,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_TRACE_SCOPE_2("thrust::set_symmetric_difference", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -270,6 +280,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_TRACE_SCOPE_2("thrust::set_symmetric_difference", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -295,6 +306,8 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_symmetric_d
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_TRACE_SCOPE_2(
+    "thrust::set_symmetric_difference_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -330,6 +343,8 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_symmetric_d
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_TRACE_SCOPE_2(
+    "thrust::set_symmetric_difference_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -355,6 +370,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_TRACE_SCOPE_2("thrust::set_union", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -376,6 +392,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_TRACE_SCOPE_2("thrust::set_union", exec, first1, last1, first2, last2);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -401,6 +418,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_union_by_ke
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_union_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -436,6 +454,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_union_by_ke
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_TRACE_SCOPE_2("thrust::set_union_by_key", exec, keys_first1, keys_last1, keys_first2, keys_last2);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
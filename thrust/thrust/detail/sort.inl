@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/adl/sort.h>
@@ -40,6 +41,7 @@ _CCCL_HOST_DEVICE void sort(const thrust::detail::execution_policy_base<DerivedP
                             RandomAccessIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_TRACE_SCOPE("thrust::sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -53,6 +55,7 @@ sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_TRACE_SCOPE("thrust::sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -64,6 +67,7 @@ _CCCL_HOST_DEVICE void stable_sort(const thrust::detail::execution_policy_base<D
                                    RandomAccessIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_TRACE_SCOPE("thrust::stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -77,6 +81,7 @@ _CCCL_HOST_DEVICE void stable_sort(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_TRACE_SCOPE("thrust::stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -90,6 +95,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -108,6 +114,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -122,6 +129,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -140,17 +148,128 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator keys_last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  _THRUST_TRACE_SCOPE("thrust::segmented_sort", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator keys_last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  _THRUST_TRACE_SCOPE("thrust::segmented_sort", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::segmented_sort_by_key", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  _THRUST_TRACE_SCOPE("thrust::segmented_sort_by_key", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort_by_key()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE bool
 is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_TRACE_SCOPE("thrust::is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -164,6 +283,7 @@ is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
           Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_TRACE_SCOPE("thrust::is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -174,6 +294,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_TRACE_SCOPE("thrust::is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -187,6 +308,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_TRACE_SCOPE("thrust::is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
@@ -318,6 +440,136 @@ void stable_sort_by_key(RandomAccessIterator1 keys_first,
   return thrust::stable_sort_by_key(select_system(system1, system2), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
 
+template <typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(RandomAccessIterator keys_first,
+                    RandomAccessIterator keys_last,
+                    OffsetIterator1 begin_offsets_first,
+                    OffsetIterator1 begin_offsets_last,
+                    OffsetIterator2 end_offsets_first,
+                    StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort(
+    select_system(system1, system2, system3),
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(RandomAccessIterator keys_first,
+                    RandomAccessIterator keys_last,
+                    OffsetIterator1 begin_offsets_first,
+                    OffsetIterator1 begin_offsets_last,
+                    OffsetIterator2 end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort(
+    select_system(system1, system2, system3),
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                           RandomAccessIterator1 keys_last,
+                           RandomAccessIterator2 values_first,
+                           OffsetIterator1 begin_offsets_first,
+                           OffsetIterator1 begin_offsets_last,
+                           OffsetIterator2 end_offsets_first,
+                           StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System4 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort_by_key()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                           RandomAccessIterator1 keys_last,
+                           RandomAccessIterator2 values_first,
+                           OffsetIterator1 begin_offsets_first,
+                           OffsetIterator1 begin_offsets_last,
+                           OffsetIterator2 end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System4 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort_by_key()
+
 template <typename ForwardIterator>
 bool is_sorted(ForwardIterator first, ForwardIterator last)
 {
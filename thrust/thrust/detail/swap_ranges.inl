@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/swap.h>
 #include <thrust/system/detail/adl/swap_ranges.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE ForwardIterator2 swap_ranges(
   ForwardIterator2 first2)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::swap_ranges");
+  _THRUST_TRACE_SCOPE("thrust::swap_ranges", exec, first1, last1);
   using thrust::system::detail::generic::swap_ranges;
   return swap_ranges(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end swap_ranges()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/tabulate.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -42,6 +43,7 @@ tabulate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          UnaryOperation unary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::tabulate");
+  _THRUST_TRACE_SCOPE("thrust::tabulate", exec, first, last);
   using thrust::system::detail::generic::tabulate;
   return tabulate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op);
 } // end tabulate()
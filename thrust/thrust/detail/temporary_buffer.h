@@ -29,6 +29,7 @@
 #include <thrust/detail/execution_policy.h>
 #include <thrust/detail/pointer.h>
 #include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/adl/temporary_buffer.h>
 #include <thrust/system/detail/generic/temporary_buffer.h>
@@ -63,8 +64,10 @@ get_temporary_buffer(const thrust::detail::execution_policy_base<DerivedPolicy>&
   using thrust::detail::get_temporary_buffer; // execute_with_allocator
   using thrust::system::detail::generic::get_temporary_buffer;
 
-  return thrust::detail::down_cast_pair<T, DerivedPolicy>(
+  auto result = thrust::detail::down_cast_pair<T, DerivedPolicy>(
     get_temporary_buffer<T>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), n));
+  _THRUST_TRACE_TEMPORARY_BYTES(static_cast<::cuda::std::uint64_t>(result.second) * sizeof(T));
+  return result;
 } // end get_temporary_buffer()
 
 _CCCL_EXEC_CHECK_DISABLE
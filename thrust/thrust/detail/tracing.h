@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Instrumentation of the algorithm entry points for thrust::tracing. Everything in here compiles to nothing unless
+// THRUST_ENABLE_TRACING is defined.
+
+#ifdef THRUST_ENABLE_TRACING
+
+#  include <thrust/iterator/iterator_categories.h>
+#  include <thrust/iterator/iterator_traits.h>
+#  include <thrust/tracing.h>
+
+#  include <cuda/std/optional>
+#  include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace tracing
+{
+namespace detail
+{
+
+// Computing the distance of other iterators would be linear and would consume single-pass ranges.
+template <typename Iterator>
+_CCCL_HOST ::cuda::std::int64_t element_count(Iterator first, Iterator last)
+{
+  if constexpr (::cuda::std::is_convertible_v<iterator_traversal_t<Iterator>, random_access_traversal_tag>)
+  {
+    return static_cast<::cuda::std::int64_t>(last - first);
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+template <typename Iterator1, typename Iterator2>
+_CCCL_HOST ::cuda::std::int64_t element_count(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2)
+{
+  const ::cuda::std::int64_t n1 = element_count(first1, last1);
+  const ::cuda::std::int64_t n2 = element_count(first2, last2);
+  return (n1 < 0 || n2 < 0) ? -1 : n1 + n2;
+}
+
+template <typename DerivedPolicy>
+_CCCL_HOST const char* system_name_of(const thrust::detail::execution_policy_base<DerivedPolicy>&)
+{
+  return system_name<DerivedPolicy>();
+}
+
+template <typename DerivedPolicy>
+_CCCL_HOST void sequential_fallback()
+{
+  if constexpr (dispatches_to<DerivedPolicy, THRUST_NS_QUALIFIER::system::omp::detail::execution_policy>
+                || dispatches_to<DerivedPolicy, THRUST_NS_QUALIFIER::system::tbb::detail::execution_policy>)
+  {
+    scope::mark_sequential_fallback();
+  }
+}
+
+} // namespace detail
+} // namespace tracing
+THRUST_NAMESPACE_END
+
+// Records an event for the algorithm invocation from here until the end of the current function scope in host code.
+// Does nothing in device code. Mirrors _CCCL_NVTX_RANGE_SCOPE.
+#  define _THRUST_TRACE_SCOPE_IMPL(name, exec, elements, forwarding)                                                 \
+    ::cuda::std::optional<THRUST_NS_QUALIFIER::tracing::detail::scope> __thrust_trace_scope;                          \
+    NV_IF_TARGET(NV_IS_HOST,                                                                                          \
+                 (__thrust_trace_scope.emplace(                                                                       \
+                    name, THRUST_NS_QUALIFIER::tracing::detail::system_name_of(exec), (elements), (forwarding));)); \
+    (void) __thrust_trace_scope
+
+// Adds to the temporary storage recorded for the innermost traced algorithm on this thread.
+#  define _THRUST_TRACE_TEMPORARY_BYTES(bytes) \
+    NV_IF_TARGET(NV_IS_HOST, (THRUST_NS_QUALIFIER::tracing::detail::scope::add_temporary_bytes(bytes);))
+
+// Marks the innermost traced algorithm on this thread as executed sequentially, if the sequential implementation was
+// reached with an OpenMP or TBB policy.
+#  define _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy) \
+    NV_IF_TARGET(NV_IS_HOST, (THRUST_NS_QUALIFIER::tracing::detail::sequential_fallback<DerivedPolicy>();))
+
+#else // ^^^ THRUST_ENABLE_TRACING ^^^ / vvv !THRUST_ENABLE_TRACING vvv
+
+#  define _THRUST_TRACE_SCOPE_IMPL(name, exec, elements, forwarding)
+#  define _THRUST_TRACE_TEMPORARY_BYTES(bytes)
+#  define _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy)
+
+#endif // !THRUST_ENABLE_TRACING
+
+// Traces an algorithm over the range [first, last).
+#define _THRUST_TRACE_SCOPE(name, exec, first, last) \
+  _THRUST_TRACE_SCOPE_IMPL(name, exec, THRUST_NS_QUALIFIER::tracing::detail::element_count(first, last), false)
+
+// Traces an algorithm over the ranges [first1, last1) and [first2, last2).
+#define _THRUST_TRACE_SCOPE_2(name, exec, first1, last1, first2, last2) \
+  _THRUST_TRACE_SCOPE_IMPL(                                             \
+    name, exec, THRUST_NS_QUALIFIER::tracing::detail::element_count(first1, last1, first2, last2), false)
+
+// Traces an algorithm over n elements.
+#define _THRUST_TRACE_SCOPE_N(name, exec, n) \
+  _THRUST_TRACE_SCOPE_IMPL(name, exec, static_cast<::cuda::std::int64_t>(n), false)
+
+// Traces an algorithm over n elements, which forwards to another traced algorithm. The forwarded call is recorded as
+// part of this one instead of as a nested event.
+#define _THRUST_TRACE_FORWARDING_SCOPE_N(name, exec, n) \
+  _THRUST_TRACE_SCOPE_IMPL(name, exec, static_cast<::cuda::std::int64_t>(n), true)
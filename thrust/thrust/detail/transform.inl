@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/transform.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   UnaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_TRACE_SCOPE("thrust::transform", exec, first, last);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 } // end transform()
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   BinaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_TRACE_SCOPE("thrust::transform", exec, first1, last1);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 } // end transform()
@@ -82,6 +85,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_TRACE_SCOPE("thrust::transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 } // end transform_if()
@@ -103,6 +107,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_TRACE_SCOPE("thrust::transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
@@ -127,6 +132,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_TRACE_SCOPE("thrust::transform_if", exec, first1, last1);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
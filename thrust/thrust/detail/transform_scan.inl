@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/adl/transform_scan.h>
@@ -49,6 +50,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::transform_inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, binary_op);
@@ -71,6 +73,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::transform_inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
@@ -93,6 +96,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_exclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_exclusive_scan");
+  _THRUST_TRACE_SCOPE("thrust::transform_exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_exclusive_scan;
   return transform_exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
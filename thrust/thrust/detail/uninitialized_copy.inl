@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/uninitialized_copy.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy(
   ForwardIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy");
+  _THRUST_TRACE_SCOPE("thrust::uninitialized_copy", exec, first, last);
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, ForwardIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy_n");
+  _THRUST_TRACE_SCOPE_N("thrust::uninitialized_copy_n", exec, n);
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/uninitialized_fill.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE void uninitialized_fill(
   const T& x)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_fill");
+  _THRUST_TRACE_SCOPE("thrust::uninitialized_fill", exec, first, last);
   using thrust::system::detail::generic::uninitialized_fill;
   return uninitialized_fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, x);
 } // end uninitialized_fill()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_fill_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, Size n, const T& x)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_fill_n");
+  _THRUST_TRACE_SCOPE_N("thrust::uninitialized_fill_n", exec, n);
   using thrust::system::detail::generic::uninitialized_fill_n;
   return uninitialized_fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, x);
 } // end uninitialized_fill_n()
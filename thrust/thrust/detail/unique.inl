@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/unique.h>
 #include <thrust/system/detail/adl/unique_by_key.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator
 unique(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_TRACE_SCOPE("thrust::unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE ForwardIterator unique(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_TRACE_SCOPE("thrust::unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_TRACE_SCOPE("thrust::unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -82,6 +86,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_TRACE_SCOPE("thrust::unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -95,6 +100,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key
   ForwardIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_TRACE_SCOPE("thrust::unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -110,6 +116,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_TRACE_SCOPE("thrust::unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
@@ -130,6 +137,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_c
   OutputIterator2 values_output)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_TRACE_SCOPE("thrust::unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -157,6 +165,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_c
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_TRACE_SCOPE("thrust::unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -326,6 +335,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_TRACE_SCOPE("thrust::unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -336,6 +346,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_TRACE_SCOPE("thrust::unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file thrust/external_sort.h
+ *  \brief Sorting files of records which do not fit in memory
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cstddef>
+#include <string>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p external_sort_options controls the resources \p external_sort and \p external_sort_by_key use.
+ */
+struct external_sort_options
+{
+  //! The number of bytes of memory the sort uses for its buffers and for sorting runs in memory.
+  std::size_t memory_budget = std::size_t{1} << 30;
+
+  //! The directory in which the sort creates its temporary files. If empty, the system's temporary directory is used.
+  std::string temporary_directory;
+
+  //! Whether to read ahead and write behind on separate threads, which splits the budget into more, smaller buffers.
+  bool overlap_io = true;
+};
+
+/*! \p external_sort sorts the records of type \c T stored in the file \p input_path into ascending order and writes
+ *  them to the file \p output_path. The sort is stable, and the files may be larger than the available memory.
+ *
+ *  The input is read in runs which fit in <tt>options.memory_budget</tt>, each run is sorted in memory with
+ *  \p stable_sort using \p exec and written to a temporary file, and the runs are then merged with a k-way merge
+ *  streamed to the output file, in several passes if there are too many runs for the buffers of a single pass to fit
+ *  in the budget. If the input fits in a single run, no temporary files are created.
+ *
+ *  \param exec The host execution policy sorting the runs.
+ *  \param input_path The file holding the records to sort, in their binary representation.
+ *  \param output_path The file to create or overwrite with the sorted records. It may be the same as \p input_path.
+ *  \param comp The comparison operator.
+ *  \param options The resources to use.
+ *
+ *  \tparam T is trivially copyable, and a model of <a
+ *          href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> if \p comp is
+ *          not given.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam StrictWeakOrdering is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a> on \c T.
+ *
+ *  \throw thrust::system_error if a file cannot be read or written, or if the size of the input is not a multiple of
+ *         <tt>sizeof(T)</tt>.
+ *
+ *  The following code snippet demonstrates how to sort a file of records by their first field with the TBB system:
+ *
+ *  \code
+ *  #include <thrust/external_sort.h>
+ *  #include <thrust/system/tbb/execution_policy.h>
+ *  ...
+ *  struct record
+ *  {
+ *    long long id;
+ *    char payload[56];
+ *  };
+ *
+ *  struct by_id
+ *  {
+ *    bool operator()(const record& a, const record& b) const
+ *    {
+ *      return a.id < b.id;
+ *    }
+ *  };
+ *  ...
+ *  thrust::external_sort_options options;
+ *  options.memory_budget = std::size_t{8} << 30;
+ *
+ *  thrust::external_sort<record>(thrust::tbb::par, "records.bin", "sorted.bin", by_id(), options);
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ */
+template <typename T, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path,
+                   StrictWeakOrdering comp,
+                   const external_sort_options& options);
+
+/*! \p external_sort sorts the records of type \c T stored in the file \p input_path with respect to \p comp and writes
+ *  them to the file \p output_path, with the default \p external_sort_options.
+ */
+template <typename T, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path,
+                   StrictWeakOrdering comp);
+
+/*! \p external_sort sorts the records of type \c T stored in the file \p input_path into ascending order and writes
+ *  them to the file \p output_path, with the default \p external_sort_options.
+ */
+template <typename T, typename DerivedPolicy>
+void external_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                   const std::string& input_path,
+                   const std::string& output_path);
+
+/*! \p external_sort_by_key sorts the keys of type \c Key stored in the file \p keys_input_path into ascending order,
+ *  together with the values of type \c Value stored at the same positions of the file \p values_input_path, like
+ *  \p stable_sort_by_key, and writes them to the files \p keys_output_path and \p values_output_path. The sort is
+ *  stable, and the files may be larger than the available memory. \p external_sort describes how the files are sorted.
+ *
+ *  \param exec The host execution policy sorting the runs.
+ *  \param keys_input_path The file holding the keys to sort, in their binary representation.
+ *  \param values_input_path The file holding the values, in their binary representation.
+ *  \param keys_output_path The file to create or overwrite with the sorted keys.
+ *  \param values_output_path The file to create or overwrite with the values in the order of the sorted keys.
+ *  \param comp The comparison operator.
+ *  \param options The resources to use.
+ *
+ *  \tparam Key is trivially copyable, and a model of <a
+ *          href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> if \p comp is
+ *          not given.
+ *  \tparam Value is trivially copyable.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam StrictWeakOrdering is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a> on \c Key.
+ *
+ *  \throw thrust::system_error if a file cannot be read or written, or if the files do not hold the same number of
+ *         keys and values.
+ *
+ *  \see \p external_sort
+ *  \see \p stable_sort_by_key
+ */
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path,
+                          StrictWeakOrdering comp,
+                          const external_sort_options& options);
+
+/*! \p external_sort_by_key sorts the keys stored in the file \p keys_input_path with respect to \p comp together
+ *  with the values stored in the file \p values_input_path, with the default \p external_sort_options.
+ */
+template <typename Key, typename Value, typename DerivedPolicy, typename StrictWeakOrdering>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path,
+                          StrictWeakOrdering comp);
+
+/*! \p external_sort_by_key sorts the keys stored in the file \p keys_input_path into ascending order together with
+ *  the values stored in the file \p values_input_path, with the default \p external_sort_options.
+ */
+template <typename Key, typename Value, typename DerivedPolicy>
+void external_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          const std::string& keys_input_path,
+                          const std::string& values_input_path,
+                          const std::string& keys_output_path,
+                          const std::string& values_output_path);
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/external_sort.inl>
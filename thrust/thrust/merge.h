@@ -717,6 +717,323 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator2 values_result,
   StrictWeakCompare comp);
 
+/*! \p merge_k combines \c k sorted ranges, stored one after another and delimited by a sequence of offsets, into a
+ *  single sorted range. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, so
+ *  <tt>[offsets_first, offsets_last)</tt> holds <tt>k + 1</tt> nondecreasing offsets. Unlike a cascade of \p merge
+ *  calls, which needs <tt>log2(k)</tt> passes over the data, every element is read and written once.
+ *
+ *  \p merge_k is stable: the relative order of elements within each segment is preserved, and for equivalent
+ *  elements of different segments, the element of the segment with the lower index precedes the other.
+ *
+ *  The return value is <tt>result + (offsets_first[k] - offsets_first[0])</tt>.
+ *
+ *  This version of \p merge_k compares elements using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param first The beginning of the input range holding all segments.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's argument types and to
+ *          a type in \p OutputIterator's set of \c value_types.
+ *  \tparam OffsetIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>.
+ *  \tparam StrictWeakOrdering is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Each segment shall be sorted with respect to \p comp.
+ *  \pre The resulting range shall not overlap with the input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_k to merge three sorted segments of integers using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[8]    = {1, 4, 7,  2, 5,  0, 3, 6};
+ *  int offsets[4] = {0, 3, 5, 8};
+ *
+ *  int result[8];
+ *
+ *  int *result_end = thrust::merge_k(thrust::host, offsets, offsets + 4, keys, result, ::cuda::std::less<int>());
+ *
+ *  // result = {0, 1, 2, 3, 4, 5, 6, 7}
+ *  \endcode
+ *
+ *  \see \p merge
+ *  \see \p merge_k_by_key
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+/*! \p merge_k combines \c k sorted ranges, stored one after another and delimited by a sequence of offsets, into a
+ *  single sorted range. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>.
+ *
+ *  \p merge_k is stable, and for equivalent elements the element of the segment with the lower index comes first.
+ *
+ *  This version of \p merge_k compares elements using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param first The beginning of the input range holding all segments.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \pre Each segment shall be sorted with respect to \c operator<.
+ *  \pre The resulting range shall not overlap with the input range.
+ *
+ *  \see \p merge
+ *  \see \p merge_k_by_key
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p merge_k combines \c k sorted ranges, stored one after another and delimited by a sequence of offsets, into a
+ *  single sorted range. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>.
+ *
+ *  \p merge_k is stable, and for equivalent elements the element of the segment with the lower index comes first.
+ *
+ *  This version of \p merge_k compares elements using a function object \p comp.
+ *
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param first The beginning of the input range holding all segments.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \pre Each segment shall be sorted with respect to \p comp.
+ *  \pre The resulting range shall not overlap with the input range.
+ *
+ *  \see \p merge
+ *  \see \p merge_k_by_key
+ */
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator merge_k(OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp);
+
+/*! \p merge_k combines \c k sorted ranges, stored one after another and delimited by a sequence of offsets, into a
+ *  single sorted range. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>.
+ *
+ *  \p merge_k is stable, and for equivalent elements the element of the segment with the lower index comes first.
+ *
+ *  This version of \p merge_k compares elements using \c operator<.
+ *
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param first The beginning of the input range holding all segments.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \pre Each segment shall be sorted with respect to \c operator<.
+ *  \pre The resulting range shall not overlap with the input range.
+ *
+ *  \see \p merge
+ *  \see \p merge_k_by_key
+ */
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator
+merge_k(OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p merge_k_by_key performs a key-value \p merge_k. That is, the keys of all segments are merged as by \p merge_k,
+ *  and the values associated with the keys, stored in a range starting at \p values_first with the same offsets,
+ *  are copied into the output range of values in the same order.
+ *
+ *  The return value is <tt>(keys_result + n, values_result + n)</tt>, where \c n is
+ *  <tt>offsets_first[k] - offsets_first[0]</tt>.
+ *
+ *  This version of \p merge_k_by_key compares keys using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param keys_first The beginning of the input range holding the keys of all segments.
+ *  \param values_first The beginning of the input range holding the values of all segments.
+ *  \param keys_result The beginning of the merged output range of keys.
+ *  \param values_result The beginning of the merged output range of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \pre Each segment of keys shall be sorted with respect to \p comp.
+ *  \pre The resulting ranges shall not overlap with any input range.
+ *
+ *  The following code snippet demonstrates how to use \p merge_k_by_key using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/merge.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[6]    = {1, 3,  1, 2,  0, 3};
+ *  int vals[6]    = {0, 0,  1, 1,  2, 2};
+ *  int offsets[4] = {0, 2, 4, 6};
+ *
+ *  int keys_result[6];
+ *  int vals_result[6];
+ *
+ *  thrust::merge_k_by_key(thrust::host, offsets, offsets + 4, keys, vals, keys_result, vals_result,
+ *                         ::cuda::std::less<int>());
+ *
+ *  // keys_result = {0, 1, 1, 2, 3, 3}
+ *  // vals_result = {2, 0, 1, 1, 0, 2}
+ *  \endcode
+ *
+ *  \see \p merge_by_key
+ *  \see \p merge_k
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp);
+
+/*! \p merge_k_by_key performs a key-value \p merge_k, comparing keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param keys_first The beginning of the input range holding the keys of all segments.
+ *  \param values_first The beginning of the input range holding the values of all segments.
+ *  \param keys_result The beginning of the merged output range of keys.
+ *  \param values_result The beginning of the merged output range of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \pre Each segment of keys shall be sorted with respect to \c operator<.
+ *  \pre The resulting ranges shall not overlap with any input range.
+ *
+ *  \see \p merge_by_key
+ *  \see \p merge_k
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result);
+
+/*! \p merge_k_by_key performs a key-value \p merge_k, comparing keys using a function object \p comp.
+ *
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param keys_first The beginning of the input range holding the keys of all segments.
+ *  \param values_first The beginning of the input range holding the values of all segments.
+ *  \param keys_result The beginning of the merged output range of keys.
+ *  \param values_result The beginning of the merged output range of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \pre Each segment of keys shall be sorted with respect to \p comp.
+ *  \pre The resulting ranges shall not overlap with any input range.
+ *
+ *  \see \p merge_by_key
+ *  \see \p merge_k
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp);
+
+/*! \p merge_k_by_key performs a key-value \p merge_k, comparing keys using \c operator<.
+ *
+ *  \param offsets_first The beginning of the sequence of segment offsets.
+ *  \param offsets_last The end of the sequence of segment offsets.
+ *  \param keys_first The beginning of the input range holding the keys of all segments.
+ *  \param values_first The beginning of the input range holding the values of all segments.
+ *  \param keys_result The beginning of the merged output range of keys.
+ *  \param values_result The beginning of the merged output range of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys,
+ *          and such that <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \pre Each segment of keys shall be sorted with respect to \c operator<.
+ *  \pre The resulting ranges shall not overlap with any input range.
+ *
+ *  \see \p merge_by_key
+ *  \see \p merge_k
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result);
+
 /*! \} // merging
  */
 
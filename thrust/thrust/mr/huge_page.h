@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief Memory resource backing large allocations with transparent or explicit huge pages.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#include <cuda/std/bit>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <new>
+
+#if _CCCL_OS(LINUX)
+#  include <sys/mman.h>
+#endif // _CCCL_OS(LINUX)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A type used for configuring \p huge_page_resource.
+ */
+struct huge_page_options
+{
+  /*! The size of a huge page. Mappings are aligned to and sized in multiples of this value.
+   */
+  std::size_t huge_page_size;
+  /*! Allocations of at least this many bytes are mapped directly from the operating system and backed by huge pages.
+   *      Smaller allocations are forwarded to \p new_delete_resource.
+   */
+  std::size_t threshold;
+  /*! If true, an explicit \p MAP_HUGETLB mapping (backed by the hugetlbfs pool of pages of \p huge_page_size bytes) is
+   *      attempted first. When that pool is exhausted or not configured, the resource falls back to a regular mapping
+   *      advised with \p MADV_HUGEPAGE.
+   */
+  bool use_hugetlbfs;
+
+  /*! Checks if the options are self-consistent.
+   *
+   *  \returns true if the options are valid, false otherwise.
+   */
+  bool validate() const
+  {
+    return huge_page_size != 0 && (huge_page_size & (huge_page_size - 1)) == 0;
+  }
+};
+
+/*! A memory resource that backs large allocations with huge pages to reduce TLB pressure of random-access workloads
+ *      on big host buffers.
+ *
+ *  Allocations of at least \p huge_page_options::threshold bytes are rounded up to a multiple of the huge page size,
+ *      mapped with alignment to the huge page size and advised with \p MADV_HUGEPAGE, so that the kernel can back them
+ *      with transparent huge pages. Optionally, explicit hugetlbfs mappings are tried first. Smaller allocations, and
+ *      all allocations on platforms without \p mmap, are served by \p new_delete_resource.
+ *
+ *  This resource can be used directly with \p mr::allocator, or as the upstream of the pool resources, in which case
+ *      the chunks the pools carve their blocks from are backed by huge pages.
+ */
+class huge_page_resource final : public new_delete_resource_base
+{
+public:
+  /*! Get the default options: 2 MiB huge pages, used for every allocation of at least one huge page, relying on
+   *      transparent huge pages only.
+   */
+  static huge_page_options get_default_options()
+  {
+    huge_page_options ret;
+
+    ret.huge_page_size = static_cast<std::size_t>(2) << 20;
+    ret.threshold      = ret.huge_page_size;
+    ret.use_hugetlbfs  = false;
+
+    return ret;
+  }
+
+  /*! Constructor.
+   *
+   *  \param options huge page options to use
+   */
+  huge_page_resource(huge_page_options options = get_default_options())
+      : m_options(options)
+  {
+    assert(m_options.validate());
+  }
+
+  /*! Returns the options this resource was constructed with.
+   */
+  huge_page_options options() const noexcept
+  {
+    return m_options;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (!uses_huge_pages(bytes))
+    {
+      return new_delete_resource_base::do_allocate(bytes, alignment);
+    }
+
+#if _CCCL_OS(LINUX)
+    const std::size_t mapped = mapping_size(bytes);
+
+#  if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if (m_options.use_hugetlbfs && alignment <= m_options.huge_page_size)
+    {
+      // request the configured page size explicitly; the default hugetlbfs page size may differ, and mapping_size()
+      // would then not match the size the kernel expects in munmap
+      const int page_size = ::cuda::std::countr_zero(m_options.huge_page_size) << MAP_HUGE_SHIFT;
+      const int flags     = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_size;
+      void* p             = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, flags, -1, 0);
+      if (p != MAP_FAILED)
+      {
+        return p;
+      }
+    }
+#  endif // MAP_HUGETLB && MAP_HUGE_SHIFT
+
+    // over-map by the alignment, then trim the misaligned head and the unused tail
+    const std::size_t align = alignment > m_options.huge_page_size ? alignment : m_options.huge_page_size;
+    void* raw =
+      ::mmap(nullptr, mapped + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+      throw std::bad_alloc();
+    }
+
+    const ::cuda::std::uintptr_t raw_int = reinterpret_cast<::cuda::std::uintptr_t>(raw);
+    const ::cuda::std::uintptr_t aligned = (raw_int + align - 1) & ~static_cast<::cuda::std::uintptr_t>(align - 1);
+    const std::size_t head               = static_cast<std::size_t>(aligned - raw_int);
+    const std::size_t tail               = align - head;
+
+    if (head != 0)
+    {
+      ::munmap(raw, head);
+    }
+    if (tail != 0)
+    {
+      ::munmap(reinterpret_cast<char*>(aligned) + mapped, tail);
+    }
+
+    void* p = reinterpret_cast<void*>(aligned);
+#  if defined(MADV_HUGEPAGE)
+    // a failure here only means no transparent huge pages; the mapping itself is still usable
+    ::madvise(p, mapped, MADV_HUGEPAGE);
+#  endif // MADV_HUGEPAGE
+    return p;
+#else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+    return new_delete_resource_base::do_allocate(bytes, alignment);
+#endif // !_CCCL_OS(LINUX)
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (!uses_huge_pages(bytes))
+    {
+      new_delete_resource_base::do_deallocate(p, bytes, alignment);
+      return;
+    }
+
+#if _CCCL_OS(LINUX)
+    ::munmap(p, mapping_size(bytes));
+#else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+    new_delete_resource_base::do_deallocate(p, bytes, alignment);
+#endif // !_CCCL_OS(LINUX)
+  }
+
+private:
+  bool uses_huge_pages(std::size_t bytes) const noexcept
+  {
+    return bytes != 0 && bytes >= m_options.threshold;
+  }
+
+  std::size_t mapping_size(std::size_t bytes) const noexcept
+  {
+    return (bytes + m_options.huge_page_size - 1) & ~(m_options.huge_page_size - 1);
+  }
+
+  huge_page_options m_options;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,344 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief Memory resource and allocator backed by a memory-mapped file.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_OS(WINDOWS)
+
+#  include <thrust/host_vector.h>
+#  include <thrust/mr/allocator.h>
+#  include <thrust/mr/memory_resource.h>
+#  include <thrust/system_error.h>
+
+#  include <cerrno>
+#  include <new>
+#  include <string>
+
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! How \p mapped_file_resource maps its file.
+ */
+enum class mapped_file_mode
+{
+  /*! The file is opened for reading and mapped read-only. Writing to the memory is an error.
+   */
+  read_only,
+  /*! The file is opened for reading and writing, and created if it does not exist. Writes to the memory are written to
+   *      the file, and allocations larger than the file extend it, so a growing container extends the file to its
+   *      capacity.
+   */
+  read_write,
+  /*! The file is opened for reading and mapped privately. Writes to the memory are visible only to this process and
+   *      never written to the file, and the part of an allocation beyond the end of the file is zero-filled memory.
+   */
+  copy_on_write
+};
+
+/*! The access pattern \p mapped_file_resource advises the operating system to expect for its mappings.
+ */
+enum class mapped_file_advice
+{
+  /*! No advice; the default read-ahead of the operating system.
+   */
+  normal,
+  /*! Pages are accessed in order, so aggressive read-ahead pays off and pages can be freed soon after they are used.
+   */
+  sequential,
+  /*! Pages are accessed in random order, so read-ahead is disabled.
+   */
+  random,
+  /*! The whole mapping is needed soon, so the operating system starts reading it in the background.
+   */
+  will_need
+};
+
+/*! A type used for configuring \p mapped_file_resource.
+ */
+struct mapped_file_options
+{
+  /*! How the file is opened and mapped.
+   */
+  mapped_file_mode mode;
+  /*! If true, mappings are populated with \p MAP_POPULATE, reading the whole file into the page cache before the
+   *      allocation returns instead of faulting it in page by page when the memory is first touched. Ignored on
+   *      platforms without \p MAP_POPULATE.
+   */
+  bool populate;
+  /*! The access pattern passed to \p madvise for every mapping.
+   */
+  mapped_file_advice advice;
+};
+
+/*! A memory resource whose allocations are mappings of a file.
+ *
+ *  Every allocation maps the beginning of the file, so the memory of an allocation of \p n bytes holds the first \p n
+ *      bytes of the file without them being read up front: pages are read on first access and shared with the page
+ *      cache, instead of being copied into memory owned by the process. This makes loading large, read-mostly arrays
+ *      near-instant, and lets the host systems run algorithms directly on the mapped pages.
+ *
+ *  Because all allocations alias the same file, the resource is meant to back a single container at a time, typically
+ *      through \p mapped_file_allocator; it must not be used as the upstream resource of a pool. Allocations are
+ *      aligned to the page size, and requests for a larger alignment throw \p std::bad_alloc, as do requests larger
+ *      than the file of a \p mapped_file_mode::read_only resource.
+ */
+class mapped_file_resource final : public memory_resource<>
+{
+public:
+  /*! Get the default options: read-only mappings, faulted in on demand with the default read-ahead.
+   */
+  static mapped_file_options get_default_options()
+  {
+    mapped_file_options ret;
+
+    ret.mode     = mapped_file_mode::read_only;
+    ret.populate = false;
+    ret.advice   = mapped_file_advice::normal;
+
+    return ret;
+  }
+
+  /*! Constructor. Opens the file.
+   *
+   *  \param path the file to map
+   *  \param options mapping options to use
+   *  \throws thrust::system_error if the file cannot be opened.
+   */
+  explicit mapped_file_resource(const std::string& path, mapped_file_options options = get_default_options())
+      : m_options(options)
+      , m_fd(options.mode == mapped_file_mode::read_write ? ::open(path.c_str(), O_RDWR | O_CREAT, 0644)
+                                                          : ::open(path.c_str(), O_RDONLY))
+  {
+    if (m_fd == -1)
+    {
+      throw thrust::system_error(errno, thrust::generic_category(), "mapped_file_resource: cannot open " + path);
+    }
+  }
+
+  mapped_file_resource(const mapped_file_resource&)            = delete;
+  mapped_file_resource& operator=(const mapped_file_resource&) = delete;
+
+  /*! Destructor. Closes the file; mappings which are still alive remain valid.
+   */
+  ~mapped_file_resource()
+  {
+    ::close(m_fd);
+  }
+
+  /*! Returns the options this resource was constructed with.
+   */
+  mapped_file_options options() const noexcept
+  {
+    return m_options;
+  }
+
+  /*! Returns the current size of the file, in bytes.
+   */
+  std::size_t file_size() const
+  {
+    struct ::stat status;
+    if (::fstat(m_fd, &status) != 0)
+    {
+      throw thrust::system_error(errno, thrust::generic_category(), "mapped_file_resource: cannot stat the file");
+    }
+    return static_cast<std::size_t>(status.st_size);
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (alignment > page_size())
+    {
+      throw std::bad_alloc();
+    }
+
+    std::size_t file_bytes = file_size();
+    if (bytes > file_bytes)
+    {
+      if (m_options.mode == mapped_file_mode::read_only)
+      {
+        throw std::bad_alloc();
+      }
+      if (m_options.mode == mapped_file_mode::read_write)
+      {
+        if (::ftruncate(m_fd, static_cast<::off_t>(bytes)) != 0)
+        {
+          throw std::bad_alloc();
+        }
+        file_bytes = bytes;
+      }
+    }
+
+    const int protection = m_options.mode == mapped_file_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    int flags            = m_options.mode == mapped_file_mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+#  if defined(MAP_POPULATE)
+    if (m_options.populate)
+    {
+      flags |= MAP_POPULATE;
+    }
+#  endif // MAP_POPULATE
+
+    const std::size_t length      = mapping_size(bytes);
+    const std::size_t file_length = bytes < file_bytes ? bytes : file_bytes;
+
+    void* p = nullptr;
+    if (file_length == length)
+    {
+      p = ::mmap(nullptr, length, protection, flags, m_fd, 0);
+      if (p == MAP_FAILED)
+      {
+        throw std::bad_alloc();
+      }
+    }
+    else
+    {
+      // the part of the allocation beyond the end of the file is anonymous memory, with the file mapped over the rest
+      p = ::mmap(nullptr, length, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED)
+      {
+        throw std::bad_alloc();
+      }
+      if (file_length != 0 && ::mmap(p, file_length, protection, flags | MAP_FIXED, m_fd, 0) == MAP_FAILED)
+      {
+        ::munmap(p, length);
+        throw std::bad_alloc();
+      }
+    }
+
+    // a failure here only means no advice; the mapping itself is still usable
+    ::madvise(p, length, advice());
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t) override
+  {
+    ::munmap(p, mapping_size(bytes));
+  }
+
+private:
+  static std::size_t page_size() noexcept
+  {
+    return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  }
+
+  // mmap rejects empty mappings, so empty allocations map a single byte
+  static std::size_t mapping_size(std::size_t bytes) noexcept
+  {
+    return bytes == 0 ? 1 : bytes;
+  }
+
+  int advice() const noexcept
+  {
+    switch (m_options.advice)
+    {
+      case mapped_file_advice::sequential:
+        return MADV_SEQUENTIAL;
+      case mapped_file_advice::random:
+        return MADV_RANDOM;
+      case mapped_file_advice::will_need:
+        return MADV_WILLNEED;
+      default:
+        return MADV_NORMAL;
+    }
+  }
+
+  mapped_file_options m_options;
+  int m_fd;
+};
+
+/*! An allocator of objects in the file of a \p mapped_file_resource.
+ *
+ *  Unlike \p allocator, this allocator leaves objects it default-constructs uninitialized, so that a container sized
+ *      to the file holds the contents of the file without reading or writing any of its pages. Elements a container
+ *      default-constructs therefore hold the bytes of the file at their position, or zeros beyond its end. \c T is
+ *      expected to be trivially copyable.
+ *
+ *  \tparam T the type that will be allocated by this allocator.
+ */
+template <typename T>
+class mapped_file_allocator : public thrust::mr::allocator<T, mapped_file_resource>
+{
+  using base = thrust::mr::allocator<T, mapped_file_resource>;
+
+public:
+  /*! The \p rebind metafunction provides the type of a \p mapped_file_allocator instantiated with another type.
+   *
+   *  \tparam U the other type to use for instantiation.
+   */
+  template <typename U>
+  struct rebind
+  {
+    /*! The alias \p other gives the type of the rebound \p mapped_file_allocator.
+     */
+    using other = mapped_file_allocator<U>;
+  };
+
+  /*! Constructor.
+   *
+   *  \param resource the resource mapping the file.
+   */
+  _CCCL_HOST mapped_file_allocator(mapped_file_resource* resource)
+      : base(resource)
+  {}
+
+  /*! Conversion constructor from an allocator of a different type. Copies the memory resource pointer. */
+  template <typename U>
+  _CCCL_HOST mapped_file_allocator(const mapped_file_allocator<U>& other)
+      : base(other)
+  {}
+
+  /*! Default construction leaves the object uninitialized, keeping the contents of the file.
+   */
+  template <typename U>
+  _CCCL_HOST_DEVICE void construct(U*)
+  {}
+};
+
+/*! A \p host_vector whose elements live in the file of a \p mapped_file_resource.
+ */
+template <typename T>
+using mapped_file_vector = thrust::host_vector<T, mapped_file_allocator<T>>;
+
+/*! Opens the file of a \p mapped_file_resource as a vector of the records it holds, without reading it.
+ *
+ *  \tparam T the type of the records in the file
+ *  \param resource the resource mapping the file, which must outlive the vector
+ *  \return a vector of <tt>resource.file_size() / sizeof(T)</tt> elements mapping the file.
+ */
+template <typename T>
+_CCCL_HOST mapped_file_vector<T> open_mapped_file_vector(mapped_file_resource& resource)
+{
+  return mapped_file_vector<T>(resource.file_size() / sizeof(T), mapped_file_allocator<T>(&resource));
+}
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
+
+#endif // !_CCCL_OS(WINDOWS)
@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file thrust/pipeline.h
+ *  \brief Fused execution of a sequence of transformations, filters, scans and reductions
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup transformations
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p transform_stage is a stage of a \p pipeline which replaces each element \c x by <tt>f(x)</tt>, like \p transform.
+ *  Use \p make_transform_stage to create one.
+ *
+ *  \tparam UnaryFunction The type of the function object applied to each element.
+ *
+ *  \see \p pipeline
+ */
+template <typename UnaryFunction>
+struct transform_stage
+{
+  //! The function object applied to each element.
+  UnaryFunction f;
+};
+
+/*! \p filter_stage is a stage of a \p pipeline which keeps exactly the elements \c x for which <tt>pred(x)</tt> is
+ *  \c true, like \p copy_if. Use \p make_filter_stage to create one.
+ *
+ *  \tparam Predicate The type of the predicate selecting the elements to keep.
+ *
+ *  \see \p pipeline
+ */
+template <typename Predicate>
+struct filter_stage
+{
+  //! The predicate selecting the elements to keep.
+  Predicate pred;
+};
+
+/*! \p inclusive_scan_stage is a stage of a \p pipeline which replaces the elements by their inclusive prefix sums with
+ *  respect to \c op, like \p inclusive_scan. The sums have the type of the elements which reach the stage.
+ *  Use \p make_inclusive_scan_stage to create one.
+ *
+ *  \tparam AssociativeOperator The type of the associative operator of the scan.
+ *
+ *  \see \p pipeline
+ */
+template <typename AssociativeOperator>
+struct inclusive_scan_stage
+{
+  //! The associative operator of the scan.
+  AssociativeOperator op;
+};
+
+/*! \p reduce_by_key_stage is a stage of a \p pipeline which reduces each run of consecutive elements with equal keys to
+ *  a single element, like \p reduce_by_key. The elements which reach the stage are tuples holding a key and a value,
+ *  and the stage produces a <tt>thrust::tuple</tt> of the first key of each run and the reduction of its values with
+ *  respect to \c op. Use \p make_reduce_by_key_stage to create one.
+ *
+ *  \tparam BinaryPredicate The type of the equivalence relation comparing keys.
+ *  \tparam AssociativeOperator The type of the associative operator reducing values.
+ *
+ *  \see \p pipeline
+ */
+template <typename BinaryPredicate, typename AssociativeOperator>
+struct reduce_by_key_stage
+{
+  //! The equivalence relation comparing keys.
+  BinaryPredicate pred;
+  //! The associative operator reducing values.
+  AssociativeOperator op;
+};
+
+/*! \p make_transform_stage creates a \p transform_stage.
+ *
+ *  \param f The function object applied to each element.
+ *  \return A \p transform_stage applying \p f.
+ */
+template <typename UnaryFunction>
+_CCCL_HOST_DEVICE transform_stage<UnaryFunction> make_transform_stage(UnaryFunction f)
+{
+  return transform_stage<UnaryFunction>{f};
+}
+
+/*! \p make_filter_stage creates a \p filter_stage.
+ *
+ *  \param pred The predicate selecting the elements to keep.
+ *  \return A \p filter_stage keeping the elements satisfying \p pred.
+ */
+template <typename Predicate>
+_CCCL_HOST_DEVICE filter_stage<Predicate> make_filter_stage(Predicate pred)
+{
+  return filter_stage<Predicate>{pred};
+}
+
+/*! \p make_inclusive_scan_stage creates an \p inclusive_scan_stage.
+ *
+ *  \param op The associative operator of the scan.
+ *  \return An \p inclusive_scan_stage with respect to \p op.
+ */
+template <typename AssociativeOperator>
+_CCCL_HOST_DEVICE inclusive_scan_stage<AssociativeOperator> make_inclusive_scan_stage(AssociativeOperator op)
+{
+  return inclusive_scan_stage<AssociativeOperator>{op};
+}
+
+/*! \p make_reduce_by_key_stage creates a \p reduce_by_key_stage.
+ *
+ *  \param pred The equivalence relation comparing keys.
+ *  \param op The associative operator reducing values.
+ *  \return A \p reduce_by_key_stage comparing keys with \p pred and reducing values with \p op.
+ */
+template <typename BinaryPredicate, typename AssociativeOperator>
+_CCCL_HOST_DEVICE reduce_by_key_stage<BinaryPredicate, AssociativeOperator>
+make_reduce_by_key_stage(BinaryPredicate pred, AssociativeOperator op)
+{
+  return reduce_by_key_stage<BinaryPredicate, AssociativeOperator>{pred, op};
+}
+
+/*! \p pipeline passes the elements of <tt>[first, last)</tt> through a sequence of stages and copies the elements
+ *  produced by the last stage to the range beginning at \p result. Each stage consumes the elements produced by the
+ *  previous one: \p transform_stage and \p filter_stage act on one element at a time, \p inclusive_scan_stage and
+ *  \p reduce_by_key_stage carry state from one element to the next. Without stages, \p pipeline is a \p copy.
+ *
+ *  The result is the same as that of calling the corresponding algorithms one after another, but the stages are
+ *  fused: the cpp system streams each element through all stages, and the omp and tbb systems process the input in
+ *  cache-sized tiles, materializing intermediate results only at scans and reductions by key which are followed by
+ *  further stages. Other systems run the stages one after another.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result The beginning of the output sequence.
+ *  \param stages The stages, in order of application.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>, and the elements produced by the last stage are convertible to a type in its set of
+ *          \c value_types.
+ *  \tparam Stages are specializations of \p transform_stage, \p filter_stage, \p inclusive_scan_stage and
+ *          \p reduce_by_key_stage.
+ *
+ *  \pre The binary predicate of a \p reduce_by_key_stage shall be an equivalence relation.
+ *  \pre The output sequence shall not overlap with the input sequence.
+ *
+ *  The following code snippet demonstrates how to use \p pipeline to sum the squares of the positive numbers of a
+ *  sequence per key in a single pass, using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/iterator/zip_iterator.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct square_value
+ *  {
+ *    thrust::tuple<int, int> operator()(thrust::tuple<int, int> x) const
+ *    {
+ *      return thrust::make_tuple(thrust::get<0>(x), thrust::get<1>(x) * thrust::get<1>(x));
+ *    }
+ *  };
+ *
+ *  struct positive_value
+ *  {
+ *    bool operator()(thrust::tuple<int, int> x) const
+ *    {
+ *      return thrust::get<1>(x) > 0;
+ *    }
+ *  };
+ *  ...
+ *  int keys[7]   = {0, 0, 0, 1, 1, 2, 2};
+ *  int values[7] = {1, -2, 3, 4, 5, -6, 7};
+ *
+ *  int keys_result[3];
+ *  int values_result[3];
+ *
+ *  thrust::pipeline(thrust::host,
+ *                   thrust::make_zip_iterator(keys, values),
+ *                   thrust::make_zip_iterator(keys + 7, values + 7),
+ *                   thrust::make_zip_iterator(keys_result, values_result),
+ *                   thrust::make_filter_stage(positive_value()),
+ *                   thrust::make_transform_stage(square_value()),
+ *                   thrust::make_reduce_by_key_stage(::cuda::std::equal_to<int>(), ::cuda::std::plus<int>()));
+ *
+ *  // keys_result   = {0, 1, 2}
+ *  // values_result = {10, 41, 49}
+ *  \endcode
+ *
+ *  \see \p transform
+ *  \see \p copy_if
+ *  \see \p inclusive_scan
+ *  \see \p reduce_by_key
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+_CCCL_HOST_DEVICE OutputIterator pipeline(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages);
+
+/*! \p pipeline passes the elements of <tt>[first, last)</tt> through a sequence of stages and copies the elements
+ *  produced by the last stage to the range beginning at \p result. The stages are fused as described above.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result The beginning of the output sequence.
+ *  \param stages The stages, in order of application.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>, and the elements produced by the last stage are convertible to a type in its set of
+ *          \c value_types.
+ *  \tparam Stages are specializations of \p transform_stage, \p filter_stage, \p inclusive_scan_stage and
+ *          \p reduce_by_key_stage.
+ *
+ *  \pre The binary predicate of a \p reduce_by_key_stage shall be an equivalence relation.
+ *  \pre The output sequence shall not overlap with the input sequence.
+ *
+ *  \see \p transform
+ *  \see \p copy_if
+ *  \see \p inclusive_scan
+ *  \see \p reduce_by_key
+ */
+template <typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(InputIterator first, InputIterator last, OutputIterator result, const Stages&... stages);
+
+/*! \} // end transformations
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/pipeline.inl>
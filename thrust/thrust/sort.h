@@ -905,6 +905,332 @@ void stable_sort_by_key(RandomAccessIterator1 keys_first,
                         RandomAccessIterator2 values_first,
                         StrictWeakOrdering comp);
 
+/*! \p segmented_sort sorts each of a sequence of segments of <tt>[keys_first, keys_last)</tt> independently of the
+ *  others. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>, where
+ *  \c i ranges over <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. Rows of a CSR matrix, for example, are
+ *  the segments with the begin offsets <tt>[row_offsets, row_offsets + num_rows)</tt> and the end offsets
+ *  <tt>row_offsets + 1</tt>. Elements which belong to no segment are left unchanged.
+ *
+ *  \p segmented_sort is stable: it preserves the relative order of equivalent elements within each segment.
+ *
+ *  The CUDA system sorts all segments at once with \p cub::DeviceSegmentedSort when the keys are arithmetic and \p comp
+ *  is \p cuda::std::less or \p cuda::std::greater. For other keys or comparators it copies the offsets to the host
+ *  once and then launches one merge sort per segment, so prefer few, long segments there.
+ *
+ *  This version of \p segmented_sort compares objects using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence holding all segments.
+ *  \param keys_last The end of the sequence holding all segments.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to
+ *          \p StrictWeakOrdering's argument types.
+ *  \tparam OffsetIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort the rows of a CSR matrix by column
+ *  index using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int row_offsets[4] = {0, 3, 3, 7};
+ *  int columns[7]     = {5, 1, 3,  6, 0, 4, 2};
+ *
+ *  thrust::segmented_sort(thrust::host, columns, columns + 7, row_offsets, row_offsets + 3, row_offsets + 1,
+ *                         ::cuda::std::less<int>());
+ *
+ *  // columns is now {1, 3, 5,  0, 2, 4, 6}
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator keys_last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts each of a sequence of segments of <tt>[keys_first, keys_last)</tt> independently of the
+ *  others. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left unchanged.
+ *
+ *  \p segmented_sort is stable. This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence holding all segments.
+ *  \param keys_last The end of the sequence holding all segments.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort_by_key
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator keys_last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort sorts each of a sequence of segments of <tt>[keys_first, keys_last)</tt> independently of the
+ *  others. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left unchanged.
+ *
+ *  \p segmented_sort is stable. This version of \p segmented_sort compares objects using a function object \p comp.
+ *
+ *  \param keys_first The beginning of the sequence holding all segments.
+ *  \param keys_last The end of the sequence holding all segments.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *  \param comp Comparison operator.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort_by_key
+ */
+template <typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(RandomAccessIterator keys_first,
+                    RandomAccessIterator keys_last,
+                    OffsetIterator1 begin_offsets_first,
+                    OffsetIterator1 begin_offsets_last,
+                    OffsetIterator2 end_offsets_first,
+                    StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts each of a sequence of segments of <tt>[keys_first, keys_last)</tt> independently of the
+ *  others. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left unchanged.
+ *
+ *  \p segmented_sort is stable. This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  \param keys_first The beginning of the sequence holding all segments.
+ *  \param keys_last The end of the sequence holding all segments.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort_by_key
+ */
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(RandomAccessIterator keys_first,
+                    RandomAccessIterator keys_last,
+                    OffsetIterator1 begin_offsets_first,
+                    OffsetIterator1 begin_offsets_last,
+                    OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort_by_key performs a key-value \p segmented_sort. That is, the keys of each segment are sorted as
+ *  by \p segmented_sort, and the values at the same positions of <tt>[values_first, values_first + (keys_last -
+ *  keys_first))</tt> are permuted along with their keys.
+ *
+ *  \p segmented_sort_by_key is stable: it preserves the relative order of equivalent keys within each segment.
+ *
+ *  On the CUDA system the cost of \p segmented_sort_by_key depends on the keys and \p comp as for \p segmented_sort.
+ *
+ *  This version of \p segmented_sort_by_key compares keys using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence holding all segments.
+ *  \param keys_last The end of the key sequence holding all segments.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and \p RandomAccessIterator1's \c value_type is convertible to
+ *          \p StrictWeakOrdering's argument types.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator2 is mutable.
+ *  \tparam OffsetIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort the rows of a CSR matrix by
+ *  column index using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int row_offsets[4] = {0, 3, 3, 7};
+ *  int columns[7]     = {5, 1, 3,  6, 0, 4, 2};
+ *  char values[7]     = {'a', 'b', 'c',  'd', 'e', 'f', 'g'};
+ *
+ *  thrust::segmented_sort_by_key(thrust::host, columns, columns + 7, values, row_offsets, row_offsets + 3,
+ *                                row_offsets + 1, ::cuda::std::less<int>());
+ *
+ *  // columns is now {  1,   3,   5,    0,   2,   4,   6}
+ *  // values is now  {'b', 'c', 'a',  'e', 'g', 'f', 'd'}
+ *  \endcode
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p segmented_sort
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key performs a key-value \p segmented_sort, comparing keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence holding all segments.
+ *  \param keys_last The end of the key sequence holding all segments.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p segmented_sort
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort_by_key performs a key-value \p segmented_sort, comparing keys using a function object \p comp.
+ *
+ *  \param keys_first The beginning of the key sequence holding all segments.
+ *  \param keys_last The end of the key sequence holding all segments.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *  \param comp Comparison operator.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p segmented_sort
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                           RandomAccessIterator1 keys_last,
+                           RandomAccessIterator2 values_first,
+                           OffsetIterator1 begin_offsets_first,
+                           OffsetIterator1 begin_offsets_last,
+                           OffsetIterator2 end_offsets_first,
+                           StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key performs a key-value \p segmented_sort, comparing keys using \c operator<.
+ *
+ *  \param keys_first The beginning of the key sequence holding all segments.
+ *  \param keys_last The end of the key sequence holding all segments.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_offsets_first The beginning of the sequence of offsets at which the segments begin.
+ *  \param begin_offsets_last The end of the sequence of offsets at which the segments begin.
+ *  \param end_offsets_first The beginning of the sequence of offsets at which the segments end.
+ *
+ *  \pre Each segment shall lie within <tt>[keys_first, keys_last)</tt>, and no two segments shall overlap.
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p segmented_sort
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                           RandomAccessIterator1 keys_last,
+                           RandomAccessIterator2 values_first,
+                           OffsetIterator1 begin_offsets_first,
+                           OffsetIterator1 begin_offsets_last,
+                           OffsetIterator2 end_offsets_first);
+
 /*! \} // end sorting
  */
 
@@ -40,6 +40,7 @@
 
 #include <thrust/system/cpp/detail/adjacent_difference.h>
 #include <thrust/system/cpp/detail/assign_value.h>
+#include <thrust/system/cpp/detail/async_launch.h>
 #include <thrust/system/cpp/detail/binary_search.h>
 #include <thrust/system/cpp/detail/copy.h>
 #include <thrust/system/cpp/detail/copy_if.h>
@@ -59,6 +60,7 @@
 #include <thrust/system/cpp/detail/merge.h>
 #include <thrust/system/cpp/detail/mismatch.h>
 #include <thrust/system/cpp/detail/partition.h>
+#include <thrust/system/cpp/detail/pipeline.h>
 #include <thrust/system/cpp/detail/reduce.h>
 #include <thrust/system/cpp/detail/reduce_by_key.h>
 #include <thrust/system/cpp/detail/remove.h>
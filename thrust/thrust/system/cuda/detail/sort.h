@@ -41,6 +41,7 @@
 
 #  include <cub/device/device_merge_sort.cuh>
 #  include <cub/device/device_radix_sort.cuh>
+#  include <cub/device/device_segmented_sort.cuh>
 
 #  include <thrust/detail/alignment.h>
 #  include <thrust/detail/integer_math.h>
@@ -59,8 +60,11 @@
 #  include <thrust/type_traits/is_contiguous_iterator.h>
 
 #  include <cuda/cmath>
+#  include <cuda/std/algorithm>
 #  include <cuda/std/cstdint>
 
+#  include <vector>
+
 #  if _CCCL_HAS_NVFP16()
 #    include <cuda_fp16.h>
 #  endif // _CCCL_HAS_NVFP16()
@@ -399,6 +403,365 @@ THRUST_RUNTIME_FUNCTION void smart_sort(
 }
 } // namespace __smart_sort
 
+//---------------------------------------------------------------------
+// Segmented sort
+//---------------------------------------------------------------------
+
+namespace __segmented_sort
+{
+
+template <class SORT_ITEMS, class Comparator>
+struct dispatch;
+
+// sort keys in ascending order
+template <class KeyOrVoid>
+struct dispatch<thrust::detail::false_type, ::cuda::std::less<KeyOrVoid>>
+{
+  template <class Key, class Item, class BeginOffsetIt, class EndOffsetIt>
+  THRUST_RUNTIME_FUNCTION static cudaError_t
+  doit(void* d_temp_storage,
+       size_t& temp_storage_bytes,
+       const Key* keys_in,
+       Key* keys_out,
+       const Item* /*items_in*/,
+       Item* /*items_out*/,
+       ::cuda::std::int64_t count,
+       ::cuda::std::int64_t num_segments,
+       BeginOffsetIt begin_offsets,
+       EndOffsetIt end_offsets,
+       cudaStream_t stream)
+  {
+    return cub::DeviceSegmentedSort::StableSortKeys(
+      d_temp_storage, temp_storage_bytes, keys_in, keys_out, count, num_segments, begin_offsets, end_offsets, stream);
+  }
+}; // struct dispatch -- sort keys in ascending order;
+
+// sort keys in descending order
+template <class KeyOrVoid>
+struct dispatch<thrust::detail::false_type, ::cuda::std::greater<KeyOrVoid>>
+{
+  template <class Key, class Item, class BeginOffsetIt, class EndOffsetIt>
+  THRUST_RUNTIME_FUNCTION static cudaError_t
+  doit(void* d_temp_storage,
+       size_t& temp_storage_bytes,
+       const Key* keys_in,
+       Key* keys_out,
+       const Item* /*items_in*/,
+       Item* /*items_out*/,
+       ::cuda::std::int64_t count,
+       ::cuda::std::int64_t num_segments,
+       BeginOffsetIt begin_offsets,
+       EndOffsetIt end_offsets,
+       cudaStream_t stream)
+  {
+    return cub::DeviceSegmentedSort::StableSortKeysDescending(
+      d_temp_storage, temp_storage_bytes, keys_in, keys_out, count, num_segments, begin_offsets, end_offsets, stream);
+  }
+}; // struct dispatch -- sort keys in descending order;
+
+// sort pairs in ascending order
+template <class KeyOrVoid>
+struct dispatch<thrust::detail::true_type, ::cuda::std::less<KeyOrVoid>>
+{
+  template <class Key, class Item, class BeginOffsetIt, class EndOffsetIt>
+  THRUST_RUNTIME_FUNCTION static cudaError_t
+  doit(void* d_temp_storage,
+       size_t& temp_storage_bytes,
+       const Key* keys_in,
+       Key* keys_out,
+       const Item* items_in,
+       Item* items_out,
+       ::cuda::std::int64_t count,
+       ::cuda::std::int64_t num_segments,
+       BeginOffsetIt begin_offsets,
+       EndOffsetIt end_offsets,
+       cudaStream_t stream)
+  {
+    return cub::DeviceSegmentedSort::StableSortPairs(
+      d_temp_storage,
+      temp_storage_bytes,
+      keys_in,
+      keys_out,
+      items_in,
+      items_out,
+      count,
+      num_segments,
+      begin_offsets,
+      end_offsets,
+      stream);
+  }
+}; // struct dispatch -- sort pairs in ascending order;
+
+// sort pairs in descending order
+template <class KeyOrVoid>
+struct dispatch<thrust::detail::true_type, ::cuda::std::greater<KeyOrVoid>>
+{
+  template <class Key, class Item, class BeginOffsetIt, class EndOffsetIt>
+  THRUST_RUNTIME_FUNCTION static cudaError_t
+  doit(void* d_temp_storage,
+       size_t& temp_storage_bytes,
+       const Key* keys_in,
+       Key* keys_out,
+       const Item* items_in,
+       Item* items_out,
+       ::cuda::std::int64_t count,
+       ::cuda::std::int64_t num_segments,
+       BeginOffsetIt begin_offsets,
+       EndOffsetIt end_offsets,
+       cudaStream_t stream)
+  {
+    return cub::DeviceSegmentedSort::StableSortPairsDescending(
+      d_temp_storage,
+      temp_storage_bytes,
+      keys_in,
+      keys_out,
+      items_in,
+      items_out,
+      count,
+      num_segments,
+      begin_offsets,
+      end_offsets,
+      stream);
+  }
+}; // struct dispatch -- sort pairs in descending order;
+
+// Sorts the segments from a copy of the keys and items back into them. cub::DeviceSegmentedSort does not write the
+// elements outside of all segments, so they keep their values.
+template <typename SORT_ITEMS,
+          typename Derived,
+          typename Key,
+          typename Item,
+          typename BeginOffsetIt,
+          typename EndOffsetIt,
+          typename CompareOp>
+THRUST_RUNTIME_FUNCTION void radix_sort(
+  execution_policy<Derived>& policy,
+  Key* keys,
+  Item* items,
+  ::cuda::std::int64_t count,
+  ::cuda::std::int64_t num_segments,
+  BeginOffsetIt begin_offsets,
+  EndOffsetIt end_offsets,
+  CompareOp)
+{
+  size_t temp_storage_bytes = 0;
+  cudaStream_t stream       = cuda_cub::stream(policy);
+
+  const ::cuda::std::int64_t items_count = SORT_ITEMS::value ? count : 0;
+
+  cudaError_t status;
+
+  status = dispatch<SORT_ITEMS, CompareOp>::doit(
+    nullptr, temp_storage_bytes, keys, keys, items, items, count, num_segments, begin_offsets, end_offsets, stream);
+  cuda_cub::throw_on_error(status, "segmented_sort: failed on 1st step");
+
+  size_t keys_temp_storage  = ::cuda::round_up(sizeof(Key) * count, 128);
+  size_t items_temp_storage = ::cuda::round_up(sizeof(Item) * items_count, 128);
+
+  size_t storage_size = keys_temp_storage + items_temp_storage + temp_storage_bytes;
+
+  // Allocate temporary storage.
+  thrust::detail::temporary_array<std::uint8_t, Derived> tmp(policy, storage_size);
+
+  Key* keys_in   = thrust::detail::aligned_reinterpret_cast<Key*>(tmp.data().get());
+  Item* items_in = thrust::detail::aligned_reinterpret_cast<Item*>(tmp.data().get() + keys_temp_storage);
+  void* ptr      = static_cast<void*>(tmp.data().get() + keys_temp_storage + items_temp_storage);
+
+  cuda_cub::copy_n(policy, keys, count, keys_in);
+  if constexpr (SORT_ITEMS::value)
+  {
+    cuda_cub::copy_n(policy, items, items_count, items_in);
+  }
+
+  status = dispatch<SORT_ITEMS, CompareOp>::doit(
+    ptr, temp_storage_bytes, keys_in, keys, items_in, items, count, num_segments, begin_offsets, end_offsets, stream);
+  cuda_cub::throw_on_error(status, "segmented_sort: failed on 2nd step");
+}
+
+// CUB has no segmented sort taking a comparator, so the segments are merge sorted one at a time. The offsets are
+// copied to the host once, and the sorts share the temporary storage of the longest segment and are not synchronized
+// in between, but every segment still costs a launch.
+template <typename SORT_ITEMS,
+          typename Derived,
+          typename KeysIt,
+          typename ItemsIt,
+          typename BeginOffsetIt,
+          typename EndOffsetIt,
+          typename CompareOp>
+_CCCL_HOST void sort_each_segment(
+  execution_policy<Derived>& policy,
+  KeysIt keys_first,
+  ItemsIt items_first,
+  ::cuda::std::int64_t num_segments,
+  BeginOffsetIt begin_offsets_first,
+  EndOffsetIt end_offsets_first,
+  CompareOp compare_op)
+{
+  using offset_t  = ::cuda::std::int64_t;
+  using size_type = thrust::detail::it_difference_t<KeysIt>;
+
+  cudaStream_t stream = cuda_cub::stream(policy);
+  cudaError_t status;
+
+  thrust::detail::temporary_array<offset_t, Derived> d_offsets(policy, 2 * num_segments);
+  cuda_cub::copy_n(policy, begin_offsets_first, num_segments, d_offsets.begin());
+  cuda_cub::copy_n(policy, end_offsets_first, num_segments, d_offsets.begin() + num_segments);
+
+  std::vector<offset_t> offsets(static_cast<size_t>(2 * num_segments));
+  status = cuda_cub::trivial_copy_from_device(
+    offsets.data(), thrust::raw_pointer_cast(d_offsets.data()), offsets.size(), stream);
+  cuda_cub::throw_on_error(status, "segmented_sort: failed to copy the offsets to the host");
+
+  offset_t max_count = 0;
+  for (offset_t i = 0; i < num_segments; ++i)
+  {
+    max_count = (::cuda::std::max) (max_count, offsets[num_segments + i] - offsets[i]);
+  }
+  if (max_count < 2)
+  {
+    return;
+  }
+
+  size_t storage_size = 0;
+  status              = __merge_sort::doit_step<SORT_ITEMS, thrust::detail::true_type>(
+    nullptr, storage_size, keys_first, items_first, static_cast<size_type>(max_count), compare_op, stream);
+  cuda_cub::throw_on_error(status, "segmented_sort: failed on 1st step");
+
+  // Allocate temporary storage.
+  thrust::detail::temporary_array<std::uint8_t, Derived> tmp(policy, storage_size);
+  void* ptr = static_cast<void*>(tmp.data().get());
+
+  for (offset_t i = 0; i < num_segments; ++i)
+  {
+    const offset_t begin = offsets[i];
+    const offset_t count = offsets[num_segments + i] - begin;
+    if (count > 1)
+    {
+      size_t segment_storage_size = storage_size;
+      status                      = __merge_sort::doit_step<SORT_ITEMS, thrust::detail::true_type>(
+        ptr,
+        segment_storage_size,
+        keys_first + begin,
+        items_first + (SORT_ITEMS::value ? begin : 0),
+        static_cast<size_type>(count),
+        compare_op,
+        stream);
+      cuda_cub::throw_on_error(status, "segmented_sort: failed on 2nd step");
+    }
+  }
+}
+
+template <
+  class SORT_ITEMS,
+  class Policy,
+  class KeysIt,
+  class ItemsIt,
+  class BeginOffsetIt,
+  class EndOffsetIt,
+  class CompareOp,
+  ::cuda::std::enable_if_t<!__smart_sort::can_use_primitive_sort<thrust::detail::it_value_t<KeysIt>, CompareOp>::value,
+                           int> = 0>
+THRUST_RUNTIME_FUNCTION void segmented_sort(
+  execution_policy<Policy>& policy,
+  KeysIt keys_first,
+  KeysIt,
+  ItemsIt items_first,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first,
+  CompareOp compare_op)
+{
+  const auto num_segments = static_cast<::cuda::std::int64_t>(begin_offsets_last - begin_offsets_first);
+  if (num_segments == 0)
+  {
+    return;
+  }
+
+  // The offsets are read on the host. The device pass must still see the kernels launched there, see
+  // THRUST_CDP_DISPATCH.
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (__segmented_sort::sort_each_segment<SORT_ITEMS>(
+       policy, keys_first, items_first, num_segments, begin_offsets_first, end_offsets_first, compare_op);),
+    (using size_type = thrust::detail::it_difference_t<KeysIt>; size_t storage_size = 0;
+     __merge_sort::doit_step<SORT_ITEMS, thrust::detail::true_type>(
+       nullptr, storage_size, keys_first, items_first, size_type{0}, compare_op, cuda_cub::stream(policy));));
+
+  cuda_cub::throw_on_error(cuda_cub::synchronize_optional(policy), "segmented_sort: failed to synchronize");
+}
+
+template <
+  class SORT_ITEMS,
+  class Policy,
+  class KeysIt,
+  class ItemsIt,
+  class BeginOffsetIt,
+  class EndOffsetIt,
+  class CompareOp,
+  ::cuda::std::enable_if_t<__smart_sort::can_use_primitive_sort<thrust::detail::it_value_t<KeysIt>, CompareOp>::value,
+                           int> = 0>
+THRUST_RUNTIME_FUNCTION void segmented_sort(
+  execution_policy<Policy>& policy,
+  KeysIt keys_first,
+  KeysIt keys_last,
+  ItemsIt items_first,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first,
+  CompareOp compare_op)
+{
+  const auto count        = static_cast<::cuda::std::int64_t>(keys_last - keys_first);
+  const auto num_segments = static_cast<::cuda::std::int64_t>(begin_offsets_last - begin_offsets_first);
+  if (count == 0 || num_segments == 0)
+  {
+    return;
+  }
+
+  // ensure sequences have trivial iterators
+  thrust::detail::trivial_sequence<KeysIt, Policy> keys(policy, keys_first, keys_last);
+
+  if constexpr (SORT_ITEMS::value)
+  {
+    thrust::detail::trivial_sequence<ItemsIt, Policy> values(policy, items_first, items_first + count);
+
+    __segmented_sort::radix_sort<SORT_ITEMS>(
+      policy,
+      thrust::raw_pointer_cast(&*keys.begin()),
+      thrust::raw_pointer_cast(&*values.begin()),
+      count,
+      num_segments,
+      begin_offsets_first,
+      end_offsets_first,
+      compare_op);
+
+    if (!is_contiguous_iterator<ItemsIt>::value)
+    {
+      cuda_cub::copy(policy, values.begin(), values.end(), items_first);
+    }
+  }
+  else
+  {
+    __segmented_sort::radix_sort<SORT_ITEMS>(
+      policy,
+      thrust::raw_pointer_cast(&*keys.begin()),
+      thrust::raw_pointer_cast(&*keys.begin()),
+      count,
+      num_segments,
+      begin_offsets_first,
+      end_offsets_first,
+      compare_op);
+  }
+
+  // copy results back, if necessary
+  if (!is_contiguous_iterator<KeysIt>::value)
+  {
+    cuda_cub::copy(policy, keys.begin(), keys.end(), keys_first);
+  }
+
+  cuda_cub::throw_on_error(cuda_cub::synchronize_optional(policy), "segmented_sort: failed to synchronize");
+}
+} // namespace __segmented_sort
+
 //-------------------------
 // Thrust API entry points
 //-------------------------
@@ -445,6 +808,57 @@ void _CCCL_HOST_DEVICE stable_sort_by_key(
     (thrust::stable_sort_by_key(cvt_to_seq(derived_cast(policy)), keys_first, keys_last, values, compare_op);));
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <class Derived, class KeysIt, class BeginOffsetIt, class EndOffsetIt, class CompareOp>
+void _CCCL_HOST_DEVICE segmented_sort(
+  execution_policy<Derived>& policy,
+  KeysIt keys_first,
+  KeysIt keys_last,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first,
+  CompareOp compare_op)
+{
+  THRUST_CDP_DISPATCH(
+    (using key_t = thrust::detail::it_value_t<KeysIt>; key_t* null_ = nullptr;
+     __segmented_sort::segmented_sort<thrust::detail::false_type>(
+       policy, keys_first, keys_last, null_, begin_offsets_first, begin_offsets_last, end_offsets_first, compare_op);),
+    (thrust::segmented_sort(
+       cvt_to_seq(derived_cast(policy)),
+       keys_first,
+       keys_last,
+       begin_offsets_first,
+       begin_offsets_last,
+       end_offsets_first,
+       compare_op);));
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class Derived, class KeysIt, class ValuesIt, class BeginOffsetIt, class EndOffsetIt, class CompareOp>
+void _CCCL_HOST_DEVICE segmented_sort_by_key(
+  execution_policy<Derived>& policy,
+  KeysIt keys_first,
+  KeysIt keys_last,
+  ValuesIt values,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first,
+  CompareOp compare_op)
+{
+  THRUST_CDP_DISPATCH(
+    (__segmented_sort::segmented_sort<thrust::detail::true_type>(
+       policy, keys_first, keys_last, values, begin_offsets_first, begin_offsets_last, end_offsets_first, compare_op);),
+    (thrust::segmented_sort_by_key(
+       cvt_to_seq(derived_cast(policy)),
+       keys_first,
+       keys_last,
+       values,
+       begin_offsets_first,
+       begin_offsets_last,
+       end_offsets_first,
+       compare_op);));
+}
+
 // API with default comparator
 
 template <class Derived, class ItemsIt>
@@ -477,6 +891,48 @@ stable_sort_by_key(execution_policy<Derived>& policy, KeysIt keys_first, KeysIt
   cuda_cub::stable_sort_by_key(policy, keys_first, keys_last, values, ::cuda::std::less<key_type>());
 }
 
+template <class Derived, class KeysIt, class BeginOffsetIt, class EndOffsetIt>
+void _CCCL_HOST_DEVICE segmented_sort(
+  execution_policy<Derived>& policy,
+  KeysIt keys_first,
+  KeysIt keys_last,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first)
+{
+  using key_type = thrust::detail::it_value_t<KeysIt>;
+  cuda_cub::segmented_sort(
+    policy,
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    ::cuda::std::less<key_type>());
+}
+
+template <class Derived, class KeysIt, class ValuesIt, class BeginOffsetIt, class EndOffsetIt>
+void _CCCL_HOST_DEVICE segmented_sort_by_key(
+  execution_policy<Derived>& policy,
+  KeysIt keys_first,
+  KeysIt keys_last,
+  ValuesIt values,
+  BeginOffsetIt begin_offsets_first,
+  BeginOffsetIt begin_offsets_last,
+  EndOffsetIt end_offsets_first)
+{
+  using key_type = thrust::detail::it_value_t<KeysIt>;
+  cuda_cub::segmented_sort_by_key(
+    policy,
+    keys_first,
+    keys_last,
+    values,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    ::cuda::std::less<key_type>());
+}
+
 } // namespace cuda_cub
 THRUST_NAMESPACE_END
 #endif
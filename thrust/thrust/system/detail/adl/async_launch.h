@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// the purpose of this header is to #include the async_launch.h header
+// of the host and device systems. It should be #included in any
+// code which uses adl to dispatch async_launch
+
+// SCons can't see through the #defines below to figure out what this header
+// includes, so we fake it out by specifying all possible files we might end up
+// including inside an #if 0.
+#if 0
+#  include <thrust/system/cpp/detail/async_launch.h>
+#  include <thrust/system/cuda/detail/async_launch.h>
+#  include <thrust/system/omp/detail/async_launch.h>
+#  include <thrust/system/tbb/detail/async_launch.h>
+#endif
+
+#define __THRUST_HOST_SYSTEM_ASYNC_LAUNCH_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async_launch.h>
+#include __THRUST_HOST_SYSTEM_ASYNC_LAUNCH_HEADER
+#undef __THRUST_HOST_SYSTEM_ASYNC_LAUNCH_HEADER
+
+#define __THRUST_DEVICE_SYSTEM_ASYNC_LAUNCH_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/async_launch.h>
+#include __THRUST_DEVICE_SYSTEM_ASYNC_LAUNCH_HEADER
+#undef __THRUST_DEVICE_SYSTEM_ASYNC_LAUNCH_HEADER
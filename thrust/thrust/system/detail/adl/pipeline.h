@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// the purpose of this header is to #include the pipeline.h header
+// of the sequential, host, and device systems. It should be #included in any
+// code which uses adl to dispatch pipeline
+
+#include <thrust/system/detail/sequential/pipeline.h>
+
+// SCons can't see through the #defines below to figure out what this header
+// includes, so we fake it out by specifying all possible files we might end up
+// including inside an #if 0.
+#if 0
+#  include <thrust/system/cpp/detail/pipeline.h>
+#  include <thrust/system/cuda/detail/pipeline.h>
+#  include <thrust/system/omp/detail/pipeline.h>
+#  include <thrust/system/tbb/detail/pipeline.h>
+#endif
+
+#define __THRUST_HOST_SYSTEM_PIPELINE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/pipeline.h>
+#include __THRUST_HOST_SYSTEM_PIPELINE_HEADER
+#undef __THRUST_HOST_SYSTEM_PIPELINE_HEADER
+
+#define __THRUST_DEVICE_SYSTEM_PIPELINE_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/pipeline.h>
+#include __THRUST_DEVICE_SYSTEM_PIPELINE_HEADER
+#undef __THRUST_DEVICE_SYSTEM_PIPELINE_HEADER
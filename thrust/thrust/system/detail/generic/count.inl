@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/count.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/system/detail/generic/count.h>
 #include <thrust/transform_reduce.h>
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/equal.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/mismatch.h>
 #include <thrust/system/detail/generic/equal.h>
@@ -25,11 +25,15 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/copy.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
+#include <thrust/sort.h>
 #include <thrust/system/detail/generic/merge.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -148,6 +152,109 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
     ::cuda::std::less<value_type>());
 } // end merge_by_key()
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using value_type      = thrust::detail::it_value_t<RandomAccessIterator>;
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  if (offsets_first == offsets_last)
+  {
+    return result;
+  }
+
+  const difference_type begin = static_cast<difference_type>(*offsets_first);
+  const difference_type end   = static_cast<difference_type>(*(offsets_last - 1));
+
+  // The segments are stored in order, so a stable sort of their concatenation orders equivalent elements by segment,
+  // exactly like a stable k-way merge. Systems which can merge in a single pass override this.
+  thrust::detail::temporary_array<value_type, DerivedPolicy> keys(exec, first + begin, first + end);
+  thrust::stable_sort(exec, keys.begin(), keys.end(), comp);
+  return thrust::copy(exec, keys.begin(), keys.end(), result);
+} // end merge_k()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  return thrust::merge_k(exec, offsets_first, offsets_last, first, result, ::cuda::std::less<value_type>());
+} // end merge_k()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  using iterator_tuple = thrust::tuple<OutputIterator1, OutputIterator2>;
+
+  thrust::detail::compare_first<StrictWeakOrdering> comp_first{comp};
+
+  iterator_tuple result =
+    thrust::merge_k(exec,
+                    offsets_first,
+                    offsets_last,
+                    thrust::make_zip_iterator(keys_first, values_first),
+                    thrust::make_zip_iterator(keys_result, values_result),
+                    comp_first)
+      .get_iterator_tuple();
+
+  return thrust::make_pair(thrust::get<0>(result), thrust::get<1>(result));
+} // end merge_k_by_key()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  return thrust::merge_k_by_key(
+    exec,
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    ::cuda::std::less<value_type>());
+} // end merge_k_by_key()
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
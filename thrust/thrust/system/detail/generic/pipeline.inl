@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/generic/pipeline.h>
+#include <thrust/system/detail/internal/pipeline_stages.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace pipeline_detail
+{
+
+template <typename T, int I>
+struct tuple_element_of
+{
+  using result_type = ::cuda::std::decay_t<::cuda::std::tuple_element_t<I, T>>;
+
+  _CCCL_HOST_DEVICE result_type operator()(const T& x) const
+  {
+    return thrust::get<I>(x);
+  }
+};
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename UnaryFunction>
+_CCCL_HOST_DEVICE OutputIterator run_stage(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const transform_stage<UnaryFunction>& stage)
+{
+  return thrust::transform(exec, first, last, result, stage.f);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
+_CCCL_HOST_DEVICE OutputIterator run_stage(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const filter_stage<Predicate>& stage)
+{
+  return thrust::copy_if(exec, first, last, result, stage.pred);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename AssociativeOperator>
+_CCCL_HOST_DEVICE OutputIterator run_stage(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const inclusive_scan_stage<AssociativeOperator>& stage)
+{
+  return thrust::inclusive_scan(exec, first, last, result, stage.op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+_CCCL_HOST_DEVICE OutputIterator run_stage(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const reduce_by_key_stage<BinaryPredicate, AssociativeOperator>& stage)
+{
+  using value_type  = thrust::detail::it_value_t<InputIterator>;
+  using get_key     = tuple_element_of<value_type, 0>;
+  using get_value   = tuple_element_of<value_type, 1>;
+  using key_type    = typename get_key::result_type;
+  using mapped_type = typename get_value::result_type;
+
+  const auto n = thrust::distance(first, last);
+
+  // reduce_by_key writes keys and values to separate ranges
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys(exec, n);
+  thrust::detail::temporary_array<mapped_type, DerivedPolicy> values(exec, n);
+
+  const auto ends = thrust::reduce_by_key(
+    exec,
+    thrust::make_transform_iterator(first, get_key()),
+    thrust::make_transform_iterator(last, get_key()),
+    thrust::make_transform_iterator(first, get_value()),
+    keys.begin(),
+    values.begin(),
+    stage.pred,
+    stage.op);
+
+  return thrust::copy(exec,
+                      thrust::make_zip_iterator(keys.begin(), values.begin()),
+                      thrust::make_zip_iterator(ends.first, ends.second),
+                      result);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator run_stages(
+  thrust::execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result)
+{
+  return thrust::copy(exec, first, last, result);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Stage>
+_CCCL_HOST_DEVICE OutputIterator run_stages(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stage& stage)
+{
+  return pipeline_detail::run_stage(exec, first, last, result, stage);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Stage1,
+          typename Stage2,
+          typename... Stages>
+_CCCL_HOST_DEVICE OutputIterator run_stages(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stage1& stage1,
+  const Stage2& stage2,
+  const Stages&... stages)
+{
+  using value_type =
+    thrust::system::detail::internal::stage_output_t<Stage1, thrust::detail::it_value_t<InputIterator>>;
+
+  // no stage produces more elements than it consumes
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, thrust::distance(first, last));
+
+  const auto temp_last = pipeline_detail::run_stage(exec, first, last, temp.begin(), stage1);
+
+  return pipeline_detail::run_stages(exec, temp.begin(), temp_last, result, stage2, stages...);
+}
+
+} // end namespace pipeline_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+_CCCL_HOST_DEVICE OutputIterator pipeline(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  return pipeline_detail::run_stages(exec, first, last, result, stages...);
+} // end pipeline()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -31,6 +31,7 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/system/detail/generic/sort.h>
 #include <thrust/tuple.h>
 
@@ -152,6 +153,113 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
       .get_iterator_tuple());
 } // end is_sorted_until()
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  // One stable_sort per segment, reading each offset through the offset iterators. Both cost a round trip per segment
+  // when the data lives in another memory space, so systems which sort many segments at once override this.
+  const difference_type num_segments = static_cast<difference_type>(begin_offsets_last - begin_offsets_first);
+  for (difference_type i = 0; i < num_segments; ++i)
+  {
+    const difference_type begin = static_cast<difference_type>(begin_offsets_first[i]);
+    const difference_type end   = static_cast<difference_type>(end_offsets_first[i]);
+    if (end - begin > 1)
+    {
+      thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+  }
+} // end segmented_sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator keys_last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  thrust::segmented_sort(
+    exec,
+    keys_first,
+    keys_last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    ::cuda::std::less<value_type>());
+} // end segmented_sort()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  // one stable_sort_by_key per segment, like segmented_sort above
+  const difference_type num_segments = static_cast<difference_type>(begin_offsets_last - begin_offsets_first);
+  for (difference_type i = 0; i < num_segments; ++i)
+  {
+    const difference_type begin = static_cast<difference_type>(begin_offsets_first[i]);
+    const difference_type end   = static_cast<difference_type>(end_offsets_first[i]);
+    if (end - begin > 1)
+    {
+      thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+  }
+} // end segmented_sort_by_key()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  thrust::segmented_sort_by_key(
+    exec,
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    ::cuda::std::less<value_type>());
+} // end segmented_sort_by_key()
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE void
 stable_sort(thrust::execution_policy<DerivedPolicy>&, RandomAccessIterator, RandomAccessIterator, StrictWeakOrdering)
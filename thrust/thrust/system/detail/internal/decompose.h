@@ -117,6 +117,18 @@ private:
   index_type m_large_interval;
 };
 
+// Returns a decomposition of [0, N) which depends on N only, and not on the number of processors or threads.
+// Combining per-interval results in interval order is therefore run-to-run deterministic, even for
+// pseudo-associative operators like floating-point addition.
+template <typename IndexType>
+_CCCL_HOST_DEVICE uniform_decomposition<IndexType> deterministic_decomposition(IndexType N)
+{
+  // enough intervals to balance the load on large machines, each large enough to amortize scheduling overhead
+  const IndexType granularity   = 1024;
+  const IndexType max_intervals = 1024;
+  return uniform_decomposition<IndexType>(N, granularity, max_intervals);
+}
+
 } // end namespace internal
 } // end namespace detail
 } // end namespace system
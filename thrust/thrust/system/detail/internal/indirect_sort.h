@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/temporary_array.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// A sort by key moves the values along with the keys in every pass. For wide values it is cheaper to sort the keys
+// together with the indices of the values, and then to move each value once, by a gather.
+
+// values of at least this many bytes are sorted indirectly
+inline constexpr ::cuda::std::size_t indirect_sort_min_value_size = 32;
+
+template <typename Value>
+inline constexpr bool use_indirect_sort_by_key = sizeof(Value) >= indirect_sort_min_value_size;
+
+template <typename Index,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void indirect_stable_sort_by_key_n(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  Index n,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  thrust::detail::temporary_array<Index, DerivedPolicy> indices(exec, n);
+  thrust::sequence(exec, indices.begin(), indices.end());
+
+  // the indices are narrow, so this sorts them along with the keys directly
+  thrust::stable_sort_by_key(exec, keys_first, keys_first + n, indices.begin(), comp);
+
+  const thrust::detail::temporary_array<value_type, DerivedPolicy> values(exec, values_first, n);
+  thrust::gather(exec, indices.begin(), indices.end(), values.begin(), values_first);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void indirect_stable_sort_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  const auto n = keys_last - keys_first;
+
+  // 32-bit indices halve the traffic of the index sort compared to 64-bit ones
+  if (static_cast<::cuda::std::uint64_t>(n) <= (::cuda::std::numeric_limits<::cuda::std::uint32_t>::max)())
+  {
+    indirect_stable_sort_by_key_n(exec, keys_first, static_cast<::cuda::std::uint32_t>(n), values_first, comp);
+  }
+  else
+  {
+    indirect_stable_sort_by_key_n(exec, keys_first, static_cast<::cuda::std::uint64_t>(n), values_first, comp);
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/sequential/multiway_merge.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace multiway_merge_detail
+{
+
+// Orders (run, position) samples like the merge orders their elements: by value, then by run.
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct sample_less
+{
+  RandomAccessIterator first;
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename Size>
+  bool operator()(const thrust::pair<Size, Size>& lhs, const thrust::pair<Size, Size>& rhs) const
+  {
+    if (comp(first[lhs.second], first[rhs.second]))
+    {
+      return true;
+    }
+    if (comp(first[rhs.second], first[lhs.second]))
+    {
+      return false;
+    }
+    return lhs < rhs;
+  }
+};
+
+} // namespace multiway_merge_detail
+
+// Splits a k-way merge of the sorted runs stored at [first + offsets[i], first + offsets[i + 1]) into independent
+// parts of about equal size, which are then merged concurrently with sequential loser trees by merge_part(). Every
+// element is read and written exactly once.
+//
+// The parts are delimited by splitter elements, which are chosen from a regular sample of all runs. For a splitter at
+// position q of run s, the part boundary in run j is the upper bound of its value for j < s, the lower bound for j > s
+// and q itself for j == s, which keeps the merge stable. Sampling every g-th element of each run bounds the imbalance
+// of a part by k * g elements.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename StrictWeakOrdering>
+class multiway_merge_plan
+{
+public:
+  using size_type  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // the smallest number of elements worth merging in a separate part
+  static constexpr size_type min_part_size = 1 << 14;
+  // samples taken per run and part; bounds the imbalance of a part to 1 / oversampling of its size
+  static constexpr size_type oversampling = 8;
+
+  template <typename OffsetIterator>
+  multiway_merge_plan(
+    thrust::execution_policy<DerivedPolicy>& exec,
+    OffsetIterator offsets_first,
+    OffsetIterator offsets_last,
+    RandomAccessIterator first,
+    OutputIterator result,
+    StrictWeakOrdering comp,
+    size_type max_parts)
+      : m_first(first)
+      , m_result(result)
+      , m_comp(comp)
+      , m_num_runs(0)
+      , m_num_elements(0)
+      , m_num_parts(1)
+      , m_ends(nullptr)
+      , m_runs(exec)
+      , m_splits(exec)
+      , m_scratch(exec)
+  {
+    const size_type num_offsets = static_cast<size_type>(offsets_last - offsets_first);
+    const size_type num_segments = num_offsets < 2 ? 0 : num_offsets - 1;
+
+    // begins and ends of the nonempty runs
+    m_runs.allocate(2 * num_segments);
+    size_type* begins = raw_runs();
+    size_type* ends   = begins + num_segments;
+    for (size_type i = 0; i < num_segments; ++i)
+    {
+      const size_type begin = static_cast<size_type>(offsets_first[i]);
+      const size_type end   = static_cast<size_type>(offsets_first[i + 1]);
+      if (begin != end)
+      {
+        begins[m_num_runs] = begin;
+        ends[m_num_runs]   = end;
+        m_num_elements += end - begin;
+        ++m_num_runs;
+      }
+    }
+    m_ends = ends;
+
+    if (m_num_runs > 1)
+    {
+      m_num_parts = (::cuda::std::max) (size_type{1}, (::cuda::std::min) (max_parts, m_num_elements / min_part_size));
+    }
+
+    m_splits.allocate((m_num_parts + 1) * m_num_runs);
+    m_scratch.allocate(4 * m_num_runs * m_num_parts);
+    split(exec);
+  }
+
+  size_type num_parts() const
+  {
+    return m_num_parts;
+  }
+
+  // Merges the elements between the splitters part and part + 1. Parts are independent of each other.
+  void merge_part(size_type part)
+  {
+    const size_type* lower  = raw_splits() + part * m_num_runs;
+    const size_type* upper  = lower + m_num_runs;
+    size_type* cursors      = thrust::raw_pointer_cast(m_scratch.data()) + 4 * part * m_num_runs;
+    size_type* ends         = cursors + m_num_runs;
+    size_type* tree         = ends + m_num_runs;
+    const size_type* begins = raw_runs();
+
+    size_type output_offset = 0;
+    size_type num_runs      = 0;
+    for (size_type j = 0; j < m_num_runs; ++j)
+    {
+      output_offset += lower[j] - begins[j];
+      if (lower[j] != upper[j])
+      {
+        cursors[num_runs] = lower[j];
+        ends[num_runs]    = upper[j];
+        ++num_runs;
+      }
+    }
+
+    thrust::system::detail::sequential::multiway_merge(
+      m_first, num_runs, cursors, ends, tree, m_result + output_offset, m_comp);
+  }
+
+  OutputIterator end() const
+  {
+    return m_result + m_num_elements;
+  }
+
+private:
+  size_type* raw_runs()
+  {
+    return thrust::raw_pointer_cast(m_runs.data());
+  }
+
+  size_type* raw_splits()
+  {
+    return thrust::raw_pointer_cast(m_splits.data());
+  }
+
+  void split(thrust::execution_policy<DerivedPolicy>& exec)
+  {
+    const size_type* begins = raw_runs();
+    size_type* splits       = raw_splits();
+
+    for (size_type j = 0; j < m_num_runs; ++j)
+    {
+      splits[j]                            = begins[j];
+      splits[m_num_parts * m_num_runs + j] = m_ends[j];
+    }
+
+    if (m_num_parts == 1)
+    {
+      return;
+    }
+
+    // sample every stride-th element of each run
+    const size_type stride =
+      (::cuda::std::max) (size_type{1}, m_num_elements / (m_num_runs * m_num_parts * oversampling));
+
+    using sample_type = thrust::pair<size_type, size_type>;
+    size_type num_samples = 0;
+    for (size_type j = 0; j < m_num_runs; ++j)
+    {
+      num_samples += (m_ends[j] - begins[j]) / stride;
+    }
+
+    thrust::detail::temporary_array<sample_type, DerivedPolicy> samples(exec, num_samples);
+    sample_type* raw_samples = thrust::raw_pointer_cast(samples.data());
+    size_type n              = 0;
+    for (size_type j = 0; j < m_num_runs; ++j)
+    {
+      for (size_type pos = begins[j] + stride - 1; pos < m_ends[j]; pos += stride)
+      {
+        raw_samples[n++] = sample_type(j, pos);
+      }
+    }
+
+    thrust::sort(thrust::seq,
+                 raw_samples,
+                 raw_samples + num_samples,
+                 multiway_merge_detail::sample_less<RandomAccessIterator, StrictWeakOrdering>{m_first, m_comp});
+
+    for (size_type part = 1; part < m_num_parts; ++part)
+    {
+      size_type* row = splits + part * m_num_runs;
+      if (num_samples == 0)
+      {
+        // too few elements to sample; the last part merges everything
+        for (size_type j = 0; j < m_num_runs; ++j)
+        {
+          row[j] = begins[j];
+        }
+        continue;
+      }
+
+      const sample_type splitter = raw_samples[part * num_samples / m_num_parts];
+      const value_type value     = m_first[splitter.second];
+      for (size_type j = 0; j < m_num_runs; ++j)
+      {
+        if (j < splitter.first)
+        {
+          row[j] = thrust::upper_bound(thrust::seq, m_first + begins[j], m_first + m_ends[j], value, m_comp) - m_first;
+        }
+        else if (j > splitter.first)
+        {
+          row[j] = thrust::lower_bound(thrust::seq, m_first + begins[j], m_first + m_ends[j], value, m_comp) - m_first;
+        }
+        else
+        {
+          row[j] = splitter.second;
+        }
+      }
+    }
+  }
+
+  RandomAccessIterator m_first;
+  OutputIterator m_result;
+  StrictWeakOrdering m_comp;
+  size_type m_num_runs;
+  size_type m_num_elements;
+  size_type m_num_parts;
+  const size_type* m_ends;
+  thrust::detail::temporary_array<size_type, DerivedPolicy> m_runs;
+  thrust::detail::temporary_array<size_type, DerivedPolicy> m_splits;
+  thrust::detail::temporary_array<size_type, DerivedPolicy> m_scratch;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
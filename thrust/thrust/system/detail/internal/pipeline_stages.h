@@ -0,0 +1,347 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/tuple.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/optional>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+
+// declared in thrust/pipeline.h, which includes the systems' pipeline implementations
+template <typename UnaryFunction>
+struct transform_stage;
+
+template <typename Predicate>
+struct filter_stage;
+
+template <typename AssociativeOperator>
+struct inclusive_scan_stage;
+
+template <typename BinaryPredicate, typename AssociativeOperator>
+struct reduce_by_key_stage;
+
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// A stage_runner applies a pipeline stage to a stream of elements of type T. Elements are pushed one at a time, and
+// the runner passes the elements it produces to a sink, a function object taking one element. Stages which carry state
+// from one element to the next may hold back elements until finish is called at the end of the stream.
+template <typename Stage, typename T>
+class stage_runner;
+
+template <typename UnaryFunction, typename T>
+class stage_runner<transform_stage<UnaryFunction>, T>
+{
+public:
+  using output_type = ::cuda::std::decay_t<::cuda::std::invoke_result_t<UnaryFunction&, const T&>>;
+
+  _CCCL_HOST_DEVICE explicit stage_runner(const transform_stage<UnaryFunction>& stage)
+      : m_f(stage.f)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    sink(m_f(x));
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink&)
+  {}
+
+private:
+  UnaryFunction m_f;
+};
+
+template <typename Predicate, typename T>
+class stage_runner<filter_stage<Predicate>, T>
+{
+public:
+  using output_type = T;
+
+  _CCCL_HOST_DEVICE explicit stage_runner(const filter_stage<Predicate>& stage)
+      : m_pred(stage.pred)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    if (m_pred(x))
+    {
+      sink(x);
+    }
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink&)
+  {}
+
+private:
+  Predicate m_pred;
+};
+
+template <typename AssociativeOperator, typename T>
+class stage_runner<inclusive_scan_stage<AssociativeOperator>, T>
+{
+public:
+  // Use the input type per https://wg21.link/P0571, like the sequential inclusive_scan
+  using output_type = T;
+  using carry_type  = ::cuda::std::optional<T>;
+
+  // carry is the sum of all elements before the stream, if there are any
+  _CCCL_HOST_DEVICE explicit stage_runner(const inclusive_scan_stage<AssociativeOperator>& stage,
+                                          carry_type carry = carry_type())
+      : m_op(stage.op)
+      , m_sum(carry)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    if (m_sum)
+    {
+      *m_sum = m_op(*m_sum, x);
+    }
+    else
+    {
+      m_sum = x;
+    }
+    sink(*m_sum);
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink&)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE T combine(const T& x, const T& y)
+  {
+    return m_op(x, y);
+  }
+
+private:
+  AssociativeOperator m_op;
+  carry_type m_sum;
+};
+
+template <typename BinaryPredicate, typename AssociativeOperator, typename T>
+class stage_runner<reduce_by_key_stage<BinaryPredicate, AssociativeOperator>, T>
+{
+public:
+  using key_type    = ::cuda::std::decay_t<::cuda::std::tuple_element_t<0, T>>;
+  using value_type  = ::cuda::std::decay_t<::cuda::std::tuple_element_t<1, T>>;
+  using output_type = thrust::tuple<key_type, value_type>;
+  using carry_type  = ::cuda::std::optional<output_type>;
+
+  // carry is the run the stream continues, if any
+  _CCCL_HOST_DEVICE explicit stage_runner(const reduce_by_key_stage<BinaryPredicate, AssociativeOperator>& stage,
+                                          carry_type carry = carry_type())
+      : m_pred(stage.pred)
+      , m_op(stage.op)
+      , m_run(carry)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    if (m_run && m_pred(thrust::get<0>(*m_run), thrust::get<0>(x)))
+    {
+      thrust::get<1>(*m_run) = m_op(thrust::get<1>(*m_run), thrust::get<1>(x));
+    }
+    else
+    {
+      if (m_run)
+      {
+        sink(*m_run);
+      }
+      m_run.emplace(thrust::get<0>(x), thrust::get<1>(x));
+    }
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink& sink)
+  {
+    if (m_run)
+    {
+      sink(*m_run);
+      m_run.reset();
+    }
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE bool same_run(const key_type& x, const key_type& y)
+  {
+    return m_pred(x, y);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE value_type combine(const value_type& x, const value_type& y)
+  {
+    return m_op(x, y);
+  }
+
+private:
+  BinaryPredicate m_pred;
+  AssociativeOperator m_op;
+  carry_type m_run;
+};
+
+template <typename Stage, typename T>
+using stage_output_t = typename stage_runner<Stage, T>::output_type;
+
+// scans and reductions by key depend on all elements before, so they end the groups of stages the parallel systems
+// fuse into a single pass
+template <typename Stage>
+struct is_barrier_stage : ::cuda::std::false_type
+{};
+
+template <typename AssociativeOperator>
+struct is_barrier_stage<inclusive_scan_stage<AssociativeOperator>> : ::cuda::std::true_type
+{};
+
+template <typename BinaryPredicate, typename AssociativeOperator>
+struct is_barrier_stage<reduce_by_key_stage<BinaryPredicate, AssociativeOperator>> : ::cuda::std::true_type
+{};
+
+template <typename Stage>
+struct is_filter_stage : ::cuda::std::false_type
+{};
+
+template <typename Predicate>
+struct is_filter_stage<filter_stage<Predicate>> : ::cuda::std::true_type
+{};
+
+// Returns the index of the first barrier among Stages at or after first, or the number of stages if there is none.
+template <typename... Stages>
+_CCCL_HOST_DEVICE constexpr ::cuda::std::size_t find_barrier_stage(::cuda::std::size_t first)
+{
+  const bool is_barrier[] = {is_barrier_stage<Stages>::value..., true};
+  while (!is_barrier[first])
+  {
+    ++first;
+  }
+  return first;
+}
+
+// Pushes the elements a stage_runner produces into the next part of a stage_chain.
+template <typename Chain, typename Sink>
+struct stage_chain_sink
+{
+  Chain& chain;
+  Sink& sink;
+
+  template <typename U>
+  _CCCL_HOST_DEVICE void operator()(const U& x)
+  {
+    chain.push(x, sink);
+  }
+};
+
+// A stage_chain fuses a sequence of stages applied to elements of type T.
+template <typename T, typename... Stages>
+class stage_chain;
+
+template <typename T>
+class stage_chain<T>
+{
+public:
+  using output_type = T;
+
+  static constexpr bool has_filter = false;
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    sink(x);
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink&)
+  {}
+};
+
+template <typename T, typename Stage, typename... Stages>
+class stage_chain<T, Stage, Stages...>
+{
+  using head_type = stage_runner<Stage, T>;
+  using tail_type = stage_chain<typename head_type::output_type, Stages...>;
+
+public:
+  using output_type = typename tail_type::output_type;
+
+  static constexpr bool has_filter = is_filter_stage<Stage>::value || tail_type::has_filter;
+
+  _CCCL_HOST_DEVICE explicit stage_chain(const Stage& stage, const Stages&... stages)
+      : m_head(stage)
+      , m_tail(stages...)
+  {}
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void push(const T& x, Sink& sink)
+  {
+    stage_chain_sink<tail_type, Sink> next{m_tail, sink};
+    m_head.push(x, next);
+  }
+
+  template <typename Sink>
+  _CCCL_HOST_DEVICE void finish(Sink& sink)
+  {
+    stage_chain_sink<tail_type, Sink> next{m_tail, sink};
+    m_head.finish(next);
+    m_tail.finish(sink);
+  }
+
+private:
+  head_type m_head;
+  tail_type m_tail;
+};
+
+// Returns the chain of the stages [First, First + sizeof...(I)) of a tuple of stages.
+template <typename T, ::cuda::std::size_t First, typename StageTuple, ::cuda::std::size_t... I>
+_CCCL_HOST_DEVICE stage_chain<T, ::cuda::std::tuple_element_t<First + I, StageTuple>...>
+make_stage_chain(const StageTuple& stages, ::cuda::std::index_sequence<I...>)
+{
+  return stage_chain<T, ::cuda::std::tuple_element_t<First + I, StageTuple>...>(thrust::get<First + I>(stages)...);
+}
+
+// A sink writing elements to an output iterator.
+template <typename OutputIterator>
+struct stage_output_sink
+{
+  OutputIterator result;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename U>
+  _CCCL_HOST_DEVICE void operator()(const U& x)
+  {
+    *result = x;
+    ++result;
+  }
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
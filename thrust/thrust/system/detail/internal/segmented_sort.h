@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Segmented sorts on the parallel host systems work in two phases. First, the threads take batches of consecutive
+// segments and sort each segment of a batch on their own, which suits the many short segments of typical inputs.
+// Segments of at least large_segment_size elements are skipped, and then sorted one after another by all threads.
+template <typename Size>
+class segmented_sort_plan
+{
+public:
+  // the smallest number of elements worth sorting with more than one thread
+  static constexpr Size min_large_segment_size = 1 << 15;
+  // segments per batch of the first phase
+  static constexpr Size batch_size = 64;
+
+  template <typename OffsetIterator1, typename OffsetIterator2>
+  segmented_sort_plan(OffsetIterator1 begin_offsets_first,
+                      OffsetIterator1 begin_offsets_last,
+                      OffsetIterator2 end_offsets_first,
+                      Size num_threads)
+      : m_num_segments(static_cast<Size>(begin_offsets_last - begin_offsets_first))
+      , m_large_segment_size(min_large_segment_size)
+  {
+    Size num_elements = 0;
+    for (Size i = 0; i < m_num_segments; ++i)
+    {
+      num_elements += static_cast<Size>(end_offsets_first[i]) - static_cast<Size>(begin_offsets_first[i]);
+    }
+
+    // a segment which holds more than a thread's share of all elements would leave the other threads idle
+    m_large_segment_size = (::cuda::std::max) (m_large_segment_size, num_elements / num_threads + 1);
+  }
+
+  Size num_segments() const
+  {
+    return m_num_segments;
+  }
+
+  Size num_batches() const
+  {
+    return (m_num_segments + batch_size - 1) / batch_size;
+  }
+
+  Size batch_begin(Size batch) const
+  {
+    return batch * batch_size;
+  }
+
+  Size batch_end(Size batch) const
+  {
+    return (::cuda::std::min) (m_num_segments, (batch + 1) * batch_size);
+  }
+
+  bool is_large(Size segment_size) const
+  {
+    return segment_size >= m_large_segment_size;
+  }
+
+private:
+  Size m_num_segments;
+  Size m_large_segment_size;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
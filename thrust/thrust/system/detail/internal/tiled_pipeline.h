@@ -0,0 +1,672 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/pipeline_stages.h>
+#include <thrust/tuple.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/optional>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Pipelines on the parallel host systems run in groups of stages. Each group consists of the transformations and
+// filters up to the next barrier, a scan or a reduction by key, and the barrier itself. The input of a group is split
+// into tiles, which run through all stages of the group on one thread each, in two passes: the first pass summarizes
+// each tile, for example by its number of outputs and their sum, the summaries are then combined into what each tile
+// needs to know about the tiles before it, and the second pass runs the tiles again and writes their outputs. Only the
+// outputs of groups followed by further stages are stored in temporary arrays.
+
+// the number of input bytes per tile, so that the data a thread works on stays in its caches
+constexpr ::cuda::std::size_t pipeline_tile_bytes = 1 << 15;
+
+// A tile_terminal ends a group of stages. It describes the summaries of the tiles, combines them, and provides the
+// sinks the outputs of the transformations and filters of the group are pushed into.
+template <typename Size, typename T, typename Stage>
+class tile_terminal;
+
+// ends the last group if the pipeline does not end in a barrier
+template <typename Size, typename T>
+class tile_terminal<Size, T, void>
+{
+public:
+  using output_type = T;
+
+  // without filters, the number of outputs of a tile is known without running it
+  static constexpr bool counts_outputs_only = true;
+
+  struct summary_type
+  {
+    Size num_outputs;
+  };
+
+  struct start_type
+  {
+    Size offset;
+  };
+
+  class summary_sink
+  {
+  public:
+    void operator()(const T&)
+    {
+      ++m_summary.num_outputs;
+    }
+
+    void finish() {}
+
+    const summary_type& summary() const
+    {
+      return m_summary;
+    }
+
+  private:
+    summary_type m_summary{};
+  };
+
+  template <typename OutputIterator>
+  class writer
+  {
+  public:
+    writer(const start_type& start, OutputIterator result)
+        : m_sink{result + start.offset}
+    {}
+
+    void operator()(const T& x)
+    {
+      m_sink(x);
+    }
+
+    void finish() {}
+
+  private:
+    stage_output_sink<OutputIterator> m_sink;
+  };
+
+  summary_sink make_summary_sink() const
+  {
+    return summary_sink();
+  }
+
+  Size combine(const summary_type* summaries, start_type* starts, Size num_tiles) const
+  {
+    Size total = 0;
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      starts[tile].offset = total;
+      total += summaries[tile].num_outputs;
+    }
+    return total;
+  }
+
+  template <typename OutputIterator>
+  writer<OutputIterator> make_writer(const start_type& start, OutputIterator result) const
+  {
+    return writer<OutputIterator>(start, result);
+  }
+};
+
+template <typename Size, typename T, typename AssociativeOperator>
+class tile_terminal<Size, T, inclusive_scan_stage<AssociativeOperator>>
+{
+  using stage_type  = inclusive_scan_stage<AssociativeOperator>;
+  using runner_type = stage_runner<stage_type, T>;
+
+public:
+  using output_type = T;
+
+  static constexpr bool counts_outputs_only = false;
+
+  struct summary_type
+  {
+    Size num_outputs;
+    ::cuda::std::optional<T> sum;
+  };
+
+  struct start_type
+  {
+    Size offset;
+    // the sum of all elements of the tiles before
+    ::cuda::std::optional<T> carry;
+  };
+
+  class summary_sink
+  {
+  public:
+    explicit summary_sink(const stage_type& stage)
+        : m_runner(stage)
+    {}
+
+    void operator()(const T& x)
+    {
+      ++m_summary.num_outputs;
+      if (m_summary.sum)
+      {
+        *m_summary.sum = m_runner.combine(*m_summary.sum, x);
+      }
+      else
+      {
+        m_summary.sum = x;
+      }
+    }
+
+    void finish() {}
+
+    const summary_type& summary() const
+    {
+      return m_summary;
+    }
+
+  private:
+    runner_type m_runner;
+    summary_type m_summary{};
+  };
+
+  template <typename OutputIterator>
+  class writer
+  {
+  public:
+    writer(const stage_type& stage, const start_type& start, OutputIterator result)
+        : m_runner(stage, start.carry)
+        , m_sink{result + start.offset}
+    {}
+
+    void operator()(const T& x)
+    {
+      m_runner.push(x, m_sink);
+    }
+
+    void finish() {}
+
+  private:
+    runner_type m_runner;
+    stage_output_sink<OutputIterator> m_sink;
+  };
+
+  explicit tile_terminal(const stage_type& stage)
+      : m_stage(stage)
+  {}
+
+  summary_sink make_summary_sink() const
+  {
+    return summary_sink(m_stage);
+  }
+
+  Size combine(const summary_type* summaries, start_type* starts, Size num_tiles) const
+  {
+    runner_type runner(m_stage);
+
+    Size total = 0;
+    ::cuda::std::optional<T> sum;
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      starts[tile].offset = total;
+      starts[tile].carry  = sum;
+
+      total += summaries[tile].num_outputs;
+      if (summaries[tile].sum)
+      {
+        sum = sum ? runner.combine(*sum, *summaries[tile].sum) : *summaries[tile].sum;
+      }
+    }
+    return total;
+  }
+
+  template <typename OutputIterator>
+  writer<OutputIterator> make_writer(const start_type& start, OutputIterator result) const
+  {
+    return writer<OutputIterator>(m_stage, start, result);
+  }
+
+private:
+  stage_type m_stage;
+};
+
+// A run of equal keys may span several tiles. It is written by the tile in which it ends, which receives the key and
+// the partial reduction of the run from the tiles before.
+template <typename Size, typename T, typename BinaryPredicate, typename AssociativeOperator>
+class tile_terminal<Size, T, reduce_by_key_stage<BinaryPredicate, AssociativeOperator>>
+{
+  using stage_type  = reduce_by_key_stage<BinaryPredicate, AssociativeOperator>;
+  using runner_type = stage_runner<stage_type, T>;
+  using run_type    = typename runner_type::output_type;
+
+public:
+  using output_type = run_type;
+
+  static constexpr bool counts_outputs_only = false;
+
+  struct summary_type
+  {
+    Size num_runs;
+    ::cuda::std::optional<run_type> first_run;
+    ::cuda::std::optional<run_type> last_run;
+  };
+
+  struct start_type
+  {
+    Size offset;
+    // the run the tile continues, if any
+    ::cuda::std::optional<run_type> carry;
+    // whether the last run of the tile ends in the tile
+    bool closes_last_run;
+  };
+
+  class summary_sink
+  {
+    struct run_counter
+    {
+      summary_type& summary;
+
+      void operator()(const run_type& run)
+      {
+        ++summary.num_runs;
+        if (!summary.first_run)
+        {
+          summary.first_run = run;
+        }
+        summary.last_run = run;
+      }
+    };
+
+  public:
+    explicit summary_sink(const stage_type& stage)
+        : m_runner(stage)
+    {}
+
+    void operator()(const T& x)
+    {
+      run_counter counter{m_summary};
+      m_runner.push(x, counter);
+    }
+
+    void finish()
+    {
+      run_counter counter{m_summary};
+      m_runner.finish(counter);
+    }
+
+    const summary_type& summary() const
+    {
+      return m_summary;
+    }
+
+  private:
+    runner_type m_runner;
+    summary_type m_summary{};
+  };
+
+  template <typename OutputIterator>
+  class writer
+  {
+  public:
+    writer(const stage_type& stage, const start_type& start, OutputIterator result)
+        : m_runner(stage, start.carry)
+        , m_sink{result + start.offset}
+        , m_closes_last_run(start.closes_last_run)
+    {}
+
+    void operator()(const T& x)
+    {
+      m_runner.push(x, m_sink);
+    }
+
+    void finish()
+    {
+      if (m_closes_last_run)
+      {
+        m_runner.finish(m_sink);
+      }
+    }
+
+  private:
+    runner_type m_runner;
+    stage_output_sink<OutputIterator> m_sink;
+    bool m_closes_last_run;
+  };
+
+  explicit tile_terminal(const stage_type& stage)
+      : m_stage(stage)
+  {}
+
+  summary_sink make_summary_sink() const
+  {
+    return summary_sink(m_stage);
+  }
+
+  Size combine(const summary_type* summaries, start_type* starts, Size num_tiles) const
+  {
+    runner_type runner(m_stage);
+
+    Size total = 0;
+    // the last run of the tiles so far, which may continue in the next tile
+    ::cuda::std::optional<run_type> open_run;
+    start_type* previous = nullptr;
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      const summary_type& summary = summaries[tile];
+      start_type& start           = starts[tile];
+
+      start.closes_last_run = false;
+      if (summary.num_runs == 0)
+      {
+        start.offset = total;
+        start.carry.reset();
+        continue;
+      }
+
+      // as the keys are compared with an equivalence relation, the first run of the tile continues the open run if
+      // their first keys are equivalent
+      const bool continues =
+        open_run && runner.same_run(thrust::get<0>(*open_run), thrust::get<0>(*summary.first_run));
+      if (previous)
+      {
+        previous->closes_last_run = !continues;
+      }
+
+      start.offset = continues ? total - 1 : total;
+      start.carry  = continues ? open_run : ::cuda::std::nullopt;
+
+      if (continues && summary.num_runs == 1)
+      {
+        thrust::get<1>(*open_run) = runner.combine(thrust::get<1>(*open_run), thrust::get<1>(*summary.first_run));
+      }
+      else
+      {
+        open_run = summary.last_run;
+      }
+
+      total += continues ? summary.num_runs - 1 : summary.num_runs;
+      previous = &start;
+    }
+
+    if (previous)
+    {
+      previous->closes_last_run = true;
+    }
+
+    return total;
+  }
+
+  template <typename OutputIterator>
+  writer<OutputIterator> make_writer(const start_type& start, OutputIterator result) const
+  {
+    return writer<OutputIterator>(m_stage, start, result);
+  }
+
+private:
+  stage_type m_stage;
+};
+
+// A group of stages: a stage_chain of transformations and filters, followed by a tile_terminal.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Chain, typename Terminal>
+class tiled_stage_group
+{
+public:
+  using size_type    = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using summary_type = typename Terminal::summary_type;
+  using start_type   = typename Terminal::start_type;
+
+  tiled_stage_group(thrust::execution_policy<DerivedPolicy>& exec,
+                    RandomAccessIterator first,
+                    size_type n,
+                    size_type tile_size,
+                    const Chain& chain,
+                    const Terminal& terminal)
+      : m_first(first)
+      , m_size(n)
+      , m_tile_size(tile_size)
+      , m_num_tiles((n + tile_size - 1) / tile_size)
+      , m_chain(chain)
+      , m_terminal(terminal)
+      , m_summaries(exec, m_num_tiles)
+      , m_starts(exec, m_num_tiles)
+  {}
+
+  size_type num_tiles() const
+  {
+    return m_num_tiles;
+  }
+
+  void summarize(size_type tile)
+  {
+    summary_type& summary = thrust::raw_pointer_cast(m_summaries.data())[tile];
+
+    if constexpr (Terminal::counts_outputs_only && !Chain::has_filter)
+    {
+      summary.num_outputs = tile_end(tile) - tile_begin(tile);
+    }
+    else
+    {
+      auto sink = m_terminal.make_summary_sink();
+      run_tile(tile, sink);
+      summary = sink.summary();
+    }
+  }
+
+  // returns the number of outputs of all tiles
+  size_type combine()
+  {
+    return m_terminal.combine(
+      thrust::raw_pointer_cast(m_summaries.data()), thrust::raw_pointer_cast(m_starts.data()), m_num_tiles);
+  }
+
+  template <typename OutputIterator>
+  void write(size_type tile, OutputIterator result)
+  {
+    auto sink = m_terminal.make_writer(thrust::raw_pointer_cast(m_starts.data())[tile], result);
+    run_tile(tile, sink);
+  }
+
+private:
+  size_type tile_begin(size_type tile) const
+  {
+    return tile * m_tile_size;
+  }
+
+  size_type tile_end(size_type tile) const
+  {
+    return (::cuda::std::min) (m_size, tile_begin(tile) + m_tile_size);
+  }
+
+  template <typename Sink>
+  void run_tile(size_type tile, Sink& sink)
+  {
+    Chain chain = m_chain;
+
+    const size_type last = tile_end(tile);
+    for (size_type i = tile_begin(tile); i < last; ++i)
+    {
+      chain.push(m_first[i], sink);
+    }
+    chain.finish(sink);
+    sink.finish();
+  }
+
+  RandomAccessIterator m_first;
+  size_type m_size;
+  size_type m_tile_size;
+  size_type m_num_tiles;
+  Chain m_chain;
+  Terminal m_terminal;
+  thrust::detail::temporary_array<summary_type, DerivedPolicy> m_summaries;
+  thrust::detail::temporary_array<start_type, DerivedPolicy> m_starts;
+};
+
+namespace tiled_pipeline_detail
+{
+
+template <typename Group>
+struct summarize_tile
+{
+  Group& group;
+
+  void operator()(typename Group::size_type tile) const
+  {
+    group.summarize(tile);
+  }
+};
+
+template <typename Group, typename OutputIterator>
+struct write_tile
+{
+  Group& group;
+  OutputIterator result;
+
+  void operator()(typename Group::size_type tile) const
+  {
+    group.write(tile, result);
+  }
+};
+
+// the barrier ending the group beginning at First, or void if the group ends the pipeline without one
+template <::cuda::std::size_t First, typename... Stages>
+struct barrier_of_group
+{
+  static constexpr ::cuda::std::size_t index = find_barrier_stage<Stages...>(First);
+
+  template <bool HasBarrier, typename = void>
+  struct stage
+  {
+    using type = void;
+  };
+
+  template <typename Dummy>
+  struct stage<true, Dummy>
+  {
+    using type = ::cuda::std::tuple_element_t<index, thrust::tuple<Stages...>>;
+  };
+
+  using type = typename stage<(index < sizeof...(Stages))>::type;
+};
+
+template <::cuda::std::size_t I, typename Terminal, typename... Stages>
+Terminal make_tile_terminal(const thrust::tuple<Stages...>& stages)
+{
+  if constexpr (I == sizeof...(Stages))
+  {
+    return Terminal();
+  }
+  else
+  {
+    return Terminal(thrust::get<I>(stages));
+  }
+}
+
+template <::cuda::std::size_t First,
+          typename DerivedPolicy,
+          typename TileLoop,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename... Stages>
+OutputIterator run_groups(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  TileLoop tile_loop,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  const thrust::tuple<Stages...>& stages)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  using size_type  = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  constexpr ::cuda::std::size_t num_stages = sizeof...(Stages);
+  constexpr ::cuda::std::size_t barrier    = barrier_of_group<First, Stages...>::index;
+
+  const size_type n         = last - first;
+  const size_type tile_size =
+    (::cuda::std::max) (size_type{256}, static_cast<size_type>(pipeline_tile_bytes / sizeof(value_type)));
+
+  if (n <= tile_size)
+  {
+    // a single tile is not worth the second pass, so stream it through all remaining stages
+    auto chain = make_stage_chain<value_type, First>(stages, ::cuda::std::make_index_sequence<num_stages - First>());
+    stage_output_sink<OutputIterator> sink{result};
+    for (; first != last; ++first)
+    {
+      chain.push(*first, sink);
+    }
+    chain.finish(sink);
+    return sink.result;
+  }
+
+  auto chain = make_stage_chain<value_type, First>(stages, ::cuda::std::make_index_sequence<barrier - First>());
+
+  using chain_type    = decltype(chain);
+  using terminal_type = tile_terminal<size_type,
+                                      typename chain_type::output_type,
+                                      typename barrier_of_group<First, Stages...>::type>;
+  using group_type    = tiled_stage_group<DerivedPolicy, RandomAccessIterator, chain_type, terminal_type>;
+
+  group_type group(exec, first, n, tile_size, chain, make_tile_terminal<barrier, terminal_type>(stages));
+
+  tile_loop(group.num_tiles(), summarize_tile<group_type>{group});
+  const size_type num_outputs = group.combine();
+
+  if constexpr (barrier + 1 >= num_stages)
+  {
+    tile_loop(group.num_tiles(), write_tile<group_type, OutputIterator>{group, result});
+    return result + num_outputs;
+  }
+  else
+  {
+    using output_type = typename terminal_type::output_type;
+
+    // a barrier followed by further stages is the only place where a pipeline materializes its elements
+    thrust::detail::temporary_array<output_type, DerivedPolicy> temp(exec, num_outputs);
+    output_type* temp_first = thrust::raw_pointer_cast(temp.data());
+
+    tile_loop(group.num_tiles(), write_tile<group_type, output_type*>{group, temp_first});
+
+    return run_groups<barrier + 1>(exec, tile_loop, temp_first, temp_first + num_outputs, result, stages);
+  }
+}
+
+} // end namespace tiled_pipeline_detail
+
+// Runs a pipeline on a parallel host system. tile_loop(num_tiles, f) shall call f(tile) for each tile in
+// [0, num_tiles), in any order and concurrently.
+template <typename DerivedPolicy,
+          typename TileLoop,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename... Stages>
+OutputIterator tiled_pipeline(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  TileLoop tile_loop,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  return tiled_pipeline_detail::run_groups<0>(
+    exec, tile_loop, first, last, result, thrust::tuple<Stages...>(stages...));
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
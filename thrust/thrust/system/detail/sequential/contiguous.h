@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file contiguous.h
+ *  \brief Sequential kernels for algorithms over contiguous ranges of arithmetic types.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace contiguous
+{
+
+// The algorithms of the host systems take these kernels instead of their generic implementations when all ranges are
+// contiguous, hold the same arithmetic type, and elements are compared with ==. The kernels then work on raw pointers,
+// either through the C library (memset, memchr, memcmp) or through loops without early exits, which compilers
+// vectorize for the targeted instruction set.
+
+// Contiguous iterators which unwrap to a pointer to a (const) arithmetic value type, which excludes volatile ranges.
+template <typename Iterator>
+inline constexpr bool is_vectorizable_v =
+  thrust::is_contiguous_iterator_v<Iterator> && ::cuda::std::is_arithmetic_v<thrust::detail::it_value_t<Iterator>>
+  && ::cuda::std::is_same_v<
+    ::cuda::std::remove_const_t<::cuda::std::remove_pointer_t<thrust::try_unwrap_contiguous_iterator_t<Iterator>>>,
+    thrust::detail::it_value_t<Iterator>>;
+
+template <typename Iterator1, typename Iterator2>
+inline constexpr bool are_vectorizable_v =
+  is_vectorizable_v<Iterator1> && is_vectorizable_v<Iterator2>
+  && ::cuda::std::is_same_v<thrust::detail::it_value_t<Iterator1>, thrust::detail::it_value_t<Iterator2>>;
+
+template <typename BinaryPredicate, typename T>
+inline constexpr bool is_equal_to_v =
+  ::cuda::std::is_same_v<BinaryPredicate, ::cuda::std::equal_to<>>
+  || ::cuda::std::is_same_v<BinaryPredicate, ::cuda::std::equal_to<T>>;
+
+// Whether elements of type T may be compared against values of type U by converting the values to T first, provided
+// that is_representable<T>(value) holds.
+template <typename T, typename U>
+inline constexpr bool is_comparable_v =
+  ::cuda::std::is_same_v<T, U> || (::cuda::std::is_integral_v<T> && ::cuda::std::is_integral_v<U>);
+
+// Whether value survives the conversion to T, checked under the same usual arithmetic conversions as element == value.
+// Both sides are then converted to a type at least as wide as T, so the elements equal to value are exactly those equal
+// to value converted to T. Converting back to U instead is wrong after integer promotion: (unsigned char) 255 survives
+// the round trip through signed char, yet compares unequal to (signed char) -1.
+template <typename T, typename U>
+_CCCL_HOST_DEVICE bool is_representable(const U& value)
+{
+  static_assert(is_comparable_v<T, U>);
+  return static_cast<T>(value) == value;
+}
+
+// Elements tested per block by the searching kernels. A block is tested without an early exit, and only the block
+// holding the first match is searched element by element.
+template <typename T>
+inline constexpr ::cuda::std::ptrdiff_t block_size = sizeof(T) < 256 ? 256 / sizeof(T) : 1;
+
+template <typename T>
+_CCCL_HOST_DEVICE void fill_n(T* first, ::cuda::std::ptrdiff_t n, T value)
+{
+  if (n <= 0)
+  {
+    return;
+  }
+
+  if constexpr (::cuda::std::is_integral_v<T>)
+  {
+    if (sizeof(T) == 1 || value == T{0})
+    {
+      ::cuda::std::memset(first, static_cast<unsigned char>(value), n * sizeof(T));
+      return;
+    }
+  }
+
+  for (::cuda::std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    first[i] = value;
+  }
+}
+
+// Returns the index of the first element equal to value, or n.
+template <typename T>
+_CCCL_HOST_DEVICE ::cuda::std::ptrdiff_t find(const T* first, ::cuda::std::ptrdiff_t n, T value)
+{
+  if (n <= 0)
+  {
+    return 0;
+  }
+
+  if constexpr (sizeof(T) == 1 && ::cuda::std::is_integral_v<T>)
+  {
+    const void* match = ::cuda::std::memchr(first, static_cast<unsigned char>(value), n);
+    return match ? static_cast<const T*>(match) - first : n;
+  }
+  else
+  {
+    ::cuda::std::ptrdiff_t i = 0;
+    for (; i + block_size<T> <= n; i += block_size<T>)
+    {
+      bool found = false;
+      for (::cuda::std::ptrdiff_t j = 0; j < block_size<T>; ++j)
+      {
+        found |= first[i + j] == value;
+      }
+      if (found)
+      {
+        break;
+      }
+    }
+
+    for (; i < n; ++i)
+    {
+      if (first[i] == value)
+      {
+        return i;
+      }
+    }
+    return n;
+  }
+}
+
+// Returns the number of elements equal to value.
+template <typename T>
+_CCCL_HOST_DEVICE ::cuda::std::ptrdiff_t count(const T* first, ::cuda::std::ptrdiff_t n, T value)
+{
+  ::cuda::std::ptrdiff_t result = 0;
+  for (::cuda::std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    result += first[i] == value;
+  }
+  return result;
+}
+
+// Returns the index of the first element of first1 which differs from the corresponding element of first2, or n.
+template <typename T>
+_CCCL_HOST_DEVICE ::cuda::std::ptrdiff_t mismatch(const T* first1, ::cuda::std::ptrdiff_t n, const T* first2)
+{
+  ::cuda::std::ptrdiff_t i = 0;
+  for (; i + block_size<T> <= n; i += block_size<T>)
+  {
+    bool found = false;
+    for (::cuda::std::ptrdiff_t j = 0; j < block_size<T>; ++j)
+    {
+      found |= !(first1[i + j] == first2[i + j]);
+    }
+    if (found)
+    {
+      break;
+    }
+  }
+
+  for (; i < n; ++i)
+  {
+    if (!(first1[i] == first2[i]))
+    {
+      return i;
+    }
+  }
+  return n;
+}
+
+template <typename T>
+_CCCL_HOST_DEVICE bool equal(const T* first1, ::cuda::std::ptrdiff_t n, const T* first2)
+{
+  if (n <= 0)
+  {
+    return true;
+  }
+
+  // integers are equal if and only if their object representations are, which is not true for floating point numbers
+  if constexpr (::cuda::std::is_integral_v<T>)
+  {
+    return ::cuda::std::memcmp(first1, first2, n * sizeof(T)) == 0;
+  }
+  else
+  {
+    return contiguous::mismatch(first1, n, first2) == n;
+  }
+}
+
+// Swaps the n elements starting at front with the n elements ending at back, the first with the last. Reversing
+// [first, first + n) is swap_reversed(first, first + n, n / 2).
+template <typename T>
+_CCCL_HOST_DEVICE void swap_reversed(T* front, T* back, ::cuda::std::ptrdiff_t n)
+{
+  for (::cuda::std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    const T tmp  = front[i];
+    front[i]     = back[-1 - i];
+    back[-1 - i] = tmp;
+  }
+}
+
+} // namespace contiguous
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,4 +26,42 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special count functions
+#include <thrust/system/detail/generic/count.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename EqualityComparable>
+_CCCL_HOST_DEVICE thrust::detail::it_difference_t<InputIterator>
+count(sequential::execution_policy<DerivedPolicy>& exec,
+      InputIterator first,
+      InputIterator last,
+      const EqualityComparable& value)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<InputIterator>
+                && contiguous::is_comparable_v<value_type, EqualityComparable>)
+  {
+    if (contiguous::is_representable<value_type>(value))
+    {
+      return static_cast<thrust::detail::it_difference_t<InputIterator>>(contiguous::count(
+        thrust::unwrap_contiguous_iterator(first), last - first, static_cast<value_type>(value)));
+    }
+  }
+
+  return thrust::system::detail::generic::count(exec, first, last, value);
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,4 +26,40 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special equal functions
+#include <thrust/system/detail/generic/equal.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+_CCCL_HOST_DEVICE bool
+equal(sequential::execution_policy<DerivedPolicy>& exec,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      BinaryPredicate binary_pred)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>
+                && contiguous::is_equal_to_v<BinaryPredicate, thrust::detail::it_value_t<InputIterator1>>)
+  {
+    return contiguous::equal(
+      thrust::unwrap_contiguous_iterator(first1), last1 - first1, thrust::unwrap_contiguous_iterator(first2));
+  }
+  else
+  {
+    return thrust::system::detail::generic::equal(exec, first1, last1, first2, binary_pred);
+  }
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,4 +26,67 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special fill functions
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/streaming_store.h>
+
+#include <nv/target>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+_CCCL_HOST_DEVICE OutputIterator
+fill_n(sequential::execution_policy<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
+{
+  using value_type = thrust::detail::it_value_t<OutputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<OutputIterator> && ::cuda::std::is_convertible_v<const T&, value_type>)
+  {
+    const auto raw_first          = thrust::unwrap_contiguous_iterator(first);
+    const ::cuda::std::ptrdiff_t m = static_cast<::cuda::std::ptrdiff_t>(n);
+    const value_type raw_value    = static_cast<value_type>(value);
+
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   if (contiguous::use_streaming_stores<value_type>(m))
+                   {
+                     contiguous::streaming_fill_n(raw_first, m, raw_value);
+                     return first + n;
+                   }
+                 }));
+
+    contiguous::fill_n(raw_first, m, raw_value);
+    return first + n;
+  }
+  else
+  {
+    return thrust::system::detail::generic::fill_n(exec, first, n, value);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+_CCCL_HOST_DEVICE void
+fill(sequential::execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, const T& value)
+{
+  if constexpr (contiguous::is_vectorizable_v<ForwardIterator>)
+  {
+    sequential::fill_n(exec, first, last - first, value);
+  }
+  else
+  {
+    thrust::system::detail::generic::fill(exec, first, last, value);
+  }
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
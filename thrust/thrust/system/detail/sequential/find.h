@@ -30,6 +30,8 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/system/detail/generic/find.h>
+#include <thrust/system/detail/sequential/contiguous.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -62,6 +64,25 @@ find_if(execution_policy<DerivedPolicy>&, InputIterator first, InputIterator las
   return first;
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename T>
+_CCCL_HOST_DEVICE InputIterator
+find(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, const T& value)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<InputIterator> && contiguous::is_comparable_v<value_type, T>)
+  {
+    if (contiguous::is_representable<value_type>(value))
+    {
+      return first
+           + contiguous::find(thrust::unwrap_contiguous_iterator(first), last - first, static_cast<value_type>(value));
+    }
+  }
+
+  return thrust::system::detail::generic::find(exec, first, last, value);
+}
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
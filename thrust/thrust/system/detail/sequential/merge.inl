@@ -27,8 +27,12 @@
 #endif // no system header
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/detail/sequential/multiway_merge.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -53,6 +57,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
@@ -96,6 +101,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator2 values_result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
@@ -145,6 +151,52 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   return thrust::make_pair(keys_result, values_result);
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator merge_k(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const difference_type num_offsets = static_cast<difference_type>(offsets_last - offsets_first);
+  if (num_offsets < 2)
+  {
+    return result;
+  }
+  const difference_type num_segments = num_offsets - 1;
+
+  // cursors, ends and the loser tree
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> storage(0, exec, 4 * num_segments);
+  difference_type* cursors = thrust::raw_pointer_cast(storage.data());
+  difference_type* ends    = cursors + num_segments;
+  difference_type* tree    = ends + num_segments;
+
+  // empty segments never win, so leave them out of the tree
+  difference_type num_runs = 0;
+  for (difference_type i = 0; i < num_segments; ++i)
+  {
+    const difference_type begin = static_cast<difference_type>(offsets_first[i]);
+    const difference_type end   = static_cast<difference_type>(offsets_first[i + 1]);
+    if (begin != end)
+    {
+      cursors[num_runs] = begin;
+      ends[num_runs]    = end;
+      ++num_runs;
+    }
+  }
+
+  return sequential::multiway_merge(first, num_runs, cursors, ends, tree, result, comp);
+} // end merge_k()
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -26,4 +26,59 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special mismatch functions
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/mismatch.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__functional/operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+_CCCL_HOST_DEVICE thrust::pair<InputIterator1, InputIterator2> mismatch(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  BinaryPredicate pred)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>
+                && contiguous::is_equal_to_v<BinaryPredicate, thrust::detail::it_value_t<InputIterator1>>)
+  {
+    const auto n = contiguous::mismatch(
+      thrust::unwrap_contiguous_iterator(first1), last1 - first1, thrust::unwrap_contiguous_iterator(first2));
+    return thrust::make_pair(first1 + n, first2 + n);
+  }
+  else
+  {
+    return thrust::system::detail::generic::mismatch(exec, first1, last1, first2, pred);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<InputIterator1, InputIterator2> mismatch(
+  sequential::execution_policy<DerivedPolicy>& exec, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>)
+  {
+    return sequential::mismatch(exec, first1, last1, first2, ::cuda::std::equal_to<>());
+  }
+  else
+  {
+    return thrust::system::detail::generic::mismatch(exec, first1, last1, first2);
+  }
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file multiway_merge.h
+ *  \brief Sequential loser tree merge of many sorted runs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__utility/swap.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace multiway_merge_detail
+{
+
+// Whether the head of run a precedes the head of run b. Exhausted runs lose against everything, and equivalent
+// heads are ordered by run index, which makes the merge stable. Knowing which run comes first, a single comparison
+// tells whether the heads are ordered by value or by index.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Runs, typename Size>
+_CCCL_HOST_DEVICE bool beats(Runs& runs, Size a, Size b)
+{
+  if (runs.exhausted(a))
+  {
+    return false;
+  }
+  if (runs.exhausted(b))
+  {
+    return true;
+  }
+  return a < b ? !runs.less(b, a) : runs.less(a, b);
+}
+
+// The runs [first + cursors[i], first + ends[i]) of a single sequence.
+template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+struct sequence_runs
+{
+  RandomAccessIterator first;
+  const Size* cursors;
+  const Size* ends;
+  StrictWeakOrdering& comp;
+
+  _CCCL_HOST_DEVICE bool exhausted(Size i) const
+  {
+    return cursors[i] == ends[i];
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE bool less(Size a, Size b) const
+  {
+    return comp(first[cursors[a]], first[cursors[b]]);
+  }
+};
+
+} // namespace multiway_merge_detail
+
+/*! Builds a loser tree over the heads of \p num_runs sorted runs and returns the run whose head comes first.
+ *  \p runs provides <tt>exhausted(i)</tt>, whether run \p i has no elements left, and <tt>less(a, b)</tt>, whether
+ *  the head of run \p a is less than the head of run \p b. \p tree is scratch space for <tt>2 * num_runs</tt>
+ *  values, which holds the state of the tree between the calls to \p replay_loser_tree.
+ *
+ *  \pre <tt>num_runs > 0</tt>
+ */
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Runs, typename Size>
+_CCCL_HOST_DEVICE Size build_loser_tree(Runs& runs, Size num_runs, Size* tree)
+{
+  using multiway_merge_detail::beats;
+
+  // Node j in [1, num_runs) has the children 2j and 2j + 1, node num_runs + i is the leaf of run i. tree[j] holds the
+  // loser of the match at node j, tree[num_runs + j] its winner, which is only needed while building the tree.
+  Size* winners = tree + num_runs;
+  for (Size j = num_runs - 1; j > 0; --j)
+  {
+    const Size lhs = 2 * j < num_runs ? winners[2 * j] : 2 * j - num_runs;
+    const Size rhs = 2 * j + 1 < num_runs ? winners[2 * j + 1] : 2 * j + 1 - num_runs;
+
+    if (beats(runs, rhs, lhs))
+    {
+      winners[j] = rhs;
+      tree[j]    = lhs;
+    }
+    else
+    {
+      winners[j] = lhs;
+      tree[j]    = rhs;
+    }
+  }
+
+  return num_runs > 1 ? winners[1] : 0;
+}
+
+/*! Replays the matches on the path from the leaf of \p winner to the root of a loser tree built by
+ *  \p build_loser_tree, after the head of run \p winner was consumed, and returns the run whose head comes first now.
+ *  All runs are exhausted if that run is.
+ */
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Runs, typename Size>
+_CCCL_HOST_DEVICE Size replay_loser_tree(Runs& runs, Size num_runs, Size* tree, Size winner)
+{
+  for (Size node = (num_runs + winner) / 2; node > 0; node /= 2)
+  {
+    if (multiway_merge_detail::beats(runs, tree[node], winner))
+    {
+      ::cuda::std::swap(tree[node], winner);
+    }
+  }
+  return winner;
+}
+
+/*! Merges the sorted runs <tt>[first + cursors[i], first + ends[i])</tt> for <tt>i</tt> in
+ *  <tt>[0, num_runs)</tt> into \p result with a loser tree, so that every element is compared
+ *  <tt>O(log(num_runs))</tt> times, read once and written once. Equivalent elements are taken
+ *  from the run with the lower index first.
+ *
+ *  \p cursors is advanced to \p ends. \p tree is scratch space for <tt>2 * num_runs</tt> values.
+ */
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename OutputIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator multiway_merge(
+  RandomAccessIterator first,
+  Size num_runs,
+  Size* cursors,
+  const Size* ends,
+  Size* tree,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  using wrapped_comp_t = thrust::detail::wrapped_function<StrictWeakOrdering, bool>;
+  wrapped_comp_t wrapped_comp{comp};
+
+  Size num_elements = 0;
+  for (Size i = 0; i < num_runs; ++i)
+  {
+    num_elements += ends[i] - cursors[i];
+  }
+
+  if (num_elements == 0)
+  {
+    return result;
+  }
+
+  multiway_merge_detail::sequence_runs<RandomAccessIterator, Size, wrapped_comp_t> runs{
+    first, cursors, ends, wrapped_comp};
+
+  for (Size winner = build_loser_tree(runs, num_runs, tree); num_elements > 0; --num_elements)
+  {
+    *result = first[cursors[winner]];
+    ++result;
+    ++cursors[winner];
+    winner = replay_loser_tree(runs, num_runs, tree, winner);
+  }
+
+  return result;
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
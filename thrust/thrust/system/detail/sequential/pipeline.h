@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief Sequential implementation of pipeline.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/pipeline_stages.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+// Streams each element through all stages before reading the next one, so that no intermediate results are stored.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+_CCCL_HOST_DEVICE OutputIterator pipeline(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+  using chain_type = thrust::system::detail::internal::stage_chain<value_type, Stages...>;
+
+  chain_type chain(stages...);
+  thrust::system::detail::internal::stage_output_sink<OutputIterator> sink{result};
+
+  for (; first != last; ++first)
+  {
+    chain.push(*first, sink);
+  }
+  chain.finish(sink);
+
+  return sink.result;
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
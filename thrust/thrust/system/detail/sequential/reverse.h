@@ -26,4 +26,36 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special reverse functions
+#include <thrust/system/detail/generic/reverse.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename BidirectionalIterator>
+_CCCL_HOST_DEVICE void
+reverse(sequential::execution_policy<DerivedPolicy>& exec, BidirectionalIterator first, BidirectionalIterator last)
+{
+  if constexpr (contiguous::is_vectorizable_v<BidirectionalIterator>)
+  {
+    const auto raw_first = thrust::unwrap_contiguous_iterator(first);
+    const auto n         = last - first;
+    contiguous::swap_reversed(raw_first, raw_first + n, n / 2);
+  }
+  else
+  {
+    thrust::system::detail::generic::reverse(exec, first, last);
+  }
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
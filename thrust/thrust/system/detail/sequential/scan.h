@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
@@ -53,6 +54,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   OutputIterator result,
   BinaryFunction binary_op)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   using namespace thrust::detail;
 
   // Use the input iterator's value type per https://wg21.link/P0571
@@ -90,6 +92,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   InitialValueType init,
   BinaryFunction binary_op)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   using namespace thrust::detail;
 
   using ValueType =
@@ -130,6 +133,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   InitialValueType init,
   BinaryFunction binary_op)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   using namespace thrust::detail;
 
   // Use the initial value type per https://wg21.link/P0571
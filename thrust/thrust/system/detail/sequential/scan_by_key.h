@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/detail/tracing.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
@@ -57,6 +58,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   using KeyType   = thrust::detail::it_value_t<InputIterator1>;
   using ValueType = thrust::detail::it_value_t<InputIterator2>;
 
@@ -108,6 +110,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   using KeyType   = thrust::detail::it_value_t<InputIterator1>;
   using ValueType = T;
 
@@ -31,8 +31,15 @@
 #endif // no system header
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/tracing.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/binary_search.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -40,6 +47,138 @@ namespace detail
 {
 namespace sequential
 {
+namespace set_operations_detail
+{
+
+// When one input is at least this many times as long as the other, set_difference and set_intersection skip over
+// the runs of elements of one input which precede the next element of the other by galloping, in
+// O(n * log(m / n)) comparisons for inputs of lengths n <= m, instead of stepping through both inputs in O(n + m).
+inline constexpr ::cuda::std::uint64_t galloping_ratio = 16;
+
+template <typename InputIterator1, typename InputIterator2>
+inline constexpr bool can_gallop =
+  ::cuda::std::is_convertible_v<iterator_traversal_t<InputIterator1>, random_access_traversal_tag>
+  && ::cuda::std::is_convertible_v<iterator_traversal_t<InputIterator2>, random_access_traversal_tag>;
+
+template <typename Size1, typename Size2>
+_CCCL_HOST_DEVICE bool use_galloping(Size1 n1, Size2 n2)
+{
+  const auto size1 = static_cast<::cuda::std::uint64_t>(n1);
+  const auto size2 = static_cast<::cuda::std::uint64_t>(n2);
+  return size1 / galloping_ratio >= size2 || size2 / galloping_ratio >= size1;
+}
+
+// Returns the first position in [first, last) whose element is not less than value, like lower_bound, but searches
+// exponentially from first, in O(log(d)) comparisons for a result at distance d from first.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator gallop_lower_bound(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  const T& value,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  const difference_type n = last - first;
+
+  // the elements before first + lower are less than value
+  difference_type lower = 0;
+  difference_type upper = 1;
+  while (upper <= n && wrapped_comp(first[upper - 1], value))
+  {
+    lower = upper;
+    upper *= 2;
+  }
+
+  return sequential::lower_bound(exec, first + lower, first + ::cuda::std::min(upper - 1, n), value, comp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator galloping_set_difference(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  while (first1 != last1 && first2 != last2)
+  {
+    if (wrapped_comp(*first1, *first2))
+    {
+      const RandomAccessIterator1 next1 = gallop_lower_bound(exec, first1 + 1, last1, *first2, comp);
+      result                            = thrust::copy(exec, first1, next1, result);
+      first1                            = next1;
+    } // end if
+    else if (wrapped_comp(*first2, *first1))
+    {
+      first2 = gallop_lower_bound(exec, first2 + 1, last2, *first1, comp);
+    } // end else if
+    else
+    {
+      ++first1;
+      ++first2;
+    } // end else
+  } // end while
+
+  return thrust::copy(exec, first1, last1, result);
+} // end galloping_set_difference()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator galloping_set_intersection(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  while (first1 != last1 && first2 != last2)
+  {
+    if (wrapped_comp(*first1, *first2))
+    {
+      first1 = gallop_lower_bound(exec, first1 + 1, last1, *first2, comp);
+    } // end if
+    else if (wrapped_comp(*first2, *first1))
+    {
+      first2 = gallop_lower_bound(exec, first2 + 1, last2, *first1, comp);
+    } // end else if
+    else
+    {
+      *result = *first1;
+      ++first1;
+      ++first2;
+      ++result;
+    } // end else
+  } // end while
+
+  return result;
+} // end galloping_set_intersection()
+
+} // namespace set_operations_detail
 
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy,
@@ -56,6 +195,16 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
+
+  if constexpr (set_operations_detail::can_gallop<InputIterator1, InputIterator2>)
+  {
+    if (set_operations_detail::use_galloping(last1 - first1, last2 - first2))
+    {
+      return set_operations_detail::galloping_set_difference(exec, first1, last1, first2, last2, result, comp);
+    }
+  }
+
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
@@ -88,7 +237,7 @@ template <typename DerivedPolicy,
           typename OutputIterator,
           typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE OutputIterator set_intersection(
-  sequential::execution_policy<DerivedPolicy>&,
+  sequential::execution_policy<DerivedPolicy>& exec,
   InputIterator1 first1,
   InputIterator1 last1,
   InputIterator2 first2,
@@ -96,6 +245,15 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
+
+  if constexpr (set_operations_detail::can_gallop<InputIterator1, InputIterator2>)
+  {
+    if (set_operations_detail::use_galloping(last1 - first1, last2 - first2))
+    {
+      return set_operations_detail::galloping_set_intersection(exec, first1, last1, first2, last2, result, comp);
+    }
+  }
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
@@ -136,6 +294,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
@@ -178,6 +337,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result,
   StrictWeakOrdering comp)
 {
+  _THRUST_TRACE_SEQUENTIAL_FALLBACK(DerivedPolicy);
   // wrap comp
   thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
 
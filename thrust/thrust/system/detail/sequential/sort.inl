@@ -29,9 +29,14 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reverse.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/indirect_sort.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
 
+#include <cuda/std/cstddef>
+
 #include <nv/target>
 
 THRUST_NAMESPACE_BEGIN
@@ -91,8 +96,11 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   NV_IF_TARGET(
     NV_IS_HOST,
     (
-      using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
-      if constexpr (sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>) {
+      using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+      using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+      if constexpr (thrust::system::detail::internal::use_indirect_sort_by_key<ValueType>) {
+        thrust::system::detail::internal::indirect_stable_sort_by_key(exec, first1, last1, first2, comp);
+      } else if constexpr (sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>) {
         // if comp is greater<T> then reverse the keys and values
         // note, we also have to reverse the (unordered) input to preserve stability
         if constexpr (sort_detail::needs_reverse<KeyType, StrictWeakOrdering>)
@@ -112,5 +120,102 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
       thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp);));
 }
 
+namespace sort_detail
+{
+// segments of up to this many elements are insertion sorted
+inline constexpr ::cuda::std::ptrdiff_t small_segment_size = 32;
+} // end namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort_segment(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  if (last - first <= sort_detail::small_segment_size)
+  {
+    thrust::system::detail::sequential::insertion_sort(first, last, comp);
+  }
+  else
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort_segment_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  if (keys_last - keys_first <= sort_detail::small_segment_size)
+  {
+    thrust::system::detail::sequential::insertion_sort_by_key(keys_first, keys_last, values_first, comp);
+  }
+  else
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const difference_type num_segments = static_cast<difference_type>(begin_offsets_last - begin_offsets_first);
+  for (difference_type i = 0; i < num_segments; ++i)
+  {
+    const difference_type begin = static_cast<difference_type>(begin_offsets_first[i]);
+    const difference_type end   = static_cast<difference_type>(end_offsets_first[i]);
+    thrust::system::detail::sequential::stable_sort_segment(exec, keys_first + begin, keys_first + end, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const difference_type num_segments = static_cast<difference_type>(begin_offsets_last - begin_offsets_first);
+  for (difference_type i = 0; i < num_segments; ++i)
+  {
+    const difference_type begin = static_cast<difference_type>(begin_offsets_first[i]);
+    const difference_type end   = static_cast<difference_type>(end_offsets_first[i]);
+    thrust::system::detail::sequential::stable_sort_segment_by_key(
+      exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+  }
+}
+
 } // namespace system::detail::sequential
 THRUST_NAMESPACE_END
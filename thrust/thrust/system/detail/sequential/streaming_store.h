@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file streaming_store.h
+ *  \brief Sequential kernels writing large contiguous outputs with non-temporal stores.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#if _CCCL_ARCH(X86_64)
+#  include <emmintrin.h>
+#endif // _CCCL_ARCH(X86_64)
+
+#if !_CCCL_OS(WINDOWS)
+#  include <unistd.h>
+#endif // !_CCCL_OS(WINDOWS)
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace contiguous
+{
+
+// Regular stores to an output larger than the last-level cache evict the rest of the working set, and read every cache
+// line of the output from memory before overwriting it. Non-temporal stores write whole cache lines around the cache,
+// which roughly doubles the bandwidth of write-only passes over large outputs. fill, copy and transform use them on
+// the host for contiguous outputs of at least streaming_store_threshold() bytes.
+//
+// THRUST_HOST_STREAMING_STORE_THRESHOLD may be defined to a number of bytes to override the threshold, which otherwise
+// is the size of the last-level cache. Defining it to 0 writes all outputs with non-temporal stores, and defining it
+// to ~size_t{0} disables them.
+
+#if _CCCL_ARCH(X86_64)
+inline constexpr bool has_streaming_stores = true;
+#else // ^^^ _CCCL_ARCH(X86_64) ^^^ / vvv !_CCCL_ARCH(X86_64) vvv
+inline constexpr bool has_streaming_stores = false;
+#endif // !_CCCL_ARCH(X86_64)
+
+// the size of the last-level cache assumed where the system does not report it
+inline constexpr ::cuda::std::size_t default_last_level_cache_size = ::cuda::std::size_t{32} << 20;
+
+// the unit of the non-temporal stores, which fill whole cache lines at a time
+inline constexpr ::cuda::std::size_t streaming_line_size = 64;
+
+_CCCL_HOST inline ::cuda::std::size_t last_level_cache_size()
+{
+#if defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+  for (const int name : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE})
+  {
+    const long size = ::sysconf(name);
+    if (size > 0)
+    {
+      return static_cast<::cuda::std::size_t>(size);
+    }
+  }
+#endif // _SC_LEVEL3_CACHE_SIZE && _SC_LEVEL2_CACHE_SIZE
+  return default_last_level_cache_size;
+}
+
+_CCCL_HOST inline ::cuda::std::size_t streaming_store_threshold()
+{
+#ifdef THRUST_HOST_STREAMING_STORE_THRESHOLD
+  return static_cast<::cuda::std::size_t>(THRUST_HOST_STREAMING_STORE_THRESHOLD);
+#else // ^^^ THRUST_HOST_STREAMING_STORE_THRESHOLD ^^^ / vvv !THRUST_HOST_STREAMING_STORE_THRESHOLD vvv
+  static const ::cuda::std::size_t threshold = last_level_cache_size();
+  return threshold;
+#endif // !THRUST_HOST_STREAMING_STORE_THRESHOLD
+}
+
+// Whether an output of n elements of type T is written with non-temporal stores.
+template <typename T>
+_CCCL_HOST bool use_streaming_stores(::cuda::std::ptrdiff_t n)
+{
+  return has_streaming_stores && n > 0
+      && static_cast<::cuda::std::size_t>(n) >= streaming_store_threshold() / sizeof(T);
+}
+
+// Assigns gen(i) to result[i] for each i in [0, n). The cache lines fully covered by the output are assembled in a
+// buffer and written with non-temporal stores, so gen(i) is called once for each element of a line before it is
+// stored, and reading from result inside gen only sees the elements of preceding lines.
+template <typename T, typename Generator>
+_CCCL_HOST void streaming_generate_n(T* result, ::cuda::std::ptrdiff_t n, Generator gen)
+{
+  ::cuda::std::ptrdiff_t i = 0;
+
+#if _CCCL_ARCH(X86_64)
+  if constexpr (streaming_line_size % sizeof(T) == 0)
+  {
+    constexpr ::cuda::std::ptrdiff_t line_length = streaming_line_size / sizeof(T);
+
+    const ::cuda::std::size_t misalignment = reinterpret_cast<::cuda::std::uintptr_t>(result) % streaming_line_size;
+    if (misalignment % sizeof(T) == 0)
+    {
+      // regular stores up to the first cache line boundary
+      const ::cuda::std::ptrdiff_t head =
+        misalignment == 0 ? 0 : static_cast<::cuda::std::ptrdiff_t>((streaming_line_size - misalignment) / sizeof(T));
+      for (const ::cuda::std::ptrdiff_t head_end = (::cuda::std::min) (head, n); i < head_end; ++i)
+      {
+        result[i] = gen(i);
+      }
+
+      alignas(streaming_line_size) T line[line_length];
+      for (; i + line_length <= n; i += line_length)
+      {
+        for (::cuda::std::ptrdiff_t j = 0; j < line_length; ++j)
+        {
+          line[j] = gen(i + j);
+        }
+
+        const __m128i* source = reinterpret_cast<const __m128i*>(line);
+        __m128i* destination  = reinterpret_cast<__m128i*>(result + i);
+        for (::cuda::std::size_t k = 0; k < streaming_line_size / sizeof(__m128i); ++k)
+        {
+          _mm_stream_si128(destination + k, _mm_load_si128(source + k));
+        }
+      }
+
+      // non-temporal stores are weakly ordered, so order them before the stores which follow
+      _mm_sfence();
+    }
+  }
+#endif // _CCCL_ARCH(X86_64)
+
+  for (; i < n; ++i)
+  {
+    result[i] = gen(i);
+  }
+}
+
+template <typename T>
+_CCCL_HOST void streaming_fill_n(T* first, ::cuda::std::ptrdiff_t n, T value)
+{
+  contiguous::streaming_generate_n(first, n, [value](::cuda::std::ptrdiff_t) {
+    return value;
+  });
+}
+
+// Copies the n elements of type T starting at first to result, which must not overlap.
+template <typename T>
+_CCCL_HOST void streaming_copy_n(const T* first, ::cuda::std::ptrdiff_t n, T* result)
+{
+  const unsigned char* source   = reinterpret_cast<const unsigned char*>(first);
+  unsigned char* destination    = reinterpret_cast<unsigned char*>(result);
+  const ::cuda::std::size_t size = static_cast<::cuda::std::size_t>(n) * sizeof(T);
+  ::cuda::std::size_t i          = 0;
+
+#if _CCCL_ARCH(X86_64)
+  // regular stores up to the first cache line boundary
+  const ::cuda::std::size_t misalignment = reinterpret_cast<::cuda::std::uintptr_t>(destination) % streaming_line_size;
+  i = (::cuda::std::min) (size, misalignment == 0 ? 0 : streaming_line_size - misalignment);
+  ::cuda::std::memcpy(destination, source, i);
+
+  for (; i + streaming_line_size <= size; i += streaming_line_size)
+  {
+    for (::cuda::std::size_t k = 0; k < streaming_line_size; k += sizeof(__m128i))
+    {
+      _mm_stream_si128(reinterpret_cast<__m128i*>(destination + i + k),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + k)));
+    }
+  }
+
+  // non-temporal stores are weakly ordered, so order them before the stores which follow
+  _mm_sfence();
+#endif // _CCCL_ARCH(X86_64)
+
+  ::cuda::std::memcpy(destination + i, source + i, size - i);
+}
+
+} // namespace contiguous
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
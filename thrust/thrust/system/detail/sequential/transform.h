@@ -26,4 +26,93 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special transform functions
+#include <thrust/system/detail/generic/transform.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/streaming_store.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/cstddef>
+
+#include <nv/target>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename UnaryFunction>
+_CCCL_HOST_DEVICE OutputIterator transform(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  UnaryFunction op)
+{
+  if constexpr (thrust::is_contiguous_iterator_v<InputIterator> && contiguous::is_vectorizable_v<OutputIterator>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   using value_type               = thrust::detail::it_value_t<OutputIterator>;
+                   const ::cuda::std::ptrdiff_t n = last - first;
+                   if (contiguous::use_streaming_stores<value_type>(n))
+                   {
+                     const auto raw_first = thrust::unwrap_contiguous_iterator(first);
+                     contiguous::streaming_generate_n(
+                       thrust::unwrap_contiguous_iterator(result), n, [&op, raw_first](::cuda::std::ptrdiff_t i) {
+                         return op(raw_first[i]);
+                       });
+                     return result + n;
+                   }
+                 }));
+  }
+
+  return thrust::system::detail::generic::transform(exec, first, last, result, op);
+} // end transform()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator transform(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryFunction op)
+{
+  if constexpr (thrust::is_contiguous_iterator_v<InputIterator1> && thrust::is_contiguous_iterator_v<InputIterator2>
+                && contiguous::is_vectorizable_v<OutputIterator>)
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   using value_type               = thrust::detail::it_value_t<OutputIterator>;
+                   const ::cuda::std::ptrdiff_t n = last1 - first1;
+                   if (contiguous::use_streaming_stores<value_type>(n))
+                   {
+                     const auto raw_first1 = thrust::unwrap_contiguous_iterator(first1);
+                     const auto raw_first2 = thrust::unwrap_contiguous_iterator(first2);
+                     contiguous::streaming_generate_n(
+                       thrust::unwrap_contiguous_iterator(result),
+                       n,
+                       [&op, raw_first1, raw_first2](::cuda::std::ptrdiff_t i) {
+                         return op(raw_first1[i], raw_first2[i]);
+                       });
+                     return result + n;
+                   }
+                 }));
+  }
+
+  return thrust::system::detail::generic::transform(exec, first1, last1, first2, result, op);
+} // end transform()
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
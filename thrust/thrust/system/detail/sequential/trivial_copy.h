@@ -30,7 +30,9 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/sequential/general_copy.h>
+#include <thrust/system/detail/sequential/streaming_store.h>
 
+#include <cuda/std/cstdint>
 #include <cuda/std/cstring>
 
 #include <nv/target>
@@ -53,6 +55,17 @@ _CCCL_HOST_DEVICE T* trivial_copy_n(const T* first, std::ptrdiff_t n, T* result)
     return result;
   }
 
+  NV_IF_TARGET(NV_IS_HOST, ({
+                 const auto source      = reinterpret_cast<::cuda::std::uintptr_t>(first);
+                 const auto destination = reinterpret_cast<::cuda::std::uintptr_t>(result);
+                 const bool overlap     = source < destination + n * sizeof(T) && destination < source + n * sizeof(T);
+                 if (!overlap && contiguous::use_streaming_stores<T>(n))
+                 {
+                   contiguous::streaming_copy_n(first, n, result);
+                   return result + n;
+                 }
+               }));
+
   ::cuda::std::memmove(result, first, n * sizeof(T));
 
   return result + n;
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/async_state.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//! The number of threads running the operations of \p thrust::async with the omp system.
+#ifndef THRUST_OMP_ASYNC_NUM_THREADS
+#  define THRUST_OMP_ASYNC_NUM_THREADS 4
+#endif // THRUST_OMP_ASYNC_NUM_THREADS
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// OpenMP has no queue to submit work to from outside of a parallel region, so tasks run on a fixed set of threads of
+// their own, in submission order. The parallel regions of a task use a team of OpenMP threads as usual. At program
+// exit, the threads finish the queued tasks and are joined.
+class async_thread_pool
+{
+public:
+  explicit async_thread_pool(unsigned num_threads)
+  {
+    m_threads.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i)
+    {
+      m_threads.emplace_back([this] {
+        run();
+      });
+    }
+  }
+
+  async_thread_pool(const async_thread_pool&)            = delete;
+  async_thread_pool& operator=(const async_thread_pool&) = delete;
+
+  ~async_thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_tasks_cv.notify_all();
+    for (std::thread& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  void submit(thrust::detail::async_task task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(std::move(task));
+    }
+    m_tasks_cv.notify_one();
+  }
+
+  static async_thread_pool& get()
+  {
+    static async_thread_pool pool(THRUST_OMP_ASYNC_NUM_THREADS);
+    return pool;
+  }
+
+private:
+  void run()
+  {
+    for (;;)
+    {
+      thrust::detail::async_task task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_tasks_cv.wait(lock, [this] {
+          return m_stopping || !m_tasks.empty();
+        });
+        if (m_tasks.empty())
+        {
+          return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+      // the task reports its exceptions through its future
+      task();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_tasks_cv;
+  std::deque<thrust::detail::async_task> m_tasks;
+  bool m_stopping = false;
+  std::vector<std::thread> m_threads;
+};
+
+template <typename DerivedPolicy, typename Task>
+_CCCL_HOST void async_launch(execution_policy<DerivedPolicy>&, Task task)
+{
+  async_thread_pool::get().submit(std::move(task));
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/streaming_store.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace contiguous
+{
+
+// Parallel loops over the index space of contiguous ranges, whose intervals are processed by the sequential kernels.
+using thrust::system::detail::sequential::contiguous::are_vectorizable_v;
+using thrust::system::detail::sequential::contiguous::count;
+using thrust::system::detail::sequential::contiguous::equal;
+using thrust::system::detail::sequential::contiguous::fill_n;
+using thrust::system::detail::sequential::contiguous::find;
+using thrust::system::detail::sequential::contiguous::is_comparable_v;
+using thrust::system::detail::sequential::contiguous::is_equal_to_v;
+using thrust::system::detail::sequential::contiguous::is_representable;
+using thrust::system::detail::sequential::contiguous::is_vectorizable_v;
+using thrust::system::detail::sequential::contiguous::mismatch;
+using thrust::system::detail::sequential::contiguous::streaming_fill_n;
+using thrust::system::detail::sequential::contiguous::streaming_generate_n;
+using thrust::system::detail::sequential::contiguous::swap_reversed;
+using thrust::system::detail::sequential::contiguous::use_streaming_stores;
+
+// the smallest number of elements worth processing on a separate thread
+inline constexpr ::cuda::std::ptrdiff_t min_interval_size = 1 << 15;
+
+// the number of elements searched before checking for a match
+inline constexpr ::cuda::std::ptrdiff_t search_round_size = 1 << 20;
+
+// Calls f(begin, end) for each interval of a decomposition of [0, n) into at most one interval per thread.
+template <typename Function>
+void for_each_interval(::cuda::std::ptrdiff_t n, Function f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<Function,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  if (n <= 0)
+  {
+    return;
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const thrust::system::detail::internal::uniform_decomposition<::cuda::std::ptrdiff_t> decomp(
+    n, min_interval_size, omp_get_max_threads());
+
+  if (decomp.size() > 1)
+  {
+    const ::cuda::std::ptrdiff_t num_intervals = decomp.size();
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (::cuda::std::ptrdiff_t i = 0; i < num_intervals; ++i)
+    {
+      f(decomp[i].begin(), decomp[i].end());
+    }
+    return;
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  f(::cuda::std::ptrdiff_t{0}, n);
+}
+
+// Returns the sum of f(begin, end) over the intervals of [0, n).
+template <typename Function>
+::cuda::std::ptrdiff_t sum_intervals(::cuda::std::ptrdiff_t n, Function f)
+{
+  ::cuda::std::ptrdiff_t result = 0;
+
+  contiguous::for_each_interval(n, [&](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+    const ::cuda::std::ptrdiff_t partial = f(begin, end);
+
+    THRUST_PRAGMA_OMP(critical)
+    {
+      result += partial;
+    }
+  });
+
+  return result;
+}
+
+// Returns the smallest index in [0, n) found by f(begin, end), which returns end if it finds nothing in
+// [begin, end), or n. The range is searched in rounds, so that an early match does not wait for the whole range.
+template <typename Function>
+::cuda::std::ptrdiff_t find_first(::cuda::std::ptrdiff_t n, Function f)
+{
+  for (::cuda::std::ptrdiff_t round_begin = 0; round_begin < n; round_begin += search_round_size)
+  {
+    const ::cuda::std::ptrdiff_t round_end  = (::cuda::std::min) (n, round_begin + search_round_size);
+    const ::cuda::std::ptrdiff_t round_size = round_end - round_begin;
+    ::cuda::std::ptrdiff_t result           = round_end;
+
+    contiguous::for_each_interval(round_size, [&](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+      const ::cuda::std::ptrdiff_t found = f(round_begin + begin, round_begin + end);
+
+      if (found != round_begin + end)
+      {
+        THRUST_PRAGMA_OMP(critical)
+        {
+          result = (::cuda::std::min) (result, found);
+        }
+      }
+    });
+
+    if (result != round_end)
+    {
+      return result;
+    }
+  }
+
+  return n;
+}
+
+} // namespace contiguous
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,6 +25,46 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/detail/generic/count.h>
+#include <thrust/system/omp/detail/contiguous.h>
+#include <thrust/system/omp/detail/execution_policy.h>
 
-// this system inherits count
-#include <thrust/system/cpp/detail/count.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename InputIterator, typename EqualityComparable>
+thrust::detail::it_difference_t<InputIterator>
+count(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, const EqualityComparable& value)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<InputIterator>
+                && contiguous::is_comparable_v<value_type, EqualityComparable>)
+  {
+    if (contiguous::is_representable<value_type>(value))
+    {
+      const auto raw_first       = thrust::unwrap_contiguous_iterator(first);
+      const value_type raw_value = static_cast<value_type>(value);
+
+      return static_cast<thrust::detail::it_difference_t<InputIterator>>(contiguous::sum_intervals(
+        last - first, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+          return contiguous::count(raw_first + begin, end - begin, raw_value);
+        }));
+    }
+  }
+
+  return thrust::system::detail::generic::count(exec, first, last, value);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,6 +25,34 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
 
-// this system inherits merge
+// this system inherits merge and merge_by_key
 #include <thrust/system/cpp/detail/merge.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator merge_k(execution_policy<DerivedPolicy>& exec,
+                       OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/merge.inl>
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/multiway_merge.h>
+#include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/omp/detail/merge.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator merge_k(execution_policy<DerivedPolicy>& exec,
+                       OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if constexpr (!::cuda::std::is_convertible_v<thrust::iterator_traversal_t<OutputIterator>,
+                                               thrust::random_access_traversal_tag>)
+  {
+    // the parts cannot be written concurrently
+    return thrust::system::detail::sequential::merge_k(exec, offsets_first, offsets_last, first, result, comp);
+  }
+  else
+  {
+    using plan_type = thrust::system::detail::internal::
+      multiway_merge_plan<DerivedPolicy, RandomAccessIterator, OutputIterator, StrictWeakOrdering>;
+    using size_type = typename plan_type::size_type;
+
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    plan_type plan(exec, offsets_first, offsets_last, first, result, comp, num_threads);
+
+    const size_type num_parts = plan.num_parts();
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (size_type part = 0; part < num_parts; ++part)
+    {
+      plan.merge_part(part);
+    }
+
+    return plan.end();
+  }
+#else // ^^^ THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE ^^^ / vvv !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE vvv
+  return result;
+#endif // !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/tiled_pipeline.h>
+#include <thrust/system/detail/sequential/pipeline.h>
+#include <thrust/system/omp/detail/pipeline.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace pipeline_detail
+{
+
+struct tile_loop
+{
+  template <typename Size, typename Function>
+  void operator()(Size num_tiles, const Function& f) const
+  {
+    // filters make the work per tile uneven
+    THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+    for (Size tile = 0; tile < num_tiles; ++tile)
+    {
+      f(tile);
+    }
+  }
+};
+
+} // end namespace pipeline_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if constexpr (!::cuda::std::is_convertible_v<thrust::iterator_traversal_t<InputIterator>,
+                                               thrust::random_access_traversal_tag>
+                || !::cuda::std::is_convertible_v<thrust::iterator_traversal_t<OutputIterator>,
+                                                  thrust::random_access_traversal_tag>)
+  {
+    // the tiles cannot be read or written concurrently
+    return thrust::system::detail::sequential::pipeline(exec, first, last, result, stages...);
+  }
+  else
+  {
+    return thrust::system::detail::internal::tiled_pipeline(
+      exec, pipeline_detail::tile_loop(), first, last, result, stages...);
+  }
+#else // ^^^ THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE ^^^ / vvv !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE vvv
+  return result;
+#endif // !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -28,7 +28,7 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/decompose.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
@@ -52,8 +52,9 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
   const difference_type n = ::cuda::std::distance(first, last);
 
   // determine first and second level decomposition
+  // the first level decomposition does not depend on the number of threads, so the result is run-to-run deterministic
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
-    thrust::system::omp::detail::default_decomposition(n);
+    thrust::system::detail::internal::deterministic_decomposition(n);
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
 
   // allocate storage for the initializer and partial sums
@@ -25,9 +25,26 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/reduce_by_key.h>
+#include <thrust/system/omp/detail/contiguous.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
+#include <thrust/system/omp/detail/segment_heads.h>
+
+#include <cuda/std/type_traits>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -54,9 +71,163 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  if constexpr (!::cuda::std::is_convertible_v<iterator_traversal_t<InputIterator1>, random_access_traversal_tag>
+                || !::cuda::std::is_convertible_v<iterator_traversal_t<InputIterator2>, random_access_traversal_tag>
+                || !::cuda::std::is_convertible_v<iterator_traversal_t<OutputIterator1>, random_access_traversal_tag>
+                || !::cuda::std::is_convertible_v<iterator_traversal_t<OutputIterator2>, random_access_traversal_tag>)
+  {
+    // omp prefers generic::reduce_by_key to cpp::reduce_by_key
+    return thrust::system::detail::generic::reduce_by_key(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+  else
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+    using KeyType         = thrust::detail::it_value_t<InputIterator1>;
+
+    // Use the input iterator's value type per https://wg21.link/P0571
+    using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+    const difference_type n = thrust::distance(keys_first, keys_last);
+
+    const thrust::system::detail::internal::uniform_decomposition<difference_type> decomp(
+      n, contiguous::min_interval_size, omp_get_max_threads());
+    const difference_type num_tiles = decomp.size();
+
+    if (num_tiles <= 1)
+    {
+      return thrust::system::detail::sequential::reduce_by_key(
+        exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+    }
+
+    // Each thread reduces the segments starting in its tile into the same positions of a local buffer, so the input is
+    // read exactly once, with no flags or scans over all of it. The keys at the start of a tile which continue the last
+    // segment of the tiles before it are reduced separately and folded into the segment which started it.
+    thrust::detail::temporary_array<KeyType, DerivedPolicy> tile_keys_storage(exec, n);
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_values_storage(exec, n);
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_prefixes_storage(exec, num_tiles);
+    thrust::detail::temporary_array<difference_type, DerivedPolicy> tile_storage(exec, 5 * num_tiles + 1);
+
+    KeyType* tile_keys            = thrust::raw_pointer_cast(tile_keys_storage.data());
+    ValueType* tile_values        = thrust::raw_pointer_cast(tile_values_storage.data());
+    ValueType* tile_prefixes      = thrust::raw_pointer_cast(tile_prefixes_storage.data());
+    difference_type* tile_sizes   = thrust::raw_pointer_cast(tile_storage.data());
+    difference_type* first_heads  = tile_sizes + num_tiles;
+    difference_type* last_heads   = first_heads + num_tiles;
+    difference_type* open_heads   = last_heads + num_tiles;
+    difference_type* tile_offsets = open_heads + num_tiles;
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (difference_type tile = 0; tile < num_tiles; ++tile)
+    {
+      const difference_type begin      = decomp[tile].begin();
+      const difference_type end        = decomp[tile].end();
+      const difference_type first_head = segment_heads::guess_first_head(keys_first, begin, end, binary_pred);
+      difference_type size             = 0;
+
+      if (begin < first_head)
+      {
+        ValueType prefix = values_first[begin];
+        for (difference_type i = begin + 1; i < first_head; ++i)
+        {
+          prefix = binary_op(prefix, values_first[i]);
+        }
+        tile_prefixes[tile] = prefix;
+      }
+
+      if (first_head < end)
+      {
+        KeyType temp_key          = keys_first[first_head];
+        ValueType temp_value      = values_first[first_head];
+        difference_type last_head = first_head;
+
+        for (difference_type i = first_head + 1; i < end; ++i)
+        {
+          KeyType key = keys_first[i];
+
+          if (binary_pred(temp_key, key))
+          {
+            temp_value = binary_op(temp_value, values_first[i]);
+          }
+          else
+          {
+            tile_keys[begin + size]   = temp_key;
+            tile_values[begin + size] = temp_value;
+            ++size;
+
+            temp_key   = key;
+            temp_value = values_first[i];
+            last_head  = i;
+          }
+        }
+
+        tile_keys[begin + size]   = temp_key;
+        tile_values[begin + size] = temp_value;
+        ++size;
+        last_heads[tile] = last_head;
+      }
+
+      first_heads[tile] = first_head;
+      tile_sizes[tile]  = size;
+    }
+
+    if (!segment_heads::check_first_heads(decomp, keys_first, first_heads, last_heads, open_heads, binary_pred))
+    {
+      // binary_pred is no equivalence relation, and the tiles were split at the wrong keys
+      return thrust::system::detail::sequential::reduce_by_key(
+        exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+    }
+
+    // fold the keys at the start of each tile which continue the segment before it into the last segment of the tile
+    // which started that segment, in order, and compute the position of the segments of each tile in the output
+    difference_type open_tile = 0;
+    tile_offsets[0]           = 0;
+
+    for (difference_type tile = 0; tile < num_tiles; ++tile)
+    {
+      if (decomp[tile].begin() < first_heads[tile])
+      {
+        ValueType& open_value = tile_values[decomp[open_tile].begin() + tile_sizes[open_tile] - 1];
+        open_value            = binary_op(open_value, tile_prefixes[tile]);
+      }
+
+      if (tile_sizes[tile] > 0)
+      {
+        open_tile = tile;
+      }
+
+      tile_offsets[tile + 1] = tile_offsets[tile] + tile_sizes[tile];
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (difference_type tile = 0; tile < num_tiles; ++tile)
+    {
+      const difference_type begin  = decomp[tile].begin();
+      const difference_type offset = tile_offsets[tile];
+
+      for (difference_type i = 0; i < tile_sizes[tile]; ++i)
+      {
+        keys_output[offset + i]   = tile_keys[begin + i];
+        values_output[offset + i] = tile_values[begin + i];
+      }
+    }
+
+    const difference_type num_segments = tile_offsets[num_tiles];
+    return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
+#else // ^^^ THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE ^^^ / vvv !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE vvv
+    return thrust::make_pair(keys_output, values_output);
+#endif // !THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  }
 } // end reduce_by_key()
 
 } // namespace detail
@@ -25,6 +25,40 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/detail/generic/reverse.h>
+#include <thrust/system/omp/detail/contiguous.h>
+#include <thrust/system/omp/detail/execution_policy.h>
 
-// this system inherits reverse
-#include <thrust/system/cpp/detail/reverse.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename BidirectionalIterator>
+void reverse(execution_policy<DerivedPolicy>& exec, BidirectionalIterator first, BidirectionalIterator last)
+{
+  if constexpr (contiguous::is_vectorizable_v<BidirectionalIterator>)
+  {
+    const auto raw_first = thrust::unwrap_contiguous_iterator(first);
+    const auto n         = last - first;
+
+    // each interval of the front half is swapped with its mirror image in the back half
+    contiguous::for_each_interval(n / 2, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+      contiguous::swap_reversed(raw_first + begin, raw_first + n - begin, end - begin);
+    });
+  }
+  else
+  {
+    thrust::system::detail::generic::reverse(exec, first, last);
+  }
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace segment_heads
+{
+
+// The segments of reduce_by_key and unique_by_key are split like in the sequential implementations: a key starts a
+// new segment unless binary_pred(head, key) holds, where head is the first key of the current segment. When the input
+// is split into tiles, the head of the segment open at the start of a tile is only known once the tiles before it are
+// split, so each tile is split speculatively, comparing its first keys with the key before the tile, and the guesses
+// are checked afterwards. They are always right if binary_pred is an equivalence relation.
+
+// Returns the index of the first key in [begin, end) which does not belong to the segment headed by keys_first[head].
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size segment_end(RandomAccessIterator keys_first, Size head, Size begin, Size end, BinaryPredicate& binary_pred)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const KeyType head_key = keys_first[head];
+  while (begin < end && binary_pred(head_key, KeyType(keys_first[begin])))
+  {
+    ++begin;
+  }
+  return begin;
+}
+
+// Returns the index of the first key in [begin, end) which starts a segment, guessing that the key before begin
+// belongs to the segment open at begin.
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size guess_first_head(RandomAccessIterator keys_first, Size begin, Size end, BinaryPredicate& binary_pred)
+{
+  return begin == 0 ? begin : segment_end(keys_first, begin - 1, begin, end, binary_pred);
+}
+
+// Checks the guesses of guess_first_head for all tiles but the first. first_heads[tile] is the guess for the tile, or
+// its end if all of it continues the segment before it, and last_heads[tile] is the head of the last segment which
+// starts in the tile, if any. open_heads is scratch space for one index per tile.
+template <typename Decomposition, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+bool check_first_heads(
+  const Decomposition& decomp,
+  RandomAccessIterator keys_first,
+  const Size* first_heads,
+  const Size* last_heads,
+  Size* open_heads,
+  BinaryPredicate binary_pred)
+{
+  const Size num_tiles = decomp.size();
+
+  // the heads of the segments open at the start of the tiles, if the guesses are right
+  open_heads[0] = 0;
+  for (Size tile = 0; tile + 1 < num_tiles; ++tile)
+  {
+    open_heads[tile + 1] = first_heads[tile] < decomp[tile].end() ? last_heads[tile] : open_heads[tile];
+  }
+
+  bool valid = true;
+  THRUST_PRAGMA_OMP(parallel for reduction(&& : valid))
+  for (Size tile = 1; tile < num_tiles; ++tile)
+  {
+    const Size begin = decomp[tile].begin();
+
+    // the guess compared the keys of the tile with the head of the open segment already
+    if (open_heads[tile] != begin - 1)
+    {
+      valid = valid
+           && segment_end(keys_first, open_heads[tile], begin, decomp[tile].end(), binary_pred) == first_heads[tile];
+    }
+  }
+  return valid;
+}
+
+} // namespace segment_heads
+} // namespace detail
+} // namespace omp
+} // namespace system
+THRUST_NAMESPACE_END
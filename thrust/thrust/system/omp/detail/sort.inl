@@ -37,6 +37,9 @@
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/indirect_sort.h>
+#include <thrust/system/detail/internal/segmented_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -196,6 +199,13 @@ void stable_sort_by_key(
     return;
   }
 
+  if constexpr (thrust::system::detail::internal::use_indirect_sort_by_key<
+                  thrust::detail::it_value_t<RandomAccessIterator2>>)
+  {
+    thrust::system::detail::internal::indirect_stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
   THRUST_PRAGMA_OMP(parallel)
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
@@ -259,6 +269,129 @@ void stable_sort_by_key(
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using plan_type = thrust::system::detail::internal::segmented_sort_plan<IndexType>;
+
+  const plan_type plan(
+    begin_offsets_first, begin_offsets_last, end_offsets_first, static_cast<IndexType>(omp_get_max_threads()));
+
+  const IndexType num_batches = plan.num_batches();
+
+  // every thread sorts the short segments of its batches on its own
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for (IndexType batch = 0; batch < num_batches; ++batch)
+  {
+    for (IndexType i = plan.batch_begin(batch); i < plan.batch_end(batch); ++i)
+    {
+      const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+      const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+      if (!plan.is_large(end - begin))
+      {
+        thrust::system::detail::sequential::stable_sort_segment(exec, keys_first + begin, keys_first + end, comp);
+      }
+    }
+  }
+
+  // all threads sort each long segment together
+  for (IndexType i = 0; i < plan.num_segments(); ++i)
+  {
+    const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+    const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+    if (plan.is_large(end - begin))
+    {
+      thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using plan_type = thrust::system::detail::internal::segmented_sort_plan<IndexType>;
+
+  const plan_type plan(
+    begin_offsets_first, begin_offsets_last, end_offsets_first, static_cast<IndexType>(omp_get_max_threads()));
+
+  const IndexType num_batches = plan.num_batches();
+
+  // every thread sorts the short segments of its batches on its own
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for (IndexType batch = 0; batch < num_batches; ++batch)
+  {
+    for (IndexType i = plan.batch_begin(batch); i < plan.batch_end(batch); ++i)
+    {
+      const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+      const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+      if (!plan.is_large(end - begin))
+      {
+        thrust::system::detail::sequential::stable_sort_segment_by_key(
+          exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+      }
+    }
+  }
+
+  // all threads sort each long segment together
+  for (IndexType i = 0; i < plan.num_segments(); ++i)
+  {
+    const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+    const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+    if (plan.is_large(end - begin))
+    {
+      thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -40,6 +40,7 @@
 
 #include <thrust/system/omp/detail/adjacent_difference.h>
 #include <thrust/system/omp/detail/assign_value.h>
+#include <thrust/system/omp/detail/async_launch.h>
 #include <thrust/system/omp/detail/binary_search.h>
 #include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/copy_if.h>
@@ -59,6 +60,7 @@
 #include <thrust/system/omp/detail/merge.h>
 #include <thrust/system/omp/detail/mismatch.h>
 #include <thrust/system/omp/detail/partition.h>
+#include <thrust/system/omp/detail/pipeline.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 #include <thrust/system/omp/detail/remove.h>
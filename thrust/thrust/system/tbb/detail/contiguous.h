@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/contiguous.h>
+#include <thrust/system/detail/sequential/streaming_store.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace contiguous
+{
+
+// Parallel loops over the index space of contiguous ranges, whose intervals are processed by the sequential kernels.
+using thrust::system::detail::sequential::contiguous::are_vectorizable_v;
+using thrust::system::detail::sequential::contiguous::count;
+using thrust::system::detail::sequential::contiguous::equal;
+using thrust::system::detail::sequential::contiguous::fill_n;
+using thrust::system::detail::sequential::contiguous::find;
+using thrust::system::detail::sequential::contiguous::is_comparable_v;
+using thrust::system::detail::sequential::contiguous::is_equal_to_v;
+using thrust::system::detail::sequential::contiguous::is_representable;
+using thrust::system::detail::sequential::contiguous::is_vectorizable_v;
+using thrust::system::detail::sequential::contiguous::mismatch;
+using thrust::system::detail::sequential::contiguous::streaming_fill_n;
+using thrust::system::detail::sequential::contiguous::streaming_generate_n;
+using thrust::system::detail::sequential::contiguous::swap_reversed;
+using thrust::system::detail::sequential::contiguous::use_streaming_stores;
+
+using index_range = ::tbb::blocked_range<::cuda::std::ptrdiff_t>;
+
+// the smallest number of elements worth processing in a separate task
+inline constexpr ::cuda::std::ptrdiff_t min_interval_size = 1 << 15;
+
+// the number of elements searched before checking for a match
+inline constexpr ::cuda::std::ptrdiff_t search_round_size = 1 << 20;
+
+// Calls f(begin, end) for each interval of a decomposition of [0, n).
+template <typename Function>
+void for_each_interval(::cuda::std::ptrdiff_t n, Function f)
+{
+  if (n <= 0)
+  {
+    return;
+  }
+
+  ::tbb::parallel_for(index_range(0, n, min_interval_size), [&f](const index_range& r) {
+    f(r.begin(), r.end());
+  });
+}
+
+// Returns the sum of f(begin, end) over the intervals of [0, n).
+template <typename Function>
+::cuda::std::ptrdiff_t sum_intervals(::cuda::std::ptrdiff_t n, Function f)
+{
+  if (n <= 0)
+  {
+    return 0;
+  }
+
+  return ::tbb::parallel_reduce(
+    index_range(0, n, min_interval_size),
+    ::cuda::std::ptrdiff_t{0},
+    [&f](const index_range& r, ::cuda::std::ptrdiff_t partial) {
+      return partial + f(r.begin(), r.end());
+    },
+    [](::cuda::std::ptrdiff_t lhs, ::cuda::std::ptrdiff_t rhs) {
+      return lhs + rhs;
+    });
+}
+
+// Returns the smallest index in [0, n) found by f(begin, end), which returns end if it finds nothing in
+// [begin, end), or n. The range is searched in rounds, so that an early match does not wait for the whole range.
+template <typename Function>
+::cuda::std::ptrdiff_t find_first(::cuda::std::ptrdiff_t n, Function f)
+{
+  for (::cuda::std::ptrdiff_t round_begin = 0; round_begin < n; round_begin += search_round_size)
+  {
+    const ::cuda::std::ptrdiff_t round_end = (::cuda::std::min) (n, round_begin + search_round_size);
+
+    const ::cuda::std::ptrdiff_t result = ::tbb::parallel_reduce(
+      index_range(round_begin, round_end, min_interval_size),
+      round_end,
+      [&f](const index_range& r, ::cuda::std::ptrdiff_t partial) {
+        // intervals following a match need not be searched
+        if (partial < r.begin())
+        {
+          return partial;
+        }
+        const ::cuda::std::ptrdiff_t found = f(r.begin(), r.end());
+        return found != r.end() ? (::cuda::std::min) (partial, found) : partial;
+      },
+      [](::cuda::std::ptrdiff_t lhs, ::cuda::std::ptrdiff_t rhs) {
+        return (::cuda::std::min) (lhs, rhs);
+      });
+
+    if (result != round_end)
+    {
+      return result;
+    }
+  }
+
+  return n;
+}
+
+} // namespace contiguous
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
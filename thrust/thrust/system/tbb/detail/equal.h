@@ -25,6 +25,47 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/detail/generic/equal.h>
+#include <thrust/system/tbb/detail/contiguous.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits equal
-#include <thrust/system/cpp/detail/equal.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+bool equal(execution_policy<DerivedPolicy>& exec,
+           InputIterator1 first1,
+           InputIterator1 last1,
+           InputIterator2 first2,
+           BinaryPredicate binary_pred)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>
+                && contiguous::is_equal_to_v<BinaryPredicate, thrust::detail::it_value_t<InputIterator1>>)
+  {
+    const auto raw_first1 = thrust::unwrap_contiguous_iterator(first1);
+    const auto raw_first2 = thrust::unwrap_contiguous_iterator(first2);
+
+    // any difference decides the result, so an interval only reports whether it has one, not where
+    const auto n        = last1 - first1;
+    const auto mismatch = contiguous::find_first(n, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+      return contiguous::equal(raw_first1 + begin, end - begin, raw_first2 + begin) ? end : begin;
+    });
+    return mismatch == n;
+  }
+  else
+  {
+    return thrust::system::detail::generic::equal(exec, first1, last1, first2, binary_pred);
+  }
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
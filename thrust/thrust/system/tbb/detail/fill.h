@@ -25,6 +25,65 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/tbb/detail/contiguous.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits fill
-#include <thrust/system/cpp/detail/fill.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
+{
+  using value_type = thrust::detail::it_value_t<OutputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<OutputIterator> && ::cuda::std::is_convertible_v<const T&, value_type>)
+  {
+    const auto raw_first       = thrust::unwrap_contiguous_iterator(first);
+    const value_type raw_value = static_cast<value_type>(value);
+
+    if (contiguous::use_streaming_stores<value_type>(n))
+    {
+      contiguous::for_each_interval(n, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+        contiguous::streaming_fill_n(raw_first + begin, end - begin, raw_value);
+      });
+    }
+    else
+    {
+      contiguous::for_each_interval(n, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+        contiguous::fill_n(raw_first + begin, end - begin, raw_value);
+      });
+    }
+    return first + n;
+  }
+  else
+  {
+    return thrust::system::detail::generic::fill_n(exec, first, n, value);
+  }
+}
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, const T& value)
+{
+  if constexpr (contiguous::is_vectorizable_v<ForwardIterator>)
+  {
+    tbb::detail::fill_n(exec, first, last - first, value);
+  }
+  else
+  {
+    thrust::system::detail::generic::fill(exec, first, last, value);
+  }
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
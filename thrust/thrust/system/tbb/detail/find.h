@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/generic/find.h>
+#include <thrust/system/tbb/detail/contiguous.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -43,6 +44,29 @@ InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first
   return thrust::system::detail::generic::find_if(exec, first, last, pred);
 }
 
+template <typename DerivedPolicy, typename InputIterator, typename T>
+InputIterator find(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, const T& value)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+
+  if constexpr (contiguous::is_vectorizable_v<InputIterator> && contiguous::is_comparable_v<value_type, T>)
+  {
+    if (contiguous::is_representable<value_type>(value))
+    {
+      const auto raw_first       = thrust::unwrap_contiguous_iterator(first);
+      const value_type raw_value = static_cast<value_type>(value);
+
+      const auto n =
+        contiguous::find_first(last - first, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+          return begin + contiguous::find(raw_first + begin, end - begin, raw_value);
+        });
+      return first + n;
+    }
+  }
+
+  return thrust::system::detail::generic::find(exec, first, last, value);
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
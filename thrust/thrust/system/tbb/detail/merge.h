@@ -69,6 +69,18 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator2 values_result,
   StrictWeakOrdering comp);
 
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator merge_k(execution_policy<ExecutionPolicy>& exec,
+                       OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp);
+
 } // namespace detail
 } // namespace tbb
 } // namespace system
@@ -29,11 +29,17 @@
 #include <thrust/binary_search.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_categories.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
+#include <thrust/system/detail/internal/multiway_merge.h>
+#include <thrust/system/detail/sequential/merge.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/type_traits>
+
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -321,6 +327,47 @@ thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   return thrust::make_pair(keys_result, values_result);
 }
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator merge_k(execution_policy<DerivedPolicy>& exec,
+                       OffsetIterator offsets_first,
+                       OffsetIterator offsets_last,
+                       RandomAccessIterator first,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  if constexpr (!::cuda::std::is_convertible_v<thrust::iterator_traversal_t<OutputIterator>,
+                                               thrust::random_access_traversal_tag>)
+  {
+    // the parts cannot be written concurrently
+    return thrust::system::detail::sequential::merge_k(exec, offsets_first, offsets_last, first, result, comp);
+  }
+  else
+  {
+    using plan_type = thrust::system::detail::internal::
+      multiway_merge_plan<DerivedPolicy, RandomAccessIterator, OutputIterator, StrictWeakOrdering>;
+    using size_type = typename plan_type::size_type;
+
+    plan_type plan(
+      exec,
+      offsets_first,
+      offsets_last,
+      first,
+      result,
+      comp,
+      static_cast<size_type>(::tbb::this_task_arena::max_concurrency()));
+
+    ::tbb::parallel_for(size_type{0}, plan.num_parts(), [&plan](size_type part) {
+      plan.merge_part(part);
+    });
+
+    return plan.end();
+  }
+} // end merge_k()
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
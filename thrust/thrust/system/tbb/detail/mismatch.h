@@ -25,6 +25,63 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/mismatch.h>
+#include <thrust/system/tbb/detail/contiguous.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
 
-// this system inherits mismatch
-#include <thrust/system/cpp/detail/mismatch.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+thrust::pair<InputIterator1, InputIterator2> mismatch(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  BinaryPredicate pred)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>
+                && contiguous::is_equal_to_v<BinaryPredicate, thrust::detail::it_value_t<InputIterator1>>)
+  {
+    const auto raw_first1 = thrust::unwrap_contiguous_iterator(first1);
+    const auto raw_first2 = thrust::unwrap_contiguous_iterator(first2);
+
+    const auto n =
+      contiguous::find_first(last1 - first1, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+        return begin + contiguous::mismatch(raw_first1 + begin, end - begin, raw_first2 + begin);
+      });
+    return thrust::make_pair(first1 + n, first2 + n);
+  }
+  else
+  {
+    return thrust::system::detail::generic::mismatch(exec, first1, last1, first2, pred);
+  }
+}
+
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2>
+thrust::pair<InputIterator1, InputIterator2>
+mismatch(execution_policy<DerivedPolicy>& exec, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+  if constexpr (contiguous::are_vectorizable_v<InputIterator1, InputIterator2>)
+  {
+    return tbb::detail::mismatch(exec, first1, last1, first2, ::cuda::std::equal_to<>());
+  }
+  else
+  {
+    return thrust::system::detail::generic::mismatch(exec, first1, last1, first2);
+  }
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/tiled_pipeline.h>
+#include <thrust/system/detail/sequential/pipeline.h>
+#include <thrust/system/tbb/detail/pipeline.h>
+
+#include <cuda/std/type_traits>
+
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace pipeline_detail
+{
+
+struct tile_loop
+{
+  template <typename Size, typename Function>
+  void operator()(Size num_tiles, const Function& f) const
+  {
+    ::tbb::parallel_for(Size{0}, num_tiles, f);
+  }
+};
+
+} // end namespace pipeline_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename... Stages>
+OutputIterator pipeline(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  const Stages&... stages)
+{
+  if constexpr (!::cuda::std::is_convertible_v<thrust::iterator_traversal_t<InputIterator>,
+                                               thrust::random_access_traversal_tag>
+                || !::cuda::std::is_convertible_v<thrust::iterator_traversal_t<OutputIterator>,
+                                                  thrust::random_access_traversal_tag>)
+  {
+    // the tiles cannot be read or written concurrently
+    return thrust::system::detail::sequential::pipeline(exec, first, last, result, stages...);
+  }
+  else
+  {
+    return thrust::system::detail::internal::tiled_pipeline(
+      exec, pipeline_detail::tile_loop(), first, last, result, stages...);
+  }
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -30,6 +30,7 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/decompose.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
@@ -124,9 +125,14 @@ OutputType reduce(
   }
   else
   {
+    // split the range into a tree of subranges that depends on n only, and join the partial sums in tree order, so
+    // that the result is run-to-run deterministic regardless of the number of threads and work stealing
+    const Size grainsize = thrust::system::detail::internal::deterministic_decomposition(n)[0].size();
+
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    ::tbb::parallel_deterministic_reduce(
+      ::tbb::blocked_range<Size>(0, n, grainsize), reduce_body, ::tbb::simple_partitioner());
     return binary_op(init, reduce_body.sum);
   }
 }
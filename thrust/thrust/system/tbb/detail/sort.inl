@@ -32,8 +32,13 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/indirect_sort.h>
+#include <thrust/system/detail/internal/segmented_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -281,12 +286,118 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-  RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+  if constexpr (thrust::system::detail::internal::use_indirect_sort_by_key<val_type>)
+  {
+    thrust::system::detail::internal::indirect_stable_sort_by_key(exec, first1, last1, first2, comp);
+  }
+  else
+  {
+    RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
+    thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
-  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+    sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using plan_type = thrust::system::detail::internal::segmented_sort_plan<IndexType>;
+
+  const plan_type plan(
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    static_cast<IndexType>(::tbb::this_task_arena::max_concurrency()));
+
+  // every task sorts the short segments of its batches on its own
+  ::tbb::parallel_for(IndexType{0}, plan.num_batches(), [&](IndexType batch) {
+    for (IndexType i = plan.batch_begin(batch); i < plan.batch_end(batch); ++i)
+    {
+      const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+      const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+      if (!plan.is_large(end - begin))
+      {
+        thrust::system::detail::sequential::stable_sort_segment(exec, keys_first + begin, keys_first + end, comp);
+      }
+    }
+  });
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  // all tasks sort each long segment together
+  for (IndexType i = 0; i < plan.num_segments(); ++i)
+  {
+    const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+    const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+    if (plan.is_large(end - begin))
+    {
+      thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+  }
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using plan_type = thrust::system::detail::internal::segmented_sort_plan<IndexType>;
+
+  const plan_type plan(
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    static_cast<IndexType>(::tbb::this_task_arena::max_concurrency()));
+
+  // every task sorts the short segments of its batches on its own
+  ::tbb::parallel_for(IndexType{0}, plan.num_batches(), [&](IndexType batch) {
+    for (IndexType i = plan.batch_begin(batch); i < plan.batch_end(batch); ++i)
+    {
+      const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+      const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+      if (!plan.is_large(end - begin))
+      {
+        thrust::system::detail::sequential::stable_sort_segment_by_key(
+          exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+      }
+    }
+  });
+
+  // all tasks sort each long segment together
+  for (IndexType i = 0; i < plan.num_segments(); ++i)
+  {
+    const IndexType begin = static_cast<IndexType>(begin_offsets_first[i]);
+    const IndexType end   = static_cast<IndexType>(end_offsets_first[i]);
+    if (plan.is_large(end - begin))
+    {
+      thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+  }
 }
 
 } // end namespace detail
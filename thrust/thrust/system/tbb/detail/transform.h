@@ -26,5 +26,89 @@
 #  pragma system_header
 #endif // no system header
 
-// omp inherits transform
-#include <thrust/system/cpp/detail/transform.h>
+#include <thrust/system/detail/generic/transform.h>
+#include <thrust/system/tbb/detail/contiguous.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename UnaryFunction>
+OutputIterator transform(execution_policy<DerivedPolicy>& exec,
+                         InputIterator first,
+                         InputIterator last,
+                         OutputIterator result,
+                         UnaryFunction op)
+{
+  if constexpr (thrust::is_contiguous_iterator_v<InputIterator> && contiguous::is_vectorizable_v<OutputIterator>)
+  {
+    using value_type               = thrust::detail::it_value_t<OutputIterator>;
+    const ::cuda::std::ptrdiff_t n = last - first;
+    if (contiguous::use_streaming_stores<value_type>(n))
+    {
+      const auto raw_first  = thrust::unwrap_contiguous_iterator(first);
+      const auto raw_result = thrust::unwrap_contiguous_iterator(result);
+      contiguous::for_each_interval(n, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+        UnaryFunction f = op;
+        contiguous::streaming_generate_n(
+          raw_result + begin, end - begin, [&f, raw_first, begin](::cuda::std::ptrdiff_t i) {
+            return f(raw_first[begin + i]);
+          });
+      });
+      return result + n;
+    }
+  }
+
+  return thrust::system::detail::generic::transform(exec, first, last, result, op);
+} // end transform()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator transform(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryFunction op)
+{
+  if constexpr (thrust::is_contiguous_iterator_v<InputIterator1> && thrust::is_contiguous_iterator_v<InputIterator2>
+                && contiguous::is_vectorizable_v<OutputIterator>)
+  {
+    using value_type               = thrust::detail::it_value_t<OutputIterator>;
+    const ::cuda::std::ptrdiff_t n = last1 - first1;
+    if (contiguous::use_streaming_stores<value_type>(n))
+    {
+      const auto raw_first1 = thrust::unwrap_contiguous_iterator(first1);
+      const auto raw_first2 = thrust::unwrap_contiguous_iterator(first2);
+      const auto raw_result = thrust::unwrap_contiguous_iterator(result);
+      contiguous::for_each_interval(n, [=](::cuda::std::ptrdiff_t begin, ::cuda::std::ptrdiff_t end) {
+        BinaryFunction f = op;
+        contiguous::streaming_generate_n(
+          raw_result + begin, end - begin, [&f, raw_first1, raw_first2, begin](::cuda::std::ptrdiff_t i) {
+            return f(raw_first1[begin + i], raw_first2[begin + i]);
+          });
+      });
+      return result + n;
+    }
+  }
+
+  return thrust::system::detail::generic::transform(exec, first1, last1, first2, result, op);
+} // end transform()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
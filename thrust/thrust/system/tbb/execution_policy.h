@@ -40,6 +40,7 @@
 
 #include <thrust/system/tbb/detail/adjacent_difference.h>
 #include <thrust/system/tbb/detail/assign_value.h>
+#include <thrust/system/tbb/detail/async_launch.h>
 #include <thrust/system/tbb/detail/binary_search.h>
 #include <thrust/system/tbb/detail/copy.h>
 #include <thrust/system/tbb/detail/copy_if.h>
@@ -59,6 +60,7 @@
 #include <thrust/system/tbb/detail/merge.h>
 #include <thrust/system/tbb/detail/mismatch.h>
 #include <thrust/system/tbb/detail/partition.h>
+#include <thrust/system/tbb/detail/pipeline.h>
 #include <thrust/system/tbb/detail/reduce.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/remove.h>
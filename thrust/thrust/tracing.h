@@ -0,0 +1,475 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file thrust/tracing.h
+ *  \brief In-process tracing of Thrust algorithm invocations on the host.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! The number of events retained per thread when tracing is enabled. Older events are overwritten.
+#ifndef THRUST_TRACING_BUFFER_SIZE
+#  define THRUST_TRACING_BUFFER_SIZE 4096
+#endif // THRUST_TRACING_BUFFER_SIZE
+
+THRUST_NAMESPACE_BEGIN
+
+// forward declarations of the execution policies of all systems, used to name the system an algorithm dispatched to
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+template <typename>
+struct execution_policy;
+} // namespace sequential
+} // namespace detail
+namespace cpp
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace cpp
+namespace omp
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace omp
+namespace tbb
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace tbb
+} // namespace system
+namespace cuda_cub
+{
+template <typename>
+struct execution_policy;
+} // namespace cuda_cub
+
+/*! \p thrust::tracing records the Thrust algorithms invoked from host code, when Thrust is compiled with
+ *  \p THRUST_ENABLE_TRACING defined. Otherwise, the instrumentation at the algorithm entry points compiles to nothing
+ *  and no events are recorded.
+ *
+ *  Every call to a Thrust algorithm with an execution policy records an \p event with the algorithm name, the system
+ *  it dispatched to, the number of input elements, its duration and the amount of temporary storage it allocated.
+ *  Algorithms invoked from inside other algorithms are recorded as well, with a larger \p event::depth. If an OpenMP or
+ *  TBB algorithm is executed by the sequential implementation, the event is marked with \p event::sequential_fallback.
+ *
+ *  Events are kept in a fixed-size ring buffer per thread, holding the most recent \p THRUST_TRACING_BUFFER_SIZE
+ *  events. The buffer of a thread that exits is kept, and new threads append to it. Events can be exported as a Chrome
+ *  trace (\p write_chrome_trace, viewable in \c chrome://tracing or Perfetto) or aggregated per algorithm and system
+ *  (\p summary, \p write_summary).
+ */
+namespace tracing
+{
+
+/*! \addtogroup tracing Tracing
+ *  \{
+ */
+
+//! Whether Thrust was compiled with tracing support, i.e. with \p THRUST_ENABLE_TRACING defined.
+#ifdef THRUST_ENABLE_TRACING
+inline constexpr bool enabled = true;
+#else // ^^^ THRUST_ENABLE_TRACING ^^^ / vvv !THRUST_ENABLE_TRACING vvv
+inline constexpr bool enabled = false;
+#endif // !THRUST_ENABLE_TRACING
+
+//! A single recorded algorithm invocation.
+struct event
+{
+  //! Name of the algorithm, e.g. \c "thrust::reduce".
+  const char* name;
+  //! The system the algorithm dispatched to: \c "seq", \c "cpp", \c "omp", \c "tbb", \c "cuda" or \c "unknown".
+  const char* system;
+  //! The number of input elements, or -1 if the input iterators are not random access.
+  ::cuda::std::int64_t elements;
+  //! Start time in nanoseconds, relative to an arbitrary process-wide epoch.
+  ::cuda::std::uint64_t start_ns;
+  //! Duration in nanoseconds.
+  ::cuda::std::uint64_t duration_ns;
+  //! Bytes of temporary storage requested by the algorithm itself, excluding nested algorithms.
+  ::cuda::std::uint64_t temporary_bytes;
+  //! A process-wide index of the recording thread. Threads created after another thread exited may reuse its index.
+  ::cuda::std::uint32_t thread;
+  //! Nesting depth; 0 for algorithms invoked directly by the user.
+  ::cuda::std::uint32_t depth;
+  //! Whether an OpenMP or TBB algorithm was executed by the sequential implementation.
+  bool sequential_fallback;
+};
+
+//! Aggregated statistics of all events with the same algorithm name and system.
+struct counter
+{
+  const char* name;
+  const char* system;
+  ::cuda::std::uint64_t calls;
+  ::cuda::std::uint64_t sequential_fallbacks;
+  ::cuda::std::uint64_t elements;
+  ::cuda::std::uint64_t total_ns;
+  ::cuda::std::uint64_t temporary_bytes;
+};
+
+namespace detail
+{
+
+inline ::cuda::std::uint64_t now_ns()
+{
+  static const auto epoch = std::chrono::steady_clock::now();
+  return static_cast<::cuda::std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+// A ring buffer of the events of one thread. Only that thread pushes, so its mutex is uncontended unless the events are
+// exported or cleared at the same time, and tracing does not serialize the threads of the OpenMP and TBB systems.
+class thread_buffer
+{
+public:
+  explicit thread_buffer(::cuda::std::uint32_t thread)
+      : m_events(THRUST_TRACING_BUFFER_SIZE)
+      , m_thread(thread)
+  {}
+
+  void push(const event& e)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events[m_pushed % THRUST_TRACING_BUFFER_SIZE] = e;
+    ++m_pushed;
+    m_retained = (std::min) (m_retained + 1, ::cuda::std::uint64_t{THRUST_TRACING_BUFFER_SIZE});
+  }
+
+  void append_to(std::vector<event>& out) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (::cuda::std::uint64_t i = m_pushed - m_retained; i < m_pushed; ++i)
+    {
+      out.push_back(m_events[i % THRUST_TRACING_BUFFER_SIZE]);
+    }
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retained = 0;
+  }
+
+  ::cuda::std::uint32_t thread() const
+  {
+    return m_thread;
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  std::vector<event> m_events;
+  ::cuda::std::uint64_t m_pushed   = 0;
+  ::cuda::std::uint64_t m_retained = 0;
+  ::cuda::std::uint32_t m_thread;
+};
+
+// Owns the buffers of all threads, so that events survive the threads that recorded them. The buffers of exited
+// threads are handed to new threads, so that threads created and joined repeatedly, e.g. by std::async, do not add a
+// buffer each. The registry is never destroyed, because threads may exit during the destruction of static objects.
+class registry
+{
+public:
+  static registry& get()
+  {
+    static registry* instance = new registry;
+    return *instance;
+  }
+
+  std::shared_ptr<thread_buffer> acquire_buffer()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_free.empty())
+    {
+      auto buffer = std::move(m_free.back());
+      m_free.pop_back();
+      return buffer;
+    }
+    auto buffer = std::make_shared<thread_buffer>(static_cast<::cuda::std::uint32_t>(m_buffers.size()));
+    m_buffers.push_back(buffer);
+    return buffer;
+  }
+
+  void release_buffer(std::shared_ptr<thread_buffer> buffer)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(std::move(buffer));
+  }
+
+  std::vector<std::shared_ptr<thread_buffer>> buffers()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buffers;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::vector<std::shared_ptr<thread_buffer>> m_buffers;
+  std::vector<std::shared_ptr<thread_buffer>> m_free;
+};
+
+class scope;
+
+struct thread_state
+{
+  std::shared_ptr<thread_buffer> buffer = registry::get().acquire_buffer();
+  scope* innermost                      = nullptr;
+  ::cuda::std::uint32_t depth           = 0;
+
+  thread_state() = default;
+
+  ~thread_state()
+  {
+    registry::get().release_buffer(std::move(buffer));
+  }
+
+  thread_state(const thread_state&)            = delete;
+  thread_state& operator=(const thread_state&) = delete;
+};
+
+inline thread_state& local_state()
+{
+  static thread_local thread_state state;
+  return state;
+}
+
+template <typename Policy, template <typename> class SystemPolicy>
+inline constexpr bool dispatches_to = ::cuda::std::is_base_of_v<SystemPolicy<Policy>, Policy>;
+
+template <typename Policy>
+constexpr const char* system_name()
+{
+  // most derived systems first: omp and tbb derive from cpp, which derives from sequential
+  if constexpr (dispatches_to<Policy, THRUST_NS_QUALIFIER::cuda_cub::execution_policy>)
+  {
+    return "cuda";
+  }
+  else if constexpr (dispatches_to<Policy, THRUST_NS_QUALIFIER::system::omp::detail::execution_policy>)
+  {
+    return "omp";
+  }
+  else if constexpr (dispatches_to<Policy, THRUST_NS_QUALIFIER::system::tbb::detail::execution_policy>)
+  {
+    return "tbb";
+  }
+  else if constexpr (dispatches_to<Policy, THRUST_NS_QUALIFIER::system::cpp::detail::execution_policy>)
+  {
+    return "cpp";
+  }
+  else if constexpr (dispatches_to<Policy, THRUST_NS_QUALIFIER::system::detail::sequential::execution_policy>)
+  {
+    return "seq";
+  }
+  else
+  {
+    return "unknown";
+  }
+}
+
+// Records one event from construction to destruction. Instantiated by _THRUST_TRACE_SCOPE. A forwarding scope belongs
+// to an entry point that only forwards to another traced algorithm, e.g. transform_n to transform. The scope of that
+// algorithm is merged into the forwarding one, so that the call is recorded and timed once.
+class scope
+{
+public:
+  scope(const char* name, const char* system, ::cuda::std::int64_t elements, bool forwarding = false)
+      : m_state(local_state())
+      , m_outer(m_state.innermost)
+      , m_merged(m_outer != nullptr && m_outer->m_forwarding)
+      , m_forwarding(forwarding)
+      , m_event{name, system, elements, 0, 0, 0, m_state.buffer->thread(), m_state.depth, false}
+  {
+    if (m_merged)
+    {
+      m_outer->m_forwarding = false;
+      return;
+    }
+    m_state.innermost = this;
+    ++m_state.depth;
+    m_event.start_ns = now_ns();
+  }
+
+  ~scope()
+  {
+    if (m_merged)
+    {
+      return;
+    }
+    m_event.duration_ns = now_ns() - m_event.start_ns;
+    --m_state.depth;
+    m_state.innermost = m_outer;
+    m_state.buffer->push(m_event);
+  }
+
+  scope(const scope&)            = delete;
+  scope& operator=(const scope&) = delete;
+
+  static void add_temporary_bytes(::cuda::std::uint64_t bytes)
+  {
+    if (scope* s = local_state().innermost)
+    {
+      s->m_event.temporary_bytes += bytes;
+    }
+  }
+
+  static void mark_sequential_fallback()
+  {
+    if (scope* s = local_state().innermost)
+    {
+      s->m_event.sequential_fallback = true;
+    }
+  }
+
+private:
+  thread_state& m_state;
+  scope* m_outer;
+  bool m_merged;
+  bool m_forwarding;
+  event m_event;
+};
+
+inline void write_json_string(std::ostream& os, const char* str)
+{
+  os << '"';
+  for (; *str; ++str)
+  {
+    if (*str == '"' || *str == '\\')
+    {
+      os << '\\';
+    }
+    os << *str;
+  }
+  os << '"';
+}
+
+} // namespace detail
+
+/*! Returns all retained events of all threads, ordered by start time.
+ */
+inline std::vector<event> events()
+{
+  std::vector<event> result;
+  for (const auto& buffer : detail::registry::get().buffers())
+  {
+    buffer->append_to(result);
+  }
+  std::stable_sort(result.begin(), result.end(), [](const event& lhs, const event& rhs) {
+    return lhs.start_ns < rhs.start_ns;
+  });
+  return result;
+}
+
+/*! Discards all retained events of all threads.
+ */
+inline void clear()
+{
+  for (const auto& buffer : detail::registry::get().buffers())
+  {
+    buffer->clear();
+  }
+}
+
+/*! Aggregates all retained events by algorithm name and system, sorted by descending total time.
+ */
+inline std::vector<counter> summary()
+{
+  std::map<std::pair<std::string, std::string>, counter> counters;
+  for (const event& e : events())
+  {
+    counter& c = counters.try_emplace({e.name, e.system}, counter{e.name, e.system, 0, 0, 0, 0, 0}).first->second;
+    c.calls++;
+    c.sequential_fallbacks += e.sequential_fallback ? 1 : 0;
+    c.elements += e.elements > 0 ? static_cast<::cuda::std::uint64_t>(e.elements) : 0;
+    c.total_ns += e.duration_ns;
+    c.temporary_bytes += e.temporary_bytes;
+  }
+
+  std::vector<counter> result;
+  for (const auto& c : counters)
+  {
+    result.push_back(c.second);
+  }
+  std::stable_sort(result.begin(), result.end(), [](const counter& lhs, const counter& rhs) {
+    return lhs.total_ns > rhs.total_ns;
+  });
+  return result;
+}
+
+/*! Writes all retained events in the Chrome trace event format, which can be loaded into \c chrome://tracing or
+ *  Perfetto.
+ *
+ *  \param os The stream to write to.
+ */
+inline void write_chrome_trace(std::ostream& os)
+{
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  for (const event& e : events())
+  {
+    os << (first ? "\n" : ",\n") << "{\"name\":";
+    detail::write_json_string(os, e.name);
+    os << ",\"cat\":";
+    detail::write_json_string(os, e.system);
+    os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread << ",\"ts\":" << static_cast<double>(e.start_ns) / 1000.0
+       << ",\"dur\":" << static_cast<double>(e.duration_ns) / 1000.0 << ",\"args\":{\"elements\":" << e.elements
+       << ",\"temporary_bytes\":" << e.temporary_bytes << ",\"depth\":" << e.depth
+       << ",\"sequential_fallback\":" << (e.sequential_fallback ? "true" : "false") << "}}";
+    first = false;
+  }
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+/*! Writes the output of \p summary as a table.
+ *
+ *  \param os The stream to write to.
+ */
+inline void write_summary(std::ostream& os)
+{
+  os << "| Algorithm | System | Calls | Sequential | Elements | Time [us] | Temporary bytes |\n"
+     << "|---|---|---|---|---|---|---|\n";
+  for (const counter& c : summary())
+  {
+    os << "| " << c.name << " | " << c.system << " | " << c.calls << " | " << c.sequential_fallbacks << " | "
+       << c.elements << " | " << static_cast<double>(c.total_ns) / 1000.0 << " | " << c.temporary_bytes << " |\n";
+  }
+}
+
+/*! \} // tracing
+ */
+
+} // namespace tracing
+THRUST_NAMESPACE_END
@@ -31,6 +31,7 @@
 #endif // no system header
 
 #include <thrust/detail/execution_policy.h>
+#include <thrust/detail/tracing.h>
 
 #include <cuda/std/iterator>
 
@@ -738,6 +739,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   UnaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_TRACE_FORWARDING_SCOPE_N("thrust::transform_n", exec, count);
   return thrust::transform(exec, first, first + count, result, op);
 }
 
@@ -766,6 +768,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   BinaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_TRACE_FORWARDING_SCOPE_N("thrust::transform_n", exec, count);
   return thrust::transform(exec, first1, first1 + count, first2, result, op);
 }
 
@@ -798,7 +801,8 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
-  return thrust::transform(exec, first, first + count, result, op, pred);
+  _THRUST_TRACE_FORWARDING_SCOPE_N("thrust::transform_if_n", exec, count);
+  return thrust::transform_if(exec, first, first + count, result, op, pred);
 }
 
 //! Like \ref transform_if, but uses an element count instead of an iterator to the last element of the input sequence.
@@ -832,6 +836,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_TRACE_FORWARDING_SCOPE_N("thrust::transform_if_n", exec, count);
   return thrust::transform_if(exec, first, first + count, stencil, result, op, pred);
 }
 
@@ -872,6 +877,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_TRACE_FORWARDING_SCOPE_N("thrust::transform_if_n", exec, count);
   return thrust::transform_if(exec, first1, first1 + count, first2, stencil, result, binary_op, pred);
 }
 